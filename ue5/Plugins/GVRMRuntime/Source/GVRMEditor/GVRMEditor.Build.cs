@@ -0,0 +1,37 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+using UnrealBuildTool;
+
+public class GVRMEditor : ModuleRules
+{
+	public GVRMEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"GVRMRuntime",
+			}
+		);
+
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"AnimGraph",
+				"BlueprintGraph",
+				"GVRMShaders",
+				"Json",
+				"Projects",
+				"RenderCore",
+				"RHI",
+				"UnrealEd",
+			}
+		);
+	}
+}
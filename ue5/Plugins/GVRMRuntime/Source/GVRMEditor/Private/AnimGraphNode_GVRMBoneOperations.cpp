@@ -0,0 +1,51 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "AnimGraphNode_GVRMBoneOperations.h"
+#include "GVRMSkinningData.h"
+#include "Animation/Skeleton.h"
+#include "Kismet2/CompilerResultsLog.h"
+
+#define LOCTEXT_NAMESPACE "AnimGraphNode_GVRMBoneOperations"
+
+FText UAnimGraphNode_GVRMBoneOperations::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("GVRMBoneOperationsTitle", "GVRM Bone Operations");
+}
+
+FText UAnimGraphNode_GVRMBoneOperations::GetTooltipText() const
+{
+	return LOCTEXT("GVRMBoneOperationsTooltip", "Applies the bone operations of GVRM binding data to the local-space pose. Bones are resolved once per LOD.");
+}
+
+FLinearColor UAnimGraphNode_GVRMBoneOperations::GetNodeTitleColor() const
+{
+	return FLinearColor(0.2f, 0.6f, 0.4f);
+}
+
+FString UAnimGraphNode_GVRMBoneOperations::GetNodeCategory() const
+{
+	return TEXT("GVRM");
+}
+
+void UAnimGraphNode_GVRMBoneOperations::ValidateAnimNodeDuringCompilation(USkeleton* ForSkeleton, FCompilerResultsLog& MessageLog)
+{
+	Super::ValidateAnimNodeDuringCompilation(ForSkeleton, MessageLog);
+
+	// Bound through a pin, the binding data is only known at runtime
+	if (!Node.BindingData || !ForSkeleton)
+	{
+		return;
+	}
+
+	for (const FGVRMBoneOperation& Operation : Node.BindingData->BoneOperations)
+	{
+		if (ForSkeleton->GetReferenceSkeleton().FindBoneIndex(FName(*Operation.BoneName)) == INDEX_NONE)
+		{
+			MessageLog.Warning(*FString::Printf(TEXT("@@ - bone %s of %s is not in skeleton %s"),
+				*Operation.BoneName, *Node.BindingData->GetName(), *ForSkeleton->GetName()), this);
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,31 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimGraphNode_Base.h"
+#include "AnimNode_GVRMBoneOperations.h"
+#include "AnimGraphNode_GVRMBoneOperations.generated.h"
+
+/**
+ * Animation blueprint node for FAnimNode_GVRMBoneOperations.
+ */
+UCLASS()
+class UAnimGraphNode_GVRMBoneOperations : public UAnimGraphNode_Base
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FAnimNode_GVRMBoneOperations Node;
+
+	// UEdGraphNode interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual FLinearColor GetNodeTitleColor() const override;
+
+	// UAnimGraphNode_Base interface
+	virtual FString GetNodeCategory() const override;
+	virtual void ValidateAnimNodeDuringCompilation(USkeleton* ForSkeleton, FCompilerResultsLog& MessageLog) override;
+};
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMBakeCacheCommandlet.h"
+#include "GVRMAnimationCache.h"
+#include "GVRMSkinningData.h"
+#include "Animation/AnimSequence.h"
+#include "Engine/SkeletalMesh.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UGVRMBakeCacheCommandlet::UGVRMBakeCacheCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGVRMBakeCacheCommandlet::Main(const FString& Params)
+{
+	FString AnimationPath;
+	FString BindingDataPath;
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Animation="), AnimationPath) || !FParse::Value(*Params, TEXT("BindingData="), BindingDataPath)
+		|| !FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBakeCache - -Animation=, -BindingData= and -Output=/Game/Path/Asset are required"));
+		return 1;
+	}
+	OutputPath = FPackageName::ObjectPathToPackageName(OutputPath);
+
+	UAnimSequence* Animation = LoadObject<UAnimSequence>(nullptr, *AnimationPath);
+	if (!Animation)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBakeCache - Failed to load animation %s"), *AnimationPath);
+		return 1;
+	}
+
+	UGVRMBindingData* BindingData = LoadObject<UGVRMBindingData>(nullptr, *BindingDataPath);
+	if (!BindingData)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBakeCache - Failed to load binding data %s"), *BindingDataPath);
+		return 1;
+	}
+	BindingData->LoadSplatStreams();
+
+	USkeletalMesh* SkeletalMesh = nullptr;
+	FString SkeletalMeshPath;
+	if (FParse::Value(*Params, TEXT("SkeletalMesh="), SkeletalMeshPath))
+	{
+		SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, *SkeletalMeshPath);
+	}
+	else
+	{
+		SkeletalMeshPath = BindingData->SourceSkeletalMesh.ToString();
+		SkeletalMesh = BindingData->SourceSkeletalMesh.LoadSynchronous();
+	}
+	if (!SkeletalMesh)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBakeCache - Failed to load skeletal mesh '%s' (pass -SkeletalMesh or set the binding data's SourceSkeletalMesh)"), *SkeletalMeshPath);
+		return 1;
+	}
+
+	float SampleRate = 30.0f;
+	FParse::Value(*Params, TEXT("SampleRate="), SampleRate);
+
+	// Re-bake an existing cache in place so references to it stay valid
+	const FName AssetName(*FPackageName::GetShortName(OutputPath));
+	UPackage* Package = CreatePackage(*OutputPath);
+	Package->FullyLoad();
+	UGVRMAnimationCache* Cache = FindObject<UGVRMAnimationCache>(Package, *AssetName.ToString());
+	if (!Cache)
+	{
+		Cache = NewObject<UGVRMAnimationCache>(Package, AssetName, RF_Public | RF_Standalone);
+	}
+	Cache->bLooping = !FParse::Param(*Params, TEXT("NoLoop"));
+
+	FString Message;
+	if (!Cache->BakeFromAnimation(Animation, SkeletalMesh, BindingData, SampleRate, Message))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBakeCache - %s: %s"), *AnimationPath, *Message);
+		return 1;
+	}
+
+	// EncodeFrames logged the size and error report
+	UE_LOG(LogTemp, Display, TEXT("GVRMBakeCache - Baked %s: %d frames x %d splats at %.1f fps"),
+		*Animation->GetName(), Cache->NumFrames, Cache->NumSplats, Cache->SampleRate);
+
+	Package->MarkPackageDirty();
+	const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	if (!UPackage::SavePackage(Package, Cache, *Filename, SaveArgs))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBakeCache - Failed to save %s"), *Filename);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("GVRMBakeCache - Saved %s"), *Filename);
+
+	return 0;
+}
@@ -0,0 +1,1078 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMBenchmarkCommandlet.h"
+#include "GVRMSyntheticAvatar.h"
+#include "GVRMGoldenSuite.h"
+#include "GVRMGPUBenchmark.h"
+#include "GVRMSkinningData.h"
+#include "GVRMSkinningMath.h"
+#include "GVRMSpringBoneSolver.h"
+#include "NiagaraDataInterfaceGVRM.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Math/RandomStream.h"
+#include "Tasks/Task.h"
+#include "Engine/World.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectReader.h"
+#include "Serialization/ObjectWriter.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace GVRMBenchmark
+{
+	/** Timings of one stage at one avatar size */
+	struct FStageResult
+	{
+		FString Stage;
+		int32 NumSplats = 0;
+		int32 Iterations = 0;
+		double MinMs = 0.0;
+		double P50Ms = 0.0;
+		double P90Ms = 0.0;
+		double P99Ms = 0.0;
+		double MaxMs = 0.0;
+		double MeanMs = 0.0;
+
+		/** Splats processed per second at the median */
+		double MSplatsPerSecond() const
+		{
+			return P50Ms > 0.0 ? NumSplats / (P50Ms * 1000.0) : 0.0;
+		}
+	};
+
+	/** Linear interpolation between the closest ranks */
+	double Percentile(const TArray<double>& SortedSamples, double Fraction)
+	{
+		if (SortedSamples.Num() == 0)
+		{
+			return 0.0;
+		}
+		const double Rank = Fraction * (SortedSamples.Num() - 1);
+		const int32 Lower = FMath::FloorToInt(Rank);
+		const int32 Upper = FMath::Min(Lower + 1, SortedSamples.Num() - 1);
+		return FMath::Lerp(SortedSamples[Lower], SortedSamples[Upper], Rank - Lower);
+	}
+
+	/** Percentiles of the timed samples of one stage (sorted in place), logged */
+	FStageResult Summarize(const TCHAR* Stage, int32 NumSplats, TArray<double>& Samples)
+	{
+		Samples.Sort();
+
+		FStageResult Result;
+		Result.Stage = Stage;
+		Result.NumSplats = NumSplats;
+		Result.Iterations = Samples.Num();
+		if (Samples.Num() > 0)
+		{
+			double Sum = 0.0;
+			for (double Sample : Samples)
+			{
+				Sum += Sample;
+			}
+			Result.MinMs = Samples[0];
+			Result.P50Ms = Percentile(Samples, 0.5);
+			Result.P90Ms = Percentile(Samples, 0.9);
+			Result.P99Ms = Percentile(Samples, 0.99);
+			Result.MaxMs = Samples.Last();
+			Result.MeanMs = Sum / Samples.Num();
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("GVRMBenchmark - %-26s %8d splats  p50 %10.3f ms  p90 %10.3f ms  p99 %10.3f ms  (%.2f Msplats/s)"),
+			Stage, NumSplats, Result.P50Ms, Result.P90Ms, Result.P99Ms, Result.MSplatsPerSecond());
+		return Result;
+	}
+
+	/**
+	 * Run Setup (untimed) then Body (timed) Warmup + Iterations times.
+	 * Only the timed iterations are kept.
+	 */
+	FStageResult Measure(const TCHAR* Stage, int32 NumSplats, int32 Warmup, int32 Iterations,
+		TFunctionRef<void(int32 Iteration)> Setup, TFunctionRef<void(int32 Iteration)> Body)
+	{
+		TArray<double> Samples;
+		Samples.Reserve(Iterations);
+
+		for (int32 Iteration = -Warmup; Iteration < Iterations; ++Iteration)
+		{
+			Setup(Iteration);
+
+			const double StartTime = FPlatformTime::Seconds();
+			Body(Iteration);
+			const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			if (Iteration >= 0)
+			{
+				Samples.Add(ElapsedMs);
+			}
+		}
+
+		return Summarize(Stage, NumSplats, Samples);
+	}
+
+	void NoSetup(int32)
+	{
+	}
+
+	FString MakeResultKey(const FString& Stage, int32 NumSplats)
+	{
+		return FString::Printf(TEXT("%s@%d"), *Stage, NumSplats);
+	}
+
+	bool WriteJSON(const FString& FilePath, const TArray<FStageResult>& Results, int32 Seed)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+		Root->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+		Root->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand());
+		Root->SetNumberField(TEXT("Cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		Root->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+		Root->SetNumberField(TEXT("Seed"), Seed);
+
+		TArray<TSharedPtr<FJsonValue>> ResultValues;
+		for (const FStageResult& Result : Results)
+		{
+			TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+			ResultObject->SetStringField(TEXT("Stage"), Result.Stage);
+			ResultObject->SetNumberField(TEXT("Splats"), Result.NumSplats);
+			ResultObject->SetNumberField(TEXT("Iterations"), Result.Iterations);
+			ResultObject->SetNumberField(TEXT("MinMs"), Result.MinMs);
+			ResultObject->SetNumberField(TEXT("P50Ms"), Result.P50Ms);
+			ResultObject->SetNumberField(TEXT("P90Ms"), Result.P90Ms);
+			ResultObject->SetNumberField(TEXT("P99Ms"), Result.P99Ms);
+			ResultObject->SetNumberField(TEXT("MaxMs"), Result.MaxMs);
+			ResultObject->SetNumberField(TEXT("MeanMs"), Result.MeanMs);
+			ResultObject->SetNumberField(TEXT("MSplatsPerSecond"), Result.MSplatsPerSecond());
+			ResultValues.Add(MakeShared<FJsonValueObject>(ResultObject));
+		}
+		Root->SetArrayField(TEXT("Results"), ResultValues);
+
+		FString Contents;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Contents);
+		FJsonSerializer::Serialize(Root, Writer);
+		return FFileHelper::SaveStringToFile(Contents, *FilePath);
+	}
+
+	bool WriteCSV(const FString& FilePath, const TArray<FStageResult>& Results)
+	{
+		FString Contents = TEXT("Stage,Splats,Iterations,MinMs,P50Ms,P90Ms,P99Ms,MaxMs,MeanMs,MSplatsPerSecond\n");
+		for (const FStageResult& Result : Results)
+		{
+			Contents += FString::Printf(TEXT("%s,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n"),
+				*Result.Stage, Result.NumSplats, Result.Iterations, Result.MinMs, Result.P50Ms, Result.P90Ms,
+				Result.P99Ms, Result.MaxMs, Result.MeanMs, Result.MSplatsPerSecond());
+		}
+		return FFileHelper::SaveStringToFile(Contents, *FilePath);
+	}
+
+	/** Read stage medians from a previous run's JSON */
+	bool ReadBaseline(const FString& FilePath, TMap<FString, double>& OutMedians)
+	{
+		FString Contents;
+		if (!FFileHelper::LoadFileToString(Contents, *FilePath))
+		{
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Contents);
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+		{
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ResultValues = nullptr;
+		if (!Root->TryGetArrayField(TEXT("Results"), ResultValues))
+		{
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : *ResultValues)
+		{
+			const TSharedPtr<FJsonObject>* ResultObject = nullptr;
+			if (Value->TryGetObject(ResultObject))
+			{
+				const FString Stage = (*ResultObject)->GetStringField(TEXT("Stage"));
+				const int32 NumSplats = static_cast<int32>((*ResultObject)->GetNumberField(TEXT("Splats")));
+				OutMedians.Add(MakeResultKey(Stage, NumSplats), (*ResultObject)->GetNumberField(TEXT("P50Ms")));
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Time the splat component's GPU passes on a synthetic avatar (skipped under
+	 * -nullrhi). Samples are GPU time from timestamp queries, one pose per run.
+	 */
+	void RunGPUStages(const FGVRMSyntheticAvatar& Avatar, const FGVRMSplatGPUData& GPUData, int32 Warmup, int32 Iterations, TArray<FStageResult>& OutResults)
+	{
+		if (!FGVRMGPUBenchmark::IsSupported())
+		{
+			UE_LOG(LogTemp, Display, TEXT("GVRMBenchmark - GPU stages skipped (need an SM5 RHI with timestamp queries, run without -nullrhi)"));
+			return;
+		}
+
+		FGVRMGPUBenchmark Benchmark;
+		Benchmark.Initialize(Avatar, GPUData);
+		for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EGVRMGPUStage::Num); ++StageIndex)
+		{
+			const EGVRMGPUStage Stage = static_cast<EGVRMGPUStage>(StageIndex);
+			TArray<double> Samples;
+			FString ErrorMessage;
+			if (!Benchmark.Run(Stage, Warmup, Iterations, Samples, ErrorMessage))
+			{
+				UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - %s failed: %s"), FGVRMGPUBenchmark::GetStageName(Stage), *ErrorMessage);
+				continue;
+			}
+			OutResults.Add(Summarize(FGVRMGPUBenchmark::GetStageName(Stage), Benchmark.GetNumSplats(), Samples));
+		}
+	}
+
+	/** Benchmark the import, load, validation and CPU skinning stages on one synthetic avatar */
+	void RunSyntheticStages(int32 NumSplats, int32 Seed, int32 Warmup, int32 Iterations, const FString& ScratchDir, TArray<FStageResult>& OutResults)
+	{
+		FGVRMSyntheticAvatar Avatar;
+		Avatar.Generate(NumSplats, Seed);
+
+		const FString CSVPath = FPaths::Combine(ScratchDir, FString::Printf(TEXT("Synthetic_%d.csv"), NumSplats));
+		const FString PLYPath = FPaths::Combine(ScratchDir, FString::Printf(TEXT("Synthetic_%d.ply"), NumSplats));
+		if (!Avatar.WriteCSV(CSVPath) || !Avatar.WritePLY(PLYPath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Failed to write synthetic files to %s"), *ScratchDir);
+			return;
+		}
+
+		UGVRMBindingData* BindingData = nullptr;
+		FString ErrorMessage;
+
+		OutResults.Add(Measure(TEXT("ImportFromCSV"), NumSplats, Warmup, Iterations,
+			[&](int32) { BindingData = NewObject<UGVRMBindingData>(GetTransientPackage()); },
+			[&](int32)
+			{
+				if (!BindingData->ImportFromCSV(CSVPath, ErrorMessage))
+				{
+					UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - ImportFromCSV failed: %s"), *ErrorMessage);
+				}
+			}));
+
+		OutResults.Add(Measure(TEXT("ImportGaussiansFromPLY"), NumSplats, Warmup, Iterations,
+			[&](int32) { BindingData->Gaussians.Empty(); },
+			[&](int32)
+			{
+				if (!BindingData->ImportGaussiansFromPLY(PLYPath, ErrorMessage))
+				{
+					UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - ImportGaussiansFromPLY failed: %s"), *ErrorMessage);
+				}
+			}));
+
+		// Saved form of the fully imported asset, as in a package (splat chunks, payload inline)
+		Avatar.FillBindingData(BindingData);
+		TArray<uint8> SavedBytes;
+		FMemoryWriter Writer(SavedBytes, /*bIsPersistent*/ true);
+		BindingData->Serialize(Writer);
+
+		// Saving again after a change rebuilds the chunks; saving an unchanged asset only hashes the splats
+		// and writes the chunks already built
+		TArray<uint8> ResavedBytes;
+		FMemoryWriter ResaveWriter(ResavedBytes, /*bIsPersistent*/ true);
+		auto Resave = [&](int32)
+		{
+			ResaveWriter.Seek(0);
+			BindingData->Serialize(ResaveWriter);
+		};
+		OutResults.Add(Measure(TEXT("BinarySave"), NumSplats, Warmup, Iterations,
+			[&](int32 Iteration) { BindingData->Bindings[0].RelativePosition.X += Iteration % 2 ? -1.0 : 1.0; }, Resave));
+		OutResults.Add(Measure(TEXT("BinarySaveUnchanged"), NumSplats, Warmup, Iterations, NoSetup, Resave));
+
+		UGVRMBindingData* ResavedBindingData = NewObject<UGVRMBindingData>(GetTransientPackage());
+		FMemoryReader ResaveReader(ResavedBytes, /*bIsPersistent*/ true);
+		ResaveReader.SetCustomVersions(ResaveWriter.GetCustomVersions());
+		ResavedBindingData->Serialize(ResaveReader);
+		if (ResavedBindingData->GetSplatCount() != NumSplats || ResavedBindingData->Gaussians.Num() != NumSplats)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - BinarySaveUnchanged wrote %d splats and %d Gaussians, expected %d"),
+				ResavedBindingData->GetSplatCount(), ResavedBindingData->Gaussians.Num(), NumSplats);
+		}
+
+		UGVRMBindingData* LoadedBindingData = nullptr;
+		OutResults.Add(Measure(TEXT("BinaryLoad"), NumSplats, Warmup, Iterations,
+			[&](int32) { LoadedBindingData = NewObject<UGVRMBindingData>(GetTransientPackage()); },
+			[&](int32)
+			{
+				FMemoryReader Reader(SavedBytes, /*bIsPersistent*/ true);
+				Reader.SetCustomVersions(Writer.GetCustomVersions());
+				LoadedBindingData->Serialize(Reader);
+			}));
+
+		if (LoadedBindingData->GetSplatCount() != NumSplats || LoadedBindingData->Gaussians.Num() != NumSplats)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - BinaryLoad read %d splats and %d Gaussians, expected %d"),
+				LoadedBindingData->GetSplatCount(), LoadedBindingData->Gaussians.Num(), NumSplats);
+		}
+
+		// Same asset through tagged properties only (undo/duplication path, and packages saved before the chunks)
+		TArray<uint8> TaggedBytes;
+		FObjectWriter TaggedWriter(BindingData, TaggedBytes);
+		OutResults.Add(Measure(TEXT("BinaryLoadTagged"), NumSplats, Warmup, Iterations,
+			[&](int32) { LoadedBindingData = NewObject<UGVRMBindingData>(GetTransientPackage()); },
+			[&](int32) { FObjectReader Reader(LoadedBindingData, TaggedBytes); }));
+
+		OutResults.Add(Measure(TEXT("ValidateBindings"), NumSplats, Warmup, Iterations, NoSetup,
+			[&](int32)
+			{
+				if (!BindingData->ValidateBindings(ErrorMessage))
+				{
+					UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - ValidateBindings failed: %s"), *ErrorMessage);
+				}
+			}));
+
+		FGVRMSplatGPUData GPUData;
+		OutResults.Add(Measure(TEXT("InitializeFromBindingData"), NumSplats, Warmup, Iterations,
+			[&](int32) { GPUData = FGVRMSplatGPUData(); },
+			[&](int32) { GPUData.InitializeFromBindingData(BindingData); }));
+
+		// Scripted pose: a new frame of the sway animation every iteration
+		TArray<FMatrix44f> BoneMatrices;
+		TArray<FVector3f> SkinnedPositions;
+		TArray<FVector4f> SkinnedRotations;
+		SkinnedPositions.SetNumUninitialized(NumSplats);
+		SkinnedRotations.SetNumUninitialized(NumSplats);
+
+		OutResults.Add(Measure(TEXT("CPUSkinning"), NumSplats, Warmup, Iterations,
+			[&](int32 Iteration) { Avatar.EvaluatePose(Iteration / 30.0f, BoneMatrices); },
+			[&](int32)
+			{
+				const GVRMSkinning::FSkinningStreams Streams = Avatar.MakeStreams(BoneMatrices);
+				GVRMSkinning::DispatchInfluences(Streams.NumInfluences, [&](auto NumInfluences)
+				{
+					for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+					{
+						GVRMSkinning::SkinSplat<decltype(NumInfluences)::Value>(Streams, GPUData.SplatVertexIndices[SplatIndex], GPUData.SplatRelativePositions[SplatIndex],
+							SkinnedPositions[SplatIndex], SkinnedRotations[SplatIndex]);
+					}
+				});
+			}));
+
+		// VectorRegister path on the same poses: bone rotations once per pose, then SkinSplatVectorized
+		{
+			TArray<FVector4f> BoneRotations;
+			TArray<FVector3f> SIMDPositions;
+			TArray<FVector4f> SIMDRotations;
+			SIMDPositions.SetNumUninitialized(NumSplats);
+			SIMDRotations.SetNumUninitialized(NumSplats);
+
+			OutResults.Add(Measure(TEXT("CPUSkinningSIMD"), NumSplats, Warmup, Iterations,
+				[&](int32 Iteration) { Avatar.EvaluatePose(Iteration / 30.0f, BoneMatrices); },
+				[&](int32)
+				{
+					const GVRMSkinning::FSkinningStreams Streams = Avatar.MakeStreams(BoneMatrices);
+					GVRMSkinning::ComputeBoneRotations(Streams.BoneMatrices, BoneRotations);
+					GVRMSkinning::DispatchInfluences(Streams.NumInfluences, [&](auto NumInfluences)
+					{
+						for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+						{
+							GVRMSkinning::SkinSplatVectorized<decltype(NumInfluences)::Value>(Streams, BoneRotations, GPUData.SplatVertexIndices[SplatIndex],
+								GPUData.SplatRelativePositions[SplatIndex], SIMDPositions[SplatIndex], SIMDRotations[SplatIndex]);
+						}
+					});
+				}));
+
+			// CPUSkinning on the last timed pose; the rotation blend order differs, so allow float noise
+			const GVRMSkinning::FSkinningStreams Streams = Avatar.MakeStreams(BoneMatrices);
+			float MaxPositionDeviation = 0.0f;
+			float MaxRotationDeviation = 0.0f;
+			for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+			{
+				FVector3f ScalarPosition;
+				FVector4f ScalarRotation;
+				GVRMSkinning::SkinSplat(Streams, GPUData.SplatVertexIndices[SplatIndex], GPUData.SplatRelativePositions[SplatIndex],
+					ScalarPosition, ScalarRotation);
+				MaxPositionDeviation = FMath::Max(MaxPositionDeviation, FVector3f::Distance(ScalarPosition, SIMDPositions[SplatIndex]));
+				const FVector4f& SIMDRotation = SIMDRotations[SplatIndex];
+				const float Dot = ScalarRotation.X * SIMDRotation.X + ScalarRotation.Y * SIMDRotation.Y + ScalarRotation.Z * SIMDRotation.Z + ScalarRotation.W * SIMDRotation.W;
+				MaxRotationDeviation = FMath::Max(MaxRotationDeviation, 1.0f - FMath::Abs(Dot));
+			}
+			if (MaxPositionDeviation > 1e-3f || MaxRotationDeviation > 1e-6f)
+			{
+				UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - CPUSkinningSIMD deviates from CPUSkinning by %.6f cm, %.8f in 1 - |dot|"),
+					MaxPositionDeviation, MaxRotationDeviation);
+			}
+		}
+
+		// Two-pass LBS: each bound vertex skinned once, then every splat applies its offset
+		{
+			const int32 NumUniqueVertices = GPUData.UniqueVertexIndices.Num();
+			UE_LOG(LogTemp, Display, TEXT("GVRMBenchmark - %d bound vertices for %d splats (%.2f splats per vertex)"),
+				NumUniqueVertices, NumSplats, GPUData.GetSplatsPerUniqueVertex());
+
+			TArray<FVector3f> VertexPositions;
+			TArray<FVector4f> VertexRotations;
+			TArray<FVector3f> TwoPassPositions;
+			VertexPositions.SetNumUninitialized(NumUniqueVertices);
+			VertexRotations.SetNumUninitialized(NumUniqueVertices);
+			TwoPassPositions.SetNumUninitialized(NumSplats);
+
+			OutResults.Add(Measure(TEXT("CPUSkinningTwoPass"), NumSplats, Warmup, Iterations,
+				[&](int32 Iteration) { Avatar.EvaluatePose(Iteration / 30.0f, BoneMatrices); },
+				[&](int32)
+				{
+					const GVRMSkinning::FSkinningStreams Streams = Avatar.MakeStreams(BoneMatrices);
+					for (int32 UniqueIndex = 0; UniqueIndex < NumUniqueVertices; ++UniqueIndex)
+					{
+						GVRMSkinning::SkinBoundVertex(Streams, GPUData.UniqueVertexIndices[UniqueIndex],
+							VertexPositions[UniqueIndex], VertexRotations[UniqueIndex]);
+					}
+					for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+					{
+						const int32 UniqueIndex = GPUData.SplatUniqueVertices[SplatIndex];
+						TwoPassPositions[SplatIndex] = GVRMSkinning::SkinSplatFromVertex(VertexPositions[UniqueIndex], VertexRotations[UniqueIndex],
+							GPUData.SplatRelativePositions[SplatIndex]);
+					}
+				}));
+
+			// Single pass on the last timed pose; only float reassociation may differ
+			const GVRMSkinning::FSkinningStreams Streams = Avatar.MakeStreams(BoneMatrices);
+			float MaxDeviation = 0.0f;
+			for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+			{
+				FVector3f OnePassPosition;
+				FVector4f OnePassRotation;
+				GVRMSkinning::SkinSplat(Streams, GPUData.SplatVertexIndices[SplatIndex], GPUData.SplatRelativePositions[SplatIndex],
+					OnePassPosition, OnePassRotation);
+				MaxDeviation = FMath::Max(MaxDeviation, FVector3f::Distance(OnePassPosition, TwoPassPositions[SplatIndex]));
+			}
+			if (MaxDeviation > 1e-3f)
+			{
+				UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - CPUSkinningTwoPass deviates from CPUSkinning by %.6f cm"), MaxDeviation);
+			}
+		}
+
+		// Rigid-bone modes: one (or two) bone matrices per splat, walked in bone order
+		if (!BindingData->BuildRigidBindings(Avatar.VertexPositions, Avatar.BoneIndices, Avatar.BoneWeights, ErrorMessage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - BuildRigidBindings failed: %s"), *ErrorMessage);
+		}
+		else
+		{
+			TArray<FVector4f> BoneRotations;
+			for (const bool bBlended : { false, true })
+			{
+				OutResults.Add(Measure(bBlended ? TEXT("RigidSkinningBlended") : TEXT("RigidSkinning"), NumSplats, Warmup, Iterations,
+					[&](int32 Iteration) { Avatar.EvaluatePose(Iteration / 30.0f, BoneMatrices); },
+					[&](int32)
+					{
+						GVRMSkinning::ComputeBoneRotations(BoneMatrices, BoneRotations);
+						for (const int32 SplatIndex : BindingData->RigidSplatOrder)
+						{
+							const FGVRMRigidSplatBinding& Rigid = BindingData->RigidBindings[SplatIndex];
+							GVRMSkinning::SkinRigidSplat(BoneMatrices, BoneRotations, Rigid.HostPosition, Rigid.PrimaryBone, Rigid.SecondaryBone,
+								bBlended ? Rigid.SecondaryWeight : 0.0f, GPUData.SplatRelativePositions[SplatIndex],
+								SkinnedPositions[SplatIndex], SkinnedRotations[SplatIndex]);
+						}
+					}));
+			}
+		}
+
+		RunGPUStages(Avatar, GPUData, Warmup, Iterations, OutResults);
+
+		IFileManager::Get().Delete(*CSVPath);
+		IFileManager::Get().Delete(*PLYPath);
+	}
+
+	/**
+	 * Benchmark the Niagara cache kernels at VRM sizes without content: the
+	 * bone palette of a 150-bone skeleton and the vertex/skin weight streams of
+	 * a 500k-vertex LOD. Both must match the per-element accessor loops bit for bit.
+	 */
+	void RunCacheKernelStages(int32 Seed, int32 Warmup, int32 Iterations, TArray<FStageResult>& OutResults)
+	{
+		constexpr int32 NumBones = 150;
+		constexpr int32 NumVertices = 500000;
+		FRandomStream Random(Seed);
+		FNiagaraDataInterfaceGVRMInstanceData Cache;
+
+		TArray<FTransform> Transforms;
+		Transforms.SetNum(NumBones);
+		for (FTransform& Transform : Transforms)
+		{
+			Transform = FTransform(FQuat(FVector(Random.GetUnitVector()), Random.FRandRange(-PI, PI)), Random.GetUnitVector() * Random.FRandRange(0.0f, 150.0f),
+				FVector(Random.FRandRange(0.5f, 2.0f), Random.FRandRange(0.5f, 2.0f), Random.FRandRange(0.5f, 2.0f)));
+		}
+
+		OutResults.Add(Measure(TEXT("CacheBoneMatrices"), NumBones, Warmup, Iterations, NoSetup,
+			[&](int32) { Cache.CacheBoneMatrices(Transforms); }));
+
+		int32 NumBoneMismatches = 0;
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const FMatrix44f Expected(Transforms[BoneIndex].ToMatrixWithScale());
+			NumBoneMismatches += FMemory::Memcmp(&Expected, &Cache.CachedBoneMatrices[BoneIndex], sizeof(FMatrix44f)) != 0 ? 1 : 0;
+		}
+
+		// 3x4 GPU palette: the shaders rebuild the float4x4, so the round trip must be exact
+		TArray<FGVRMBoneMatrix3x4> PackedPalette;
+		PackedPalette.SetNumUninitialized(NumBones);
+		OutResults.Add(Measure(TEXT("PackBonePalette"), NumBones, Warmup, Iterations, NoSetup,
+			[&](int32) { GVRMSkinning::PackBoneMatrices(Cache.CachedBoneMatrices, PackedPalette); }));
+
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const FMatrix44f Unpacked = GVRMSkinning::UnpackBoneMatrix(PackedPalette[BoneIndex]);
+			NumBoneMismatches += FMemory::Memcmp(&Unpacked, &Cache.CachedBoneMatrices[BoneIndex], sizeof(FMatrix44f)) != 0 ? 1 : 0;
+		}
+
+		// Palette stage of many avatars, inline one after the other vs. as UE::Tasks chains
+		// (run with -corelimit=N to measure the scaling)
+		{
+			constexpr int32 NumAvatars = 64;
+			TIndirectArray<FNiagaraDataInterfaceGVRMInstanceData> AvatarCaches;
+			TArray<TArray<FGVRMBoneMatrix3x4>> AvatarPalettes;
+			for (int32 AvatarIndex = 0; AvatarIndex < NumAvatars; ++AvatarIndex)
+			{
+				AvatarCaches.Add(new FNiagaraDataInterfaceGVRMInstanceData());
+			}
+			AvatarPalettes.SetNum(NumAvatars);
+
+			auto UpdateAvatar = [&](int32 AvatarIndex)
+			{
+				AvatarCaches[AvatarIndex].CacheBoneMatrices(Transforms);
+				AvatarPalettes[AvatarIndex].SetNumUninitialized(NumBones);
+				GVRMSkinning::PackBoneMatrices(AvatarCaches[AvatarIndex].CachedBoneMatrices, AvatarPalettes[AvatarIndex]);
+			};
+
+			OutResults.Add(Measure(TEXT("AvatarUpdateInline"), NumAvatars * NumBones, Warmup, Iterations, NoSetup,
+				[&](int32)
+				{
+					for (int32 AvatarIndex = 0; AvatarIndex < NumAvatars; ++AvatarIndex)
+					{
+						UpdateAvatar(AvatarIndex);
+					}
+				}));
+
+			OutResults.Add(Measure(TEXT("AvatarUpdateTasks"), NumAvatars * NumBones, Warmup, Iterations, NoSetup,
+				[&](int32)
+				{
+					TArray<UE::Tasks::FTask> Tasks;
+					Tasks.Reserve(NumAvatars);
+					for (int32 AvatarIndex = 0; AvatarIndex < NumAvatars; ++AvatarIndex)
+					{
+						Tasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&UpdateAvatar, AvatarIndex] { UpdateAvatar(AvatarIndex); }));
+					}
+					UE::Tasks::Wait(Tasks);
+				}));
+
+			for (int32 AvatarIndex = 0; AvatarIndex < NumAvatars; ++AvatarIndex)
+			{
+				NumBoneMismatches += FMemory::Memcmp(AvatarPalettes[AvatarIndex].GetData(), PackedPalette.GetData(), NumBones * sizeof(FGVRMBoneMatrix3x4)) != 0 ? 1 : 0;
+			}
+		}
+
+		// Synthetic LOD with CPU copies of every stream, as a cooked mesh keeps them for the Niagara cache
+		TArray<FVector3f> Positions;
+		TArray<FSkinWeightInfo> Weights;
+		Positions.SetNumUninitialized(NumVertices);
+		Weights.SetNumZeroed(NumVertices);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			Positions[VertexIndex] = FVector3f(Random.GetUnitVector() * Random.FRandRange(0.0f, 100.0f));
+
+			// Three influences summing to 65535, the fourth slot left empty
+			FSkinWeightInfo& Info = Weights[VertexIndex];
+			const int32 First = Random.RandRange(32768, 65535);
+			const int32 Second = Random.RandRange(0, 65535 - First);
+			for (int32 Influence = 0; Influence < 3; ++Influence)
+			{
+				Info.InfluenceBones[Influence] = static_cast<FBoneIndexType>(Random.RandRange(0, NumBones - 1));
+			}
+			Info.InfluenceWeights[0] = static_cast<uint16>(First);
+			Info.InfluenceWeights[1] = static_cast<uint16>(Second);
+			Info.InfluenceWeights[2] = static_cast<uint16>(65535 - First - Second);
+		}
+
+		FSkeletalMeshLODRenderData LODData;
+		LODData.StaticVertexBuffers.PositionVertexBuffer.Init(Positions, /*bInNeedsCPUAccess*/ true);
+		LODData.StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumVertices, 1, /*bInNeedsCPUAccess*/ true);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			const FVector3f Normal(Random.GetUnitVector());
+			const FVector3f Tangent = FVector3f(Random.GetUnitVector()).Cross(Normal).GetSafeNormal();
+			LODData.StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, Tangent, Normal.Cross(Tangent), Normal);
+		}
+		LODData.SkinWeightVertexBuffer.SetMaxBoneInfluences(4);
+		LODData.SkinWeightVertexBuffer.SetUse16BitBoneIndex(true);
+		LODData.SkinWeightVertexBuffer.SetNeedsCPUAccess(true);
+		LODData.SkinWeightVertexBuffer = Weights;
+
+		// Reference: the accessor loops the kernels replace (weights normalized like the cache stores them)
+		auto CountVertexMismatches = [&]()
+		{
+			const FSkinWeightVertexBuffer& SkinWeights = LODData.SkinWeightVertexBuffer;
+			int32 NumMismatches = Cache.NumVertices == NumVertices ? 0 : NumVertices;
+			for (int32 VertexIndex = 0; VertexIndex < NumVertices && NumMismatches == 0; ++VertexIndex)
+			{
+				const FVector3f Position = LODData.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex);
+				const FVector3f Normal(LODData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex));
+				FIntVector4 BoneIndices(0, 0, 0, 0);
+				FVector4f BoneWeights(1.0f, 0.0f, 0.0f, 0.0f);
+				for (int32 Influence = 0; Influence < 4; ++Influence)
+				{
+					BoneIndices[Influence] = SkinWeights.GetBoneIndex(VertexIndex, Influence);
+					BoneWeights[Influence] = SkinWeights.GetBoneWeight(VertexIndex, Influence) * GVRMSkinning::SkinWeightScale;
+				}
+
+				const bool bMatch = FMemory::Memcmp(&Position, &Cache.CachedVertexPositions[VertexIndex], sizeof(FVector3f)) == 0
+					&& FMemory::Memcmp(&Normal, &Cache.CachedVertexNormals[VertexIndex], sizeof(FVector3f)) == 0
+					&& BoneIndices == Cache.CachedBoneIndices[VertexIndex]
+					&& FMemory::Memcmp(&BoneWeights, &Cache.CachedBoneWeights[VertexIndex], sizeof(FVector4f)) == 0;
+				NumMismatches += bMatch ? 0 : 1;
+			}
+			return NumMismatches;
+		};
+
+		OutResults.Add(Measure(TEXT("CacheLODStreams"), NumVertices, Warmup, Iterations, NoSetup,
+			[&](int32) { Cache.CacheLODStreams(LODData, 4, nullptr, nullptr); }));
+		int32 NumVertexMismatches = CountVertexMismatches();
+
+		// Same weights with variable influence counts (lookup table): the empty fourth slot is dropped
+		LODData.SkinWeightVertexBuffer.SetVariableBonesPerVertex(true);
+		LODData.SkinWeightVertexBuffer = Weights;
+
+		OutResults.Add(Measure(TEXT("CacheLODStreamsVariable"), NumVertices, Warmup, Iterations, NoSetup,
+			[&](int32) { Cache.CacheLODStreams(LODData, 4, nullptr, nullptr); }));
+		NumVertexMismatches += CountVertexMismatches();
+
+		if (NumBoneMismatches > 0 || NumVertexMismatches > 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Cache kernels differ from the reference: %d bone matrices, %d vertices"),
+				NumBoneMismatches, NumVertexMismatches);
+		}
+	}
+
+	/**
+	 * Benchmark the per-frame morph target work of a face rig: 64 expressions
+	 * (VRM blend shapes) on a 10k-vertex face region, all weighted at once.
+	 * Times the active list build and the sparse fixed-point accumulation the
+	 * GPU pass mirrors, checked against a dense float reference.
+	 */
+	void RunMorphTargetStages(int32 Seed, int32 Warmup, int32 Iterations, TArray<FStageResult>& OutResults)
+	{
+		constexpr int32 NumMorphs = 64;
+		constexpr int32 NumFaceVertices = 10000;
+		constexpr int32 MaxDeltasPerMorph = 2000;
+		FRandomStream Random(Seed);
+
+		// Each expression moves a random subset of the face; every face vertex gets a slot
+		TArray<FVector4f> MorphDeltas;
+		TArray<FIntPoint> MorphRanges;
+		TArray<float> MorphWeights;
+		MorphRanges.SetNum(NumMorphs);
+		MorphWeights.SetNum(NumMorphs);
+		for (int32 MorphIndex = 0; MorphIndex < NumMorphs; ++MorphIndex)
+		{
+			const int32 NumDeltas = Random.RandRange(MaxDeltasPerMorph / 4, MaxDeltasPerMorph);
+			const int32 FirstVertex = Random.RandRange(0, NumFaceVertices - NumDeltas);
+			MorphRanges[MorphIndex] = FIntPoint(MorphDeltas.Num(), NumDeltas);
+			MorphWeights[MorphIndex] = Random.FRandRange(0.05f, 1.0f);
+			for (int32 DeltaIndex = 0; DeltaIndex < NumDeltas; ++DeltaIndex)
+			{
+				MorphDeltas.Add(GVRMSkinning::EncodeMorphDelta(FVector3f(Random.GetUnitVector() * Random.FRandRange(0.0f, 1.5f)), FirstVertex + DeltaIndex));
+			}
+		}
+
+		TArray<FGVRMActiveMorph> ActiveMorphs;
+		TArray<int32> MorphOffsets;
+		uint32 NumActiveDeltas = 0;
+		auto BuildAndAccumulate = [&]()
+		{
+			ActiveMorphs.Reset();
+			NumActiveDeltas = 0;
+			for (int32 MorphIndex = 0; MorphIndex < NumMorphs; ++MorphIndex)
+			{
+				FGVRMActiveMorph& Morph = ActiveMorphs.AddDefaulted_GetRef();
+				Morph.FirstDelta = MorphRanges[MorphIndex].X;
+				Morph.NumDeltas = MorphRanges[MorphIndex].Y;
+				Morph.FirstThread = NumActiveDeltas;
+				Morph.Weight = MorphWeights[MorphIndex];
+				NumActiveDeltas += Morph.NumDeltas;
+			}
+
+			MorphOffsets.Reset();
+			MorphOffsets.SetNumZeroed(NumFaceVertices * 3);
+			GVRMSkinning::AccumulateMorphTargets(ActiveMorphs, MorphDeltas, MorphOffsets);
+		};
+
+		OutResults.Add(Measure(TEXT("MorphTargets64"), MorphDeltas.Num(), Warmup, Iterations, NoSetup,
+			[&](int32) { BuildAndAccumulate(); }));
+
+		// Dense reference: each delta rounds to half a fixed-point step at most
+		TArray<FVector3f> Reference;
+		Reference.SetNumZeroed(NumFaceVertices);
+		for (int32 MorphIndex = 0; MorphIndex < NumMorphs; ++MorphIndex)
+		{
+			for (int32 DeltaIndex = MorphRanges[MorphIndex].X; DeltaIndex < MorphRanges[MorphIndex].X + MorphRanges[MorphIndex].Y; ++DeltaIndex)
+			{
+				const FVector4f& Delta = MorphDeltas[DeltaIndex];
+				Reference[GVRMSkinning::GetMorphDeltaSlot(Delta)] += FVector3f(Delta) * MorphWeights[MorphIndex];
+			}
+		}
+
+		float MaxDeviation = 0.0f;
+		for (int32 VertexIndex = 0; VertexIndex < NumFaceVertices; ++VertexIndex)
+		{
+			const FVector3f Offset = GVRMSkinning::DecodeMorphOffset(MorphOffsets, VertexIndex);
+			MaxDeviation = FMath::Max(MaxDeviation, (Offset - Reference[VertexIndex]).GetAbsMax());
+		}
+
+		const float Tolerance = NumMorphs * 0.5f / GVRMSkinning::MorphFixedPointScale + UE_KINDA_SMALL_NUMBER;
+		if (NumActiveDeltas != static_cast<uint32>(MorphDeltas.Num()) || MaxDeviation > Tolerance)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - MorphTargets64 deviates from the dense reference by %.6f cm (%u of %d deltas active)"),
+				MaxDeviation, NumActiveDeltas, MorphDeltas.Num());
+		}
+	}
+
+	/**
+	 * 256 avatars with 16 six-joint spring chains each (strands around the
+	 * head, two head spheres and two shoulder capsules), one solver step per
+	 * frame under a swinging head. The same frames are replayed on a second
+	 * solver and the results compared exactly, since how ParallelFor splits
+	 * the packets must not matter.
+	 */
+	void RunSpringBoneStages(int32 Seed, int32 Warmup, int32 Iterations, TArray<FStageResult>& OutResults)
+	{
+		constexpr int32 NumAvatars = 256;
+		constexpr int32 NumChains = 16;
+		constexpr int32 NumChainBones = 7;
+		constexpr int32 HeadBone = 1;
+		FRandomStream Random(Seed);
+
+		FGVRMSpringBoneAvatarSetup Setup;
+		Setup.ParentBones = { INDEX_NONE, 0 };
+		Setup.RefLocalPose = { FTransform::Identity, FTransform(FVector(0.0, 0.0, 150.0)) };
+		for (int32 ChainIndex = 0; ChainIndex < NumChains; ++ChainIndex)
+		{
+			FGVRMSpringBoneChainSetup& Chain = Setup.Chains.AddDefaulted_GetRef();
+			const FVector Root = Random.GetUnitVector() * 10.0;
+			for (int32 ChainBone = 0; ChainBone < NumChainBones; ++ChainBone)
+			{
+				const int32 Bone = Setup.ParentBones.Num();
+				Setup.ParentBones.Add(ChainBone == 0 ? HeadBone : Bone - 1);
+				Setup.RefLocalPose.Add(ChainBone == 0
+					? FTransform(Root)
+					: FTransform(FRotator(Random.FRandRange(-10.0f, 10.0f), Random.FRandRange(-10.0f, 10.0f), 0.0f).Quaternion(), FVector(0.0, 0.0, -4.0)));
+				Chain.Bones.Add(Bone);
+			}
+			Chain.GravityPower = Random.FRandRange(0.0f, 1.0f);
+			Chain.HitRadius = 1.0f;
+			Chain.ColliderMask = 0xF;
+		}
+
+		auto AddCollider = [&Setup](int32 Bone, const FVector3f& Offset, const FVector3f& Tail, float Radius, bool bCapsule)
+		{
+			FGVRMSpringBoneColliderSetup& Collider = Setup.Colliders.AddDefaulted_GetRef();
+			Collider.Bone = Bone;
+			Collider.Offset = Offset;
+			Collider.Tail = Tail;
+			Collider.Radius = Radius;
+			Collider.bCapsule = bCapsule;
+		};
+		AddCollider(HeadBone, FVector3f(0.0f, 0.0f, 8.0f), FVector3f::ZeroVector, 9.0f, false);
+		AddCollider(HeadBone, FVector3f(0.0f, 3.0f, 0.0f), FVector3f::ZeroVector, 8.0f, false);
+		AddCollider(0, FVector3f(0.0f, 0.0f, 135.0f), FVector3f(-20.0f, 0.0f, 130.0f), 5.0f, true);
+		AddCollider(0, FVector3f(0.0f, 0.0f, 135.0f), FVector3f(20.0f, 0.0f, 130.0f), 5.0f, true);
+
+		const int32 NumBones = Setup.ParentBones.Num();
+
+		// Component space poses of a frame: every avatar's head swings in its own phase
+		TArray<TArray<FTransform>> Poses;
+		Poses.SetNum(NumAvatars);
+		auto BuildPoses = [&](int32 Frame)
+		{
+			for (int32 Avatar = 0; Avatar < NumAvatars; ++Avatar)
+			{
+				TArray<FTransform>& Pose = Poses[Avatar];
+				Pose.SetNumUninitialized(NumBones);
+				const float Phase = Frame * 0.15f + Avatar * 0.37f;
+				for (int32 Bone = 0; Bone < NumBones; ++Bone)
+				{
+					FTransform Local = Setup.RefLocalPose[Bone];
+					if (Bone == HeadBone)
+					{
+						Local.SetRotation(FRotator(FMath::Sin(Phase) * 30.0f, FMath::Cos(Phase * 0.7f) * 45.0f, 0.0f).Quaternion());
+					}
+					const int32 Parent = Setup.ParentBones[Bone];
+					Pose[Bone] = Parent != INDEX_NONE ? Local * Pose[Parent] : Local;
+				}
+			}
+		};
+
+		auto AddAvatars = [&](FGVRMSpringBoneSolver& Solver, TArray<int32>& OutAvatarIds)
+		{
+			for (int32 Avatar = 0; Avatar < NumAvatars; ++Avatar)
+			{
+				OutAvatarIds.Add(Solver.AddAvatar(CopyTemp(Setup)));
+			}
+		};
+		auto StepFrame = [&](FGVRMSpringBoneSolver& Solver, const TArray<int32>& AvatarIds)
+		{
+			for (int32 Avatar = 0; Avatar < NumAvatars; ++Avatar)
+			{
+				const FTransform ComponentToWorld(FVector((Avatar % 16) * 200.0, (Avatar / 16) * 200.0, 0.0));
+				Solver.SetPose(AvatarIds[Avatar], ComponentToWorld, Poses[Avatar]);
+			}
+			Solver.Step(1.0f / 60.0f);
+		};
+
+		FGVRMSpringBoneSolver Solver;
+		TArray<int32> AvatarIds;
+		AddAvatars(Solver, AvatarIds);
+		OutResults.Add(Measure(TEXT("SpringBones256"), Solver.GetNumJoints(), Warmup, Iterations,
+			[&](int32 Iteration) { BuildPoses(Iteration + Warmup); },
+			[&](int32) { StepFrame(Solver, AvatarIds); }));
+
+		FGVRMSpringBoneSolver Replay;
+		TArray<int32> ReplayAvatarIds;
+		AddAvatars(Replay, ReplayAvatarIds);
+		for (int32 Frame = 0; Frame < Warmup + Iterations; ++Frame)
+		{
+			BuildPoses(Frame);
+			StepFrame(Replay, ReplayAvatarIds);
+		}
+
+		int32 NumMismatches = 0;
+		TArray<FTransform> Solved;
+		TArray<FTransform> Replayed;
+		for (int32 Avatar = 0; Avatar < NumAvatars; ++Avatar)
+		{
+			Solved = Poses[Avatar];
+			Replayed = Poses[Avatar];
+			const bool bApplied = Solver.ApplyToPose(AvatarIds[Avatar], Solved) && Replay.ApplyToPose(ReplayAvatarIds[Avatar], Replayed);
+			if (!bApplied || FMemory::Memcmp(Solved.GetData(), Replayed.GetData(), Solved.Num() * sizeof(FTransform)) != 0)
+			{
+				++NumMismatches;
+			}
+		}
+
+		if (NumMismatches > 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - SpringBones256 is not deterministic: %d of %d avatars differ between two identical runs"),
+				NumMismatches, NumAvatars);
+		}
+	}
+
+	/** Benchmark UpdateCache on a registered component of a real skeletal mesh */
+	void RunUpdateCacheStages(USkeletalMesh* SkeletalMesh, int32 Warmup, int32 Iterations, TArray<FStageResult>& OutResults)
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false, TEXT("GVRMBenchmarkWorld"));
+		USkeletalMeshComponent* Component = NewObject<USkeletalMeshComponent>(World);
+		Component->SetSkeletalMeshAsset(SkeletalMesh);
+		Component->RegisterComponentWithWorld(World);
+
+		const int32 NumVertices = SkeletalMesh->GetResourceForRendering() && SkeletalMesh->GetResourceForRendering()->LODRenderData.Num() > 0
+			? SkeletalMesh->GetResourceForRendering()->LODRenderData[0].GetNumVertices()
+			: 0;
+
+		// UpdateCache does its work once per engine frame; step the frame number between calls
+		const uint32 SavedFrameNumber = GFrameNumber;
+		FNiagaraDataInterfaceGVRMInstanceData Cache;
+
+		OutResults.Add(Measure(TEXT("UpdateCacheStreams"), NumVertices, Warmup, Iterations,
+			[&](int32) { Cache.InvalidateCache(); ++GFrameNumber; },
+			[&](int32) { Cache.UpdateCache(Component, 4, nullptr); }));
+
+		OutResults.Add(Measure(TEXT("UpdateCachePose"), NumVertices, Warmup, Iterations,
+			[&](int32) { ++GFrameNumber; },
+			[&](int32) { Cache.UpdateCache(Component, 4, nullptr); }));
+
+		if (!Cache.bCacheValid)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - UpdateCache did not produce a valid cache for %s"), *SkeletalMesh->GetName());
+		}
+
+		GFrameNumber = SavedFrameNumber;
+		Component->UnregisterComponent();
+		World->DestroyWorld(false);
+	}
+
+	/**
+	 * Run every golden case this process supports against the reference outputs
+	 * of Tools/gvrm_golden.py, timing each. Returns false on any mismatch or error.
+	 */
+	bool RunGoldenSuite(const FString& GoldenPath, int32 Warmup, int32 Iterations, TArray<FStageResult>& OutResults)
+	{
+		FGVRMGoldenSuite Suite;
+		FString ErrorMessage;
+		if (!Suite.Load(GoldenPath, ErrorMessage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - %s"), *ErrorMessage);
+			return false;
+		}
+
+		int32 NumMismatches = 0;
+		for (int32 CaseIndex = 0; CaseIndex < static_cast<int32>(EGVRMGoldenCase::Num); ++CaseIndex)
+		{
+			const EGVRMGoldenCase CaseId = static_cast<EGVRMGoldenCase>(CaseIndex);
+			const FString Stage = FString::Printf(TEXT("Golden%s"), FGVRMGoldenSuite::GetCaseName(CaseId));
+			if (!FGVRMGoldenSuite::IsCaseSupported(CaseId))
+			{
+				UE_LOG(LogTemp, Display, TEXT("GVRMBenchmark - %s skipped (needs an SM5 RHI, run without -nullrhi)"), *Stage);
+				continue;
+			}
+
+			FGVRMGoldenCase Case;
+			bool bCaseSucceeded = true;
+			OutResults.Add(Measure(*Stage, Suite.GetNumSplats() * Suite.GetNumPoses(), Warmup, Iterations, NoSetup,
+				[&](int32) { bCaseSucceeded &= Suite.RunCase(CaseId, Case, ErrorMessage); }));
+
+			if (!bCaseSucceeded)
+			{
+				UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - %s failed: %s"), *Stage, *ErrorMessage);
+				++NumMismatches;
+				continue;
+			}
+			NumMismatches += Suite.Compare(Case);
+		}
+		return NumMismatches == 0;
+	}
+}
+
+UGVRMBenchmarkCommandlet::UGVRMBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGVRMBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace GVRMBenchmark;
+
+	// Golden runs only sweep avatar sizes when asked to
+	const bool bGolden = FParse::Param(*Params, TEXT("Golden"));
+	FString SplatsParam = bGolden ? FString() : TEXT("100000,500000,1000000,5000000");
+	FParse::Value(*Params, TEXT("Splats="), SplatsParam, false);
+
+	int32 Iterations = 10;
+	int32 Warmup = 2;
+	int32 Seed = 1234;
+	float Tolerance = 0.10f;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("Warmup="), Warmup);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+	Iterations = FMath::Max(Iterations, 1);
+	Warmup = FMath::Max(Warmup, 0);
+
+	FString OutputDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GVRMBenchmark"));
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+	TArray<FString> SplatCountStrings;
+	SplatsParam.ParseIntoArray(SplatCountStrings, TEXT(","), true);
+
+	TArray<FStageResult> Results;
+	bool bGoldenPassed = true;
+	if (bGolden)
+	{
+		FString GoldenPath;
+		if (!FParse::Value(*Params, TEXT("GoldenFile="), GoldenPath))
+		{
+			GoldenPath = FGVRMGoldenSuite::GetDefaultFilePath();
+		}
+		bGoldenPassed = RunGoldenSuite(GoldenPath, Warmup, Iterations, Results);
+	}
+
+	if (SplatCountStrings.Num() > 0)
+	{
+		RunCacheKernelStages(Seed, Warmup, Iterations, Results);
+		RunMorphTargetStages(Seed, Warmup, Iterations, Results);
+		RunSpringBoneStages(Seed, Warmup, Iterations, Results);
+	}
+
+	for (const FString& SplatCountString : SplatCountStrings)
+	{
+		const int32 NumSplats = FCString::Atoi(*SplatCountString);
+		if (NumSplats <= 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("GVRMBenchmark - Ignoring splat count '%s'"), *SplatCountString);
+			continue;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("GVRMBenchmark - Synthetic avatar with %d splats"), NumSplats);
+		RunSyntheticStages(NumSplats, Seed, Warmup, Iterations, OutputDir, Results);
+
+		// Synthetic avatars of the larger sizes hold hundreds of MB; free them between sizes
+		CollectGarbage(RF_NoFlags);
+	}
+
+	FString SkeletalMeshPath;
+	if (FParse::Value(*Params, TEXT("SkeletalMesh="), SkeletalMeshPath))
+	{
+		if (USkeletalMesh* SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, *SkeletalMeshPath))
+		{
+			RunUpdateCacheStages(SkeletalMesh, Warmup, Iterations, Results);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Failed to load skeletal mesh %s"), *SkeletalMeshPath);
+		}
+	}
+
+	const FString JSONPath = FPaths::Combine(OutputDir, TEXT("GVRMBenchmark.json"));
+	const FString CSVPath = FPaths::Combine(OutputDir, TEXT("GVRMBenchmark.csv"));
+	if (!WriteJSON(JSONPath, Results, Seed) || !WriteCSV(CSVPath, Results))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Failed to write results to %s"), *OutputDir);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("GVRMBenchmark - Results written to %s and %s"), *JSONPath, *CSVPath);
+
+	if (!bGoldenPassed)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Golden outputs do not match"));
+		return 1;
+	}
+
+	// Regression gate against a previous run
+	FString BaselinePath;
+	if (FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		TMap<FString, double> BaselineMedians;
+		if (!ReadBaseline(BaselinePath, BaselineMedians))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Failed to read baseline %s"), *BaselinePath);
+			return 1;
+		}
+
+		int32 NumRegressions = 0;
+		for (const FStageResult& Result : Results)
+		{
+			const double* BaselineMedian = BaselineMedians.Find(MakeResultKey(Result.Stage, Result.NumSplats));
+			if (BaselineMedian && *BaselineMedian > 0.0 && Result.P50Ms > *BaselineMedian * (1.0 + Tolerance))
+			{
+				UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Regression: %s at %d splats, p50 %.3f ms vs baseline %.3f ms (+%.1f%%)"),
+					*Result.Stage, Result.NumSplats, Result.P50Ms, *BaselineMedian, (Result.P50Ms / *BaselineMedian - 1.0) * 100.0);
+				++NumRegressions;
+			}
+		}
+
+		if (NumRegressions > 0)
+		{
+			return 1;
+		}
+		UE_LOG(LogTemp, Display, TEXT("GVRMBenchmark - No regressions beyond %.0f%% against %s"), Tolerance * 100.0f, *BaselinePath);
+	}
+
+	return 0;
+}
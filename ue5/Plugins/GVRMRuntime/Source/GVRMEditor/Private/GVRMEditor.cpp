@@ -0,0 +1,19 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMEditor.h"
+#include "Modules/ModuleManager.h"
+
+#define LOCTEXT_NAMESPACE "FGVRMEditorModule"
+
+void FGVRMEditorModule::StartupModule()
+{
+}
+
+void FGVRMEditorModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FGVRMEditorModule, GVRMEditor)
@@ -0,0 +1,583 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMGPUBenchmark.h"
+#include "GVRMSyntheticAvatar.h"
+#include "GVRMSkinningData.h"
+#include "GVRMAnimationCache.h"
+#include "GVRMSplatShaders.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "DynamicRHI.h"
+
+namespace GVRMGPUBenchmark
+{
+	/** Influences per vertex of the synthetic avatar */
+	constexpr int32 NumInfluences = 4;
+
+	/** Fixed camera of the sort stage: the whole avatar in a 1080p view, 3 m in front of it */
+	constexpr float ViewDistance = 300.0f;
+	constexpr float ViewHeight = 130.0f;
+	constexpr float ViewHalfFOV = PI / 4.0f;
+	constexpr int32 ViewWidth = 1920;
+	constexpr int32 ViewHeightPixels = 1080;
+	constexpr float ViewNearPlane = 10.0f;
+
+	/** Face rig of the morph stage, like the MorphTargets64 CPU stage: 64 expressions of 500 to 2000 deltas on 10k vertices */
+	constexpr int32 NumMorphs = 64;
+	constexpr int32 NumMorphVertices = 10000;
+	constexpr int32 MaxDeltasPerMorph = 2000;
+	constexpr int32 MorphSeed = 48;
+
+	/** Frames baked into the cache stage's animation cache (poses 0 and 1 of the scripted animation) */
+	constexpr int32 NumCacheFrames = 2;
+
+	/** GVRM.SplatCulling.* defaults */
+	constexpr float MinPixelRadius = 0.5f;
+	constexpr float BackfaceThreshold = -0.3f;
+	constexpr float FrustumMargin = 1.0f;
+
+	/** GPU time between two absolute timestamp queries (microseconds) in milliseconds */
+	double GetElapsedMs(FRHIRenderQuery* StartQuery, FRHIRenderQuery* EndQuery)
+	{
+		uint64 StartMicroseconds = 0;
+		uint64 EndMicroseconds = 0;
+		if (!RHIGetRenderQueryResult(StartQuery, StartMicroseconds, true) || !RHIGetRenderQueryResult(EndQuery, EndMicroseconds, true))
+		{
+			return -1.0;
+		}
+		return EndMicroseconds >= StartMicroseconds ? (EndMicroseconds - StartMicroseconds) / 1000.0 : -1.0;
+	}
+}
+
+const TCHAR* FGVRMGPUBenchmark::GetStageName(EGVRMGPUStage Stage)
+{
+	switch (Stage)
+	{
+	case EGVRMGPUStage::Skinning: return TEXT("GPUSkinning");
+	case EGVRMGPUStage::SkinningShared: return TEXT("GPUSkinningShared");
+	case EGVRMGPUStage::SkinningMorphs: return TEXT("GPUSkinningMorphs64");
+	case EGVRMGPUStage::CullAndSort: return TEXT("GPUCullAndSort");
+	case EGVRMGPUStage::CacheDecode: return TEXT("GPUCacheDecode");
+	default: return TEXT("Unknown");
+	}
+}
+
+bool FGVRMGPUBenchmark::IsSupported()
+{
+	return !GUsingNullRHI && GMaxRHIFeatureLevel >= ERHIFeatureLevel::SM5 && GSupportsTimestampRenderQueries;
+}
+
+FGVRMGPUBenchmark::~FGVRMGPUBenchmark()
+{
+	Release();
+}
+
+void FGVRMGPUBenchmark::Initialize(const FGVRMSyntheticAvatar& InAvatar, const FGVRMSplatGPUData& GPUData)
+{
+	Release();
+	Avatar = &InAvatar;
+	NumSplats = GPUData.NumSplats;
+	NumUniqueVertices = static_cast<uint32>(GPUData.UniqueVertexIndices.Num());
+
+	// Each expression moves a random run of the face vertices; every face vertex gets the slot of its index
+	const int32 NumFaceVertices = FMath::Min(GVRMGPUBenchmark::NumMorphVertices, InAvatar.VertexPositions.Num());
+	NumMorphSlots = NumFaceVertices;
+	NumMorphThreads = 0;
+	TArray<uint32> VertexSlots;
+	VertexSlots.Init(GVRMSkinning::MorphSlotNone, InAvatar.VertexPositions.Num());
+	for (int32 VertexIndex = 0; VertexIndex < NumFaceVertices; ++VertexIndex)
+	{
+		VertexSlots[VertexIndex] = VertexIndex;
+	}
+
+	FRandomStream Random(GVRMGPUBenchmark::MorphSeed);
+	TArray<FVector4f> Deltas;
+	ActiveMorphs.Reset();
+	for (int32 MorphIndex = 0; NumFaceVertices > 0 && MorphIndex < GVRMGPUBenchmark::NumMorphs; ++MorphIndex)
+	{
+		const int32 NumDeltas = FMath::Min(Random.RandRange(GVRMGPUBenchmark::MaxDeltasPerMorph / 4, GVRMGPUBenchmark::MaxDeltasPerMorph), NumFaceVertices);
+		const int32 FirstVertex = Random.RandRange(0, NumFaceVertices - NumDeltas);
+
+		FGVRMActiveMorph& Morph = ActiveMorphs.AddDefaulted_GetRef();
+		Morph.FirstDelta = Deltas.Num();
+		Morph.NumDeltas = NumDeltas;
+		Morph.FirstThread = NumMorphThreads;
+		Morph.Weight = Random.FRandRange(0.05f, 1.0f);
+		NumMorphThreads += NumDeltas;
+
+		for (int32 DeltaIndex = 0; DeltaIndex < NumDeltas; ++DeltaIndex)
+		{
+			Deltas.Add(GVRMSkinning::EncodeMorphDelta(FVector3f(Random.GetUnitVector() * Random.FRandRange(0.0f, 1.5f)), FirstVertex + DeltaIndex));
+		}
+	}
+
+	// Bake the cache through the CPU skinning path: bind positions from the identity palette, then the first poses
+	auto SkinFrame = [&InAvatar, &GPUData](TConstArrayView<FMatrix44f> BoneMatrices, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations)
+	{
+		const GVRMSkinning::FSkinningStreams Streams = InAvatar.MakeStreams(BoneMatrices);
+		OutPositions.SetNumUninitialized(GPUData.NumSplats);
+		OutRotations.SetNumUninitialized(GPUData.NumSplats);
+		GVRMSkinning::DispatchInfluences(Streams.NumInfluences, [&](auto NumInfluences)
+		{
+			for (int32 SplatIndex = 0; SplatIndex < GPUData.NumSplats; ++SplatIndex)
+			{
+				GVRMSkinning::SkinSplat<decltype(NumInfluences)::Value>(Streams, GPUData.SplatVertexIndices[SplatIndex], GPUData.SplatRelativePositions[SplatIndex],
+					OutPositions[SplatIndex], OutRotations[SplatIndex]);
+			}
+		});
+	};
+
+	TArray<FMatrix44f> BoneMatrices;
+	BoneMatrices.Init(FMatrix44f::Identity, InAvatar.NumBones);
+	TArray<FVector3f> BindPositions;
+	TArray<FVector4f> BindRotations;
+	SkinFrame(BoneMatrices, BindPositions, BindRotations);
+
+	UGVRMAnimationCache* Cache = NewObject<UGVRMAnimationCache>(GetTransientPackage());
+	FString ErrorMessage;
+	const bool bEncoded = Cache->EncodeFrames(MoveTemp(BindPositions), GVRMGPUBenchmark::NumCacheFrames, 30.0f,
+		[&InAvatar, &BoneMatrices, &SkinFrame](int32 FrameIndex, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations)
+		{
+			InAvatar.EvaluatePose(FrameIndex / 30.0f, BoneMatrices);
+			SkinFrame(BoneMatrices, OutPositions, OutRotations);
+		},
+		ErrorMessage);
+	if (!bEncoded)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMBenchmark - Failed to bake the GPUCacheDecode cache: %s"), *ErrorMessage);
+	}
+	CacheSplatDataOffset = Cache->GetSplatDataOffset();
+	CacheFrameStride = Cache->GetFrameStride();
+	const TArray<uint32>& CacheFrames = Cache->GetFrameData();
+	TArray<FVector4f> CachePositions;
+	CachePositions.Reserve(Cache->BindPositions.Num());
+	for (const FVector3f& Position : Cache->BindPositions)
+	{
+		CachePositions.Add(FVector4f(Position, 0.0f));
+	}
+
+	ENQUEUE_RENDER_COMMAND(GVRMBenchmarkUpload)([this, &InAvatar, &GPUData, &VertexSlots, &Deltas, &CacheFrames, &CachePositions](FRHICommandListImmediate& RHICmdList)
+	{
+		TArray<FVector4f> RelativePositions;
+		TArray<FVector4f> Scales;
+		RelativePositions.Reserve(NumSplats);
+		Scales.Reserve(NumSplats);
+		for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+		{
+			RelativePositions.Add(FVector4f(GPUData.SplatRelativePositions[SplatIndex], 0.0f));
+			Scales.Add(FVector4f(InAvatar.Gaussians[SplatIndex].Scale, 0.0f));
+		}
+
+		// Zero normals: like a splat component before its first mesh streams, no backface test
+		TArray<FVector4f> Normals;
+		Normals.SetNumZeroed(NumSplats);
+
+		SplatVertexIndices = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkSplatVertexIndices"), GPUData.SplatVertexIndices, sizeof(int32), PF_R32_SINT);
+		SplatRelativePositions = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkSplatRelativePositions"), RelativePositions, sizeof(FVector4f), PF_A32B32G32R32F);
+		VertexPositions = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkMeshPositions"), InAvatar.VertexPositions, sizeof(float), PF_R32_FLOAT);
+		BoneIndices = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkBoneIndices"), InAvatar.BoneIndices, sizeof(FIntVector4), PF_R32G32B32A32_UINT);
+		BoneWeights = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkBoneWeights"), InAvatar.BoneWeights, sizeof(FVector4f), PF_A32B32G32R32F);
+		SplatScales = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkSplatScales"), Scales, sizeof(FVector4f), PF_A32B32G32R32F);
+		SplatNormals = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkSplatNormals"), Normals, sizeof(FVector4f), PF_A32B32G32R32F);
+		UniqueVertexIndices = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkUniqueVertexIndices"), GPUData.UniqueVertexIndices, sizeof(uint32), PF_R32_UINT);
+		SplatUniqueVertices = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkSplatUniqueVertices"), GPUData.SplatUniqueVertices, sizeof(uint32), PF_R32_UINT);
+		MorphVertexSlots = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkMorphVertexSlots"), VertexSlots, sizeof(uint32), PF_R32_UINT);
+		MorphDeltas = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkMorphDeltas"), Deltas, sizeof(FVector4f), PF_A32B32G32R32F);
+
+		CacheFrameData = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkCacheFrames"), CacheFrames, sizeof(uint32), PF_R32_UINT);
+		CacheBindPositions = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkCacheBindPositions"), CachePositions, sizeof(FVector4f), PF_A32B32G32R32F);
+
+		PlaceholderUint = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkPlaceholder"), TArray<uint32>(), sizeof(uint32), PF_R32_UINT);
+		PlaceholderUint2 = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkPlaceholder"), TArray<FUintVector2>(), sizeof(FUintVector2), PF_R32G32_UINT);
+		PlaceholderUint4 = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkPlaceholder"), TArray<FIntVector4>(), sizeof(FIntVector4), PF_R32G32B32A32_UINT);
+		PlaceholderFloat4 = FGVRMGPUInput::Upload(TEXT("GVRMBenchmarkPlaceholder"), TArray<FVector4f>(), sizeof(FVector4f), PF_A32B32G32R32F);
+	});
+	FlushRenderingCommands();
+}
+
+void FGVRMGPUBenchmark::Release()
+{
+	if (!Avatar)
+	{
+		return;
+	}
+
+	ENQUEUE_RENDER_COMMAND(GVRMBenchmarkRelease)([this](FRHICommandListImmediate&)
+	{
+		for (FGVRMGPUInput* Input : { &SplatVertexIndices, &SplatRelativePositions, &VertexPositions, &BoneIndices, &BoneWeights,
+			&SplatScales, &SplatNormals, &UniqueVertexIndices, &SplatUniqueVertices, &MorphVertexSlots, &MorphDeltas, &CacheFrameData, &CacheBindPositions, &PlaceholderUint, &PlaceholderUint2, &PlaceholderUint4, &PlaceholderFloat4 })
+		{
+			Input->SafeRelease();
+		}
+	});
+	FlushRenderingCommands();
+	Avatar = nullptr;
+}
+
+bool FGVRMGPUBenchmark::Run(EGVRMGPUStage Stage, int32 Warmup, int32 Iterations, TArray<double>& OutSamplesMs, FString& OutErrorMessage)
+{
+	OutSamplesMs.Reset();
+	if (!Avatar || !IsSupported())
+	{
+		OutErrorMessage = TEXT("The GPU stages need an SM5 RHI with timestamp queries (not -nullrhi)");
+		return false;
+	}
+
+	// Palettes are evaluated up front so the render thread only records and waits
+	const int32 NumRuns = Warmup + Iterations;
+	TArray<TArray<FGVRMBoneMatrix3x4>> Palettes;
+	Palettes.SetNum(NumRuns);
+	TArray<FMatrix44f> BoneMatrices;
+	for (int32 RunIndex = 0; RunIndex < NumRuns; ++RunIndex)
+	{
+		Avatar->EvaluatePose(RunIndex / 30.0f, BoneMatrices);
+		Palettes[RunIndex].SetNumUninitialized(BoneMatrices.Num());
+		GVRMSkinning::PackBoneMatrices(BoneMatrices, Palettes[RunIndex]);
+	}
+
+	bool bSucceeded = true;
+	ENQUEUE_RENDER_COMMAND(GVRMBenchmarkRun)([this, Stage, Warmup, &Palettes, &OutSamplesMs, &bSucceeded, &OutErrorMessage](FRHICommandListImmediate& RHICmdList)
+	{
+		for (int32 RunIndex = 0; RunIndex < Palettes.Num(); ++RunIndex)
+		{
+			const TArray<FGVRMBoneMatrix3x4>& Palette = Palettes[RunIndex];
+
+			// Untimed inputs of stages that start from skinned splats
+			TRefCountPtr<FRDGPooledBuffer> SkinnedPositions;
+			TRefCountPtr<FRDGPooledBuffer> SkinnedRotations;
+			if (Stage == EGVRMGPUStage::CullAndSort)
+			{
+				FRDGBuilder GraphBuilder(RHICmdList);
+				FRDGBufferRef Positions = nullptr;
+				FRDGBufferRef Rotations = nullptr;
+				AddSkinningPasses(GraphBuilder, Palette, false, false, Positions, Rotations);
+				GraphBuilder.QueueBufferExtraction(Positions, &SkinnedPositions);
+				GraphBuilder.QueueBufferExtraction(Rotations, &SkinnedRotations);
+				GraphBuilder.Execute();
+			}
+
+			// Outputs are extracted so RDG does not cull the passes
+			FRDGBuilder GraphBuilder(RHICmdList);
+			TArray<TRefCountPtr<FRDGPooledBuffer>, TInlineAllocator<2>> Outputs;
+			TArray<FRDGBufferRef, TInlineAllocator<2>> OutputBuffers;
+			switch (Stage)
+			{
+			case EGVRMGPUStage::Skinning:
+			case EGVRMGPUStage::SkinningShared:
+			case EGVRMGPUStage::SkinningMorphs:
+			{
+				FRDGBufferRef Positions = nullptr;
+				FRDGBufferRef Rotations = nullptr;
+				AddSkinningPasses(GraphBuilder, Palette, Stage == EGVRMGPUStage::SkinningShared, Stage == EGVRMGPUStage::SkinningMorphs, Positions, Rotations);
+				OutputBuffers.Add(Positions);
+				OutputBuffers.Add(Rotations);
+				break;
+			}
+
+			case EGVRMGPUStage::CullAndSort:
+				OutputBuffers.Add(AddCullAndSortPasses(GraphBuilder, GraphBuilder.RegisterExternalBuffer(SkinnedPositions), GraphBuilder.RegisterExternalBuffer(SkinnedRotations)));
+				break;
+
+			case EGVRMGPUStage::CacheDecode:
+			{
+				FRDGBufferRef Positions = nullptr;
+				FRDGBufferRef Rotations = nullptr;
+				AddCacheDecodePass(GraphBuilder, RunIndex, Positions, Rotations);
+				OutputBuffers.Add(Positions);
+				OutputBuffers.Add(Rotations);
+				break;
+			}
+
+			default:
+				OutErrorMessage = TEXT("Unknown GPU stage");
+				bSucceeded = false;
+				return;
+			}
+
+			Outputs.SetNum(OutputBuffers.Num());
+			for (int32 OutputIndex = 0; OutputIndex < OutputBuffers.Num(); ++OutputIndex)
+			{
+				GraphBuilder.QueueBufferExtraction(OutputBuffers[OutputIndex], &Outputs[OutputIndex]);
+			}
+
+			// The graph records into this command list, so the queries bracket exactly its passes
+			FRenderQueryRHIRef StartQuery = RHICreateRenderQuery(RQT_AbsoluteTime);
+			FRenderQueryRHIRef EndQuery = RHICreateRenderQuery(RQT_AbsoluteTime);
+			RHICmdList.EndRenderQuery(StartQuery);
+			GraphBuilder.Execute();
+			RHICmdList.EndRenderQuery(EndQuery);
+			RHICmdList.SubmitCommandsAndFlushGPU();
+			RHICmdList.BlockUntilGPUIdle();
+
+			const double ElapsedMs = GVRMGPUBenchmark::GetElapsedMs(StartQuery, EndQuery);
+			if (ElapsedMs < 0.0)
+			{
+				OutErrorMessage = FString::Printf(TEXT("Timestamp queries of run %d did not resolve"), RunIndex);
+				bSucceeded = false;
+				return;
+			}
+			if (RunIndex >= Warmup)
+			{
+				OutSamplesMs.Add(ElapsedMs);
+			}
+		}
+	});
+	FlushRenderingCommands();
+
+	return bSucceeded;
+}
+
+void FGVRMGPUBenchmark::AddSkinningPasses(FRDGBuilder& GraphBuilder, const TArray<FGVRMBoneMatrix3x4>& Palette, bool bSharedVertices, bool bMorphs,
+	FRDGBufferRef& OutPositions, FRDGBufferRef& OutRotations) const
+{
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+
+	// One LBS avatar, always visible
+	FGVRMSplatBatchInstance Instance;
+	Instance.NumSplats = NumSplats;
+	Instance.NumUniqueVertices = bSharedVertices ? NumUniqueVertices : 0;
+	bMorphs &= NumMorphThreads > 0;
+	Instance.MorphVertexOffset = bMorphs ? 0 : GVRMSkinning::MorphSlotNone;
+	const FVector4f CullPlane = FVector4f::Zero();
+
+	FRDGBufferRef InstancesBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRMBenchmark.Instances"),
+		sizeof(FGVRMSplatBatchInstance), 1, &Instance, sizeof(FGVRMSplatBatchInstance));
+	FRDGBufferRef CullPlanesBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRMBenchmark.CullPlanes"),
+		sizeof(FVector4f), 1, &CullPlane, sizeof(FVector4f));
+	FRDGBufferRef PaletteBuffer = CreateVertexBuffer(GraphBuilder, TEXT("GVRMBenchmark.BoneMatrices"),
+		FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), Palette.Num() * 3), Palette.GetData(), Palette.Num() * sizeof(FGVRMBoneMatrix3x4), ERDGInitialDataFlags::NoCopy);
+
+	FRDGBufferRef VisibleInstances = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FUintVector4), 1), TEXT("GVRMBenchmark.VisibleInstances"));
+	FRDGBufferRef BatchCounters = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 3), TEXT("GVRMBenchmark.BatchCounters"));
+	FRDGBufferRef SkinningArgs = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(2), TEXT("GVRMBenchmark.SkinningArgs"));
+	{
+		FGVRMSplatCullInstancesCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatCullInstancesCS::FParameters>();
+		PassParameters->NumInstances = 1;
+		PassParameters->NumCullViews = 0;
+		PassParameters->MaxDispatchGroups = GRHIMaxDispatchThreadGroupsPerDimension.X;
+		PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+		PassParameters->CullPlanes = GraphBuilder.CreateSRV(CullPlanesBuffer);
+		PassParameters->RWVisibleInstances = GraphBuilder.CreateUAV(VisibleInstances);
+		PassParameters->RWSkinningArgs = GraphBuilder.CreateUAV(SkinningArgs, PF_R32_UINT);
+		PassParameters->RWBatchCounters = GraphBuilder.CreateUAV(BatchCounters);
+
+		TShaderMapRef<FGVRMSplatCullInstancesCS> ComputeShader(ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMCullSplatInstances (1 avatar)"), ComputeShader, PassParameters, FIntVector(1, 1, 1));
+	}
+
+	FRDGBufferRef MorphOffsetsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(int32), bMorphs ? NumMorphSlots * 3 : 3u), TEXT("GVRMBenchmark.MorphOffsets"));
+	{
+		FRDGBufferUAVRef MorphOffsetsUAV = GraphBuilder.CreateUAV(MorphOffsetsBuffer, PF_R32_SINT);
+		AddClearUAVPass(GraphBuilder, MorphOffsetsUAV, 0u);
+
+		if (bMorphs)
+		{
+			FRDGBufferRef ActiveMorphsBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRMBenchmark.ActiveMorphs"),
+				sizeof(FGVRMActiveMorph), ActiveMorphs.Num(), ActiveMorphs.GetData(), ActiveMorphs.Num() * sizeof(FGVRMActiveMorph), ERDGInitialDataFlags::NoCopy);
+
+			FGVRMSplatMorphAccumulateCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatMorphAccumulateCS::FParameters>();
+			PassParameters->NumActiveMorphs = ActiveMorphs.Num();
+			PassParameters->NumMorphThreads = NumMorphThreads;
+			PassParameters->ActiveMorphs = GraphBuilder.CreateSRV(ActiveMorphsBuffer);
+			PassParameters->MorphDeltas = MorphDeltas.SRV;
+			PassParameters->RWMorphOffsets = MorphOffsetsUAV;
+
+			TShaderMapRef<FGVRMSplatMorphAccumulateCS> ComputeShader(ShaderMap);
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMAccumulateMorphs (%u deltas)", NumMorphThreads), ComputeShader, PassParameters,
+				FComputeShaderUtils::GetGroupCountWrapped(NumMorphThreads, FGVRMSplatMorphAccumulateCS::ThreadGroupSize));
+		}
+	}
+
+	const uint32 NumSharedVertices = FMath::Max(Instance.NumUniqueVertices, 1u);
+	FRDGBufferRef SharedPositionsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSharedVertices), TEXT("GVRMBenchmark.SharedVertexPositions"));
+	FRDGBufferRef SharedRotationsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSharedVertices), TEXT("GVRMBenchmark.SharedVertexRotations"));
+	if (Instance.NumUniqueVertices > 0)
+	{
+		FGVRMSplatVertexSkinningCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatVertexSkinningCS::FParameters>();
+		PassParameters->UniqueVertexIndices = UniqueVertexIndices.SRV;
+		PassParameters->VertexPositions = VertexPositions.SRV;
+		PassParameters->BoneIndices = BoneIndices.SRV;
+		PassParameters->BoneWeights = BoneWeights.SRV;
+		PassParameters->ExtraBoneIndices = PlaceholderUint4.SRV;
+		PassParameters->ExtraBoneWeights = PlaceholderFloat4.SRV;
+		PassParameters->BoneMatrices = GraphBuilder.CreateSRV(PaletteBuffer, PF_A32B32G32R32F);
+		PassParameters->LODRemapIndices = PlaceholderUint4.SRV;
+		PassParameters->LODRemapWeights = PlaceholderFloat4.SRV;
+		PassParameters->LODRemapOffsets = PlaceholderFloat4.SRV;
+		PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+		PassParameters->VisibleInstances = GraphBuilder.CreateSRV(VisibleInstances);
+		PassParameters->BatchCounters = GraphBuilder.CreateSRV(BatchCounters);
+		PassParameters->RWSharedVertexPositions = GraphBuilder.CreateUAV(SharedPositionsBuffer);
+		PassParameters->RWSharedVertexRotations = GraphBuilder.CreateUAV(SharedRotationsBuffer);
+		PassParameters->IndirectArgs = SkinningArgs;
+
+		FGVRMSplatVertexSkinningCS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<FGVRMNumInfluencesDim>(GVRMSkinning::GetInfluencePermutation(GVRMGPUBenchmark::NumInfluences));
+		TShaderMapRef<FGVRMSplatVertexSkinningCS> ComputeShader(ShaderMap, PermutationVector);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSkinSharedVertices (%u vertices)", Instance.NumUniqueVertices),
+			ComputeShader, PassParameters, SkinningArgs, FGVRMSplatCullInstancesCS::VertexPassArgsOffset);
+	}
+	else
+	{
+		// Never read without a vertex pass, but the splat pass binds them
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(SharedPositionsBuffer), 0u);
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(SharedRotationsBuffer), 0u);
+	}
+
+	OutPositions = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRMBenchmark.SkinnedPositions"));
+	OutRotations = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRMBenchmark.SkinnedRotations"));
+	{
+		FGVRMSplatSkinningCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatSkinningCS::FParameters>();
+		PassParameters->SplatVertexIndices = SplatVertexIndices.SRV;
+		PassParameters->SplatRelativePositions = SplatRelativePositions.SRV;
+		PassParameters->VertexPositions = VertexPositions.SRV;
+		PassParameters->BoneIndices = BoneIndices.SRV;
+		PassParameters->BoneWeights = BoneWeights.SRV;
+		PassParameters->ExtraBoneIndices = PlaceholderUint4.SRV;
+		PassParameters->ExtraBoneWeights = PlaceholderFloat4.SRV;
+		PassParameters->BoneMatrices = GraphBuilder.CreateSRV(PaletteBuffer, PF_A32B32G32R32F);
+		PassParameters->LODRemapIndices = PlaceholderUint4.SRV;
+		PassParameters->LODRemapWeights = PlaceholderFloat4.SRV;
+		PassParameters->LODRemapOffsets = PlaceholderFloat4.SRV;
+		PassParameters->RigidSplatOrder = PlaceholderUint.SRV;
+		PassParameters->RigidHostPositions = PlaceholderFloat4.SRV;
+		PassParameters->RigidBones = PlaceholderUint2.SRV;
+		PassParameters->SplatUniqueVertices = SplatUniqueVertices.SRV;
+		PassParameters->MorphVertexSlots = MorphVertexSlots.SRV;
+		PassParameters->MorphOffsets = GraphBuilder.CreateSRV(MorphOffsetsBuffer, PF_R32_SINT);
+		PassParameters->SharedVertexPositions = GraphBuilder.CreateSRV(SharedPositionsBuffer);
+		PassParameters->SharedVertexRotations = GraphBuilder.CreateSRV(SharedRotationsBuffer);
+		PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+		PassParameters->VisibleInstances = GraphBuilder.CreateSRV(VisibleInstances);
+		PassParameters->BatchCounters = GraphBuilder.CreateSRV(BatchCounters);
+		PassParameters->RWSkinnedPositions = GraphBuilder.CreateUAV(OutPositions);
+		PassParameters->RWSkinnedRotations = GraphBuilder.CreateUAV(OutRotations);
+		PassParameters->IndirectArgs = SkinningArgs;
+
+		FGVRMSplatSkinningCS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<FGVRMNumInfluencesDim>(GVRMSkinning::GetInfluencePermutation(GVRMGPUBenchmark::NumInfluences));
+		TShaderMapRef<FGVRMSplatSkinningCS> ComputeShader(ShaderMap, PermutationVector);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSkinSplats (%d splats)", NumSplats),
+			ComputeShader, PassParameters, SkinningArgs, FGVRMSplatCullInstancesCS::SplatPassArgsOffset);
+	}
+}
+
+void FGVRMGPUBenchmark::AddCacheDecodePass(FRDGBuilder& GraphBuilder, int32 RunIndex, FRDGBufferRef& OutPositions, FRDGBufferRef& OutRotations) const
+{
+	// Alternate the two frames so every run decodes and blends both
+	const uint32 Frame0 = RunIndex % GVRMGPUBenchmark::NumCacheFrames;
+	const uint32 Frame1 = (Frame0 + 1) % GVRMGPUBenchmark::NumCacheFrames;
+
+	OutPositions = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRMBenchmark.CachedPositions"));
+	OutRotations = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRMBenchmark.CachedRotations"));
+
+	FGVRMSplatCacheDecodeCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatCacheDecodeCS::FParameters>();
+	PassParameters->NumSplats = NumSplats;
+	PassParameters->ClusterSize = UGVRMAnimationCache::ClusterSize;
+	PassParameters->SplatDataOffset = CacheSplatDataOffset;
+	PassParameters->Frame0Offset = Frame0 * CacheFrameStride;
+	PassParameters->Frame1Offset = Frame1 * CacheFrameStride;
+	PassParameters->Alpha = 0.5f;
+	PassParameters->FrameData = CacheFrameData.SRV;
+	PassParameters->BindPositions = CacheBindPositions.SRV;
+	PassParameters->RWSkinnedPositions = GraphBuilder.CreateUAV(OutPositions);
+	PassParameters->RWSkinnedRotations = GraphBuilder.CreateUAV(OutRotations);
+
+	TShaderMapRef<FGVRMSplatCacheDecodeCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSplatCacheDecode (%d splats)", NumSplats), ComputeShader, PassParameters,
+		FComputeShaderUtils::GetGroupCountWrapped(NumSplats, FGVRMSplatShader::ThreadGroupSize));
+}
+
+FRDGBufferRef FGVRMGPUBenchmark::AddCullAndSortPasses(FRDGBuilder& GraphBuilder, FRDGBufferRef Positions, FRDGBufferRef Rotations) const
+{
+	using namespace GVRMGPUBenchmark;
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+
+	// Camera on -X looking down +X (engine view space: x right, y up, z forward)
+	const FMatrix ViewRotation(FPlane(0, 0, 1, 0), FPlane(1, 0, 0, 0), FPlane(0, 1, 0, 0), FPlane(0, 0, 0, 1));
+	const FMatrix44f LocalToView(FTranslationMatrix(-FVector(-ViewDistance, 0.0, ViewHeight)) * ViewRotation);
+	const FMatrix44f ViewToClip(FReversedZPerspectiveMatrix(ViewHalfFOV, ViewWidth, ViewHeightPixels, ViewNearPlane));
+	const FVector2f ViewportSize(ViewWidth, ViewHeightPixels);
+
+	FRDGBufferRef ViewCullCounters = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), FGVRMSplatCullSplatsCS::NumViewCounters), TEXT("GVRMBenchmark.ViewCullCounters"));
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(ViewCullCounters), 0u);
+
+	FRDGBufferRef CompactedSplats = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSplats), TEXT("GVRMBenchmark.CompactedSplats"));
+	FRDGBufferRef CullCounters = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), FGVRMSplatCullSplatsCS::NumCounters), TEXT("GVRMBenchmark.SplatCullCounters"));
+	FRDGBufferRef SortArgs = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateIndirectDesc(FGVRMSplatCullSplatsCS::NumArgs), TEXT("GVRMBenchmark.SplatSortArgs"));
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(CullCounters), 0u);
+	{
+		FGVRMSplatCullSplatsCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatCullSplatsCS::FParameters>();
+		PassParameters->LocalToView = LocalToView;
+		PassParameters->ViewToClip = ViewToClip;
+		PassParameters->ViewportSize = ViewportSize;
+		PassParameters->NumSplats = NumSplats;
+		PassParameters->SplatBase = 0;
+		PassParameters->bEnableCulling = 1;
+		PassParameters->MinPixelRadius = MinPixelRadius;
+		PassParameters->BackfaceThreshold = BackfaceThreshold;
+		PassParameters->FrustumMargin = FrustumMargin;
+		PassParameters->SkinnedPositions = GraphBuilder.CreateSRV(Positions);
+		PassParameters->SkinnedRotations = GraphBuilder.CreateSRV(Rotations);
+		PassParameters->SplatScales = SplatScales.SRV;
+		PassParameters->SplatNormals = SplatNormals.SRV;
+		PassParameters->RWCompactedSplats = GraphBuilder.CreateUAV(CompactedSplats);
+		PassParameters->RWCullCounters = GraphBuilder.CreateUAV(CullCounters);
+
+		TShaderMapRef<FGVRMSplatCullSplatsCS> ComputeShader(ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMCullSplats (%d splats)", NumSplats), ComputeShader, PassParameters,
+			FComputeShaderUtils::GetGroupCountWrapped(NumSplats, FGVRMSplatShader::ThreadGroupSize));
+	}
+	{
+		FGVRMSplatBuildSortArgsCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatBuildSortArgsCS::FParameters>();
+		PassParameters->MaxDispatchGroups = GRHIMaxDispatchThreadGroupsPerDimension.X;
+		PassParameters->RWCullCounters = GraphBuilder.CreateUAV(CullCounters);
+		PassParameters->RWSortArgs = GraphBuilder.CreateUAV(SortArgs, PF_R32_UINT);
+		PassParameters->RWViewCullCounters = GraphBuilder.CreateUAV(ViewCullCounters);
+
+		TShaderMapRef<FGVRMSplatBuildSortArgsCS> ComputeShader(ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMBuildSplatSortArgs"), ComputeShader, PassParameters, FIntVector(1, 1, 1));
+	}
+
+	const uint32 NumSortElements = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(NumSplats));
+	FRDGBufferRef SortKeys = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSortElements), TEXT("GVRMBenchmark.SortKeys"));
+	FRDGBufferRef SortValues = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSortElements), TEXT("GVRMBenchmark.SortValues"));
+	FRDGBufferSRVRef SortCountersSRV = GraphBuilder.CreateSRV(CullCounters);
+	{
+		FGVRMSplatSortKeysCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatSortKeysCS::FParameters>();
+		PassParameters->LocalToView = LocalToView;
+		PassParameters->SplatBase = 0;
+		PassParameters->SkinnedPositions = GraphBuilder.CreateSRV(Positions);
+		PassParameters->CompactedSplats = GraphBuilder.CreateSRV(CompactedSplats);
+		PassParameters->SortCounters = SortCountersSRV;
+		PassParameters->RWSortKeys = GraphBuilder.CreateUAV(SortKeys);
+		PassParameters->RWSortValues = GraphBuilder.CreateUAV(SortValues);
+		PassParameters->IndirectArgs = SortArgs;
+
+		TShaderMapRef<FGVRMSplatSortKeysCS> ComputeShader(ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSplatSortKeys"), ComputeShader, PassParameters,
+			SortArgs, FGVRMSplatCullSplatsCS::SortArgsOffset);
+	}
+
+	TShaderMapRef<FGVRMSplatBitonicSortCS> SortShader(ShaderMap);
+	for (uint32 SortLevel = 2; SortLevel <= NumSortElements; SortLevel <<= 1)
+	{
+		for (uint32 SortStep = SortLevel >> 1; SortStep > 0; SortStep >>= 1)
+		{
+			FGVRMSplatBitonicSortCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatBitonicSortCS::FParameters>();
+			PassParameters->SortLevel = SortLevel;
+			PassParameters->SortStep = SortStep;
+			PassParameters->SortCounters = SortCountersSRV;
+			PassParameters->RWSortKeys = GraphBuilder.CreateUAV(SortKeys);
+			PassParameters->RWSortValues = GraphBuilder.CreateUAV(SortValues);
+			PassParameters->IndirectArgs = SortArgs;
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSplatBitonicSort"), SortShader, PassParameters,
+				SortArgs, FGVRMSplatCullSplatsCS::SortArgsOffset);
+		}
+	}
+
+	return SortValues;
+}
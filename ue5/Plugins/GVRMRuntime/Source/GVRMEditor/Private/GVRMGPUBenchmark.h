@@ -0,0 +1,114 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphResources.h"
+#include "GVRMGPUInput.h"
+#include "GVRMSkinningMath.h"
+
+class FRDGBuilder;
+struct FGVRMSyntheticAvatar;
+struct FGVRMSplatGPUData;
+
+/** GPU stages of GVRMBenchmark */
+enum class EGVRMGPUStage : uint8
+{
+	/** Palette upload, instance cull and FGVRMSplatSkinningCS: every splat skins its own host vertex */
+	Skinning,
+
+	/** Same as Skinning with 64 active morph targets on the avatar's first 10k vertices (AccumulateMorphsCS first) */
+	SkinningMorphs,
+
+	/** One view's splat cull, sort args, sort keys and bitonic sort of the survivors (the splat component's draw passes up to the draw) */
+	CullAndSort,
+
+	/** Same as Skinning with the shared-vertex path: FGVRMSplatVertexSkinningCS skins each bound vertex once, the splat pass offsets from it */
+	SkinningShared,
+
+	/** FGVRMSplatCacheDecodeCS interpolating two frames of an animation cache baked from the same avatar (replaces Skinning) */
+	CacheDecode,
+
+	Num
+};
+
+/**
+ * GPU timings of the splat component's passes on a synthetic avatar.
+ *
+ * Drives the same shaders with the same pass setup as FGVRMSplatBatch and
+ * FGVRMSplatSceneProxy directly through RDG, without a scene, a view or
+ * project content. Every run builds one graph for a new pose, brackets its
+ * execution with timestamp queries and waits for the GPU, so a sample is the
+ * GPU time of that stage's passes alone. Inputs a stage only reads (skinned
+ * splats for the sort) are produced by an untimed graph first.
+ */
+class FGVRMGPUBenchmark
+{
+public:
+	static const TCHAR* GetStageName(EGVRMGPUStage Stage);
+
+	/** Whether this process can time GPU stages: an SM5 RHI with timestamp queries (not -nullrhi) */
+	static bool IsSupported();
+
+	~FGVRMGPUBenchmark();
+
+	/** Upload the avatar's streams, a face rig of morph targets and a two-frame animation cache baked from it; blocks until the render thread is done */
+	void Initialize(const FGVRMSyntheticAvatar& InAvatar, const FGVRMSplatGPUData& GPUData);
+
+	/** Release the uploaded streams; blocks until the render thread is done */
+	void Release();
+
+	int32 GetNumSplats() const { return NumSplats; }
+
+	/**
+	 * Run Stage Warmup + Iterations times, one pose of the avatar's scripted
+	 * animation per run, and return the GPU milliseconds of the timed runs.
+	 */
+	bool Run(EGVRMGPUStage Stage, int32 Warmup, int32 Iterations, TArray<double>& OutSamplesMs, FString& OutErrorMessage);
+
+private:
+	const FGVRMSyntheticAvatar* Avatar = nullptr;
+	int32 NumSplats = 0;
+
+	// Splat and mesh streams in the splat batch's formats
+	FGVRMGPUInput SplatVertexIndices;
+	FGVRMGPUInput SplatRelativePositions;
+	FGVRMGPUInput VertexPositions;
+	FGVRMGPUInput BoneIndices;
+	FGVRMGPUInput BoneWeights;
+	FGVRMGPUInput SplatScales;
+	FGVRMGPUInput SplatNormals;
+	FGVRMGPUInput UniqueVertexIndices;
+	FGVRMGPUInput SplatUniqueVertices;
+	uint32 NumUniqueVertices = 0;
+
+	// Face rig of the morph stage: deltas tagged with their vertex's slot, all morphs active
+	FGVRMGPUInput MorphVertexSlots;
+	FGVRMGPUInput MorphDeltas;
+	TArray<FGVRMActiveMorph> ActiveMorphs;
+	uint32 NumMorphSlots = 0;
+	uint32 NumMorphThreads = 0;
+
+	// Animation cache of the avatar's first two poses
+	FGVRMGPUInput CacheFrameData;
+	FGVRMGPUInput CacheBindPositions;
+	uint32 CacheSplatDataOffset = 0;
+	uint32 CacheFrameStride = 0;
+
+	// Bindable placeholders of the streams the synthetic avatar does not use
+	FGVRMGPUInput PlaceholderUint;
+	FGVRMGPUInput PlaceholderUint2;
+	FGVRMGPUInput PlaceholderUint4;
+	FGVRMGPUInput PlaceholderFloat4;
+
+	/** Skin one pose like FGVRMSplatBatch::AddSkinningPasses (one avatar, no view culling), per splat or through the shared vertices, with or without the morphs */
+	void AddSkinningPasses(FRDGBuilder& GraphBuilder, const TArray<FGVRMBoneMatrix3x4>& Palette, bool bSharedVertices, bool bMorphs,
+		FRDGBufferRef& OutPositions, FRDGBufferRef& OutRotations) const;
+
+	/** Decode like FGVRMSplatSceneProxy::AddCacheDecodePass; the run index picks the frame order */
+	void AddCacheDecodePass(FRDGBuilder& GraphBuilder, int32 RunIndex, FRDGBufferRef& OutPositions, FRDGBufferRef& OutRotations) const;
+
+	/** Cull and sort the skinned splats for a fixed camera like FGVRMSplatSceneProxy::AddDrawPasses; returns the sorted indices */
+	FRDGBufferRef AddCullAndSortPasses(FRDGBuilder& GraphBuilder, FRDGBufferRef Positions, FRDGBufferRef Rotations) const;
+};
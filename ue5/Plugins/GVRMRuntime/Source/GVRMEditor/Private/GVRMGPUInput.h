@@ -0,0 +1,49 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHI.h"
+#include "RHIResources.h"
+#include "RHICommandList.h"
+
+/**
+ * Static input of the editor's GPU runs (golden suite, GPU benchmark stages):
+ * a typed buffer and its SRV, like the splat batch's streams. Render thread.
+ */
+struct FGVRMGPUInput
+{
+	FBufferRHIRef Buffer;
+	FShaderResourceViewRHIRef SRV;
+
+	/** Upload Data; an empty array uploads one zeroed element so unused streams stay bindable */
+	template<typename ElementType>
+	static FGVRMGPUInput Upload(const TCHAR* DebugName, const TArray<ElementType>& Data, uint32 SRVStride, EPixelFormat SRVFormat)
+	{
+		TArray<ElementType> Placeholder;
+		if (Data.Num() == 0)
+		{
+			Placeholder.SetNumZeroed(1);
+		}
+		const TArray<ElementType>& Source = Data.Num() > 0 ? Data : Placeholder;
+
+		FGVRMGPUInput Input;
+		const uint32 NumBytes = Source.Num() * sizeof(ElementType);
+		FRHIResourceCreateInfo CreateInfo(DebugName);
+		Input.Buffer = RHICreateVertexBuffer(NumBytes, BUF_ShaderResource | BUF_Static, CreateInfo);
+
+		void* BufferData = RHILockBuffer(Input.Buffer, 0, NumBytes, RLM_WriteOnly);
+		FMemory::Memcpy(BufferData, Source.GetData(), NumBytes);
+		RHIUnlockBuffer(Input.Buffer);
+
+		Input.SRV = RHICreateShaderResourceView(Input.Buffer, SRVStride, SRVFormat);
+		return Input;
+	}
+
+	void SafeRelease()
+	{
+		SRV.SafeRelease();
+		Buffer.SafeRelease();
+	}
+};
@@ -0,0 +1,631 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMGoldenSuite.h"
+#include "GVRMGPUInput.h"
+#include "GVRMAnimationCache.h"
+#include "GVRMSplatShaders.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+
+namespace GVRMGolden
+{
+	constexpr uint32 FileMagic = 0x47565247; // 'GVRG'
+	constexpr int32 FileVersion = 2;
+
+	/** Influences per vertex in the fixture (both stream sets, and the packed bytes) */
+	constexpr int32 NumInfluences = 8;
+
+	/** Mismatches logged per case before summarizing */
+	constexpr int32 MaxLoggedMismatches = 8;
+
+	/** Float math against the double precision reference: rounding only */
+	constexpr float CPUPositionTolerance = 1.0e-3f;
+	constexpr float CPURotationTolerance = 1.0e-6f;
+
+	/** GPU math may contract, reorder and use approximate reciprocals */
+	constexpr float GPUPositionTolerance = 1.0e-2f;
+	constexpr float GPURotationTolerance = 1.0e-5f;
+
+	/** A few 16-bit position quantization steps of the animation cache's cluster ranges */
+	constexpr float CachePositionTolerance = 1.0e-2f;
+	constexpr float CacheRotationTolerance = 1.0e-5f;
+
+	template<typename ElementType>
+	bool ReadArray(FArchive& Reader, int32 ExpectedNum, TArray<ElementType>& OutArray)
+	{
+		Reader << OutArray;
+		return !Reader.IsError() && OutArray.Num() == ExpectedNum;
+	}
+}
+
+FString FGVRMGoldenSuite::GetDefaultFilePath()
+{
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GVRMRuntime"));
+	return FPaths::Combine(Plugin.IsValid() ? Plugin->GetBaseDir() : FPaths::ProjectDir(), TEXT("Resources"), TEXT("Golden"), TEXT("GVRMSkinningGolden.bin"));
+}
+
+const TCHAR* FGVRMGoldenSuite::GetCaseName(EGVRMGoldenCase Case)
+{
+	switch (Case)
+	{
+	case EGVRMGoldenCase::LBS: return TEXT("LBS");
+	case EGVRMGoldenCase::LBSRemap: return TEXT("LBSRemap");
+	case EGVRMGoldenCase::SIMD: return TEXT("SIMD");
+	case EGVRMGoldenCase::DQS: return TEXT("DQS");
+	case EGVRMGoldenCase::Quantized: return TEXT("Quantized");
+	case EGVRMGoldenCase::AnimationCache: return TEXT("AnimationCache");
+	case EGVRMGoldenCase::GPU: return TEXT("GPU");
+	case EGVRMGoldenCase::GPURemap: return TEXT("GPURemap");
+	default: return TEXT("Unknown");
+	}
+}
+
+bool FGVRMGoldenSuite::IsCaseSupported(EGVRMGoldenCase Case)
+{
+	if (Case == EGVRMGoldenCase::GPU || Case == EGVRMGoldenCase::GPURemap)
+	{
+		return !GUsingNullRHI && GMaxRHIFeatureLevel >= ERHIFeatureLevel::SM5;
+	}
+	return true;
+}
+
+bool FGVRMGoldenSuite::Load(const FString& FilePath, FString& OutErrorMessage)
+{
+	using namespace GVRMGolden;
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		OutErrorMessage = FString::Printf(TEXT("Failed to read %s (generate it with Tools/gvrm_golden.py)"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 Seed = 0;
+	Reader << Magic << Version << Seed;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		OutErrorMessage = FString::Printf(TEXT("%s is not a version %d golden file"), *FilePath, FileVersion);
+		return false;
+	}
+
+	Reader << NumBones << NumVertices << NumSplats << NumPoses;
+	if (Reader.IsError() || NumBones <= 0 || NumBones > MAX_uint8 + 1 || NumVertices <= 0 || NumSplats <= 0 || NumPoses <= 0)
+	{
+		OutErrorMessage = FString::Printf(TEXT("%s has an invalid fixture header"), *FilePath);
+		return false;
+	}
+
+	TArray<float> Positions;
+	TArray<int32> Indices;
+	TArray<float> Weights;
+	TArray<uint8> QuantizedWeights;
+	TArray<int32> Remaps;
+	TArray<float> RemapBlend;
+	TArray<float> RemapShift;
+	TArray<float> Relative;
+	TArray<float> Matrices;
+	const bool bFixtureRead = ReadArray(Reader, NumVertices * 3, Positions)
+		&& ReadArray(Reader, NumVertices * NumInfluences, Indices)
+		&& ReadArray(Reader, NumVertices * NumInfluences, Weights)
+		&& ReadArray(Reader, NumVertices * NumInfluences, QuantizedWeights)
+		&& ReadArray(Reader, NumVertices * 4, Remaps)
+		&& ReadArray(Reader, NumVertices * 4, RemapBlend)
+		&& ReadArray(Reader, NumVertices * 4, RemapShift)
+		&& ReadArray(Reader, NumSplats, SplatVertexIndices)
+		&& ReadArray(Reader, NumSplats * 3, Relative)
+		&& ReadArray(Reader, NumPoses * NumBones * 16, Matrices);
+	if (!bFixtureRead)
+	{
+		OutErrorMessage = FString::Printf(TEXT("%s has a truncated or mis-sized fixture"), *FilePath);
+		return false;
+	}
+
+	VertexPositions.SetNumUninitialized(NumVertices);
+	BoneIndices.SetNumUninitialized(NumVertices);
+	BoneWeights.SetNumUninitialized(NumVertices);
+	ExtraBoneIndices.SetNumUninitialized(NumVertices);
+	ExtraBoneWeights.SetNumUninitialized(NumVertices);
+	PackedSkinWeights.SetNumUninitialized(NumVertices * NumInfluences * 2);
+	RemapIndices.SetNumUninitialized(NumVertices);
+	RemapWeights.SetNumUninitialized(NumVertices);
+	RemapOffsets.SetNumUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	{
+		const int32* VertexIndices = &Indices[VertexIndex * NumInfluences];
+		const float* VertexWeights = &Weights[VertexIndex * NumInfluences];
+		VertexPositions[VertexIndex] = FVector3f(Positions[VertexIndex * 3], Positions[VertexIndex * 3 + 1], Positions[VertexIndex * 3 + 2]);
+		BoneIndices[VertexIndex] = FIntVector4(VertexIndices[0], VertexIndices[1], VertexIndices[2], VertexIndices[3]);
+		BoneWeights[VertexIndex] = FVector4f(VertexWeights[0], VertexWeights[1], VertexWeights[2], VertexWeights[3]);
+		ExtraBoneIndices[VertexIndex] = FIntVector4(VertexIndices[4], VertexIndices[5], VertexIndices[6], VertexIndices[7]);
+		ExtraBoneWeights[VertexIndex] = FVector4f(VertexWeights[4], VertexWeights[5], VertexWeights[6], VertexWeights[7]);
+
+		uint8* Packed = &PackedSkinWeights[VertexIndex * NumInfluences * 2];
+		for (int32 Influence = 0; Influence < NumInfluences; ++Influence)
+		{
+			if (VertexIndices[Influence] < 0 || VertexIndices[Influence] >= NumBones)
+			{
+				OutErrorMessage = FString::Printf(TEXT("%s: vertex %d references bone %d of %d"), *FilePath, VertexIndex, VertexIndices[Influence], NumBones);
+				return false;
+			}
+			Packed[Influence] = static_cast<uint8>(VertexIndices[Influence]);
+			Packed[NumInfluences + Influence] = QuantizedWeights[VertexIndex * NumInfluences + Influence];
+		}
+
+		const int32* Remap = &Remaps[VertexIndex * 4];
+		if (Remap[0] < 0 || Remap[0] >= NumVertices || Remap[1] < 0 || Remap[1] >= NumVertices || Remap[2] < 0 || Remap[2] >= NumVertices)
+		{
+			OutErrorMessage = FString::Printf(TEXT("%s: vertex %d has an out of range LOD remap"), *FilePath, VertexIndex);
+			return false;
+		}
+		RemapIndices[VertexIndex] = FIntVector4(Remap[0], Remap[1], Remap[2], Remap[3]);
+		RemapWeights[VertexIndex] = FVector4f(RemapBlend[VertexIndex * 4], RemapBlend[VertexIndex * 4 + 1], RemapBlend[VertexIndex * 4 + 2], RemapBlend[VertexIndex * 4 + 3]);
+		RemapOffsets[VertexIndex] = FVector4f(RemapShift[VertexIndex * 4], RemapShift[VertexIndex * 4 + 1], RemapShift[VertexIndex * 4 + 2], RemapShift[VertexIndex * 4 + 3]);
+	}
+
+	RelativePositions.SetNumUninitialized(NumSplats);
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		if (SplatVertexIndices[SplatIndex] < 0 || SplatVertexIndices[SplatIndex] >= NumVertices)
+		{
+			OutErrorMessage = FString::Printf(TEXT("%s: splat %d is bound to vertex %d of %d"), *FilePath, SplatIndex, SplatVertexIndices[SplatIndex], NumVertices);
+			return false;
+		}
+		RelativePositions[SplatIndex] = FVector3f(Relative[SplatIndex * 3], Relative[SplatIndex * 3 + 1], Relative[SplatIndex * 3 + 2]);
+	}
+
+	PoseMatrices.SetNum(NumPoses);
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		PoseMatrices[PoseIndex].SetNumUninitialized(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			FMemory::Memcpy(PoseMatrices[PoseIndex][BoneIndex].M, &Matrices[(PoseIndex * NumBones + BoneIndex) * 16], 16 * sizeof(float));
+		}
+	}
+
+	int32 NumReferences = 0;
+	Reader << NumReferences;
+	References.Reset();
+	for (int32 ReferenceIndex = 0; ReferenceIndex < NumReferences && !Reader.IsError(); ++ReferenceIndex)
+	{
+		FGVRMGoldenCase& Reference = References.AddDefaulted_GetRef();
+		TArray<float> ReferencePositions;
+		TArray<float> ReferenceRotations;
+		Reader << Reference.Name;
+		Reference.Reference = Reference.Name;
+		if (!ReadArray(Reader, NumSplats * NumPoses * 3, ReferencePositions) || !ReadArray(Reader, NumSplats * NumPoses * 4, ReferenceRotations))
+		{
+			break;
+		}
+
+		Reference.Positions.SetNumUninitialized(NumSplats * NumPoses);
+		Reference.Rotations.SetNumUninitialized(NumSplats * NumPoses);
+		FMemory::Memcpy(Reference.Positions.GetData(), ReferencePositions.GetData(), ReferencePositions.Num() * sizeof(float));
+		FMemory::Memcpy(Reference.Rotations.GetData(), ReferenceRotations.GetData(), ReferenceRotations.Num() * sizeof(float));
+	}
+
+	if (Reader.IsError() || References.Num() != NumReferences)
+	{
+		OutErrorMessage = FString::Printf(TEXT("%s has truncated reference outputs"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+GVRMSkinning::FSkinningStreams FGVRMGoldenSuite::MakeStreams(int32 PoseIndex, bool bUseRemap) const
+{
+	GVRMSkinning::FSkinningStreams Streams;
+	Streams.VertexPositions = VertexPositions;
+	Streams.BoneIndices = BoneIndices;
+	Streams.BoneWeights = BoneWeights;
+	Streams.ExtraBoneIndices = ExtraBoneIndices;
+	Streams.ExtraBoneWeights = ExtraBoneWeights;
+	Streams.BoneMatrices = PoseMatrices[PoseIndex];
+	Streams.NumInfluences = GVRMGolden::NumInfluences;
+	if (bUseRemap)
+	{
+		Streams.LODRemapIndices = RemapIndices;
+		Streams.LODRemapWeights = RemapWeights;
+		Streams.LODRemapOffsets = RemapOffsets;
+		Streams.NumRemapVertices = NumVertices;
+	}
+	return Streams;
+}
+
+void FGVRMGoldenSuite::SkinPose(int32 PoseIndex, bool bUseRemap, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations) const
+{
+	const GVRMSkinning::FSkinningStreams Streams = MakeStreams(PoseIndex, bUseRemap);
+	OutPositions.SetNumUninitialized(NumSplats);
+	OutRotations.SetNumUninitialized(NumSplats);
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		GVRMSkinning::SkinSplat(Streams, SplatVertexIndices[SplatIndex], RelativePositions[SplatIndex], OutPositions[SplatIndex], OutRotations[SplatIndex]);
+	}
+}
+
+bool FGVRMGoldenSuite::RunCase(EGVRMGoldenCase Case, FGVRMGoldenCase& OutCase, FString& OutErrorMessage) const
+{
+	using namespace GVRMGolden;
+
+	OutCase.Name = GetCaseName(Case);
+	OutCase.Positions.Reset(NumSplats * NumPoses);
+	OutCase.Rotations.Reset(NumSplats * NumPoses);
+	OutCase.PositionTolerance = CPUPositionTolerance;
+	OutCase.RotationTolerance = CPURotationTolerance;
+
+	if (NumSplats == 0)
+	{
+		OutErrorMessage = TEXT("No golden fixture loaded");
+		return false;
+	}
+
+	TArray<FVector3f> PosePositions;
+	TArray<FVector4f> PoseRotations;
+	PosePositions.SetNumUninitialized(NumSplats);
+	PoseRotations.SetNumUninitialized(NumSplats);
+
+	switch (Case)
+	{
+	case EGVRMGoldenCase::LBS:
+	case EGVRMGoldenCase::LBSRemap:
+		OutCase.Reference = Case == EGVRMGoldenCase::LBSRemap ? TEXT("LBSRemap") : TEXT("LBS");
+		for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			SkinPose(PoseIndex, Case == EGVRMGoldenCase::LBSRemap, PosePositions, PoseRotations);
+			OutCase.Positions.Append(PosePositions);
+			OutCase.Rotations.Append(PoseRotations);
+		}
+		return true;
+
+	case EGVRMGoldenCase::SIMD:
+	{
+		OutCase.Reference = TEXT("LBSRemap");
+		TArray<FVector4f> BoneRotations;
+		for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			const GVRMSkinning::FSkinningStreams Streams = MakeStreams(PoseIndex, true);
+			GVRMSkinning::ComputeBoneRotations(Streams.BoneMatrices, BoneRotations);
+			GVRMSkinning::DispatchInfluences(Streams.NumInfluences, [&](auto NumInfluences)
+			{
+				for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+				{
+					GVRMSkinning::SkinSplatVectorized<decltype(NumInfluences)::Value>(Streams, BoneRotations, SplatVertexIndices[SplatIndex], RelativePositions[SplatIndex],
+						PosePositions[SplatIndex], PoseRotations[SplatIndex]);
+				}
+			});
+			OutCase.Positions.Append(PosePositions);
+			OutCase.Rotations.Append(PoseRotations);
+		}
+		return true;
+	}
+
+	case EGVRMGoldenCase::DQS:
+		OutCase.Reference = TEXT("DQS");
+		for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			const GVRMSkinning::FSkinningStreams Streams = MakeStreams(PoseIndex, false);
+			for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+			{
+				GVRMSkinning::SkinSplatDualQuat(Streams, SplatVertexIndices[SplatIndex], RelativePositions[SplatIndex], PosePositions[SplatIndex], PoseRotations[SplatIndex]);
+			}
+			OutCase.Positions.Append(PosePositions);
+			OutCase.Rotations.Append(PoseRotations);
+		}
+		return true;
+
+	case EGVRMGoldenCase::Quantized:
+	{
+		OutCase.Reference = TEXT("Quantized");
+
+		// Decode the packed bytes the way the Niagara data interface reads an 8-bit skin weight buffer
+		GVRMSkinning::FPackedSkinWeights Packed;
+		Packed.Data = PackedSkinWeights.GetData();
+		Packed.VertexStride = NumInfluences * 2;
+		Packed.NumInfluences = NumInfluences;
+		Packed.WeightOffset = NumInfluences;
+
+		TArray<FIntVector4> DecodedIndices;
+		TArray<FVector4f> DecodedWeights;
+		TArray<FIntVector4> DecodedExtraIndices;
+		TArray<FVector4f> DecodedExtraWeights;
+		DecodedIndices.SetNumUninitialized(NumVertices);
+		DecodedWeights.SetNumUninitialized(NumVertices);
+		DecodedExtraIndices.SetNumUninitialized(NumVertices);
+		DecodedExtraWeights.SetNumUninitialized(NumVertices);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			int32 Indices[NumInfluences];
+			float Weights[NumInfluences];
+			GVRMSkinning::UnpackSkinWeights(Packed, VertexIndex, NumInfluences, Indices, Weights);
+			DecodedIndices[VertexIndex] = FIntVector4(Indices[0], Indices[1], Indices[2], Indices[3]);
+			DecodedWeights[VertexIndex] = FVector4f(Weights[0], Weights[1], Weights[2], Weights[3]);
+			DecodedExtraIndices[VertexIndex] = FIntVector4(Indices[4], Indices[5], Indices[6], Indices[7]);
+			DecodedExtraWeights[VertexIndex] = FVector4f(Weights[4], Weights[5], Weights[6], Weights[7]);
+		}
+
+		for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			GVRMSkinning::FSkinningStreams Streams = MakeStreams(PoseIndex, false);
+			Streams.BoneIndices = DecodedIndices;
+			Streams.BoneWeights = DecodedWeights;
+			Streams.ExtraBoneIndices = DecodedExtraIndices;
+			Streams.ExtraBoneWeights = DecodedExtraWeights;
+			for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+			{
+				GVRMSkinning::SkinSplat(Streams, SplatVertexIndices[SplatIndex], RelativePositions[SplatIndex], PosePositions[SplatIndex], PoseRotations[SplatIndex]);
+			}
+			OutCase.Positions.Append(PosePositions);
+			OutCase.Rotations.Append(PoseRotations);
+		}
+		return true;
+	}
+
+	case EGVRMGoldenCase::AnimationCache:
+	{
+		OutCase.Reference = TEXT("LBS");
+		OutCase.PositionTolerance = CachePositionTolerance;
+		OutCase.RotationTolerance = CacheRotationTolerance;
+
+		// Pose 0 of the fixture is the bind pose
+		TArray<FVector3f> BindPositions;
+		TArray<FVector4f> BindRotations;
+		SkinPose(0, false, BindPositions, BindRotations);
+
+		UGVRMAnimationCache* Cache = NewObject<UGVRMAnimationCache>(GetTransientPackage());
+		const bool bEncoded = Cache->EncodeFrames(MoveTemp(BindPositions), NumPoses, 30.0f,
+			[this](int32 FrameIndex, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations)
+			{
+				SkinPose(FrameIndex, false, OutPositions, OutRotations);
+			},
+			OutErrorMessage);
+		if (!bEncoded)
+		{
+			return false;
+		}
+
+		for (int32 FrameIndex = 0; FrameIndex < NumPoses; ++FrameIndex)
+		{
+			if (!Cache->DecodeFrame(FrameIndex, PosePositions, PoseRotations))
+			{
+				OutErrorMessage = FString::Printf(TEXT("Failed to decode cache frame %d"), FrameIndex);
+				return false;
+			}
+			OutCase.Positions.Append(PosePositions);
+			OutCase.Rotations.Append(PoseRotations);
+		}
+		return true;
+	}
+
+	case EGVRMGoldenCase::GPU:
+	case EGVRMGoldenCase::GPURemap:
+		OutCase.Reference = Case == EGVRMGoldenCase::GPURemap ? TEXT("LBSRemap") : TEXT("LBS");
+		OutCase.PositionTolerance = GPUPositionTolerance;
+		OutCase.RotationTolerance = GPURotationTolerance;
+		if (!IsCaseSupported(Case))
+		{
+			OutErrorMessage = TEXT("The GPU cases need an SM5 RHI (not -nullrhi)");
+			return false;
+		}
+		return RunGPUCase(Case == EGVRMGoldenCase::GPURemap, OutCase, OutErrorMessage);
+
+	default:
+		OutErrorMessage = TEXT("Unknown golden case");
+		return false;
+	}
+}
+
+bool FGVRMGoldenSuite::RunGPUCase(bool bUseRemap, FGVRMGoldenCase& OutCase, FString& OutErrorMessage) const
+{
+	bool bSucceeded = true;
+
+	// Everything below runs on the render thread; the flush keeps this frame's references alive
+	ENQUEUE_RENDER_COMMAND(GVRMGoldenSkinSplats)([this, bUseRemap, &OutCase, &bSucceeded, &OutErrorMessage](FRHICommandListImmediate& RHICmdList)
+	{
+		using namespace GVRMGolden;
+
+		TArray<FVector4f> SplatRelativePositions;
+		SplatRelativePositions.Reserve(NumSplats);
+		for (const FVector3f& RelativePosition : RelativePositions)
+		{
+			SplatRelativePositions.Add(FVector4f(RelativePosition, 0.0f));
+		}
+
+		// Same formats as the splat batch's combined streams; rigid, shared vertex and morph streams stay unused
+		const FGVRMGPUInput SplatVertexIndicesInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenSplatVertexIndices"), SplatVertexIndices, sizeof(int32), PF_R32_SINT);
+		const FGVRMGPUInput RelativePositionsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenSplatRelativePositions"), SplatRelativePositions, sizeof(FVector4f), PF_A32B32G32R32F);
+		const FGVRMGPUInput VertexPositionsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenMeshPositions"), VertexPositions, sizeof(float), PF_R32_FLOAT);
+		const FGVRMGPUInput BoneIndicesInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenBoneIndices"), BoneIndices, sizeof(FIntVector4), PF_R32G32B32A32_UINT);
+		const FGVRMGPUInput BoneWeightsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenBoneWeights"), BoneWeights, sizeof(FVector4f), PF_A32B32G32R32F);
+		const FGVRMGPUInput ExtraBoneIndicesInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenExtraBoneIndices"), ExtraBoneIndices, sizeof(FIntVector4), PF_R32G32B32A32_UINT);
+		const FGVRMGPUInput ExtraBoneWeightsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenExtraBoneWeights"), ExtraBoneWeights, sizeof(FVector4f), PF_A32B32G32R32F);
+		const FGVRMGPUInput RemapIndicesInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenLODRemapIndices"), RemapIndices, sizeof(FIntVector4), PF_R32G32B32A32_UINT);
+		const FGVRMGPUInput RemapWeightsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenLODRemapWeights"), RemapWeights, sizeof(FVector4f), PF_A32B32G32R32F);
+		const FGVRMGPUInput RemapOffsetsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenLODRemapOffsets"), RemapOffsets, sizeof(FVector4f), PF_A32B32G32R32F);
+		const FGVRMGPUInput RigidSplatOrderInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenRigidSplatOrder"), TArray<uint32>(), sizeof(uint32), PF_R32_UINT);
+		const FGVRMGPUInput RigidHostPositionsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenRigidHostPositions"), TArray<FVector4f>(), sizeof(FVector4f), PF_A32B32G32R32F);
+		const FGVRMGPUInput RigidBonesInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenRigidBones"), TArray<FUintVector2>(), sizeof(FUintVector2), PF_R32G32_UINT);
+		const FGVRMGPUInput SplatUniqueVerticesInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenSplatUniqueVertices"), TArray<uint32>(), sizeof(uint32), PF_R32_UINT);
+		const FGVRMGPUInput MorphVertexSlotsInput = FGVRMGPUInput::Upload(TEXT("GVRMGoldenMorphVertexSlots"), TArray<uint32>(), sizeof(uint32), PF_R32_UINT);
+
+		// One LBS instance, skinned in a single pass (no shared vertices, no morphs)
+		FGVRMSplatBatchInstance Instance;
+		Instance.NumSplats = NumSplats;
+		Instance.NumRemapVertices = bUseRemap ? NumVertices : 0;
+		const FVector4f CullPlane = FVector4f::Zero();
+
+		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+		FGVRMSplatSkinningCS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<FGVRMNumInfluencesDim>(GVRMSkinning::GetInfluencePermutation(NumInfluences));
+		TShaderMapRef<FGVRMSplatCullInstancesCS> CullShader(ShaderMap);
+		TShaderMapRef<FGVRMSplatSkinningCS> SkinningShader(ShaderMap, PermutationVector);
+		if (!CullShader.IsValid() || !SkinningShader.IsValid())
+		{
+			OutErrorMessage = TEXT("The GVRM splat skinning shaders are not compiled for this platform");
+			bSucceeded = false;
+			return;
+		}
+
+		TArray<FGVRMBoneMatrix3x4> Palette;
+		Palette.SetNumUninitialized(NumBones);
+		const uint32 NumOutputBytes = NumSplats * sizeof(FVector4f);
+
+		for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			GVRMSkinning::PackBoneMatrices(PoseMatrices[PoseIndex], Palette);
+
+			FRDGBuilder GraphBuilder(RHICmdList);
+			FRDGBufferRef InstancesBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRMGolden.Instances"),
+				sizeof(FGVRMSplatBatchInstance), 1, &Instance, sizeof(FGVRMSplatBatchInstance));
+			FRDGBufferRef CullPlanesBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRMGolden.CullPlanes"),
+				sizeof(FVector4f), 1, &CullPlane, sizeof(FVector4f));
+			FRDGBufferRef PaletteBuffer = CreateVertexBuffer(GraphBuilder, TEXT("GVRMGolden.BoneMatrices"),
+				FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), Palette.Num() * 3), Palette.GetData(), Palette.Num() * sizeof(FGVRMBoneMatrix3x4));
+
+			FRDGBufferRef VisibleInstances = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FUintVector4), 1), TEXT("GVRMGolden.VisibleInstances"));
+			FRDGBufferRef BatchCounters = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 3), TEXT("GVRMGolden.BatchCounters"));
+			FRDGBufferRef SkinningArgs = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(2), TEXT("GVRMGolden.SkinningArgs"));
+
+			// The batch's own cull pass writes the indirect args and counters the skinning pass reads
+			{
+				FGVRMSplatCullInstancesCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatCullInstancesCS::FParameters>();
+				PassParameters->NumInstances = 1;
+				PassParameters->NumCullViews = 0;
+				PassParameters->MaxDispatchGroups = GRHIMaxDispatchThreadGroupsPerDimension.X;
+				PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+				PassParameters->CullPlanes = GraphBuilder.CreateSRV(CullPlanesBuffer);
+				PassParameters->RWVisibleInstances = GraphBuilder.CreateUAV(VisibleInstances);
+				PassParameters->RWSkinningArgs = GraphBuilder.CreateUAV(SkinningArgs, PF_R32_UINT);
+				PassParameters->RWBatchCounters = GraphBuilder.CreateUAV(BatchCounters);
+				FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMGoldenCullInstances"), CullShader, PassParameters, FIntVector(1, 1, 1));
+			}
+
+			FRDGBufferRef MorphOffsetsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(int32), 3), TEXT("GVRMGolden.MorphOffsets"));
+			FRDGBufferRef SharedPositionsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), 1), TEXT("GVRMGolden.SharedVertexPositions"));
+			FRDGBufferRef SharedRotationsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), 1), TEXT("GVRMGolden.SharedVertexRotations"));
+			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(MorphOffsetsBuffer, PF_R32_SINT), 0u);
+			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(SharedPositionsBuffer), 0u);
+			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(SharedRotationsBuffer), 0u);
+
+			FRDGBufferRef PositionsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRMGolden.SkinnedPositions"));
+			FRDGBufferRef RotationsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRMGolden.SkinnedRotations"));
+			{
+				FGVRMSplatSkinningCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatSkinningCS::FParameters>();
+				PassParameters->SplatVertexIndices = SplatVertexIndicesInput.SRV;
+				PassParameters->SplatRelativePositions = RelativePositionsInput.SRV;
+				PassParameters->VertexPositions = VertexPositionsInput.SRV;
+				PassParameters->BoneIndices = BoneIndicesInput.SRV;
+				PassParameters->BoneWeights = BoneWeightsInput.SRV;
+				PassParameters->ExtraBoneIndices = ExtraBoneIndicesInput.SRV;
+				PassParameters->ExtraBoneWeights = ExtraBoneWeightsInput.SRV;
+				PassParameters->BoneMatrices = GraphBuilder.CreateSRV(PaletteBuffer, PF_A32B32G32R32F);
+				PassParameters->LODRemapIndices = RemapIndicesInput.SRV;
+				PassParameters->LODRemapWeights = RemapWeightsInput.SRV;
+				PassParameters->LODRemapOffsets = RemapOffsetsInput.SRV;
+				PassParameters->RigidSplatOrder = RigidSplatOrderInput.SRV;
+				PassParameters->RigidHostPositions = RigidHostPositionsInput.SRV;
+				PassParameters->RigidBones = RigidBonesInput.SRV;
+				PassParameters->SplatUniqueVertices = SplatUniqueVerticesInput.SRV;
+				PassParameters->MorphVertexSlots = MorphVertexSlotsInput.SRV;
+				PassParameters->MorphOffsets = GraphBuilder.CreateSRV(MorphOffsetsBuffer, PF_R32_SINT);
+				PassParameters->SharedVertexPositions = GraphBuilder.CreateSRV(SharedPositionsBuffer);
+				PassParameters->SharedVertexRotations = GraphBuilder.CreateSRV(SharedRotationsBuffer);
+				PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+				PassParameters->VisibleInstances = GraphBuilder.CreateSRV(VisibleInstances);
+				PassParameters->BatchCounters = GraphBuilder.CreateSRV(BatchCounters);
+				PassParameters->RWSkinnedPositions = GraphBuilder.CreateUAV(PositionsBuffer);
+				PassParameters->RWSkinnedRotations = GraphBuilder.CreateUAV(RotationsBuffer);
+				PassParameters->IndirectArgs = SkinningArgs;
+				FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMGoldenSkinSplats (pose %d)", PoseIndex),
+					SkinningShader, PassParameters, SkinningArgs, FGVRMSplatCullInstancesCS::SplatPassArgsOffset);
+			}
+
+			FRHIGPUBufferReadback PositionsReadback(TEXT("GVRMGolden.PositionsReadback"));
+			FRHIGPUBufferReadback RotationsReadback(TEXT("GVRMGolden.RotationsReadback"));
+			AddEnqueueCopyPass(GraphBuilder, &PositionsReadback, PositionsBuffer, NumOutputBytes);
+			AddEnqueueCopyPass(GraphBuilder, &RotationsReadback, RotationsBuffer, NumOutputBytes);
+			GraphBuilder.Execute();
+
+			RHICmdList.SubmitCommandsAndFlushGPU();
+			RHICmdList.BlockUntilGPUIdle();
+			if (!PositionsReadback.IsReady() || !RotationsReadback.IsReady())
+			{
+				OutErrorMessage = FString::Printf(TEXT("Readback of pose %d did not complete"), PoseIndex);
+				bSucceeded = false;
+				return;
+			}
+
+			const FVector4f* Positions = static_cast<const FVector4f*>(PositionsReadback.Lock(NumOutputBytes));
+			for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+			{
+				OutCase.Positions.Add(FVector3f(Positions[SplatIndex]));
+			}
+			PositionsReadback.Unlock();
+
+			const FVector4f* Rotations = static_cast<const FVector4f*>(RotationsReadback.Lock(NumOutputBytes));
+			OutCase.Rotations.Append(Rotations, NumSplats);
+			RotationsReadback.Unlock();
+		}
+	});
+	FlushRenderingCommands();
+
+	return bSucceeded;
+}
+
+int32 FGVRMGoldenSuite::Compare(const FGVRMGoldenCase& Actual) const
+{
+	const FGVRMGoldenCase* Expected = References.FindByPredicate([&Actual](const FGVRMGoldenCase& Reference) { return Reference.Name == Actual.Reference; });
+	if (!Expected)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMGolden - %s: the golden file has no %s reference"), *Actual.Name, *Actual.Reference);
+		return FMath::Max(Actual.Positions.Num(), 1);
+	}
+
+	if (Expected->Positions.Num() != Actual.Positions.Num() || Expected->Rotations.Num() != Actual.Rotations.Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMGolden - %s: %d reference splat samples, %d produced"), *Actual.Name, Expected->Positions.Num(), Actual.Positions.Num());
+		return FMath::Max(Expected->Positions.Num(), 1);
+	}
+
+	int32 NumMismatches = 0;
+	float MaxPositionError = 0.0f;
+	float MaxRotationError = 0.0f;
+
+	for (int32 SampleIndex = 0; SampleIndex < Expected->Positions.Num(); ++SampleIndex)
+	{
+		const float PositionError = FVector3f::Distance(Expected->Positions[SampleIndex], Actual.Positions[SampleIndex]);
+
+		const FVector4f& ExpectedRotation = Expected->Rotations[SampleIndex];
+		const FVector4f& ActualRotation = Actual.Rotations[SampleIndex];
+		const float Dot = ExpectedRotation.X * ActualRotation.X + ExpectedRotation.Y * ActualRotation.Y + ExpectedRotation.Z * ActualRotation.Z + ExpectedRotation.W * ActualRotation.W;
+		const float RotationError = 1.0f - FMath::Abs(Dot);
+
+		MaxPositionError = FMath::Max(MaxPositionError, PositionError);
+		MaxRotationError = FMath::Max(MaxRotationError, RotationError);
+
+		// Negated comparisons so NaNs count as mismatches
+		if (!(PositionError <= Actual.PositionTolerance) || !(RotationError <= Actual.RotationTolerance))
+		{
+			if (NumMismatches < GVRMGolden::MaxLoggedMismatches)
+			{
+				UE_LOG(LogTemp, Error, TEXT("GVRMGolden - %s: pose %d splat %d position error %.6f cm, rotation error %.3g"),
+					*Actual.Name, SampleIndex / NumSplats, SampleIndex % NumSplats, PositionError, RotationError);
+			}
+			++NumMismatches;
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("GVRMGolden - %-14s %s  vs %-9s max position error %.6f cm (tolerance %.6f), max rotation error %.3g (tolerance %.3g), %d mismatches"),
+		*Actual.Name, NumMismatches == 0 ? TEXT("PASS") : TEXT("FAIL"), *Actual.Reference, MaxPositionError, Actual.PositionTolerance,
+		MaxRotationError, Actual.RotationTolerance, NumMismatches);
+	return NumMismatches;
+}
@@ -0,0 +1,128 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GVRMSkinningMath.h"
+
+/** Skinning paths covered by the golden suite */
+enum class EGVRMGoldenCase : uint8
+{
+	/** GVRMSkinning::SkinSplat on LOD0 vertices (8 influences) */
+	LBS,
+
+	/** Same, through the fixture's LOD remap (three corners, barycentric weights, offsets) */
+	LBSRemap,
+
+	/** GVRMSkinning::SkinSplatVectorized through the LOD remap */
+	SIMD,
+
+	/** GVRMSkinning::SkinSplatDualQuat on LOD0 vertices */
+	DQS,
+
+	/** SkinSplat on 8-bit weights packed like the engine's skin weight buffer and decoded by UnpackSkinWeights */
+	Quantized,
+
+	/** LBS frames through the animation cache encoder and decoder */
+	AnimationCache,
+
+	/** SkinSplatsCS (FGVRMSplatSkinningCS) dispatched through RDG after the instance cull, read back */
+	GPU,
+
+	/** Same, through the LOD remap */
+	GPURemap,
+
+	Num
+};
+
+/** Skinned splats of one case (or one reference) over all golden poses */
+struct FGVRMGoldenCase
+{
+	FString Name;
+
+	/** Reference output the case is compared against */
+	FString Reference;
+
+	/** Allowed position difference (cm) */
+	float PositionTolerance = 0.0f;
+
+	/** Allowed rotation difference (1 - |dot|) */
+	float RotationTolerance = 0.0f;
+
+	TArray<FVector3f> Positions;
+	TArray<FVector4f> Rotations;
+};
+
+/**
+ * Golden-output regression suite for the skinning math.
+ *
+ * The golden file holds a fixed synthetic avatar (bone palettes of a few poses,
+ * 8-influence skin weights with their 8-bit quantization, a LOD remap, splats)
+ * and its skinned splats computed in double precision by Tools/gvrm_golden.py,
+ * independently of this code. Every case skins the avatar through one CPU or
+ * GPU path and must land within its tolerances of the matching reference, so
+ * drift in the skinning math, LOD remap, weight decoding or cache codec shows
+ * up without project content. Run by the GVRM.Skinning.Golden automation tests
+ * and by GVRMBenchmark -Golden (timed).
+ */
+class FGVRMGoldenSuite
+{
+public:
+	/** Resources/Golden/GVRMSkinningGolden.bin in the plugin */
+	static FString GetDefaultFilePath();
+
+	static const TCHAR* GetCaseName(EGVRMGoldenCase Case);
+
+	/** Whether the case can run in this process (the GPU cases need an SM5 RHI, so not with -nullrhi) */
+	static bool IsCaseSupported(EGVRMGoldenCase Case);
+
+	/** Read the fixture and reference outputs */
+	bool Load(const FString& FilePath, FString& OutErrorMessage);
+
+	int32 GetNumSplats() const { return NumSplats; }
+	int32 GetNumPoses() const { return NumPoses; }
+
+	/** Skin every pose of one case */
+	bool RunCase(EGVRMGoldenCase Case, FGVRMGoldenCase& OutCase, FString& OutErrorMessage) const;
+
+	/** Compare a run against its reference with the run's tolerances; logs mismatching splats and returns their count */
+	int32 Compare(const FGVRMGoldenCase& Actual) const;
+
+private:
+	int32 NumBones = 0;
+	int32 NumVertices = 0;
+	int32 NumSplats = 0;
+	int32 NumPoses = 0;
+
+	// Mesh streams (bind pose, component space), influences 4 to 7 in the Extra streams
+	TArray<FVector3f> VertexPositions;
+	TArray<FIntVector4> BoneIndices;
+	TArray<FVector4f> BoneWeights;
+	TArray<FIntVector4> ExtraBoneIndices;
+	TArray<FVector4f> ExtraBoneWeights;
+
+	/** The same influences in the engine's packed layout: 8 bone indices then 8 weights, one byte each */
+	TArray<uint8> PackedSkinWeights;
+
+	// LOD remap per vertex
+	TArray<FIntVector4> RemapIndices;
+	TArray<FVector4f> RemapWeights;
+	TArray<FVector4f> RemapOffsets;
+
+	// Splats
+	TArray<int32> SplatVertexIndices;
+	TArray<FVector3f> RelativePositions;
+
+	/** Skinning palette of every golden pose */
+	TArray<TArray<FMatrix44f>> PoseMatrices;
+
+	/** Reference outputs by name (LBS, LBSRemap, DQS, Quantized) */
+	TArray<FGVRMGoldenCase> References;
+
+	GVRMSkinning::FSkinningStreams MakeStreams(int32 PoseIndex, bool bUseRemap) const;
+
+	void SkinPose(int32 PoseIndex, bool bUseRemap, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations) const;
+
+	bool RunGPUCase(bool bUseRemap, FGVRMGoldenCase& OutCase, FString& OutErrorMessage) const;
+};
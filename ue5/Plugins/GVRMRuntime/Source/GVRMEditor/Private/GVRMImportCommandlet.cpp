@@ -0,0 +1,97 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMImportCommandlet.h"
+#include "GVRMSkinningData.h"
+#include "Engine/SkeletalMesh.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UGVRMImportCommandlet::UGVRMImportCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGVRMImportCommandlet::Main(const FString& Params)
+{
+	FString InputDir;
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Input="), InputDir) || !FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMImport - -Input=ConverterOutputDir and -Output=/Game/Path/Asset are required"));
+		return 1;
+	}
+	OutputPath = FPackageName::ObjectPathToPackageName(OutputPath);
+
+	USkeletalMesh* SkeletalMesh = nullptr;
+	FString SkeletalMeshPath;
+	if (FParse::Value(*Params, TEXT("SkeletalMesh="), SkeletalMeshPath))
+	{
+		SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, *SkeletalMeshPath);
+		if (!SkeletalMesh)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMImport - Failed to load skeletal mesh %s"), *SkeletalMeshPath);
+			return 1;
+		}
+	}
+
+	UPackage* Package = CreatePackage(*OutputPath);
+	UGVRMBindingData* BindingData = NewObject<UGVRMBindingData>(Package, FName(*FPackageName::GetShortName(OutputPath)), RF_Public | RF_Standalone);
+	BindingData->SourceSkeletalMesh = SkeletalMesh;
+
+	// The mesh data is built by ImportFromCSV once the host vertices are known
+	FString Message;
+	if (!BindingData->ImportFromCSV(FPaths::Combine(InputDir, TEXT("splat_binding.csv")), Message))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMImport - %s"), *Message);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("GVRMImport - %s"), *Message);
+
+	const FString MetadataPath = FPaths::Combine(InputDir, TEXT("metadata.json"));
+	if (IFileManager::Get().FileExists(*MetadataPath))
+	{
+		if (!BindingData->ImportMetadataFromJSON(MetadataPath, Message))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMImport - %s"), *Message);
+			return 1;
+		}
+		UE_LOG(LogTemp, Display, TEXT("GVRMImport - Metadata: %s"), *Message);
+	}
+
+	const FString PLYPath = FPaths::Combine(InputDir, TEXT("model.ply"));
+	if (IFileManager::Get().FileExists(*PLYPath))
+	{
+		if (!BindingData->ImportGaussiansFromPLY(PLYPath, Message))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMImport - %s"), *Message);
+			return 1;
+		}
+		UE_LOG(LogTemp, Display, TEXT("GVRMImport - %s"), *Message);
+	}
+
+	if (!BindingData->ValidateBindings(Message))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMImport - Imported bindings are invalid: %s"), *Message);
+		return 1;
+	}
+
+	Package->MarkPackageDirty();
+	const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	if (!UPackage::SavePackage(Package, BindingData, *Filename, SaveArgs))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMImport - Failed to save %s"), *Filename);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("GVRMImport - Saved %d splats to %s"), BindingData->GetSplatCount(), *Filename);
+
+	return 0;
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSimplifyCommandlet.h"
+#include "GVRMSplatSimplifier.h"
+#include "GVRMSkinningData.h"
+#include "NiagaraDataInterfaceGVRM.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace GVRMSimplifyCommandlet
+{
+	bool WriteReport(const FString& FilePath, const FString& Source, const FString& Output, const FGVRMSplatSimplifySettings& Settings,
+		const FGVRMSplatSimplifyReport& Report)
+	{
+		TSharedRef<FJsonObject> SettingsObject = MakeShared<FJsonObject>();
+		SettingsObject->SetNumberField(TEXT("MinOpacity"), Settings.MinOpacity);
+		SettingsObject->SetNumberField(TEXT("MinScale"), Settings.MinScale);
+		SettingsObject->SetNumberField(TEXT("MaxMergeCost"), Settings.MaxMergeCost);
+		SettingsObject->SetNumberField(TEXT("MaxColorDistance"), Settings.MaxColorDistance);
+		SettingsObject->SetNumberField(TEXT("NeighbourScale"), Settings.NeighbourScale);
+		SettingsObject->SetNumberField(TEXT("MaxPasses"), Settings.MaxPasses);
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("Source"), Source);
+		Root->SetStringField(TEXT("Output"), Output);
+		Root->SetObjectField(TEXT("Settings"), SettingsObject);
+		Root->SetNumberField(TEXT("InputSplats"), Report.NumInputSplats);
+		Root->SetNumberField(TEXT("OutputSplats"), Report.NumOutputSplats);
+		Root->SetNumberField(TEXT("Reduction"), Report.GetReduction());
+		Root->SetNumberField(TEXT("DroppedSplats"), Report.NumDroppedSplats);
+		Root->SetNumberField(TEXT("Merges"), Report.NumMerges);
+		Root->SetNumberField(TEXT("InputVertices"), Report.NumInputVertices);
+		Root->SetNumberField(TEXT("OutputVertices"), Report.NumOutputVertices);
+		Root->SetNumberField(TEXT("DroppedMassFraction"), Report.DroppedMassFraction);
+		Root->SetNumberField(TEXT("TotalMergeCost"), Report.TotalMergeCost);
+		Root->SetNumberField(TEXT("MaxMergeCost"), Report.MaxMergeCost);
+		Root->SetNumberField(TEXT("RMSMergeDisplacement"), Report.RMSMergeDisplacement);
+
+		FString Contents;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Contents);
+		FJsonSerializer::Serialize(Root, Writer);
+		return FFileHelper::SaveStringToFile(Contents, *FilePath);
+	}
+}
+
+UGVRMSimplifyCommandlet::UGVRMSimplifyCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGVRMSimplifyCommandlet::Main(const FString& Params)
+{
+	FString SourcePath;
+	if (!FParse::Value(*Params, TEXT("BindingData="), SourcePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMSimplify - -BindingData=/Game/Path/Asset is required"));
+		return 1;
+	}
+
+	UGVRMBindingData* Source = LoadObject<UGVRMBindingData>(nullptr, *SourcePath);
+	if (!Source)
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMSimplify - Failed to load binding data %s"), *SourcePath);
+		return 1;
+	}
+	Source->LoadSplatStreams();
+
+	FGVRMSplatSimplifySettings Settings;
+	FParse::Value(*Params, TEXT("MinOpacity="), Settings.MinOpacity);
+	FParse::Value(*Params, TEXT("MinScale="), Settings.MinScale);
+	FParse::Value(*Params, TEXT("MaxMergeCost="), Settings.MaxMergeCost);
+	FParse::Value(*Params, TEXT("MaxColorDistance="), Settings.MaxColorDistance);
+	FParse::Value(*Params, TEXT("NeighbourScale="), Settings.NeighbourScale);
+	FParse::Value(*Params, TEXT("MaxPasses="), Settings.MaxPasses);
+	Settings.MaxPasses = FMath::Max(Settings.MaxPasses, 0);
+
+	// Bind positions of the LOD0 vertices, from the same streams the runtime reads
+	USkeletalMesh* SkeletalMesh = nullptr;
+	FNiagaraDataInterfaceGVRMInstanceData MeshStreams;
+	FString SkeletalMeshPath;
+	if (FParse::Value(*Params, TEXT("SkeletalMesh="), SkeletalMeshPath))
+	{
+		SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, *SkeletalMeshPath);
+		FSkeletalMeshRenderData* RenderData = SkeletalMesh ? SkeletalMesh->GetResourceForRendering() : nullptr;
+		if (!RenderData || RenderData->LODRenderData.Num() == 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GVRMSimplify - Failed to load skeletal mesh %s or it has no render data"), *SkeletalMeshPath);
+			return 1;
+		}
+		MeshStreams.CacheLODStreams(RenderData->LODRenderData[0], GVRMSkinning::MaxBoneInfluences, Source, nullptr);
+	}
+
+	// The simplified splats go to a copy unless the output is the source itself
+	FString OutputPath = FPackageName::ObjectPathToPackageName(SourcePath) + TEXT("_Simplified");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	OutputPath = FPackageName::ObjectPathToPackageName(OutputPath);
+
+	UGVRMBindingData* Output = Source;
+	UPackage* Package = Source->GetOutermost();
+	if (OutputPath != Package->GetName())
+	{
+		Package = CreatePackage(*OutputPath);
+		Output = DuplicateObject<UGVRMBindingData>(Source, Package, FName(*FPackageName::GetShortName(OutputPath)));
+		Output->SetFlags(RF_Public | RF_Standalone);
+	}
+
+	FGVRMSplatSimplifyReport Report;
+	FString Message;
+	if (!FGVRMSplatSimplifier::Simplify(*Output, MeshStreams.CachedVertexPositions, Settings, Report, Message))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMSimplify - %s: %s"), *SourcePath, *Message);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("GVRMSimplify - %s: %s"), *SourcePath, *Message);
+
+	// Merged splats have new host vertices: LOD remaps, rigid bindings and palette follow them
+	if (SkeletalMesh)
+	{
+		const bool bMeshDataBuilt = Output->BuildMeshData(SkeletalMesh, Message);
+		UE_LOG(LogTemp, Display, TEXT("GVRMSimplify - %s"), *Message);
+		if (!bMeshDataBuilt)
+		{
+			return 1;
+		}
+	}
+
+	if (!Output->ValidateBindings(Message))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMSimplify - Simplified bindings are invalid: %s"), *Message);
+		return 1;
+	}
+
+	Package->MarkPackageDirty();
+	const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	if (!UPackage::SavePackage(Package, Output, *Filename, SaveArgs))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMSimplify - Failed to save %s"), *Filename);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("GVRMSimplify - Saved %d splats to %s"), Output->GetSplatCount(), *Filename);
+
+	FString ReportPath;
+	if (FParse::Value(*Params, TEXT("Report="), ReportPath)
+		&& !GVRMSimplifyCommandlet::WriteReport(ReportPath, SourcePath, Output->GetPathName(), Settings, Report))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GVRMSimplify - Failed to write the report to %s"), *ReportPath);
+		return 1;
+	}
+
+	return 0;
+}
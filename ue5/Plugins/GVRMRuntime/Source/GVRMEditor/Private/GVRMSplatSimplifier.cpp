@@ -0,0 +1,631 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSplatSimplifier.h"
+#include "GVRMSkinningData.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+
+namespace GVRMSplatSimplify
+{
+	/** Symmetric 3x3 matrix (XX, YY, ZZ, XY, XZ, YZ) */
+	struct FCovariance
+	{
+		double M[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+		/** Add Scale * D * D^T */
+		void AddOuter(const FVector3d& D, double Scale)
+		{
+			M[0] += Scale * D.X * D.X;
+			M[1] += Scale * D.Y * D.Y;
+			M[2] += Scale * D.Z * D.Z;
+			M[3] += Scale * D.X * D.Y;
+			M[4] += Scale * D.X * D.Z;
+			M[5] += Scale * D.Y * D.Z;
+		}
+
+		void AddScaled(const FCovariance& Other, double Scale)
+		{
+			for (int32 Index = 0; Index < 6; ++Index)
+			{
+				M[Index] += Scale * Other.M[Index];
+			}
+		}
+
+		double Determinant() const
+		{
+			return M[0] * (M[1] * M[2] - M[5] * M[5])
+				- M[3] * (M[3] * M[2] - M[5] * M[4])
+				+ M[4] * (M[3] * M[5] - M[1] * M[4]);
+		}
+
+		double Trace() const
+		{
+			return M[0] + M[1] + M[2];
+		}
+	};
+
+	/** Floor of the determinants going into the merge cost (flat splats have almost none) */
+	constexpr double MinDeterminant = 1e-30;
+
+	/** A splat or the merge of several, in the space of its neighbourhood */
+	struct FCluster
+	{
+		FVector3d Mean = FVector3d::ZeroVector;
+		FCovariance Covariance;
+		FVector3d Color = FVector3d::ZeroVector;
+
+		/** Opacity times volume, preserved by merges */
+		double Mass = 0.0;
+
+		/** Mass over the average splat mass (weight of the merge cost) */
+		double Weight = 0.0;
+
+		double LogDeterminant = 0.0;
+
+		/** RMS radius, sqrt of the covariance trace */
+		double Radius = 0.0;
+
+		/** Original splat whose host vertex this cluster binds to, and that vertex's bind position */
+		int32 HostSplat = INDEX_NONE;
+		FVector3d HostPosition = FVector3d::ZeroVector;
+
+		/** Cluster that absorbed this one */
+		int32 MergedInto = INDEX_NONE;
+
+		/** Whether this cluster absorbed others (its Gaussian is rebuilt from the moments) */
+		bool bMerged = false;
+
+		bool bDropped = false;
+
+		void UpdateDerived()
+		{
+			LogDeterminant = FMath::Loge(FMath::Max(Covariance.Determinant(), MinDeterminant));
+			Radius = FMath::Sqrt(FMath::Max(Covariance.Trace(), 0.0));
+		}
+	};
+
+	/** Opacity times volume of a splat */
+	double GetMass(const FGVRMSplatGaussian& Gaussian)
+	{
+		return FMath::Max(static_cast<double>(Gaussian.Opacity) * Gaussian.Scale.X * Gaussian.Scale.Y * Gaussian.Scale.Z, UE_DOUBLE_SMALL_NUMBER);
+	}
+
+	FCovariance MakeCovariance(const FGVRMSplatGaussian& Gaussian)
+	{
+		const FQuat4d Rotation(Gaussian.Rotation.GetNormalized());
+		const FVector3d Scale(Gaussian.Scale);
+
+		FCovariance Covariance;
+		Covariance.AddOuter(Rotation.GetAxisX(), Scale.X * Scale.X);
+		Covariance.AddOuter(Rotation.GetAxisY(), Scale.Y * Scale.Y);
+		Covariance.AddOuter(Rotation.GetAxisZ(), Scale.Z * Scale.Z);
+		return Covariance;
+	}
+
+	/** Moment-matched mean and covariance of two clusters */
+	void MergeMoments(const FCluster& A, const FCluster& B, FVector3d& OutMean, FCovariance& OutCovariance)
+	{
+		const double Mass = A.Mass + B.Mass;
+		OutMean = (A.Mean * A.Mass + B.Mean * B.Mass) / Mass;
+
+		OutCovariance = FCovariance();
+		OutCovariance.AddScaled(A.Covariance, A.Mass / Mass);
+		OutCovariance.AddScaled(B.Covariance, B.Mass / Mass);
+		OutCovariance.AddOuter(A.Mean - OutMean, A.Mass / Mass);
+		OutCovariance.AddOuter(B.Mean - OutMean, B.Mass / Mass);
+	}
+
+	/** Runnalls upper bound on the KL divergence caused by replacing A and B by their merge */
+	double MergeCost(const FCluster& A, const FCluster& B)
+	{
+		FVector3d Mean;
+		FCovariance Covariance;
+		MergeMoments(A, B, Mean, Covariance);
+
+		const double LogDeterminant = FMath::Loge(FMath::Max(Covariance.Determinant(), MinDeterminant));
+		return 0.5 * ((A.Weight + B.Weight) * LogDeterminant - A.Weight * A.LogDeterminant - B.Weight * B.LogDeterminant);
+	}
+
+	/** Eigenvalues and unit eigenvectors of a covariance (cyclic Jacobi) */
+	void EigenDecompose(const FCovariance& Covariance, double OutValues[3], FVector3d OutAxes[3])
+	{
+		double A[3][3] = {
+			{ Covariance.M[0], Covariance.M[3], Covariance.M[4] },
+			{ Covariance.M[3], Covariance.M[1], Covariance.M[5] },
+			{ Covariance.M[4], Covariance.M[5], Covariance.M[2] } };
+		double V[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+
+		static const int32 Pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+		for (int32 Sweep = 0; Sweep < 32; ++Sweep)
+		{
+			const double OffDiagonal = A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2];
+			const double Diagonal = A[0][0] * A[0][0] + A[1][1] * A[1][1] + A[2][2] * A[2][2];
+			if (OffDiagonal <= 1e-24 * Diagonal || OffDiagonal == 0.0)
+			{
+				break;
+			}
+
+			for (const int32* Pair : Pairs)
+			{
+				const int32 P = Pair[0];
+				const int32 Q = Pair[1];
+				if (A[P][Q] == 0.0)
+				{
+					continue;
+				}
+
+				// Rotation that zeroes A[P][Q]
+				const double Theta = (A[Q][Q] - A[P][P]) / (2.0 * A[P][Q]);
+				const double T = (Theta >= 0.0 ? 1.0 : -1.0) / (FMath::Abs(Theta) + FMath::Sqrt(Theta * Theta + 1.0));
+				const double Cos = 1.0 / FMath::Sqrt(T * T + 1.0);
+				const double Sin = T * Cos;
+
+				for (int32 K = 0; K < 3; ++K)
+				{
+					const double KP = A[K][P];
+					const double KQ = A[K][Q];
+					A[K][P] = Cos * KP - Sin * KQ;
+					A[K][Q] = Sin * KP + Cos * KQ;
+				}
+				for (int32 K = 0; K < 3; ++K)
+				{
+					const double PK = A[P][K];
+					const double QK = A[Q][K];
+					A[P][K] = Cos * PK - Sin * QK;
+					A[Q][K] = Sin * PK + Cos * QK;
+				}
+				for (int32 K = 0; K < 3; ++K)
+				{
+					const double KP = V[K][P];
+					const double KQ = V[K][Q];
+					V[K][P] = Cos * KP - Sin * KQ;
+					V[K][Q] = Sin * KP + Cos * KQ;
+				}
+			}
+		}
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			OutValues[Axis] = FMath::Max(A[Axis][Axis], 0.0);
+			OutAxes[Axis] = FVector3d(V[0][Axis], V[1][Axis], V[2][Axis]).GetSafeNormal();
+		}
+	}
+
+	/** Gaussian of a merged cluster: principal axes and RMS extents, opacity from the preserved mass */
+	FGVRMSplatGaussian MakeGaussian(const FCluster& Cluster)
+	{
+		double Variances[3];
+		FVector3d Axes[3];
+		EigenDecompose(Cluster.Covariance, Variances, Axes);
+
+		// Right handed, so the basis is a rotation
+		const FVector3d AxisZ = Axes[0] ^ Axes[1];
+		const FMatrix44d Basis(Axes[0], Axes[1], AxisZ, FVector3d::ZeroVector);
+		const FVector3d Scale(FMath::Sqrt(Variances[0]), FMath::Sqrt(Variances[1]), FMath::Sqrt(Variances[2]));
+		const double Volume = Scale.X * Scale.Y * Scale.Z;
+
+		FGVRMSplatGaussian Gaussian;
+		Gaussian.Rotation = FQuat4f(FQuat4d(Basis).GetNormalized());
+		Gaussian.Scale = FVector3f(Scale);
+		Gaussian.Color = FVector3f(Cluster.Color.BoundToBox(FVector3d::ZeroVector, FVector3d::OneVector));
+		Gaussian.Opacity = Volume > UE_DOUBLE_SMALL_NUMBER ? static_cast<float>(FMath::Clamp(Cluster.Mass / Volume, 0.0, 1.0)) : 1.0f;
+		return Gaussian;
+	}
+
+	/** Merges done in one neighbourhood */
+	struct FNeighbourhoodResult
+	{
+		int32 NumMerges = 0;
+		double TotalCost = 0.0;
+		double MaxCost = 0.0;
+	};
+
+	/** Merge candidate (indices into the live clusters of a pass) */
+	struct FCandidate
+	{
+		double Cost = 0.0;
+		int32 A = INDEX_NONE;
+		int32 B = INDEX_NONE;
+	};
+
+	/**
+	 * Merge the clusters of one neighbourhood pairwise, cheapest first. Each pass
+	 * pairs every cluster with its cheapest neighbour in a grid of NeighbourScale
+	 * median radii, then merges the disjoint pairs under the cost threshold.
+	 */
+	FNeighbourhoodResult MergeNeighbourhood(TArray<FCluster>& Clusters, TConstArrayView<int32> Members, bool bRebindHosts,
+		const FGVRMSplatSimplifySettings& Settings)
+	{
+		FNeighbourhoodResult Result;
+		const double MaxColorDistanceSquared = FMath::Square(static_cast<double>(Settings.MaxColorDistance));
+
+		TArray<int32> Live;
+		TArray<double> Radii;
+		TMap<FIntVector, int32> CellHeads;
+		TArray<int32> NextInCell;
+		TArray<FCandidate> Candidates;
+		TBitArray<> bPaired;
+
+		for (int32 Pass = 0; Pass < Settings.MaxPasses; ++Pass)
+		{
+			Live.Reset();
+			for (const int32 ClusterIndex : Members)
+			{
+				if (!Clusters[ClusterIndex].bDropped && Clusters[ClusterIndex].MergedInto == INDEX_NONE)
+				{
+					Live.Add(ClusterIndex);
+				}
+			}
+			if (Live.Num() < 2)
+			{
+				break;
+			}
+
+			Radii.Reset(Live.Num());
+			for (const int32 ClusterIndex : Live)
+			{
+				Radii.Add(Clusters[ClusterIndex].Radius);
+			}
+			Radii.Sort();
+			const double CellSize = FMath::Max(Settings.NeighbourScale * Radii[Radii.Num() / 2], UE_DOUBLE_KINDA_SMALL_NUMBER);
+
+			auto GetCell = [CellSize](const FVector3d& Position)
+			{
+				return FIntVector(FMath::FloorToInt32(Position.X / CellSize), FMath::FloorToInt32(Position.Y / CellSize), FMath::FloorToInt32(Position.Z / CellSize));
+			};
+
+			CellHeads.Reset();
+			NextInCell.SetNumUninitialized(Live.Num());
+			for (int32 LiveIndex = 0; LiveIndex < Live.Num(); ++LiveIndex)
+			{
+				int32& Head = CellHeads.FindOrAdd(GetCell(Clusters[Live[LiveIndex]].Mean), INDEX_NONE);
+				NextInCell[LiveIndex] = Head;
+				Head = LiveIndex;
+			}
+
+			// Cheapest neighbour of every cluster
+			Candidates.Reset();
+			for (int32 LiveIndex = 0; LiveIndex < Live.Num(); ++LiveIndex)
+			{
+				const FCluster& Cluster = Clusters[Live[LiveIndex]];
+				const FIntVector Cell = GetCell(Cluster.Mean);
+
+				FCandidate Best;
+				Best.Cost = Settings.MaxMergeCost;
+				for (int32 Z = -1; Z <= 1; ++Z)
+				{
+					for (int32 Y = -1; Y <= 1; ++Y)
+					{
+						for (int32 X = -1; X <= 1; ++X)
+						{
+							const int32* Head = CellHeads.Find(Cell + FIntVector(X, Y, Z));
+							for (int32 Other = Head ? *Head : INDEX_NONE; Other != INDEX_NONE; Other = NextInCell[Other])
+							{
+								const FCluster& OtherCluster = Clusters[Live[Other]];
+								if (Other == LiveIndex
+									|| FVector3d::DistSquared(Cluster.Mean, OtherCluster.Mean) > FMath::Square(Settings.NeighbourScale * FMath::Max(Cluster.Radius, OtherCluster.Radius))
+									|| FVector3d::DistSquared(Cluster.Color, OtherCluster.Color) > MaxColorDistanceSquared)
+								{
+									continue;
+								}
+
+								const double Cost = MergeCost(Cluster, OtherCluster);
+								if (Cost < Best.Cost || (Best.B == INDEX_NONE && Cost <= Best.Cost))
+								{
+									Best.Cost = Cost;
+									Best.A = LiveIndex;
+									Best.B = Other;
+								}
+							}
+						}
+					}
+				}
+
+				if (Best.B != INDEX_NONE)
+				{
+					Candidates.Add(Best);
+				}
+			}
+
+			if (Candidates.Num() == 0)
+			{
+				break;
+			}
+
+			Candidates.Sort([](const FCandidate& Left, const FCandidate& Right)
+			{
+				return Left.Cost != Right.Cost ? Left.Cost < Right.Cost : (Left.A != Right.A ? Left.A < Right.A : Left.B < Right.B);
+			});
+
+			// Each cluster takes part in one merge per pass
+			bPaired.Init(false, Live.Num());
+			for (const FCandidate& Candidate : Candidates)
+			{
+				if (bPaired[Candidate.A] || bPaired[Candidate.B])
+				{
+					continue;
+				}
+				bPaired[Candidate.A] = true;
+				bPaired[Candidate.B] = true;
+
+				const int32 KeptIndex = FMath::Min(Live[Candidate.A], Live[Candidate.B]);
+				const int32 AbsorbedIndex = FMath::Max(Live[Candidate.A], Live[Candidate.B]);
+				FCluster& Kept = Clusters[KeptIndex];
+				FCluster& Absorbed = Clusters[AbsorbedIndex];
+
+				FVector3d Mean;
+				FCovariance Covariance;
+				MergeMoments(Kept, Absorbed, Mean, Covariance);
+
+				const double Mass = Kept.Mass + Absorbed.Mass;
+				Kept.Color = (Kept.Color * Kept.Mass + Absorbed.Color * Absorbed.Mass) / Mass;
+				Kept.Mean = Mean;
+				Kept.Covariance = Covariance;
+				Kept.Mass = Mass;
+				Kept.Weight += Absorbed.Weight;
+				Kept.bMerged = true;
+				Kept.UpdateDerived();
+
+				// Bind to whichever host vertex is closer to the merged centre
+				if (bRebindHosts && FVector3d::DistSquared(Absorbed.HostPosition, Mean) < FVector3d::DistSquared(Kept.HostPosition, Mean))
+				{
+					Kept.HostSplat = Absorbed.HostSplat;
+					Kept.HostPosition = Absorbed.HostPosition;
+				}
+				Absorbed.MergedInto = KeptIndex;
+
+				++Result.NumMerges;
+				Result.TotalCost += Candidate.Cost;
+				Result.MaxCost = FMath::Max(Result.MaxCost, Candidate.Cost);
+			}
+		}
+
+		return Result;
+	}
+}
+
+FString FGVRMSplatSimplifyReport::ToString() const
+{
+	return FString::Printf(TEXT("%d -> %d splats (-%.1f%%): %d dropped (%.2f%% of the mass), %d merges (cost %.3f total, %.3f max, RMS displacement %.4f), %d -> %d bound vertices"),
+		NumInputSplats, NumOutputSplats, GetReduction() * 100.0f, NumDroppedSplats, DroppedMassFraction * 100.0f,
+		NumMerges, TotalMergeCost, MaxMergeCost, RMSMergeDisplacement, NumInputVertices, NumOutputVertices);
+}
+
+bool FGVRMSplatSimplifier::Simplify(UGVRMBindingData& BindingData, TConstArrayView<FVector3f> VertexPositions,
+	const FGVRMSplatSimplifySettings& Settings, FGVRMSplatSimplifyReport& OutReport, FString& OutErrorMessage)
+{
+	using namespace GVRMSplatSimplify;
+
+	const TArray<FSplatBindingInfo>& Bindings = BindingData.Bindings;
+	const int32 NumSplats = Bindings.Num();
+	if (!BindingData.AreSplatStreamsComplete())
+	{
+		OutErrorMessage = TEXT("Splat streams are still loading");
+		return false;
+	}
+	if (NumSplats == 0 || BindingData.Gaussians.Num() != NumSplats)
+	{
+		OutErrorMessage = FString::Printf(TEXT("Simplification needs a Gaussian per binding (%d bindings, %d Gaussians)"), NumSplats, BindingData.Gaussians.Num());
+		return false;
+	}
+
+	// With bind positions, splats of one bone can merge across host vertices
+	const bool bRebindHosts = VertexPositions.Num() > 0;
+	for (const FSplatBindingInfo& Binding : Bindings)
+	{
+		if (Binding.VertexIndex < 0 || (bRebindHosts && Binding.VertexIndex >= VertexPositions.Num()))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Splat %d is bound to vertex %d, LOD0 has %d vertices"), Binding.SplatIndex, Binding.VertexIndex, VertexPositions.Num());
+			return false;
+		}
+	}
+
+	OutReport = FGVRMSplatSimplifyReport();
+	OutReport.NumInputSplats = NumSplats;
+
+	// Clusters start as the input splats
+	TArray<FCluster> Clusters;
+	Clusters.SetNum(NumSplats);
+	double TotalMass = 0.0;
+	double DroppedMass = 0.0;
+	double KeptMass = 0.0;
+	int32 NumKept = 0;
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		const FSplatBindingInfo& Binding = Bindings[SplatIndex];
+		const FGVRMSplatGaussian& Gaussian = BindingData.Gaussians[SplatIndex];
+
+		FCluster& Cluster = Clusters[SplatIndex];
+		Cluster.HostSplat = SplatIndex;
+		Cluster.HostPosition = bRebindHosts ? FVector3d(VertexPositions[Binding.VertexIndex]) : FVector3d::ZeroVector;
+		Cluster.Mean = Cluster.HostPosition + Binding.RelativePosition;
+		Cluster.Covariance = MakeCovariance(Gaussian);
+		Cluster.Color = FVector3d(Gaussian.Color);
+		Cluster.Mass = GetMass(Gaussian);
+		Cluster.bDropped = Gaussian.Opacity < Settings.MinOpacity || Gaussian.Scale.GetMax() < Settings.MinScale;
+		Cluster.UpdateDerived();
+
+		TotalMass += Cluster.Mass;
+		if (Cluster.bDropped)
+		{
+			DroppedMass += Cluster.Mass;
+			++OutReport.NumDroppedSplats;
+		}
+		else
+		{
+			KeptMass += Cluster.Mass;
+			++NumKept;
+		}
+	}
+
+	const double AverageMass = NumKept > 0 ? KeptMass / NumKept : 1.0;
+	for (FCluster& Cluster : Clusters)
+	{
+		Cluster.Weight = Cluster.Mass / AverageMass;
+	}
+
+	// Neighbourhoods: one bone with bind positions, otherwise one host vertex
+	TArray<int64> Keys;
+	Keys.SetNumUninitialized(NumSplats);
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		const FSplatBindingInfo& Binding = Bindings[SplatIndex];
+		Keys[SplatIndex] = bRebindHosts && Binding.BoneIndex >= 0 ? Binding.BoneIndex : (int64(1) << 32) | Binding.VertexIndex;
+	}
+
+	TArray<int32> Order;
+	Order.SetNumUninitialized(NumSplats);
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		Order[SplatIndex] = SplatIndex;
+	}
+	Algo::StableSortBy(Order, [&Keys](int32 SplatIndex) { return Keys[SplatIndex]; });
+
+	TArray<int32> NeighbourhoodStarts;
+	for (int32 OrderIndex = 0; OrderIndex < NumSplats; ++OrderIndex)
+	{
+		if (OrderIndex == 0 || Keys[Order[OrderIndex]] != Keys[Order[OrderIndex - 1]])
+		{
+			NeighbourhoodStarts.Add(OrderIndex);
+		}
+	}
+	NeighbourhoodStarts.Add(NumSplats);
+
+	// Neighbourhoods only touch their own clusters
+	TArray<FNeighbourhoodResult> Results;
+	Results.SetNum(NeighbourhoodStarts.Num() - 1);
+	ParallelFor(Results.Num(), [&](int32 Neighbourhood)
+	{
+		const int32 Start = NeighbourhoodStarts[Neighbourhood];
+		Results[Neighbourhood] = MergeNeighbourhood(Clusters, TConstArrayView<int32>(Order).Slice(Start, NeighbourhoodStarts[Neighbourhood + 1] - Start),
+			bRebindHosts, Settings);
+	});
+
+	for (const FNeighbourhoodResult& Result : Results)
+	{
+		OutReport.NumMerges += Result.NumMerges;
+		OutReport.TotalMergeCost += Result.TotalCost;
+		OutReport.MaxMergeCost = FMath::Max(OutReport.MaxMergeCost, static_cast<float>(Result.MaxCost));
+	}
+	OutReport.DroppedMassFraction = TotalMass > 0.0 ? static_cast<float>(DroppedMass / TotalMass) : 0.0f;
+
+	// Distance of every merged splat from the centre of the merge it ended up in
+	double DisplacementSum = 0.0;
+	double DisplacedMass = 0.0;
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		if (Clusters[SplatIndex].bDropped)
+		{
+			continue;
+		}
+
+		int32 Root = SplatIndex;
+		while (Clusters[Root].MergedInto != INDEX_NONE)
+		{
+			Root = Clusters[Root].MergedInto;
+		}
+		if (Clusters[Root].bMerged)
+		{
+			const FSplatBindingInfo& Binding = Bindings[SplatIndex];
+			const FVector3d OriginalMean = (bRebindHosts ? FVector3d(VertexPositions[Binding.VertexIndex]) : FVector3d::ZeroVector) + Binding.RelativePosition;
+			const double Mass = GetMass(BindingData.Gaussians[SplatIndex]);
+			DisplacementSum += Mass * FVector3d::DistSquared(OriginalMean, Clusters[Root].Mean);
+			DisplacedMass += Mass;
+		}
+	}
+	OutReport.RMSMergeDisplacement = DisplacedMass > 0.0 ? static_cast<float>(FMath::Sqrt(DisplacementSum / DisplacedMass)) : 0.0f;
+
+	// Surviving clusters in input order
+	const bool bHadRigidBindings = BindingData.HasRigidBindings();
+	TArray<FSplatBindingInfo> NewBindings;
+	TArray<FGVRMSplatGaussian> NewGaussians;
+	TArray<FGVRMRigidSplatBinding> NewRigidBindings;
+	TSet<int32> InputVertices;
+	TSet<int32> OutputVertices;
+	NewBindings.Reserve(NumSplats - OutReport.NumDroppedSplats - OutReport.NumMerges);
+	NewGaussians.Reserve(NewBindings.Max());
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		InputVertices.Add(Bindings[SplatIndex].VertexIndex);
+
+		const FCluster& Cluster = Clusters[SplatIndex];
+		if (Cluster.bDropped || Cluster.MergedInto != INDEX_NONE)
+		{
+			continue;
+		}
+
+		const int32 VertexIndex = Bindings[Cluster.HostSplat].VertexIndex;
+		NewBindings.Emplace(NewBindings.Num(), VertexIndex, Bindings[SplatIndex].BoneIndex, Cluster.Mean - Cluster.HostPosition);
+		NewGaussians.Add(Cluster.bMerged ? MakeGaussian(Cluster) : BindingData.Gaussians[SplatIndex]);
+		OutputVertices.Add(VertexIndex);
+
+		// Rigid bindings only depend on the host vertex
+		if (bHadRigidBindings)
+		{
+			NewRigidBindings.Add(BindingData.RigidBindings[Cluster.HostSplat]);
+		}
+	}
+	OutReport.NumOutputSplats = NewBindings.Num();
+	OutReport.NumInputVertices = InputVertices.Num();
+	OutReport.NumOutputVertices = OutputVertices.Num();
+
+	if (NewBindings.Num() == 0)
+	{
+		OutErrorMessage = TEXT("Every splat was dropped; lower MinOpacity or MinScale");
+		return false;
+	}
+
+	// Host vertices are a subset of the input ones, so their LOD remaps carry over
+	TArray<int32> NewBoundVertexIndices = OutputVertices.Array();
+	NewBoundVertexIndices.Sort();
+	bool bLODBindingsValid = true;
+	for (FGVRMLODBinding& LODBinding : BindingData.LODBindings)
+	{
+		TArray<FGVRMLODVertexRemap> NewRemaps;
+		NewRemaps.Reserve(NewBoundVertexIndices.Num());
+		for (const int32 VertexIndex : NewBoundVertexIndices)
+		{
+			const int32 BoundIndex = Algo::BinarySearch(BindingData.BoundVertexIndices, VertexIndex);
+			if (BoundIndex == INDEX_NONE || !LODBinding.VertexRemaps.IsValidIndex(BoundIndex))
+			{
+				bLODBindingsValid = false;
+				break;
+			}
+			NewRemaps.Add(LODBinding.VertexRemaps[BoundIndex]);
+		}
+		LODBinding.VertexRemaps = MoveTemp(NewRemaps);
+	}
+	if (!bLODBindingsValid)
+	{
+		BindingData.LODBindings.Empty();
+	}
+
+	if (bHadRigidBindings)
+	{
+		BindingData.RigidSplatOrder.SetNumUninitialized(NewRigidBindings.Num());
+		for (int32 SplatIndex = 0; SplatIndex < NewRigidBindings.Num(); ++SplatIndex)
+		{
+			BindingData.RigidSplatOrder[SplatIndex] = SplatIndex;
+		}
+		Algo::StableSortBy(BindingData.RigidSplatOrder, [&NewRigidBindings](int32 SplatIndex) { return NewRigidBindings[SplatIndex].PrimaryBone; });
+		BindingData.RigidBindings = MoveTemp(NewRigidBindings);
+	}
+	else
+	{
+		BindingData.RigidBindings.Empty();
+		BindingData.RigidSplatOrder.Empty();
+	}
+
+	BindingData.Bindings = MoveTemp(NewBindings);
+	BindingData.Gaussians = MoveTemp(NewGaussians);
+	BindingData.BoundVertexIndices = MoveTemp(NewBoundVertexIndices);
+
+	OutErrorMessage = OutReport.ToString();
+	if (!bLODBindingsValid)
+	{
+		OutErrorMessage += TEXT("; LOD remaps did not match the bound vertices and were cleared, run BuildLODRemaps again");
+	}
+	return true;
+}
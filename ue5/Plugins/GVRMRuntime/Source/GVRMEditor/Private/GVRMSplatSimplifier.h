@@ -0,0 +1,94 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UGVRMBindingData;
+
+/** Thresholds of FGVRMSplatSimplifier::Simplify */
+struct FGVRMSplatSimplifySettings
+{
+	/** Splats below this opacity are dropped */
+	float MinOpacity = 0.01f;
+
+	/** Splats whose largest axis (scale) is below this are dropped (0: keep every size) */
+	float MinScale = 0.0f;
+
+	/**
+	 * Largest merge cost accepted, in units of the average splat: the Runnalls
+	 * upper bound on the KL divergence between the two Gaussians and their
+	 * moment-matched merge, weighted by opacity times volume.
+	 */
+	float MaxMergeCost = 0.1f;
+
+	/** Largest base color distance (RGB, 0 to 1 per channel) between two merged splats */
+	float MaxColorDistance = 0.1f;
+
+	/** Merge candidates lie within this many RMS radii of the larger splat */
+	float NeighbourScale = 2.0f;
+
+	/** Merge passes per neighbourhood (each pass merges disjoint pairs) */
+	int32 MaxPasses = 8;
+};
+
+/** Outcome of FGVRMSplatSimplifier::Simplify */
+struct FGVRMSplatSimplifyReport
+{
+	int32 NumInputSplats = 0;
+	int32 NumOutputSplats = 0;
+
+	/** Splats removed by the opacity and size thresholds */
+	int32 NumDroppedSplats = 0;
+
+	/** Pairwise merges (each removes one splat) */
+	int32 NumMerges = 0;
+
+	int32 NumInputVertices = 0;
+	int32 NumOutputVertices = 0;
+
+	/** Share of the total opacity times volume carried by the dropped splats */
+	float DroppedMassFraction = 0.0f;
+
+	/** Sum and largest of the accepted merge costs (see FGVRMSplatSimplifySettings::MaxMergeCost) */
+	float TotalMergeCost = 0.0f;
+	float MaxMergeCost = 0.0f;
+
+	/** Mass weighted RMS distance from a merged splat's original centre to its merge's centre */
+	float RMSMergeDisplacement = 0.0f;
+
+	/** Output splats relative to input splats */
+	float GetReduction() const
+	{
+		return NumInputSplats > 0 ? 1.0f - static_cast<float>(NumOutputSplats) / NumInputSplats : 0.0f;
+	}
+
+	FString ToString() const;
+};
+
+/**
+ * Offline splat decimation for captures with redundant splats.
+ *
+ * Drops near-transparent and tiny splats, then merges splats of the same
+ * neighbourhood pairwise, cheapest first, while the covariance-aware merge
+ * cost stays under a threshold. A merge is the moment-matched Gaussian of the
+ * two (mass = opacity times volume is preserved, color is mass weighted), and
+ * its RelativePosition is recomputed against the host vertex nearest to it.
+ *
+ * Neighbourhoods are the splats of one host vertex, or with the LOD0 bind
+ * positions of the mesh the splats of one bone. The derived streams that only
+ * depend on host vertices (BoundVertexIndices, LOD remaps, rigid bindings) are
+ * carried over; the compact palette stays valid but may hold unused bones
+ * until the mesh data is rebuilt (UGVRMBindingData::BuildMeshData).
+ */
+class FGVRMSplatSimplifier
+{
+public:
+	/**
+	 * Simplify the splats of BindingData in place. Needs every splat streamed in
+	 * and a Gaussian per binding. VertexPositions (LOD0, bind pose) may be empty.
+	 */
+	static bool Simplify(UGVRMBindingData& BindingData, TConstArrayView<FVector3f> VertexPositions,
+		const FGVRMSplatSimplifySettings& Settings, FGVRMSplatSimplifyReport& OutReport, FString& OutErrorMessage);
+};
@@ -0,0 +1,147 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSpringBoneReference.h"
+
+FGVRMSpringBoneReference::FGVRMSpringBoneReference(const FGVRMSpringBoneAvatarSetup& InSetup)
+	: Setup(InSetup)
+{
+	ChainJoints.SetNum(Setup.Chains.Num());
+	for (int32 ChainIndex = 0; ChainIndex < Setup.Chains.Num(); ++ChainIndex)
+	{
+		ChainJoints[ChainIndex].SetNum(Setup.Chains[ChainIndex].Bones.Num() - 1);
+	}
+}
+
+void FGVRMSpringBoneReference::SetPose(const FTransform& InComponentToWorld, TConstArrayView<FTransform> ComponentSpaceTransforms)
+{
+	ComponentToWorld = InComponentToWorld;
+	WorldScale = ComponentToWorld.GetMaximumAxisScale();
+
+	Roots.SetNum(Setup.Chains.Num());
+	RootParentRotations.SetNum(Setup.Chains.Num());
+	for (int32 ChainIndex = 0; ChainIndex < Setup.Chains.Num(); ++ChainIndex)
+	{
+		const int32 RootBone = Setup.Chains[ChainIndex].Bones[0];
+		const int32 ParentBone = Setup.ParentBones[RootBone];
+		Roots[ChainIndex] = ComponentToWorld.TransformPosition(ComponentSpaceTransforms[RootBone].GetTranslation());
+		RootParentRotations[ChainIndex] = ParentBone != INDEX_NONE
+			? ComponentToWorld.GetRotation() * ComponentSpaceTransforms[ParentBone].GetRotation()
+			: ComponentToWorld.GetRotation();
+	}
+
+	ColliderHeads.SetNum(Setup.Colliders.Num());
+	ColliderTails.SetNum(Setup.Colliders.Num());
+	ColliderRadii.SetNum(Setup.Colliders.Num());
+	for (int32 ColliderIndex = 0; ColliderIndex < Setup.Colliders.Num(); ++ColliderIndex)
+	{
+		const FGVRMSpringBoneColliderSetup& Collider = Setup.Colliders[ColliderIndex];
+		const FTransform BoneToWorld = ComponentSpaceTransforms[Collider.Bone] * ComponentToWorld;
+		ColliderHeads[ColliderIndex] = BoneToWorld.TransformPosition(FVector(Collider.Offset));
+		ColliderTails[ColliderIndex] = BoneToWorld.TransformPosition(FVector(Collider.Tail));
+		ColliderRadii[ColliderIndex] = Collider.Radius * WorldScale;
+	}
+
+	if (bHasState)
+	{
+		return;
+	}
+
+	// Tails start at the animated pose, at rest
+	for (int32 ChainIndex = 0; ChainIndex < Setup.Chains.Num(); ++ChainIndex)
+	{
+		const TArray<int32>& Bones = Setup.Chains[ChainIndex].Bones;
+		for (int32 JointIndex = 0; JointIndex < ChainJoints[ChainIndex].Num(); ++JointIndex)
+		{
+			FJoint& Joint = ChainJoints[ChainIndex][JointIndex];
+			Joint.Tail = Joint.PrevTail = ComponentToWorld.TransformPosition(ComponentSpaceTransforms[Bones[JointIndex + 1]].GetTranslation());
+			Joint.Rotation = ComponentToWorld.GetRotation() * ComponentSpaceTransforms[Bones[JointIndex]].GetRotation();
+		}
+	}
+	bHasState = true;
+}
+
+void FGVRMSpringBoneReference::Step(float DeltaTime)
+{
+	for (int32 ChainIndex = 0; ChainIndex < Setup.Chains.Num(); ++ChainIndex)
+	{
+		const FGVRMSpringBoneChainSetup& Chain = Setup.Chains[ChainIndex];
+		const double ForceScale = DeltaTime * FGVRMSpringBoneSolver::VRMUnitScale * WorldScale;
+
+		FVector Head = Roots[ChainIndex];
+		FQuat ParentRotation = RootParentRotations[ChainIndex];
+		for (int32 JointIndex = 0; JointIndex < ChainJoints[ChainIndex].Num(); ++JointIndex)
+		{
+			FJoint& Joint = ChainJoints[ChainIndex][JointIndex];
+
+			// Bone axis and length from the reference offset of the next bone
+			const FVector RestOffset = Setup.RefLocalPose[Chain.Bones[JointIndex + 1]].GetTranslation();
+			const FVector BoneAxis = RestOffset.GetSafeNormal(UE_KINDA_SMALL_NUMBER, FVector::UnitZ());
+			const double BoneLength = RestOffset.Size() * WorldScale;
+			const FQuat RestRotation = ParentRotation * Setup.RefLocalPose[Chain.Bones[JointIndex]].GetRotation();
+			const FVector RestDirection = RestRotation.RotateVector(BoneAxis);
+
+			FVector NextTail = Joint.Tail
+				+ (Joint.Tail - Joint.PrevTail) * (1.0 - Chain.DragForce)
+				+ RestDirection * (Chain.Stiffness * ForceScale)
+				+ FVector(Chain.GravityDir) * (Chain.GravityPower * ForceScale);
+			NextTail = Head + (NextTail - Head).GetSafeNormal() * BoneLength;
+
+			for (int32 ColliderIndex = 0; ColliderIndex < Setup.Colliders.Num(); ++ColliderIndex)
+			{
+				if ((Chain.ColliderMask & (uint64(1) << ColliderIndex)) == 0)
+				{
+					continue;
+				}
+
+				FVector Center = ColliderHeads[ColliderIndex];
+				if (Setup.Colliders[ColliderIndex].bCapsule)
+				{
+					Center = FMath::ClosestPointOnSegment(NextTail, ColliderHeads[ColliderIndex], ColliderTails[ColliderIndex]);
+				}
+
+				const double Radius = Chain.HitRadius * WorldScale + ColliderRadii[ColliderIndex];
+				const FVector FromCenter = NextTail - Center;
+				if (FromCenter.SizeSquared() < FMath::Square(Radius))
+				{
+					NextTail = Center + FromCenter.GetSafeNormal() * Radius;
+					++NumHits;
+				}
+			}
+			NextTail = Head + (NextTail - Head).GetSafeNormal() * BoneLength;
+
+			Joint.Rotation = FQuat::FindBetweenNormals(RestDirection, (NextTail - Head).GetSafeNormal()) * RestRotation;
+			Joint.PrevTail = Joint.Tail;
+			Joint.Tail = NextTail;
+
+			Head = NextTail;
+			ParentRotation = Joint.Rotation;
+		}
+	}
+}
+
+void FGVRMSpringBoneReference::ApplyToPose(TArrayView<FTransform> ComponentSpaceTransforms) const
+{
+	const FQuat WorldToComponentRotation = ComponentToWorld.GetRotation().Inverse();
+	for (int32 ChainIndex = 0; ChainIndex < Setup.Chains.Num(); ++ChainIndex)
+	{
+		const TArray<int32>& Bones = Setup.Chains[ChainIndex].Bones;
+		const TArray<FJoint>& Joints = ChainJoints[ChainIndex];
+
+		// Animated rotation of the tip under its parent, read before the parent is replaced
+		const FQuat TipLocalRotation = ComponentSpaceTransforms[Bones[Bones.Num() - 2]].GetRotation().Inverse() * ComponentSpaceTransforms[Bones.Last()].GetRotation();
+
+		FVector Head = Roots[ChainIndex];
+		for (int32 JointIndex = 0; JointIndex < Joints.Num(); ++JointIndex)
+		{
+			FTransform& Bone = ComponentSpaceTransforms[Bones[JointIndex]];
+			Bone.SetTranslation(ComponentToWorld.InverseTransformPosition(Head));
+			Bone.SetRotation((WorldToComponentRotation * Joints[JointIndex].Rotation).GetNormalized());
+			Head = Joints[JointIndex].Tail;
+		}
+
+		FTransform& Tip = ComponentSpaceTransforms[Bones.Last()];
+		Tip.SetTranslation(ComponentToWorld.InverseTransformPosition(Head));
+		Tip.SetRotation((WorldToComponentRotation * Joints.Last().Rotation * TipLocalRotation).GetNormalized());
+	}
+}
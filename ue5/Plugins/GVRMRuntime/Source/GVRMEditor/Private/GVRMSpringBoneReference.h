@@ -0,0 +1,64 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GVRMSpringBoneSolver.h"
+
+/**
+ * Scalar VRMC_springBone reference for one avatar, in double precision.
+ *
+ * Walks every chain joint by joint with FVector/FQuat math, following the
+ * specification's update (verlet with drag, stiffness towards the animated
+ * direction, gravity, bone length constraint, sphere and capsule colliders) in
+ * the same units as FGVRMSpringBoneSolver (world space cm, VRM forces in meters
+ * per second). It shares nothing with the packed solver but the setup, so the
+ * GVRM.SpringBones.Reference tests catch drift in the SIMD lanes, the packet
+ * layout and the pose recomposition.
+ */
+class FGVRMSpringBoneReference
+{
+public:
+	explicit FGVRMSpringBoneReference(const FGVRMSpringBoneAvatarSetup& InSetup);
+
+	/** Animated inputs of this frame; the first pose starts the tails (FGVRMSpringBoneSolver::SetPose) */
+	void SetPose(const FTransform& ComponentToWorld, TConstArrayView<FTransform> ComponentSpaceTransforms);
+
+	/** One integration step of every chain */
+	void Step(float DeltaTime);
+
+	/**
+	 * Write the chain bones of a component space pose: joints at their solved
+	 * heads with the solved rotations, tips at the last tail keeping their
+	 * animated rotation relative to the parent
+	 */
+	void ApplyToPose(TArrayView<FTransform> ComponentSpaceTransforms) const;
+
+	/** Collider pushes over all steps */
+	int32 GetNumHits() const { return NumHits; }
+
+private:
+	struct FJoint
+	{
+		FVector Tail = FVector::ZeroVector;
+		FVector PrevTail = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+	};
+
+	FGVRMSpringBoneAvatarSetup Setup;
+
+	/** Per chain, one entry per simulated bone */
+	TArray<TArray<FJoint>> ChainJoints;
+
+	FTransform ComponentToWorld = FTransform::Identity;
+	double WorldScale = 1.0;
+	TArray<FVector> Roots;
+	TArray<FQuat> RootParentRotations;
+	TArray<FVector> ColliderHeads;
+	TArray<FVector> ColliderTails;
+	TArray<double> ColliderRadii;
+
+	bool bHasState = false;
+	int32 NumHits = 0;
+};
@@ -0,0 +1,189 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSyntheticAvatar.h"
+#include "Misc/FileHelper.h"
+#include "Math/RandomStream.h"
+
+namespace GVRMSyntheticAvatar
+{
+	constexpr int32 NumBones = 64;
+	constexpr int32 MinVertices = 1024;
+	constexpr int32 MaxVertices = 250000;
+
+	/** Splats per host vertex, roughly what the converter produces for a VRM body */
+	constexpr int32 SplatsPerVertex = 8;
+
+	/** Sway amplitude of the scripted pose (radians) */
+	constexpr float PoseAmplitude = 0.35f;
+
+	/** SH band 0 coefficient used by the 3DGS reference renderer */
+	constexpr float SHC0 = 0.28209479177387814f;
+}
+
+void FGVRMSyntheticAvatar::Generate(int32 InNumSplats, int32 Seed)
+{
+	using namespace GVRMSyntheticAvatar;
+
+	FRandomStream Random(Seed);
+
+	NumSplats = FMath::Max(InNumSplats, 1);
+	NumVertices = FMath::Clamp(NumSplats / SplatsPerVertex, MinVertices, MaxVertices);
+	NumBones = GVRMSyntheticAvatar::NumBones;
+
+	// Binary bone tree, about 180 units tall
+	BoneParents.SetNum(NumBones);
+	RefLocalPose.SetNum(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		BoneParents[BoneIndex] = BoneIndex == 0 ? INDEX_NONE : (BoneIndex - 1) / 2;
+		const FVector Offset = BoneIndex == 0
+			? FVector(0.0, 0.0, 90.0)
+			: FVector((BoneIndex % 2 == 0 ? 1.0 : -1.0) * 6.0, 0.0, 14.0);
+		RefLocalPose[BoneIndex] = FTransform(FQuat::Identity, Offset);
+	}
+
+	TArray<FTransform> RefComponentSpace;
+	RefComponentSpace.SetNum(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const int32 Parent = BoneParents[BoneIndex];
+		RefComponentSpace[BoneIndex] = Parent == INDEX_NONE ? RefLocalPose[BoneIndex] : RefLocalPose[BoneIndex] * RefComponentSpace[Parent];
+	}
+
+	// Vertices scattered around their primary bone, up to four influences
+	VertexPositions.SetNumUninitialized(NumVertices);
+	BoneIndices.SetNumUninitialized(NumVertices);
+	BoneWeights.SetNumUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	{
+		const int32 PrimaryBone = Random.RandRange(0, NumBones - 1);
+		VertexPositions[VertexIndex] = FVector3f(RefComponentSpace[PrimaryBone].GetLocation() + Random.GetUnitVector() * Random.FRandRange(2.0f, 8.0f));
+
+		FIntVector4 Indices(PrimaryBone, Random.RandRange(0, NumBones - 1), Random.RandRange(0, NumBones - 1), Random.RandRange(0, NumBones - 1));
+		FVector4f Weights(1.0f, Random.FRand() * 0.5f, Random.FRand() * 0.25f, Random.FRand() * 0.125f);
+		const float WeightSum = Weights.X + Weights.Y + Weights.Z + Weights.W;
+		BoneIndices[VertexIndex] = Indices;
+		BoneWeights[VertexIndex] = Weights / WeightSum;
+	}
+
+	// Splats around random host vertices
+	Bindings.SetNum(NumSplats);
+	Gaussians.SetNum(NumSplats);
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		const int32 VertexIndex = Random.RandRange(0, NumVertices - 1);
+		Bindings[SplatIndex] = FSplatBindingInfo(SplatIndex, VertexIndex, BoneIndices[VertexIndex].X, Random.GetUnitVector() * Random.FRandRange(0.0f, 1.5f));
+
+		FGVRMSplatGaussian& Gaussian = Gaussians[SplatIndex];
+		Gaussian.Rotation = FQuat4f(FVector3f(Random.GetUnitVector()), Random.FRandRange(-PI, PI));
+		Gaussian.Scale = FVector3f(Random.FRandRange(0.05f, 0.6f), Random.FRandRange(0.05f, 0.6f), Random.FRandRange(0.05f, 0.6f));
+		Gaussian.Color = FVector3f(Random.FRand(), Random.FRand(), Random.FRand());
+		Gaussian.Opacity = Random.FRandRange(0.05f, 0.95f);
+	}
+}
+
+void FGVRMSyntheticAvatar::EvaluatePose(float Time, TArray<FMatrix44f>& OutBoneMatrices) const
+{
+	using namespace GVRMSyntheticAvatar;
+
+	TArray<FTransform> RefComponentSpace;
+	TArray<FTransform> PoseComponentSpace;
+	RefComponentSpace.SetNum(NumBones);
+	PoseComponentSpace.SetNum(NumBones);
+	OutBoneMatrices.SetNum(NumBones);
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const FVector SwayAxis = FVector(1.0, (BoneIndex % 3) - 1.0, 0.5).GetSafeNormal();
+		const float Angle = PoseAmplitude * FMath::Sin(2.0f * PI * 0.5f * Time + BoneIndex * 0.7f);
+		const FTransform PoseLocal(FQuat(SwayAxis, Angle) * RefLocalPose[BoneIndex].GetRotation(), RefLocalPose[BoneIndex].GetLocation());
+
+		const int32 Parent = BoneParents[BoneIndex];
+		RefComponentSpace[BoneIndex] = Parent == INDEX_NONE ? RefLocalPose[BoneIndex] : RefLocalPose[BoneIndex] * RefComponentSpace[Parent];
+		PoseComponentSpace[BoneIndex] = Parent == INDEX_NONE ? PoseLocal : PoseLocal * PoseComponentSpace[Parent];
+
+		OutBoneMatrices[BoneIndex] = FMatrix44f(RefComponentSpace[BoneIndex].ToMatrixWithScale().Inverse() * PoseComponentSpace[BoneIndex].ToMatrixWithScale());
+	}
+}
+
+GVRMSkinning::FSkinningStreams FGVRMSyntheticAvatar::MakeStreams(TConstArrayView<FMatrix44f> BoneMatrices) const
+{
+	GVRMSkinning::FSkinningStreams Streams;
+	Streams.VertexPositions = VertexPositions;
+	Streams.BoneIndices = BoneIndices;
+	Streams.BoneWeights = BoneWeights;
+	Streams.BoneMatrices = BoneMatrices;
+	return Streams;
+}
+
+void FGVRMSyntheticAvatar::FillBindingData(UGVRMBindingData* BindingData) const
+{
+	BindingData->Bindings = Bindings;
+	BindingData->Gaussians = Gaussians;
+
+	TSet<int32> UniqueVertices;
+	for (const FSplatBindingInfo& Binding : Bindings)
+	{
+		UniqueVertices.Add(Binding.VertexIndex);
+	}
+	BindingData->BoundVertexIndices = UniqueVertices.Array();
+	BindingData->BoundVertexIndices.Sort();
+	BindingData->LODBindings.Empty();
+}
+
+bool FGVRMSyntheticAvatar::WriteCSV(const FString& FilePath) const
+{
+	FString Contents;
+	Contents.Reserve(NumSplats * 48);
+	Contents += TEXT("SplatIndex,VertexIndex,BoneIndex,RelativePosX,RelativePosY,RelativePosZ\n");
+	for (const FSplatBindingInfo& Binding : Bindings)
+	{
+		Contents += FString::Printf(TEXT("%d,%d,%d,%.6f,%.6f,%.6f\n"), Binding.SplatIndex, Binding.VertexIndex, Binding.BoneIndex,
+			Binding.RelativePosition.X, Binding.RelativePosition.Y, Binding.RelativePosition.Z);
+	}
+	return FFileHelper::SaveStringToFile(Contents, *FilePath);
+}
+
+bool FGVRMSyntheticAvatar::WritePLY(const FString& FilePath) const
+{
+	using namespace GVRMSyntheticAvatar;
+
+	static const TCHAR* PropertyNames[] = {
+		TEXT("x"), TEXT("y"), TEXT("z"),
+		TEXT("f_dc_0"), TEXT("f_dc_1"), TEXT("f_dc_2"), TEXT("opacity"),
+		TEXT("scale_0"), TEXT("scale_1"), TEXT("scale_2"),
+		TEXT("rot_0"), TEXT("rot_1"), TEXT("rot_2"), TEXT("rot_3")
+	};
+	constexpr int32 NumProperties = UE_ARRAY_COUNT(PropertyNames);
+
+	FString Header = FString::Printf(TEXT("ply\nformat binary_little_endian 1.0\nelement vertex %d\n"), NumSplats);
+	for (const TCHAR* PropertyName : PropertyNames)
+	{
+		Header += FString::Printf(TEXT("property float %s\n"), PropertyName);
+	}
+	Header += TEXT("end_header\n");
+
+	const FTCHARToUTF8 HeaderUTF8(*Header);
+	TArray<uint8> FileData;
+	FileData.Reserve(HeaderUTF8.Length() + static_cast<int64>(NumSplats) * NumProperties * sizeof(float));
+	FileData.Append(reinterpret_cast<const uint8*>(HeaderUTF8.Get()), HeaderUTF8.Length());
+
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		const FGVRMSplatGaussian& Gaussian = Gaussians[SplatIndex];
+		const FVector3f Position(Bindings[SplatIndex].RelativePosition);
+
+		// Inverse of the activations applied by ImportGaussiansFromPLY
+		const float Values[NumProperties] = {
+			Position.X, Position.Y, Position.Z,
+			(Gaussian.Color.X - 0.5f) / SHC0, (Gaussian.Color.Y - 0.5f) / SHC0, (Gaussian.Color.Z - 0.5f) / SHC0,
+			FMath::Loge(Gaussian.Opacity / (1.0f - Gaussian.Opacity)),
+			FMath::Loge(Gaussian.Scale.X), FMath::Loge(Gaussian.Scale.Y), FMath::Loge(Gaussian.Scale.Z),
+			Gaussian.Rotation.W, Gaussian.Rotation.X, Gaussian.Rotation.Y, Gaussian.Rotation.Z
+		};
+		FileData.Append(reinterpret_cast<const uint8*>(Values), sizeof(Values));
+	}
+
+	return FFileHelper::SaveArrayToFile(FileData, *FilePath);
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GVRMSkinningData.h"
+#include "GVRMSkinningMath.h"
+
+/**
+ * Deterministic synthetic GVRM avatar for headless benchmarks.
+ *
+ * Generates a small bone tree, a skinned vertex cloud and splat bindings from
+ * a seed, so runs on different machines and builds see identical data without
+ * any content in the project. Can write itself out in the converter formats
+ * (bindings CSV, 3DGS PLY) to exercise the import paths.
+ */
+struct FGVRMSyntheticAvatar
+{
+	int32 NumSplats = 0;
+	int32 NumVertices = 0;
+	int32 NumBones = 0;
+
+	/** Parent of each bone (INDEX_NONE for the root); parents precede children */
+	TArray<int32> BoneParents;
+
+	/** Reference pose, local to the parent bone */
+	TArray<FTransform> RefLocalPose;
+
+	// Mesh streams (bind pose, component space)
+	TArray<FVector3f> VertexPositions;
+	TArray<FIntVector4> BoneIndices;
+	TArray<FVector4f> BoneWeights;
+
+	// Splats
+	TArray<FSplatBindingInfo> Bindings;
+	TArray<FGVRMSplatGaussian> Gaussians;
+
+	/** Build an avatar with InNumSplats splats from Seed */
+	void Generate(int32 InNumSplats, int32 Seed);
+
+	/**
+	 * Skinning matrices (bind pose to scripted pose, component space) at Time.
+	 * Every bone sways around its own axis with a per-bone phase.
+	 */
+	void EvaluatePose(float Time, TArray<FMatrix44f>& OutBoneMatrices) const;
+
+	/** Skinning streams over this avatar's mesh with the given palette */
+	GVRMSkinning::FSkinningStreams MakeStreams(TConstArrayView<FMatrix44f> BoneMatrices) const;
+
+	/** Copy bindings and Gaussians into a binding data asset */
+	void FillBindingData(UGVRMBindingData* BindingData) const;
+
+	/** Write the bindings in the gvrm_to_ue5.py CSV format */
+	bool WriteCSV(const FString& FilePath) const;
+
+	/** Write the Gaussians as a binary 3DGS PLY (pre-activation values, as the converter extracts them) */
+	bool WritePLY(const FString& FilePath) const;
+};
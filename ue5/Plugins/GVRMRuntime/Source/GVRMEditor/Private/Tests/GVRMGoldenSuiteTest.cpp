@@ -0,0 +1,59 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMGoldenSuite.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GVRMGoldenSuiteTest
+{
+	/** Skin the golden avatar through one path and compare it with the reference of Tools/gvrm_golden.py */
+	bool RunGoldenCase(FAutomationTestBase& Test, EGVRMGoldenCase Case)
+	{
+		if (!FGVRMGoldenSuite::IsCaseSupported(Case))
+		{
+			Test.AddInfo(FString::Printf(TEXT("%s skipped: needs an SM5 RHI (not -nullrhi)"), FGVRMGoldenSuite::GetCaseName(Case)));
+			return true;
+		}
+
+		FGVRMGoldenSuite Suite;
+		FString ErrorMessage;
+		if (!Suite.Load(FGVRMGoldenSuite::GetDefaultFilePath(), ErrorMessage))
+		{
+			Test.AddError(ErrorMessage);
+			return false;
+		}
+
+		FGVRMGoldenCase Actual;
+		if (!Suite.RunCase(Case, Actual, ErrorMessage))
+		{
+			Test.AddError(ErrorMessage);
+			return false;
+		}
+
+		Test.TestEqual(FString::Printf(TEXT("%s splats outside tolerance of %s"), *Actual.Name, *Actual.Reference), Suite.Compare(Actual), 0);
+		return true;
+	}
+}
+
+#define GVRM_GOLDEN_TEST(CaseName) \
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGVRMGolden##CaseName##Test, "GVRM.Skinning.Golden." #CaseName, \
+		EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter) \
+	bool FGVRMGolden##CaseName##Test::RunTest(const FString& Parameters) \
+	{ \
+		return GVRMGoldenSuiteTest::RunGoldenCase(*this, EGVRMGoldenCase::CaseName); \
+	}
+
+GVRM_GOLDEN_TEST(LBS)
+GVRM_GOLDEN_TEST(LBSRemap)
+GVRM_GOLDEN_TEST(SIMD)
+GVRM_GOLDEN_TEST(DQS)
+GVRM_GOLDEN_TEST(Quantized)
+GVRM_GOLDEN_TEST(AnimationCache)
+GVRM_GOLDEN_TEST(GPU)
+GVRM_GOLDEN_TEST(GPURemap)
+
+#undef GVRM_GOLDEN_TEST
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,185 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSplatSimplifier.h"
+#include "GVRMSkinningData.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GVRMSplatSimplifierTest
+{
+	/** Allowed relative drift of the total mass and absolute drift of its centroid (cm) */
+	constexpr double MassTolerance = 1e-4;
+	constexpr double CentroidTolerance = 1e-3;
+
+	/** Every kept input centre lies within this many sigmas of an output splat */
+	constexpr double CoverageSigmas = 3.0;
+
+	/** Bind positions of the LOD0 vertices the splats hang off */
+	const FVector3f VertexPositions[] = {
+		FVector3f(0.0f, 0.0f, 0.0f),
+		FVector3f(10.0f, 0.0f, 0.0f),
+		FVector3f(0.0f, 10.0f, 0.0f),
+		FVector3f(30.0f, 30.0f, 0.0f),
+	};
+
+	struct FInputSplat
+	{
+		int32 VertexIndex;
+		int32 BoneIndex;
+		FVector RelativePosition;
+		FGVRMSplatGaussian Gaussian;
+	};
+
+	FGVRMSplatGaussian MakeGaussian(const FVector3f& Scale, const FVector3f& Color, float Opacity, const FQuat4f& Rotation = FQuat4f::Identity)
+	{
+		FGVRMSplatGaussian Gaussian;
+		Gaussian.Rotation = Rotation;
+		Gaussian.Scale = Scale;
+		Gaussian.Color = Color;
+		Gaussian.Opacity = Opacity;
+		return Gaussian;
+	}
+
+	/**
+	 * Eight splats on three bones: two near copies (one merge), a transparent one
+	 * (dropped), two overlapping splats of different colour (kept apart), two
+	 * rotated anisotropic copies (one merge) and an isolated one.
+	 */
+	TArray<FInputSplat> BuildInput()
+	{
+		const FVector3f Grey(0.5f, 0.5f, 0.5f);
+		const FVector3f Green(0.1f, 0.8f, 0.1f);
+		const FQuat4f Tilted(FVector3f(0.0f, 0.0f, 1.0f), 0.5f);
+		return {
+			{ 0, 0, FVector(0.0, 0.0, 0.0), MakeGaussian(FVector3f(1.0f), Grey, 0.4f) },
+			{ 0, 0, FVector(0.1, 0.0, 0.0), MakeGaussian(FVector3f(1.0f), FVector3f(0.52f, 0.5f, 0.5f), 0.4f) },
+			{ 0, 0, FVector(0.0, 0.1, 0.0), MakeGaussian(FVector3f(1.0f), Grey, 0.005f) },
+			{ 1, 0, FVector(0.0, 0.0, 0.0), MakeGaussian(FVector3f(1.0f), FVector3f(1.0f, 0.0f, 0.0f), 0.4f) },
+			{ 1, 0, FVector(0.1, 0.0, 0.0), MakeGaussian(FVector3f(1.0f), FVector3f(0.0f, 0.0f, 1.0f), 0.4f) },
+			{ 2, 1, FVector(0.0, 0.0, 0.0), MakeGaussian(FVector3f(2.0f, 1.0f, 0.5f), Green, 0.4f, Tilted) },
+			{ 2, 1, FVector(0.05, 0.05, 0.0), MakeGaussian(FVector3f(2.0f, 1.0f, 0.5f), Green, 0.3f, Tilted) },
+			{ 3, 2, FVector(0.0, 0.0, 1.0), MakeGaussian(FVector3f(1.0f), Grey, 0.6f) },
+		};
+	}
+
+	double GetMass(const FGVRMSplatGaussian& Gaussian)
+	{
+		return static_cast<double>(Gaussian.Opacity) * Gaussian.Scale.X * Gaussian.Scale.Y * Gaussian.Scale.Z;
+	}
+
+	/** Distance of a point from a splat's centre in units of its standard deviations */
+	double GetSigmaDistance(const FVector& Point, const FVector& Center, const FGVRMSplatGaussian& Gaussian)
+	{
+		const FVector3f Local = Gaussian.Rotation.GetNormalized().UnrotateVector(FVector3f(Point - Center));
+		const FVector3f Scale = Gaussian.Scale.ComponentMax(FVector3f(UE_KINDA_SMALL_NUMBER));
+		return FVector3f(Local.X / Scale.X, Local.Y / Scale.Y, Local.Z / Scale.Z).Size();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGVRMSplatSimplifierInvariantsTest, "GVRM.Simplifier.Invariants",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGVRMSplatSimplifierInvariantsTest::RunTest(const FString& Parameters)
+{
+	using namespace GVRMSplatSimplifierTest;
+
+	const TArray<FInputSplat> Input = BuildInput();
+	UGVRMBindingData* BindingData = NewObject<UGVRMBindingData>(GetTransientPackage());
+	TSet<int32> InputVertices;
+	for (int32 SplatIndex = 0; SplatIndex < Input.Num(); ++SplatIndex)
+	{
+		BindingData->Bindings.Emplace(SplatIndex, Input[SplatIndex].VertexIndex, Input[SplatIndex].BoneIndex, Input[SplatIndex].RelativePosition);
+		BindingData->Gaussians.Add(Input[SplatIndex].Gaussian);
+		InputVertices.Add(Input[SplatIndex].VertexIndex);
+	}
+	BindingData->BoundVertexIndices = InputVertices.Array();
+	BindingData->BoundVertexIndices.Sort();
+
+	const FGVRMSplatSimplifySettings Settings;
+	FGVRMSplatSimplifyReport Report;
+	FString Message;
+	if (!FGVRMSplatSimplifier::Simplify(*BindingData, VertexPositions, Settings, Report, Message))
+	{
+		AddError(Message);
+		return false;
+	}
+	AddInfo(Message);
+
+	// Splat count: one drop and two merges, and the report adds up
+	TestEqual(TEXT("Dropped splats"), Report.NumDroppedSplats, 1);
+	TestEqual(TEXT("Merges"), Report.NumMerges, 2);
+	TestEqual(TEXT("Output splats"), Report.NumOutputSplats, Report.NumInputSplats - Report.NumDroppedSplats - Report.NumMerges);
+	TestEqual(TEXT("Bindings"), BindingData->Bindings.Num(), Report.NumOutputSplats);
+	TestEqual(TEXT("Gaussians"), BindingData->Gaussians.Num(), Report.NumOutputSplats);
+	for (int32 SplatIndex = 0; SplatIndex < BindingData->Bindings.Num(); ++SplatIndex)
+	{
+		const FSplatBindingInfo& Binding = BindingData->Bindings[SplatIndex];
+		TestEqual(TEXT("Splat index"), Binding.SplatIndex, SplatIndex);
+		TestTrue(FString::Printf(TEXT("Splat %d is bound to an input vertex"), SplatIndex), InputVertices.Contains(Binding.VertexIndex));
+		TestTrue(FString::Printf(TEXT("Bound vertices hold vertex %d"), Binding.VertexIndex), BindingData->BoundVertexIndices.Contains(Binding.VertexIndex));
+	}
+	TestTrue(TEXT("Bindings validate"), BindingData->ValidateBindings(Message));
+
+	// Weight: merges preserve the mass (opacity times volume) of the kept splats and its centroid
+	double InputMass = 0.0;
+	double DroppedMass = 0.0;
+	FVector InputMoment = FVector::ZeroVector;
+	for (const FInputSplat& Splat : Input)
+	{
+		const double Mass = GetMass(Splat.Gaussian);
+		if (Splat.Gaussian.Opacity < Settings.MinOpacity)
+		{
+			DroppedMass += Mass;
+			continue;
+		}
+		InputMass += Mass;
+		InputMoment += (FVector(VertexPositions[Splat.VertexIndex]) + Splat.RelativePosition) * Mass;
+	}
+
+	double OutputMass = 0.0;
+	FVector OutputMoment = FVector::ZeroVector;
+	for (int32 SplatIndex = 0; SplatIndex < BindingData->Bindings.Num(); ++SplatIndex)
+	{
+		const FSplatBindingInfo& Binding = BindingData->Bindings[SplatIndex];
+		const FGVRMSplatGaussian& Gaussian = BindingData->Gaussians[SplatIndex];
+		TestTrue(FString::Printf(TEXT("Splat %d opacity is in [0, 1]"), SplatIndex), Gaussian.Opacity >= 0.0f && Gaussian.Opacity <= 1.0f);
+
+		const double Mass = GetMass(Gaussian);
+		OutputMass += Mass;
+		OutputMoment += (FVector(VertexPositions[Binding.VertexIndex]) + Binding.RelativePosition) * Mass;
+	}
+
+	TestTrue(FString::Printf(TEXT("Mass is preserved (%.6f in, %.6f out)"), InputMass, OutputMass),
+		FMath::Abs(OutputMass - InputMass) <= MassTolerance * InputMass);
+	TestTrue(TEXT("Mass centroid is preserved"),
+		FVector::Dist(InputMoment / InputMass, OutputMoment / OutputMass) <= CentroidTolerance);
+	TestTrue(TEXT("Dropped mass fraction"),
+		FMath::IsNearlyEqual(Report.DroppedMassFraction, static_cast<float>(DroppedMass / (InputMass + DroppedMass)), 1e-5f));
+
+	// Coverage: every kept input splat lies inside an output splat
+	for (int32 InputIndex = 0; InputIndex < Input.Num(); ++InputIndex)
+	{
+		const FInputSplat& Splat = Input[InputIndex];
+		if (Splat.Gaussian.Opacity < Settings.MinOpacity)
+		{
+			continue;
+		}
+
+		const FVector Point = FVector(VertexPositions[Splat.VertexIndex]) + Splat.RelativePosition;
+		double Nearest = TNumericLimits<double>::Max();
+		for (int32 SplatIndex = 0; SplatIndex < BindingData->Bindings.Num(); ++SplatIndex)
+		{
+			const FSplatBindingInfo& Binding = BindingData->Bindings[SplatIndex];
+			const FVector Center = FVector(VertexPositions[Binding.VertexIndex]) + Binding.RelativePosition;
+			Nearest = FMath::Min(Nearest, GetSigmaDistance(Point, Center, BindingData->Gaussians[SplatIndex]));
+		}
+		TestTrue(FString::Printf(TEXT("Input splat %d is covered (%.3f sigma)"), InputIndex, Nearest), Nearest <= CoverageSigmas);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,165 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSpringBoneReference.h"
+#include "GVRMSpringBoneSolver.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GVRMSpringBoneTest
+{
+	/** Colliders of a reference case */
+	enum class ECollider : uint8
+	{
+		None,
+		Sphere,
+		Capsule,
+	};
+
+	constexpr int32 SpineBone = 1;
+	constexpr int32 NumFrames = 90;
+	constexpr float FixedTimeStep = 1.0f / 60.0f;
+
+	/** Allowed difference between the packed solver and the reference (cm, and 1 - |dot|) */
+	constexpr double PositionTolerance = 1e-2;
+	constexpr double RotationTolerance = 1e-5;
+
+	/**
+	 * Five chains of 6, 5, 4, 3 and 2 bones hanging off a spine: one full packet
+	 * whose lanes end at different depths, and a second packet with one lane.
+	 * Each chain points sideways and falls under gravity onto the collider.
+	 */
+	FGVRMSpringBoneAvatarSetup BuildSetup(ECollider Collider)
+	{
+		FGVRMSpringBoneAvatarSetup Setup;
+		Setup.ParentBones = { INDEX_NONE, 0 };
+		Setup.RefLocalPose = { FTransform::Identity, FTransform(FVector(0.0, 0.0, 100.0)) };
+
+		const int32 ChainLengths[] = { 4, 6, 2, 5, 3 };
+		for (int32 ChainIndex = 0; ChainIndex < UE_ARRAY_COUNT(ChainLengths); ++ChainIndex)
+		{
+			FGVRMSpringBoneChainSetup& Chain = Setup.Chains.AddDefaulted_GetRef();
+			for (int32 ChainBone = 0; ChainBone < ChainLengths[ChainIndex]; ++ChainBone)
+			{
+				const int32 Bone = Setup.ParentBones.Num();
+				Setup.ParentBones.Add(ChainBone == 0 ? SpineBone : Bone - 1);
+				Setup.RefLocalPose.Add(ChainBone == 0
+					? FTransform(FVector(0.0, ChainIndex * 8.0 - 16.0, 0.0))
+					: FTransform(FRotator(0.0f, 5.0f * ChainIndex - 10.0f, 0.0f).Quaternion(), FVector(6.0, 0.0, 0.0)));
+				Chain.Bones.Add(Bone);
+			}
+			Chain.Stiffness = 0.3f + 0.2f * ChainIndex;
+			Chain.DragForce = 0.2f + 0.1f * ChainIndex;
+			Chain.GravityPower = 1.0f;
+			Chain.GravityDir = FVector3f(0.0f, 0.0f, -1.0f);
+			Chain.HitRadius = 1.0f;
+			Chain.ColliderMask = Collider != ECollider::None ? 1 : 0;
+		}
+
+		if (Collider != ECollider::None)
+		{
+			FGVRMSpringBoneColliderSetup& ColliderSetup = Setup.Colliders.AddDefaulted_GetRef();
+			ColliderSetup.Bone = SpineBone;
+			ColliderSetup.bCapsule = Collider == ECollider::Capsule;
+			ColliderSetup.Offset = ColliderSetup.bCapsule ? FVector3f(14.0f, -30.0f, -10.0f) : FVector3f(14.0f, 0.0f, -14.0f);
+			ColliderSetup.Tail = ColliderSetup.bCapsule ? FVector3f(14.0f, 30.0f, -10.0f) : FVector3f::ZeroVector;
+			ColliderSetup.Radius = ColliderSetup.bCapsule ? 5.0f : 12.0f;
+		}
+		return Setup;
+	}
+
+	/** Component space pose of a frame: the spine sways and twists */
+	void BuildPose(const FGVRMSpringBoneAvatarSetup& Setup, int32 Frame, TArray<FTransform>& OutPose)
+	{
+		OutPose.SetNumUninitialized(Setup.ParentBones.Num());
+		const float Phase = Frame * 0.11f;
+		for (int32 Bone = 0; Bone < Setup.ParentBones.Num(); ++Bone)
+		{
+			FTransform Local = Setup.RefLocalPose[Bone];
+			if (Bone == SpineBone)
+			{
+				Local.SetRotation(FRotator(FMath::Sin(Phase) * 20.0f, FMath::Sin(Phase * 0.6f) * 35.0f, FMath::Cos(Phase * 0.8f) * 10.0f).Quaternion());
+			}
+			const int32 Parent = Setup.ParentBones[Bone];
+			OutPose[Bone] = Parent != INDEX_NONE ? Local * OutPose[Parent] : Local;
+		}
+	}
+
+	/** Step the packed solver and the reference through the same frames and compare every chain bone after each step */
+	bool RunReferenceCase(FAutomationTestBase& Test, ECollider Collider)
+	{
+		const FGVRMSpringBoneAvatarSetup Setup = BuildSetup(Collider);
+		FGVRMSpringBoneReference Reference(Setup);
+		FGVRMSpringBoneSolver Solver;
+		const int32 AvatarId = Solver.AddAvatar(CopyTemp(Setup));
+
+		TArray<FTransform> Pose;
+		TArray<FTransform> Solved;
+		TArray<FTransform> Expected;
+		double MaxPositionError = 0.0;
+		double MaxRotationError = 0.0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			// The avatar walks and turns, so world space and component space differ
+			const FTransform ComponentToWorld(FRotator(0.0f, Frame * 1.5f, 0.0f), FVector(Frame * 2.0, Frame * -1.0, 10.0));
+			BuildPose(Setup, Frame, Pose);
+
+			Solver.ClearPoses();
+			Solver.SetPose(AvatarId, ComponentToWorld, Pose);
+			Solver.Step(FixedTimeStep);
+			Reference.SetPose(ComponentToWorld, Pose);
+			Reference.Step(FixedTimeStep);
+
+			Solved = Pose;
+			Expected = Pose;
+			if (!Solver.ApplyToPose(AvatarId, Solved))
+			{
+				Test.AddError(FString::Printf(TEXT("Frame %d: the solver has no result"), Frame));
+				return false;
+			}
+			Reference.ApplyToPose(Expected);
+
+			for (const FGVRMSpringBoneChainSetup& Chain : Setup.Chains)
+			{
+				for (const int32 Bone : Chain.Bones)
+				{
+					const double PositionError = FVector::Dist(Solved[Bone].GetTranslation(), Expected[Bone].GetTranslation());
+					const double RotationError = 1.0 - FMath::Abs(Solved[Bone].GetRotation() | Expected[Bone].GetRotation());
+					MaxPositionError = FMath::Max(MaxPositionError, PositionError);
+					MaxRotationError = FMath::Max(MaxRotationError, RotationError);
+					if (PositionError > PositionTolerance || RotationError > RotationTolerance)
+					{
+						Test.AddError(FString::Printf(TEXT("Frame %d, bone %d: %.5f cm and %.2e rotation from the reference"),
+							Frame, Bone, PositionError, RotationError));
+						return false;
+					}
+				}
+			}
+		}
+
+		Test.AddInfo(FString::Printf(TEXT("%d frames, %d collider hits, at most %.2e cm and %.2e rotation from the reference"),
+			NumFrames, Reference.GetNumHits(), MaxPositionError, MaxRotationError));
+		if (Collider != ECollider::None)
+		{
+			Test.TestTrue(TEXT("Chains hit the collider"), Reference.GetNumHits() > 0);
+		}
+		return true;
+	}
+}
+
+#define GVRM_SPRING_BONE_TEST(CaseName) \
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGVRMSpringBoneReference##CaseName##Test, "GVRM.SpringBones.Reference." #CaseName, \
+		EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter) \
+	bool FGVRMSpringBoneReference##CaseName##Test::RunTest(const FString& Parameters) \
+	{ \
+		return GVRMSpringBoneTest::RunReferenceCase(*this, GVRMSpringBoneTest::ECollider::CaseName); \
+	}
+
+GVRM_SPRING_BONE_TEST(None)
+GVRM_SPRING_BONE_TEST(Sphere)
+GVRM_SPRING_BONE_TEST(Capsule)
+
+#undef GVRM_SPRING_BONE_TEST
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,38 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GVRMBakeCacheCommandlet.generated.h"
+
+/**
+ * GVRM Bake Cache Commandlet - Bakes an animation into a splat animation cache.
+ *
+ * Samples the animation on the binding data's skeletal mesh and encodes the
+ * skinned splats of every frame (UGVRMAnimationCache::BakeFromAnimation), then
+ * saves the cache and logs its size and error report. An existing cache at the
+ * output path is re-baked in place, so actors referencing it keep working.
+ *
+ * The skeletal mesh defaults to the binding data's SourceSkeletalMesh.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Project.uproject -run=GVRMBakeCache -unattended
+ *     -Animation=/Game/VRM/Anims/Idle -BindingData=/Game/VRM/Avatar_Binding
+ *     -Output=/Game/VRM/Avatar_Idle_Cache [-SkeletalMesh=/Game/VRM/Avatar]
+ *     [-SampleRate=30] [-NoLoop]
+ *
+ * Returns 1 if an input cannot be loaded, the bake fails or the cache cannot be saved.
+ */
+UCLASS()
+class GVRMEDITOR_API UGVRMBakeCacheCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGVRMBakeCacheCommandlet();
+
+	// UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GVRMBenchmarkCommandlet.generated.h"
+
+/**
+ * GVRM Benchmark Commandlet - Headless CPU performance runs.
+ *
+ * Times the CPU side of the plugin on synthetic avatars (deterministic, no
+ * content needed) and writes percentiles as JSON and CSV:
+ * - ImportFromCSV and ImportGaussiansFromPLY on converter-format files
+ * - BinaryLoad: binding data deserialized from its saved form (splat chunks);
+ *   BinaryLoadTagged: the same through tagged properties only
+ * - ValidateBindings, FGVRMSplatGPUData::InitializeFromBindingData
+ * - CPUSkinning: every splat through the CPU skinning math with a scripted pose
+ * - CPUSkinningSIMD: the same pose through the VectorRegister path (checked against CPUSkinning)
+ * - CPUSkinningTwoPass: the same pose, each bound vertex skinned once and shared
+ *   by its splats (checked against CPUSkinning)
+ * - RigidSkinning / RigidSkinningBlended: the same pose through the rigid-bone modes
+ * - CacheBoneMatrices (150 bones) / CacheLODStreams (500k vertices): the Niagara
+ *   cache kernels on synthetic data, checked bit for bit against the accessor loops
+ * - PackBonePalette: the 150-bone palette into the 3x4 GPU layout (round trip checked exactly)
+ * - MorphTargets64: active list and sparse fixed-point accumulation of 64 weighted
+ *   expressions on a 10k-vertex face (checked against a dense float sum)
+ * - AvatarUpdateInline / AvatarUpdateTasks: palette and packing of 64 avatars, one
+ *   after the other vs. one UE::Tasks task each (use -corelimit=N for scaling)
+ * - SpringBones256: one spring bone solver step for 256 avatars of 16 six-joint
+ *   chains (checked for identical results on a replay)
+ * - UpdateCacheStreams / UpdateCachePose: FNiagaraDataInterfaceGVRMInstanceData::UpdateCache
+ *   on a real skeletal mesh (only with -SkeletalMesh)
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Project.uproject -run=GVRMBenchmark -nullrhi -unattended
+ *     [-Splats=100000,500000,1000000,5000000] [-Iterations=10] [-Warmup=2] [-Seed=1234]
+ *     [-SkeletalMesh=/Game/VRM/Avatar.Avatar] [-Output=Dir]
+ *     [-Baseline=PreviousRun.json] [-Tolerance=0.10]
+ *     [-Golden] [-GoldenFile=Path]
+ *
+ * With -Baseline, every stage whose median is slower than the baseline median
+ * by more than Tolerance is reported and the commandlet returns 1.
+ *
+ * With -Golden, the FGVRMGoldenSuite cases (LBS, LBS through a LOD remap, the
+ * VectorRegister path, dual quaternions, 8-bit quantized weights, animation
+ * cache round trip, and with a GPU RHI the SkinSplatsCS dispatch) are timed as
+ * Golden* stages and compared against the double precision references of
+ * Tools/gvrm_golden.py (default Resources/Golden/GVRMSkinningGolden.bin in the
+ * plugin); any mismatch makes the commandlet return 1. The size sweep only runs
+ * if -Splats is given. The same cases run as the GVRM.Skinning.Golden
+ * automation tests.
+ */
+UCLASS()
+class GVRMEDITOR_API UGVRMBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGVRMBenchmarkCommandlet();
+
+	// UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+};
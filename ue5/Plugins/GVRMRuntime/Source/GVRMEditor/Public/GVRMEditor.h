@@ -0,0 +1,19 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+/**
+ * GVRM Editor Module
+ * Editor-only tooling for GVRM assets (commandlets, offline processing, animation graph nodes).
+ */
+class FGVRMEditorModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GVRMImportCommandlet.generated.h"
+
+/**
+ * GVRM Import Commandlet - Creates a binding data asset from the output of gvrm_to_ue5.py.
+ *
+ * Reads splat_binding.csv, then metadata.json and model.ply when present, and
+ * with -SkeletalMesh sets it as the asset's SourceSkeletalMesh so every
+ * mesh-derived table is built on import (UGVRMBindingData::BuildMeshData).
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Project.uproject -run=GVRMImport -unattended
+ *     -Input=Path/To/ConverterOutput -Output=/Game/VRM/Avatar_Binding
+ *     [-SkeletalMesh=/Game/VRM/Avatar]
+ *
+ * Returns 1 if a file cannot be imported, the mesh data cannot be built or the asset cannot be saved.
+ */
+UCLASS()
+class GVRMEDITOR_API UGVRMImportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGVRMImportCommandlet();
+
+	// UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,42 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GVRMSimplifyCommandlet.generated.h"
+
+/**
+ * GVRM Simplify Commandlet - Offline splat decimation of a binding data asset.
+ *
+ * Drops near-transparent and tiny splats and merges overlapping splats of the
+ * same neighbourhood (see FGVRMSplatSimplifier), then saves the result as a
+ * new binding data asset and logs the splat reduction against the error
+ * estimates (dropped mass, merge cost, RMS merge displacement).
+ *
+ * With -SkeletalMesh, splats of the same bone merge across host vertices
+ * (each merge is rebound to the nearest host) and the mesh data (LOD remaps,
+ * rigid bindings, compact bone palette) is rebuilt; without it, only splats of
+ * the same host vertex merge.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd Project.uproject -run=GVRMSimplify -unattended
+ *     -BindingData=/Game/VRM/Avatar_Binding [-Output=/Game/VRM/Avatar_Binding_Simplified]
+ *     [-SkeletalMesh=/Game/VRM/Avatar] [-MinOpacity=0.01] [-MinScale=0]
+ *     [-MaxMergeCost=0.1] [-MaxColorDistance=0.1] [-NeighbourScale=2] [-MaxPasses=8]
+ *     [-Report=Path.json]
+ *
+ * Returns 1 if the asset cannot be loaded, simplified or saved.
+ */
+UCLASS()
+class GVRMEDITOR_API UGVRMSimplifyCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGVRMSimplifyCommandlet();
+
+	// UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+};
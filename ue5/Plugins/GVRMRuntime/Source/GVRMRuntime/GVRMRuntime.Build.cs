@@ -1,6 +1,7 @@
 // Copyright (c) 2025 gaussian-vrm community
 // Licensed under the MIT License.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class GVRMRuntime : ModuleRules
@@ -18,7 +19,9 @@ public class GVRMRuntime : ModuleRules
 
 		PrivateIncludePaths.AddRange(
 			new string[] {
-				// ... add other private include paths required here ...
+				// Scene view extension passes need FViewInfo and FPostProcessingInputs
+				Path.Combine(GetModuleDirectory("Renderer"), "Private"),
+				Path.Combine(GetModuleDirectory("Renderer"), "Internal"),
 			}
 		);
 
@@ -36,6 +39,7 @@ public class GVRMRuntime : ModuleRules
 				"NiagaraShader",
 				"Json",
 				"JsonUtilities",
+				"GVRMShaders",
 			}
 		);
 
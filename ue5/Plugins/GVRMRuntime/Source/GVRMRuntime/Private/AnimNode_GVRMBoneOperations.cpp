@@ -0,0 +1,93 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "AnimNode_GVRMBoneOperations.h"
+#include "GVRMSkinningData.h"
+#include "Animation/AnimInstanceProxy.h"
+
+void FAnimNode_GVRMBoneOperations::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	FAnimNode_Base::Initialize_AnyThread(Context);
+	GetEvaluateGraphExposedInputs().Execute(Context);
+	Source.Initialize(Context);
+}
+
+void FAnimNode_GVRMBoneOperations::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	Source.CacheBones(Context);
+	ResolveOperations(Context.AnimInstanceProxy->GetRequiredBones());
+}
+
+void FAnimNode_GVRMBoneOperations::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	GetEvaluateGraphExposedInputs().Execute(Context);
+	Source.Update(Context);
+
+	// A binding data pin changed at runtime; bones are otherwise only resolved in CacheBones
+	if (ResolvedBindingData.Get() != BindingData)
+	{
+		ResolveOperations(Context.AnimInstanceProxy->GetRequiredBones());
+	}
+}
+
+void FAnimNode_GVRMBoneOperations::Evaluate_AnyThread(FPoseContext& Output)
+{
+	Source.Evaluate(Output);
+
+	const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
+	if (ClampedAlpha <= ZERO_ANIMWEIGHT_THRESH)
+	{
+		return;
+	}
+
+	const bool bFullWeight = ClampedAlpha >= 1.0f - ZERO_ANIMWEIGHT_THRESH;
+	for (const FResolvedOperation& Operation : ResolvedOperations)
+	{
+		FTransform& BoneTransform = Output.Pose[Operation.BoneIndex];
+		const FQuat Rotation = bFullWeight ? Operation.Rotation : FQuat::Slerp(FQuat::Identity, Operation.Rotation, ClampedAlpha);
+		BoneTransform.SetRotation(BoneTransform.GetRotation() * Rotation);
+		BoneTransform.AddToTranslation(Operation.PositionOffset * ClampedAlpha);
+	}
+}
+
+void FAnimNode_GVRMBoneOperations::GatherDebugData(FNodeDebugData& DebugData)
+{
+	const FString DebugLine = FString::Printf(TEXT("%s(%d bones, %d unresolved, Alpha: %.2f)"),
+		*DebugData.GetNodeName(this), ResolvedOperations.Num(), NumUnresolvedOperations, Alpha);
+	DebugData.AddDebugItem(DebugLine);
+	Source.GatherDebugData(DebugData);
+}
+
+void FAnimNode_GVRMBoneOperations::ResolveOperations(const FBoneContainer& RequiredBones)
+{
+	ResolvedOperations.Reset();
+	ResolvedBindingData = BindingData;
+	NumUnresolvedOperations = 0;
+
+	if (!BindingData || !RequiredBones.IsValid())
+	{
+		return;
+	}
+
+	ResolvedOperations.Reserve(BindingData->BoneOperations.Num());
+	for (const FGVRMBoneOperation& Operation : BindingData->BoneOperations)
+	{
+		// FName comparison ignores case, like FindBoneOperation
+		const int32 MeshBoneIndex = RequiredBones.GetPoseBoneIndexForBoneName(FName(*Operation.BoneName));
+		const FCompactPoseBoneIndex BoneIndex = MeshBoneIndex != INDEX_NONE
+			? RequiredBones.MakeCompactPoseIndex(FMeshPoseBoneIndex(MeshBoneIndex))
+			: FCompactPoseBoneIndex(INDEX_NONE);
+
+		// Bones missing from the skeleton or culled at this LOD
+		if (!BoneIndex.IsValid())
+		{
+			++NumUnresolvedOperations;
+			continue;
+		}
+
+		FResolvedOperation& Resolved = ResolvedOperations.AddDefaulted_GetRef();
+		Resolved.BoneIndex = BoneIndex;
+		Resolved.Rotation = Operation.Rotation.Quaternion();
+		Resolved.PositionOffset = Operation.PositionOffset;
+	}
+}
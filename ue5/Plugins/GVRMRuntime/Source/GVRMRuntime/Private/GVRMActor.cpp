@@ -3,8 +3,10 @@
 
 #include "GVRMActor.h"
 #include "NiagaraDataInterfaceGVRM.h"
-#include "DrawDebugHelpers.h"
+#include "GVRMSpringBoneSubsystem.h"
+#include "GVRMStats.h"
 #include "Engine/World.h"
+#include "Engine/SkinnedAsset.h"
 
 AGVRMActor::AGVRMActor()
 {
@@ -22,6 +24,11 @@ AGVRMActor::AGVRMActor()
 	SplatNiagaraSystem = CreateDefaultSubobject<UNiagaraComponent>(TEXT("SplatNiagaraSystem"));
 	SplatNiagaraSystem->SetupAttachment(VRMSkeletalMesh);
 	SplatNiagaraSystem->bAutoActivate = false; // We'll activate manually after initialization
+
+	// Create splat component (hidden until selected as the renderer)
+	SplatComponent = CreateDefaultSubobject<UGVRMSplatComponent>(TEXT("SplatComponent"));
+	SplatComponent->SetupAttachment(VRMSkeletalMesh);
+	SplatComponent->SetVisibility(false);
 }
 
 void AGVRMActor::BeginPlay()
@@ -38,6 +45,22 @@ void AGVRMActor::BeginPlay()
 	}
 }
 
+void AGVRMActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UGVRMSpringBoneSubsystem* SpringBones = GetWorld() ? GetWorld()->GetSubsystem<UGVRMSpringBoneSubsystem>() : nullptr)
+	{
+		SpringBones->UnregisterAvatar(VRMSkeletalMesh);
+	}
+	if (VRMSkeletalMesh && SkeletalMeshTransformHandle.IsValid())
+	{
+		VRMSkeletalMesh->TransformUpdated.Remove(SkeletalMeshTransformHandle);
+		SkeletalMeshTransformHandle.Reset();
+	}
+	RemoveSplatBounds();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AGVRMActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -45,11 +68,8 @@ void AGVRMActor::Tick(float DeltaTime)
 	// Update performance stats
 	UpdatePerformanceStats(DeltaTime);
 
-	// Draw debug visualization if enabled
-	if (bShowDebugInfo)
-	{
-		DrawDebugVisualization();
-	}
+	// Forward the debug toggles (also turns the view off again)
+	DrawDebugVisualization();
 }
 
 bool AGVRMActor::InitializeGVRM()
@@ -71,6 +91,21 @@ bool AGVRMActor::InitializeGVRM()
 		return false;
 	}
 
+	// Cooked binding data streams its splats in after load. The splat component
+	// starts drawing with the first chunk; Niagara needs the final particle count.
+	const bool bNeedsAllSplats = SplatRenderer != EGVRMSplatRenderer::SplatComponent;
+	if (!BindingData->AreSplatStreamsComplete() && (bNeedsAllSplats || BindingData->GetSplatCount() == 0))
+	{
+		if (!SplatStreamsHandle.IsValid())
+		{
+			SplatStreamsHandle = BindingData->OnSplatStreamsUpdated.AddUObject(this, &AGVRMActor::HandleSplatStreamsUpdated);
+			BindingData->RequestSplatStreams();
+			UE_LOG(LogTemp, Log, TEXT("AGVRMActor::InitializeGVRM - Waiting for splat streams of %s (%d of %d splats)"),
+				*BindingData->GetName(), BindingData->GetSplatCount(), BindingData->GetTotalSplatCount());
+		}
+		return true;
+	}
+
 	// Validate binding data
 	FString ValidationError;
 	if (!BindingData->ValidateBindings(ValidationError))
@@ -95,6 +130,74 @@ bool AGVRMActor::InitializeGVRM()
 		ApplyBoneOperations();
 	}
 
+	if (SplatRenderer == EGVRMSplatRenderer::SplatComponent)
+	{
+		if (!SetupSplatComponent())
+		{
+			const FString ErrorMsg = TEXT("Failed to setup splat component (binding data has no Gaussians)");
+			UE_LOG(LogTemp, Error, TEXT("AGVRMActor::InitializeGVRM - %s"), *ErrorMsg);
+			OnGVRMInitializationFailed.Broadcast(ErrorMsg);
+			return false;
+		}
+	}
+	else
+	{
+		if (AnimationCache)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AGVRMActor::InitializeGVRM - Animation caches play on the SplatComponent renderer only; ignoring %s"), *AnimationCache->GetName());
+		}
+
+		if (!SetupNiagaraSystem())
+		{
+			return false;
+		}
+	}
+
+	SetupSpringBones();
+	SetupSplatBounds();
+
+	// Activate splat rendering
+	if (bAutoActivateSplats)
+	{
+		ActivateSplats();
+	}
+
+	// Mark as initialized
+	bIsInitialized = true;
+	ActiveSplatCount = BindingData->GetSplatCount();
+
+	// Keep ActiveSplatCount in step with the remaining chunks
+	if (!BindingData->AreSplatStreamsComplete() && !SplatStreamsHandle.IsValid())
+	{
+		SplatStreamsHandle = BindingData->OnSplatStreamsUpdated.AddUObject(this, &AGVRMActor::HandleSplatStreamsUpdated);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("AGVRMActor::InitializeGVRM - Initialization successful (%d splats)"), ActiveSplatCount);
+	OnGVRMInitialized.Broadcast();
+
+	return true;
+}
+
+void AGVRMActor::HandleSplatStreamsUpdated()
+{
+	if (!bIsInitialized)
+	{
+		InitializeGVRM();
+	}
+	else if (BindingData)
+	{
+		ActiveSplatCount = BindingData->GetSplatCount();
+	}
+
+	if (bIsInitialized && BindingData && BindingData->AreSplatStreamsComplete())
+	{
+		BindingData->OnSplatStreamsUpdated.Remove(SplatStreamsHandle);
+		SplatStreamsHandle.Reset();
+	}
+}
+
+bool AGVRMActor::SetupNiagaraSystem()
+{
 	// Setup Niagara system
 	if (SplatNiagaraSystemAsset)
 	{
@@ -118,19 +221,35 @@ bool AGVRMActor::InitializeGVRM()
 		return false;
 	}
 
-	// Activate Niagara system
-	if (bAutoActivateSplats)
+	return true;
+}
+
+bool AGVRMActor::SetupSplatComponent()
+{
+	if (!SplatComponent || !VRMSkeletalMesh || !BindingData)
 	{
-		ActivateSplats();
+		return false;
 	}
 
-	// Mark as initialized
-	bIsInitialized = true;
-	ActiveSplatCount = BindingData->GetSplatCount();
+	if (BindingData->Gaussians.Num() != BindingData->GetSplatCount())
+	{
+		return false;
+	}
 
-	UE_LOG(LogTemp, Log, TEXT("AGVRMActor::InitializeGVRM - Initialization successful (%d splats)"), ActiveSplatCount);
-	OnGVRMInitialized.Broadcast();
+	SplatComponent->SetSkeletalMeshComponent(VRMSkeletalMesh);
+	SplatComponent->SetBindingData(BindingData);
+	SplatComponent->SetAnimationCache(AnimationCache);
+	SplatComponent->SetSkinningMode(SkinningMode);
+	SplatComponent->RigidSkinningMinLOD = RigidSkinningMinLOD;
 
+	if (SplatComponent->IsPlayingAnimationCache())
+	{
+		// The cache holds the pose; skip animation and bone updates entirely
+		VRMSkeletalMesh->SetComponentTickEnabled(false);
+		UE_LOG(LogTemp, Log, TEXT("AGVRMActor::SetupSplatComponent - Playing animation cache %s"), *AnimationCache->GetName());
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("AGVRMActor::SetupSplatComponent - Splat component configured with skeletal mesh"));
 	return true;
 }
 
@@ -158,6 +277,10 @@ bool AGVRMActor::SetupNiagaraDataInterface()
 	// Set skeletal mesh component reference
 	GVRMNDI->SkeletalMeshComponent = VRMSkeletalMesh;
 
+	// Binding data supplies the LOD vertex remaps
+	GVRMNDI->BindingData = BindingData;
+	GVRMNDI->SkinningMode = SkinningMode;
+
 	UE_LOG(LogTemp, Log, TEXT("AGVRMActor::SetupNiagaraDataInterface - NDI configured with skeletal mesh"));
 	return true;
 }
@@ -176,40 +299,167 @@ void AGVRMActor::ApplyBoneOperations()
 		return;
 	}
 
-	int32 AppliedCount = 0;
+	if (BindingData->BoneOperations.Num() == 0)
+	{
+		return;
+	}
 
+	// The pose is modified by FAnimNode_GVRMBoneOperations ("GVRM Bone Operations" in the
+	// animation blueprint), which resolves the bones once per LOD; only report what it will find
+	const FReferenceSkeleton& RefSkeleton = SkelComp->SkeletalMesh->GetRefSkeleton();
+	TArray<FString> MissingBones;
 	for (const FGVRMBoneOperation& BoneOp : BindingData->BoneOperations)
 	{
-		// Find bone index by name
-		FName BoneName(*BoneOp.BoneName);
-		int32 BoneIndex = SkelComp->GetBoneIndex(BoneName);
-
-		if (BoneIndex == INDEX_NONE)
+		if (RefSkeleton.FindBoneIndex(FName(*BoneOp.BoneName)) == INDEX_NONE)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("AGVRMActor::ApplyBoneOperations - Bone not found: %s"), *BoneOp.BoneName);
-			continue;
+			MissingBones.Add(BoneOp.BoneName);
 		}
+	}
 
-		// Get current bone transform
-		FTransform BoneTransform = SkelComp->GetBoneTransform(BoneIndex);
+	const int32 NumResolved = BindingData->BoneOperations.Num() - MissingBones.Num();
+	if (MissingBones.Num() > 0)
+	{
+		// One line per actor, however many bones the mesh lacks
+		UE_LOG(LogTemp, Warning, TEXT("AGVRMActor::ApplyBoneOperations - %d of %d bone operations resolve on %s (not found: %s); add a GVRM Bone Operations node with this binding data to its animation blueprint to apply them"),
+			NumResolved, BindingData->BoneOperations.Num(), *SkelComp->SkeletalMesh->GetName(), *FString::Join(MissingBones, TEXT(", ")));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("AGVRMActor::ApplyBoneOperations - %d of %d bone operations resolve on %s; add a GVRM Bone Operations node with this binding data to its animation blueprint to apply them"),
+			NumResolved, BindingData->BoneOperations.Num(), *SkelComp->SkeletalMesh->GetName());
+	}
+}
+
+void AGVRMActor::SetupSpringBones()
+{
+	UGVRMSpringBoneSubsystem* SpringBones = GetWorld() ? GetWorld()->GetSubsystem<UGVRMSpringBoneSubsystem>() : nullptr;
+	if (!SpringBones || !VRMSkeletalMesh)
+	{
+		return;
+	}
+
+	// A playing animation cache already holds the whole pose
+	const bool bPlayingCache = SplatRenderer == EGVRMSplatRenderer::SplatComponent && SplatComponent && SplatComponent->IsPlayingAnimationCache();
+	if (!bSimulateSpringBones || !BindingData || BindingData->SpringChains.Num() == 0 || bPlayingCache)
+	{
+		SpringBones->UnregisterAvatar(VRMSkeletalMesh);
+		return;
+	}
+
+	FString ErrorMessage;
+	if (!SpringBones->RegisterAvatar(VRMSkeletalMesh, BindingData, ErrorMessage))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AGVRMActor::SetupSpringBones - %s"), *ErrorMessage);
+		return;
+	}
+
+	// Teleports restart the chains instead of swinging them across the jump
+	if (!SkeletalMeshTransformHandle.IsValid())
+	{
+		SkeletalMeshTransformHandle = VRMSkeletalMesh->TransformUpdated.AddUObject(this, &AGVRMActor::HandleSkeletalMeshTransformUpdated);
+	}
+
+	// The renderers read the solved pose when they tick
+	if (SplatRenderer == EGVRMSplatRenderer::SplatComponent)
+	{
+		SplatComponent->PrimaryComponentTick.AddPrerequisite(SpringBones, SpringBones->GetTickFunction());
+	}
+	else
+	{
+		SplatNiagaraSystem->SetTickBehavior(ENiagaraTickBehavior::ForceTickLast);
+	}
+}
+
+void AGVRMActor::HandleSkeletalMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (Teleport != ETeleportType::TeleportPhysics)
+	{
+		return;
+	}
+
+	if (UGVRMSpringBoneSubsystem* SpringBones = UGVRMSpringBoneSubsystem::Find(VRMSkeletalMesh))
+	{
+		SpringBones->ResetAvatar(VRMSkeletalMesh);
+	}
+}
+
+void AGVRMActor::SetupSplatBounds()
+{
+	RemoveSplatBounds();
+
+	// The splat component computes its own bounds from the same boxes
+	if (!bPushSplatBounds || SplatRenderer != EGVRMSplatRenderer::Niagara || !VRMSkeletalMesh || !SplatNiagaraSystem)
+	{
+		return;
+	}
 
-		// Apply position offset
-		BoneTransform.AddToTranslation(BoneOp.PositionOffset);
+	// The spring bones solve after the pose is finalized; wait for them so the bounds hold this frame's springs
+	if (UGVRMSpringBoneSubsystem* SpringBones = UGVRMSpringBoneSubsystem::Find(VRMSkeletalMesh))
+	{
+		SpringBonesSolvedHandle = SpringBones->OnSolved().AddUObject(this, &AGVRMActor::UpdateSplatBounds);
+		return;
+	}
 
-		// Apply rotation
-		FQuat RotationQuat = BoneOp.Rotation.Quaternion();
-		BoneTransform.SetRotation(BoneTransform.GetRotation() * RotationQuat);
+	BoneTransformsFinalizedHandle = VRMSkeletalMesh->RegisterOnBoneTransformsFinalizedDelegate(
+		FOnBoneTransformsFinalizedMultiCast::FDelegate::CreateUObject(this, &AGVRMActor::UpdateSplatBounds));
+}
 
-		// Note: SetBoneTransformByName was removed in UE5.3+
-		// Bone operations should be applied through Animation Blueprints or Control Rig
-		// For now, this function serves as a reference for bone operation data
-		// TODO: Implement bone operations through Animation Blueprint or Control Rig system
-		UE_LOG(LogTemp, Warning, TEXT("AGVRMActor::ApplyBoneOperations - Bone transform application requires Animation BP integration (bone: %s)"), *BoneName.ToString());
+void AGVRMActor::RemoveSplatBounds()
+{
+	if (VRMSkeletalMesh && BoneTransformsFinalizedHandle.IsValid())
+	{
+		VRMSkeletalMesh->UnregisterOnBoneTransformsFinalizedDelegate(BoneTransformsFinalizedHandle);
+	}
+	BoneTransformsFinalizedHandle.Reset();
 
-		AppliedCount++;
+	// Looked up on the world: the avatar may already be unregistered from the solver
+	UGVRMSpringBoneSubsystem* SpringBones = GetWorld() ? GetWorld()->GetSubsystem<UGVRMSpringBoneSubsystem>() : nullptr;
+	if (SpringBones && SpringBonesSolvedHandle.IsValid())
+	{
+		SpringBones->OnSolved().Remove(SpringBonesSolvedHandle);
 	}
+	SpringBonesSolvedHandle.Reset();
 
-	UE_LOG(LogTemp, Log, TEXT("AGVRMActor::ApplyBoneOperations - Applied %d bone operations"), AppliedCount);
+	SplatBounds.Reset();
+	SplatBoundsPose.Reset();
+}
+
+void AGVRMActor::UpdateSplatBounds()
+{
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatBounds);
+
+	const USkeletalMesh* Mesh = VRMSkeletalMesh ? VRMSkeletalMesh->SkeletalMesh : nullptr;
+	if (!BindingData || !Mesh)
+	{
+		return;
+	}
+
+	// Measured once, then extended with each streamed chunk (splats are never dropped)
+	if (!SplatBounds.IsBuiltFor(Mesh, BindingData))
+	{
+		FString ErrorMessage;
+		if (!SplatBounds.Build(*Mesh, *BindingData, ErrorMessage))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AGVRMActor - %s: no splat bounds (%s), keeping the Niagara system's own"), *GetName(), *ErrorMessage);
+		}
+	}
+
+	// Called after this frame's solve when spring bones are simulated (see SetupSplatBounds)
+	SplatBoundsPose = VRMSkeletalMesh->GetComponentSpaceTransforms();
+	if (const UGVRMSpringBoneSubsystem* SpringBones = UGVRMSpringBoneSubsystem::Find(VRMSkeletalMesh))
+	{
+		SpringBones->ApplyToPose(VRMSkeletalMesh, SplatBoundsPose);
+	}
+
+	const FBox MeshBounds = SplatBounds.Calculate(SplatBoundsPose);
+	if (!MeshBounds.IsValid)
+	{
+		return;
+	}
+
+	// Fixed bounds are in the Niagara component's local space
+	const FTransform MeshToSystem = VRMSkeletalMesh->GetComponentTransform().GetRelativeTransform(SplatNiagaraSystem->GetComponentTransform());
+	SplatNiagaraSystem->SetSystemFixedBounds(MeshBounds.ExpandBy(SplatBoundsPadding).TransformBy(MeshToSystem));
 }
 
 void AGVRMActor::ApplyModelScale()
@@ -233,6 +483,16 @@ void AGVRMActor::ApplyModelScale()
 
 void AGVRMActor::ActivateSplats()
 {
+	if (SplatRenderer == EGVRMSplatRenderer::SplatComponent)
+	{
+		if (SplatComponent && !SplatComponent->IsVisible())
+		{
+			SplatComponent->SetVisibility(true);
+			UE_LOG(LogTemp, Log, TEXT("AGVRMActor::ActivateSplats - Splat component shown"));
+		}
+		return;
+	}
+
 	if (SplatNiagaraSystem && !SplatNiagaraSystem->IsActive())
 	{
 		SplatNiagaraSystem->Activate(true);
@@ -242,6 +502,12 @@ void AGVRMActor::ActivateSplats()
 
 void AGVRMActor::DeactivateSplats()
 {
+	if (SplatComponent && SplatComponent->IsVisible())
+	{
+		SplatComponent->SetVisibility(false);
+		UE_LOG(LogTemp, Log, TEXT("AGVRMActor::DeactivateSplats - Splat component hidden"));
+	}
+
 	if (SplatNiagaraSystem && SplatNiagaraSystem->IsActive())
 	{
 		SplatNiagaraSystem->Deactivate();
@@ -278,32 +544,21 @@ float AGVRMActor::GetCurrentFPS() const
 
 void AGVRMActor::DrawDebugVisualization()
 {
-	UWorld* World = GetWorld();
-	if (!World || !VRMSkeletalMesh || !bIsInitialized)
+	if (!SplatComponent)
 	{
 		return;
 	}
 
-	// Show bones
-	if (bShowBones)
-	{
-		const TArray<FTransform>& BoneTransforms = VRMSkeletalMesh->GetComponentSpaceTransforms();
-		for (int32 i = 0; i < BoneTransforms.Num(); ++i)
-		{
-			FVector BonePos = VRMSkeletalMesh->GetComponentTransform().TransformPosition(
-				BoneTransforms[i].GetLocation()
-			);
-			DrawDebugSphere(World, BonePos, 2.0f, 8, FColor::Green, false, 0.0f, 0, 0.5f);
-		}
-	}
+	// No per-element game thread drawing: the splat component's proxy draws joints, sampled
+	// vertices and vertex-to-splat lines from the buffers it skinned this frame
+	const bool bDrawBones = bShowDebugInfo && bShowBones;
+	const bool bDrawVertices = bShowDebugInfo && bShowVertices;
+	SplatComponent->SetDebugDraw(bDrawBones, bDrawVertices);
 
-	// Show vertices (sampled every 100 vertices to avoid performance hit)
-	// Note: Vertex visualization disabled in UE5.3+ due to API changes
-	// TODO: Implement proper vertex visualization using UE5.3+ skeletal mesh APIs
-	// Previous implementation used ComputeSkinnedPositions which requires additional parameters in UE5.3+
-	if (bShowVertices && BindingData)
+	if ((bDrawBones || bDrawVertices) && SplatRenderer != EGVRMSplatRenderer::SplatComponent && !bLoggedDebugRendererWarning)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AGVRMActor::DrawDebugVisualization - Vertex visualization not yet implemented for UE5.3+"));
+		bLoggedDebugRendererWarning = true;
+		UE_LOG(LogTemp, Warning, TEXT("AGVRMActor::DrawDebugVisualization - Bone and vertex visualization requires the SplatComponent renderer"));
 	}
 }
 
@@ -0,0 +1,644 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMAnimationCache.h"
+#include "GVRMSkinningData.h"
+#include "GVRMSkinningMath.h"
+#include "GVRMRenderUtils.h"
+#include "GVRMMemoryReport.h"
+#include "GVRMStats.h"
+#include "RenderingThread.h"
+
+#if WITH_EDITOR
+#include "NiagaraDataInterfaceGVRM.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimationPoseData.h"
+#include "Animation/AttributesRuntime.h"
+#include "AnimationRuntime.h"
+#include "BonePose.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Async/ParallelFor.h"
+#endif
+
+/**
+ * Frame encoding shared by the bake and the CPU decode.
+ * Must match GVRMSplatCache.usf.
+ */
+namespace GVRMAnimationCacheCodec
+{
+	/** Largest magnitude of the three smallest components of a unit quaternion */
+	constexpr float SmallestThreeRange = 0.70710678f;
+
+	uint32 QuantizeSigned(float Value, uint32 MaxValue)
+	{
+		const float Normalized = (FMath::Clamp(Value, -SmallestThreeRange, SmallestThreeRange) + SmallestThreeRange) / (2.0f * SmallestThreeRange);
+		return static_cast<uint32>(FMath::RoundToInt(Normalized * MaxValue));
+	}
+
+	float DequantizeSigned(uint32 Value, float MaxValue)
+	{
+		return (Value / MaxValue) * (2.0f * SmallestThreeRange) - SmallestThreeRange;
+	}
+
+	uint32 FloatBits(float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	float BitsFloat(uint32 Bits)
+	{
+		float Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	void EncodeRotation(FVector4f Rotation, uint32& OutA16, uint32& OutPacked)
+	{
+		Rotation = GVRMSkinning::NormalizeQuaternion(Rotation);
+
+		int32 LargestIndex = 0;
+		for (int32 Component = 1; Component < 4; ++Component)
+		{
+			if (FMath::Abs(Rotation[Component]) > FMath::Abs(Rotation[LargestIndex]))
+			{
+				LargestIndex = Component;
+			}
+		}
+
+		// q and -q are the same rotation; keep the dropped component positive
+		if (Rotation[LargestIndex] < 0.0f)
+		{
+			Rotation = -Rotation;
+		}
+
+		float Smallest[3];
+		int32 NumSmallest = 0;
+		for (int32 Component = 0; Component < 4; ++Component)
+		{
+			if (Component != LargestIndex)
+			{
+				Smallest[NumSmallest++] = Rotation[Component];
+			}
+		}
+
+		OutA16 = QuantizeSigned(Smallest[0], 65535);
+		OutPacked = QuantizeSigned(Smallest[1], 32767) | (QuantizeSigned(Smallest[2], 32767) << 15) | (static_cast<uint32>(LargestIndex) << 30);
+	}
+
+	FVector4f DecodeRotation(uint32 A16, uint32 Packed)
+	{
+		const float A = DequantizeSigned(A16, 65535.0f);
+		const float B = DequantizeSigned(Packed & 0x7FFF, 32767.0f);
+		const float C = DequantizeSigned((Packed >> 15) & 0x7FFF, 32767.0f);
+		const float D = FMath::Sqrt(FMath::Clamp(1.0f - A * A - B * B - C * C, 0.0f, 1.0f));
+
+		switch (Packed >> 30)
+		{
+		case 0: return FVector4f(D, A, B, C);
+		case 1: return FVector4f(A, D, B, C);
+		case 2: return FVector4f(A, B, D, C);
+		default: return FVector4f(A, B, C, D);
+		}
+	}
+
+	/** Encode one frame into OutWords (FrameStride words) */
+	void EncodeFrame(TConstArrayView<FVector3f> Positions, TConstArrayView<FVector4f> Rotations, TConstArrayView<FVector3f> BindPositions,
+		int32 ClusterSize, uint32 SplatDataOffset, uint32* OutWords)
+	{
+		const int32 NumSplats = Positions.Num();
+		const int32 NumClusters = FMath::DivideAndRoundUp(NumSplats, ClusterSize);
+
+		for (int32 Cluster = 0; Cluster < NumClusters; ++Cluster)
+		{
+			const int32 First = Cluster * ClusterSize;
+			const int32 Last = FMath::Min(First + ClusterSize, NumSplats);
+
+			FVector3f RangeMin(UE_MAX_FLT);
+			FVector3f RangeMax(-UE_MAX_FLT);
+			for (int32 SplatIndex = First; SplatIndex < Last; ++SplatIndex)
+			{
+				const FVector3f Delta = Positions[SplatIndex] - BindPositions[SplatIndex];
+				RangeMin = RangeMin.ComponentMin(Delta);
+				RangeMax = RangeMax.ComponentMax(Delta);
+			}
+			const FVector3f RangeScale = RangeMax - RangeMin;
+
+			uint32* ClusterWords = OutWords + Cluster * 6;
+			ClusterWords[0] = FloatBits(RangeMin.X);
+			ClusterWords[1] = FloatBits(RangeMin.Y);
+			ClusterWords[2] = FloatBits(RangeMin.Z);
+			ClusterWords[3] = FloatBits(RangeScale.X);
+			ClusterWords[4] = FloatBits(RangeScale.Y);
+			ClusterWords[5] = FloatBits(RangeScale.Z);
+
+			for (int32 SplatIndex = First; SplatIndex < Last; ++SplatIndex)
+			{
+				const FVector3f Delta = Positions[SplatIndex] - BindPositions[SplatIndex];
+				uint32 Quantized[3];
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					Quantized[Axis] = RangeScale[Axis] > 0.0f
+						? static_cast<uint32>(FMath::Clamp(FMath::RoundToInt((Delta[Axis] - RangeMin[Axis]) / RangeScale[Axis] * 65535.0f), 0, 65535))
+						: 0;
+				}
+
+				uint32 A16;
+				uint32 Packed;
+				EncodeRotation(Rotations[SplatIndex], A16, Packed);
+
+				uint32* SplatWords = OutWords + SplatDataOffset + SplatIndex * 3;
+				SplatWords[0] = Quantized[0] | (Quantized[1] << 16);
+				SplatWords[1] = Quantized[2] | (A16 << 16);
+				SplatWords[2] = Packed;
+			}
+		}
+	}
+
+	/** Decode one splat of an encoded frame */
+	void DecodeSplat(const uint32* FrameWords, int32 SplatIndex, int32 ClusterSize, uint32 SplatDataOffset, const FVector3f& BindPosition,
+		FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		const uint32* ClusterWords = FrameWords + (SplatIndex / ClusterSize) * 6;
+		const FVector3f RangeMin(BitsFloat(ClusterWords[0]), BitsFloat(ClusterWords[1]), BitsFloat(ClusterWords[2]));
+		const FVector3f RangeScale(BitsFloat(ClusterWords[3]), BitsFloat(ClusterWords[4]), BitsFloat(ClusterWords[5]));
+
+		const uint32* SplatWords = FrameWords + SplatDataOffset + SplatIndex * 3;
+		const FVector3f Quantized(SplatWords[0] & 0xFFFF, SplatWords[0] >> 16, SplatWords[1] & 0xFFFF);
+
+		OutPosition = BindPosition + RangeMin + Quantized / 65535.0f * RangeScale;
+		OutRotation = DecodeRotation(SplatWords[1] >> 16, SplatWords[2]);
+	}
+}
+
+// ============================================
+// FGVRMAnimationCacheResource
+// ============================================
+
+void FGVRMAnimationCacheResource::InitRHI(FRHICommandListBase& RHICmdList)
+{
+	using namespace GVRMRender;
+
+	UploadBuffer(TEXT("GVRMAnimationCacheFrames"), PendingFrameData, sizeof(uint32), PF_R32_UINT,
+		FrameDataBuffer, FrameDataSRV);
+	UploadBuffer(TEXT("GVRMAnimationCacheBindPositions"), PendingBindPositions, sizeof(FVector4f), PF_A32B32G32R32F,
+		BindPositionsBuffer, BindPositionsSRV);
+
+	// The GPU copies are all that is needed from here on
+	PendingFrameData.Empty();
+	PendingBindPositions.Empty();
+}
+
+void FGVRMAnimationCacheResource::ReleaseRHI()
+{
+	GVRMRender::ReleaseBuffer(FrameDataBuffer, FrameDataSRV);
+	GVRMRender::ReleaseBuffer(BindPositionsBuffer, BindPositionsSRV);
+}
+
+// ============================================
+// UGVRMAnimationCache
+// ============================================
+
+float UGVRMAnimationCache::GetDuration() const
+{
+	return NumFrames > 1 && SampleRate > 0.0f ? (NumFrames - 1) / SampleRate : 0.0f;
+}
+
+void UGVRMAnimationCache::GetFramesAtTime(float Time, int32& OutFrame0, int32& OutFrame1, float& OutAlpha) const
+{
+	OutFrame0 = 0;
+	OutFrame1 = 0;
+	OutAlpha = 0.0f;
+
+	if (NumFrames <= 1 || SampleRate <= 0.0f)
+	{
+		return;
+	}
+
+	// The last baked frame is the end of the animation (the loop point for looping caches)
+	const float LastFrame = static_cast<float>(NumFrames - 1);
+	float FramePosition = Time * SampleRate;
+	if (bLooping)
+	{
+		FramePosition = FMath::Fmod(FramePosition, LastFrame);
+		if (FramePosition < 0.0f)
+		{
+			FramePosition += LastFrame;
+		}
+	}
+	else
+	{
+		FramePosition = FMath::Clamp(FramePosition, 0.0f, LastFrame);
+	}
+
+	OutFrame0 = FMath::Min(FMath::FloorToInt(FramePosition), NumFrames - 1);
+	OutFrame1 = FMath::Min(OutFrame0 + 1, NumFrames - 1);
+	OutAlpha = FramePosition - OutFrame0;
+}
+
+void UGVRMAnimationCache::FinishFrameRead()
+{
+	PendingFrameRequest->WaitCompletion();
+	PendingFrameRequest.Reset();
+	FrameData = MoveTemp(FrameReadBuffer);
+}
+
+const TArray<uint32>& UGVRMAnimationCache::GetFrameData()
+{
+	// A background read already on its way is finished rather than issued again
+	if (PendingFrameRequest)
+	{
+		FinishFrameRead();
+	}
+
+	const int64 BulkDataSize = FrameBulkData.GetBulkDataSize();
+	if (FrameData.Num() == 0 && BulkDataSize > 0)
+	{
+		LLM_SCOPE_BYTAG(GVRM_AnimationCache);
+		FrameData.SetNumUninitialized(BulkDataSize / sizeof(uint32));
+		void* Dest = FrameData.GetData();
+		FrameBulkData.GetCopy(&Dest, false);
+	}
+	return FrameData;
+}
+
+FGVRMAnimationCacheResource* UGVRMAnimationCache::RequestResource()
+{
+	check(IsInGameThread());
+
+	if (!bResourceRequested)
+	{
+		// Frames still on disk are read on an IO thread; the game thread only polls
+		const int64 BulkDataSize = FrameBulkData.GetBulkDataSize();
+		if (FrameData.Num() == 0 && BulkDataSize > 0 && !FrameBulkData.IsBulkDataLoaded())
+		{
+			if (!PendingFrameRequest)
+			{
+				LLM_SCOPE_BYTAG(GVRM_AnimationCache);
+				FrameReadBuffer.SetNumUninitialized(BulkDataSize / sizeof(uint32));
+				PendingFrameRequest.Reset(FrameBulkData.CreateStreamingRequest(AIOP_BelowNormal, nullptr, reinterpret_cast<uint8*>(FrameReadBuffer.GetData())));
+				if (!PendingFrameRequest)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("UGVRMAnimationCache::RequestResource - %s: background read failed, reading the frames now"), *GetPathName());
+					FrameReadBuffer.Empty();
+				}
+			}
+
+			if (PendingFrameRequest)
+			{
+				if (!PendingFrameRequest->PollCompletion())
+				{
+					return nullptr;
+				}
+				FinishFrameRead();
+			}
+		}
+
+		GetFrameData();
+		if (NumSplats == 0 || NumFrames == 0 || BindPositions.Num() != NumSplats
+			|| FrameData.Num() != static_cast<int64>(GetFrameStride()) * NumFrames)
+		{
+			return nullptr;
+		}
+
+		// The CPU copy is not kept; DecodeFrame reads the bulk data again if asked
+		LLM_SCOPE_BYTAG(GVRM_AnimationCache);
+		Resource.PendingFrameData = MoveTemp(FrameData);
+		Resource.PendingBindPositions.SetNumUninitialized(NumSplats);
+		for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+		{
+			Resource.PendingBindPositions[SplatIndex] = FVector4f(BindPositions[SplatIndex], 0.0f);
+		}
+
+		BeginInitResource(&Resource);
+		bResourceRequested = true;
+	}
+
+	return &Resource;
+}
+
+bool UGVRMAnimationCache::DecodeFrame(int32 FrameIndex, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations)
+{
+	const TArray<uint32>& Data = GetFrameData();
+	const uint32 FrameStride = GetFrameStride();
+	if (FrameIndex < 0 || FrameIndex >= NumFrames || BindPositions.Num() != NumSplats
+		|| Data.Num() < static_cast<int64>(FrameStride) * (FrameIndex + 1))
+	{
+		return false;
+	}
+
+	OutPositions.SetNumUninitialized(NumSplats);
+	OutRotations.SetNumUninitialized(NumSplats);
+
+	const uint32* FrameWords = Data.GetData() + static_cast<int64>(FrameStride) * FrameIndex;
+	const uint32 SplatDataOffset = GetSplatDataOffset();
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		GVRMAnimationCacheCodec::DecodeSplat(FrameWords, SplatIndex, ClusterSize, SplatDataOffset, BindPositions[SplatIndex],
+			OutPositions[SplatIndex], OutRotations[SplatIndex]);
+	}
+	return true;
+}
+
+void UGVRMAnimationCache::Serialize(FArchive& Ar)
+{
+	LLM_SCOPE_BYTAG(GVRM_AnimationCache);
+	Super::Serialize(Ar);
+	FrameBulkData.Serialize(Ar, this);
+}
+
+void UGVRMAnimationCache::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	if (PendingFrameRequest)
+	{
+		PendingFrameRequest->Cancel();
+	}
+
+	if (bResourceRequested)
+	{
+		BeginReleaseResource(&Resource);
+		ReleaseFence.BeginFence();
+		bResourceRequested = false;
+	}
+}
+
+bool UGVRMAnimationCache::IsReadyForFinishDestroy()
+{
+	if (PendingFrameRequest)
+	{
+		if (!PendingFrameRequest->PollCompletion())
+		{
+			return false;
+		}
+		PendingFrameRequest.Reset();
+	}
+	return Super::IsReadyForFinishDestroy() && ReleaseFence.IsFenceComplete();
+}
+
+void UGVRMAnimationCache::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	FGVRMMemoryBreakdown Breakdown;
+	GetMemoryBreakdown(Breakdown);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Breakdown.GetCPUBytes());
+	CumulativeResourceSize.AddDedicatedVideoMemoryBytes(Breakdown.GetGPUBytes());
+}
+
+void UGVRMAnimationCache::GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const
+{
+	OutBreakdown.AddArray(TEXT("BindPositions"), BindPositions);
+	OutBreakdown.AddArray(TEXT("FrameData"), FrameData);
+	OutBreakdown.AddArray(TEXT("FrameReadBuffer"), FrameReadBuffer);
+	OutBreakdown.AddCPU(TEXT("FrameBulkData (loaded)"), FrameBulkData.IsBulkDataLoaded() ? FrameBulkData.GetBulkDataSize() : 0);
+
+	// Sizes of what RequestResource uploaded (the RHI buffers belong to the render thread)
+	if (bResourceRequested)
+	{
+		OutBreakdown.AddGPU(TEXT("FrameData"), static_cast<uint64>(GetFrameStride()) * NumFrames * sizeof(uint32));
+		OutBreakdown.AddGPU(TEXT("BindPositions"), static_cast<uint64>(NumSplats) * sizeof(FVector4f));
+	}
+}
+
+bool UGVRMAnimationCache::EncodeFrames(TArray<FVector3f> InBindPositions, int32 InNumFrames, float InSampleRate,
+	TFunctionRef<void(int32 FrameIndex, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations)> GetFrame, FString& OutErrorMessage)
+{
+	if (InBindPositions.Num() == 0 || InNumFrames <= 0 || InSampleRate <= 0.0f)
+	{
+		OutErrorMessage = TEXT("Bind positions, frames and a positive sample rate are required");
+		return false;
+	}
+
+	LLM_SCOPE_BYTAG(GVRM_AnimationCache);
+
+	// The bulk data is rewritten below; a read of the previous frames must be done with it first
+	if (PendingFrameRequest)
+	{
+		FinishFrameRead();
+	}
+
+	BindPositions = MoveTemp(InBindPositions);
+	NumSplats = BindPositions.Num();
+	NumFrames = InNumFrames;
+	SampleRate = InSampleRate;
+
+	const uint32 FrameStride = GetFrameStride();
+	const uint32 SplatDataOffset = GetSplatDataOffset();
+	TArray<uint32> NewFrameData;
+	NewFrameData.SetNumZeroed(static_cast<int64>(FrameStride) * NumFrames);
+
+	TArray<FVector3f> FramePositions;
+	TArray<FVector4f> FrameRotations;
+
+	Bounds = FBox(ForceInit);
+	double SquaredErrorSum = 0.0;
+	float MaxPositionError = 0.0f;
+	float MinRotationDot = 1.0f;
+
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+	{
+		GetFrame(FrameIndex, FramePositions, FrameRotations);
+		if (FramePositions.Num() != NumSplats || FrameRotations.Num() != NumSplats)
+		{
+			OutErrorMessage = FString::Printf(TEXT("Frame %d has %d positions and %d rotations for %d splats"),
+				FrameIndex, FramePositions.Num(), FrameRotations.Num(), NumSplats);
+			NumFrames = 0;
+			return false;
+		}
+
+		uint32* FrameWords = NewFrameData.GetData() + static_cast<int64>(FrameStride) * FrameIndex;
+		GVRMAnimationCacheCodec::EncodeFrame(FramePositions, FrameRotations, BindPositions, ClusterSize, SplatDataOffset, FrameWords);
+
+		// Measure what playback will actually see
+		for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+		{
+			FVector3f DecodedPosition;
+			FVector4f DecodedRotation;
+			GVRMAnimationCacheCodec::DecodeSplat(FrameWords, SplatIndex, ClusterSize, SplatDataOffset, BindPositions[SplatIndex], DecodedPosition, DecodedRotation);
+
+			const float PositionError = FVector3f::Distance(DecodedPosition, FramePositions[SplatIndex]);
+			SquaredErrorSum += PositionError * PositionError;
+			MaxPositionError = FMath::Max(MaxPositionError, PositionError);
+
+			const FVector4f& Rotation = FrameRotations[SplatIndex];
+			const float Dot = FMath::Abs(Rotation.X * DecodedRotation.X + Rotation.Y * DecodedRotation.Y + Rotation.Z * DecodedRotation.Z + Rotation.W * DecodedRotation.W);
+			MinRotationDot = FMath::Min(MinRotationDot, Dot);
+
+			Bounds += FVector(FramePositions[SplatIndex]);
+		}
+	}
+
+	FrameData = MoveTemp(NewFrameData);
+	FrameBulkData.Lock(LOCK_READ_WRITE);
+	void* BulkData = FrameBulkData.Realloc(FrameData.Num() * sizeof(uint32));
+	FMemory::Memcpy(BulkData, FrameData.GetData(), FrameData.Num() * sizeof(uint32));
+	FrameBulkData.Unlock();
+	FrameBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+
+	const int64 NumSamples = static_cast<int64>(NumFrames) * NumSplats;
+	Report.RawBytes = NumSamples * (sizeof(FVector3f) + sizeof(FVector4f));
+	Report.CompressedBytes = FrameData.Num() * sizeof(uint32) + BindPositions.Num() * sizeof(FVector3f);
+	Report.CompressionRatio = Report.CompressedBytes > 0 ? static_cast<float>(static_cast<double>(Report.RawBytes) / Report.CompressedBytes) : 0.0f;
+	Report.MaxPositionError = MaxPositionError;
+	Report.RMSPositionError = static_cast<float>(FMath::Sqrt(SquaredErrorSum / NumSamples));
+	Report.MaxRotationErrorDegrees = FMath::RadiansToDegrees(2.0f * FMath::Acos(FMath::Clamp(MinRotationDot, 0.0f, 1.0f)));
+
+	// Drop the previous GPU copy; playback requests the new one
+	if (bResourceRequested)
+	{
+		ReleaseResourceAndFlush(&Resource);
+		bResourceRequested = false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UGVRMAnimationCache::EncodeFrames - %s: %d frames x %d splats, %.2f MB -> %.2f MB (%.1fx), position error max %.4f / RMS %.4f cm, rotation error max %.3f deg"),
+		*GetName(), NumFrames, NumSplats, Report.RawBytes / (1024.0 * 1024.0), Report.CompressedBytes / (1024.0 * 1024.0), Report.CompressionRatio,
+		Report.MaxPositionError, Report.RMSPositionError, Report.MaxRotationErrorDegrees);
+
+	MarkPackageDirty();
+	return true;
+}
+
+#if WITH_EDITOR
+bool UGVRMAnimationCache::BakeFromAnimation(UAnimSequence* Animation, USkeletalMesh* SkeletalMesh, const UGVRMBindingData* BindingData, float InSampleRate, FString& OutErrorMessage)
+{
+	if (!Animation || !SkeletalMesh || !BindingData)
+	{
+		OutErrorMessage = TEXT("Animation, skeletal mesh and binding data are required");
+		return false;
+	}
+
+	if (Animation->GetSkeleton() != SkeletalMesh->GetSkeleton())
+	{
+		OutErrorMessage = FString::Printf(TEXT("Animation %s does not use the skeleton of %s"), *Animation->GetName(), *SkeletalMesh->GetName());
+		return false;
+	}
+
+	if (InSampleRate <= 0.0f)
+	{
+		OutErrorMessage = TEXT("Sample rate must be positive");
+		return false;
+	}
+
+	const FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+	if (!RenderData || RenderData->LODRenderData.Num() == 0)
+	{
+		OutErrorMessage = FString::Printf(TEXT("Skeletal mesh %s has no render data"), *SkeletalMesh->GetName());
+		return false;
+	}
+
+	// LOD0 streams, read exactly like the runtime paths
+	FNiagaraDataInterfaceGVRMInstanceData MeshStreams;
+	MeshStreams.CacheLODStreams(RenderData->LODRenderData[0], GVRMSkinning::MaxBoneInfluences, BindingData, nullptr);
+
+	FGVRMSplatGPUData SplatData;
+	SplatData.InitializeFromBindingData(BindingData);
+	const int32 NewNumSplats = SplatData.NumSplats;
+	if (NewNumSplats == 0)
+	{
+		OutErrorMessage = TEXT("Binding data has no splats");
+		return false;
+	}
+
+	for (int32 SplatIndex = 0; SplatIndex < NewNumSplats; ++SplatIndex)
+	{
+		if (!MeshStreams.CachedVertexPositions.IsValidIndex(SplatData.SplatVertexIndices[SplatIndex]))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Splat %d is bound to vertex %d, but %s LOD0 has %d vertices"),
+				SplatIndex, SplatData.SplatVertexIndices[SplatIndex], *SkeletalMesh->GetName(), MeshStreams.CachedVertexPositions.Num());
+			return false;
+		}
+	}
+
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+	const int32 NumBones = RefSkeleton.GetNum();
+	TArray<FMatrix44f> BoneMatrices;
+	BoneMatrices.SetNum(NumBones);
+
+	GVRMSkinning::FSkinningStreams Streams;
+	Streams.VertexPositions = MeshStreams.CachedVertexPositions;
+	Streams.BoneIndices = MeshStreams.CachedBoneIndices;
+	Streams.BoneWeights = MeshStreams.CachedBoneWeights;
+	Streams.ExtraBoneIndices = MeshStreams.CachedExtraBoneIndices;
+	Streams.ExtraBoneWeights = MeshStreams.CachedExtraBoneWeights;
+	Streams.NumInfluences = MeshStreams.NumInfluences;
+	Streams.BoneMatrices = BoneMatrices;
+
+	TArray<FVector3f> FramePositions;
+	TArray<FVector4f> FrameRotations;
+	FramePositions.SetNumUninitialized(NewNumSplats);
+	FrameRotations.SetNumUninitialized(NewNumSplats);
+
+	auto SkinFrame = [&]()
+	{
+		GVRMSkinning::DispatchInfluences(Streams.NumInfluences, [&](auto NumInfluences)
+		{
+			ParallelFor(NewNumSplats, [&](int32 SplatIndex)
+			{
+				GVRMSkinning::SkinSplat<decltype(NumInfluences)::Value>(Streams, SplatData.SplatVertexIndices[SplatIndex], SplatData.SplatRelativePositions[SplatIndex],
+					FramePositions[SplatIndex], FrameRotations[SplatIndex]);
+			});
+		});
+	};
+
+	// Bind pose (reference skeleton in component space)
+	TArray<FTransform> RefComponentSpace;
+	FAnimationRuntime::FillUpComponentSpaceTransforms(RefSkeleton, RefSkeleton.GetRefBonePose(), RefComponentSpace);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		BoneMatrices[BoneIndex] = FMatrix44f(RefComponentSpace[BoneIndex].ToMatrixWithScale());
+	}
+	SkinFrame();
+	TArray<FVector3f> NewBindPositions = FramePositions;
+
+	// Sample the animation on the whole skeleton (end frame included)
+	TArray<FBoneIndexType> RequiredBones;
+	RequiredBones.SetNumUninitialized(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		RequiredBones[BoneIndex] = static_cast<FBoneIndexType>(BoneIndex);
+	}
+	FBoneContainer BoneContainer(RequiredBones, UE::Anim::FCurveFilterSettings(UE::Anim::ECurveFilterMode::DisallowAll), *SkeletalMesh);
+
+	const float Duration = Animation->GetPlayLength();
+	const int32 NewNumFrames = FMath::FloorToInt(Duration * InSampleRate) + 1;
+
+	auto SampleFrame = [&](int32 FrameIndex, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations)
+	{
+		const double Time = FMath::Min(FrameIndex / static_cast<double>(InSampleRate), static_cast<double>(Duration));
+		{
+			FMemMark Mark(FMemStack::Get());
+			FCompactPose Pose;
+			Pose.SetBoneContainer(&BoneContainer);
+			FBlendedCurve Curve;
+			Curve.InitFrom(BoneContainer);
+			UE::Anim::FStackAttributeContainer Attributes;
+			FAnimationPoseData PoseData(Pose, Curve, Attributes);
+			Animation->GetAnimationPose(PoseData, FAnimExtractContext(Time, false));
+
+			FCSPose<FCompactPose> ComponentPose;
+			ComponentPose.InitPose(Pose);
+			for (const FCompactPoseBoneIndex BoneIndex : Pose.ForEachBoneIndex())
+			{
+				const int32 MeshBoneIndex = BoneContainer.MakeMeshPoseIndex(BoneIndex).GetInt();
+				BoneMatrices[MeshBoneIndex] = FMatrix44f(ComponentPose.GetComponentSpaceTransform(BoneIndex).ToMatrixWithScale());
+			}
+		}
+		SkinFrame();
+		OutPositions = FramePositions;
+		OutRotations = FrameRotations;
+	};
+
+	if (!EncodeFrames(MoveTemp(NewBindPositions), NewNumFrames, InSampleRate, SampleFrame, OutErrorMessage))
+	{
+		return false;
+	}
+
+	SourceAnimation = Animation;
+	SourceBindingData = const_cast<UGVRMBindingData*>(BindingData);
+	return true;
+}
+#endif
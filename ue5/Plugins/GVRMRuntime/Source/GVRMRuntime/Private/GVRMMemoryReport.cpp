@@ -0,0 +1,214 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMMemoryReport.h"
+#include "GVRMActor.h"
+#include "GVRMAnimationCache.h"
+#include "GVRMSkinningData.h"
+#include "GVRMSplatComponent.h"
+#include "GVRMSplatSceneProxy.h"
+#include "GVRMSplatRendering.h"
+#include "NiagaraDataInterfaceGVRM.h"
+#include "NiagaraComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "RenderingThread.h"
+#include "UObject/UObjectIterator.h"
+
+namespace GVRMMemoryReport
+{
+	/** One named block of a report (an asset, an actor's component, a batch) */
+	struct FSection
+	{
+		FString Name;
+		FGVRMMemoryBreakdown Breakdown;
+	};
+
+	FString FormatBytes(uint64 Bytes)
+	{
+		if (Bytes >= 1024 * 1024)
+		{
+			return FString::Printf(TEXT("%.2f MB"), Bytes / (1024.0 * 1024.0));
+		}
+		return FString::Printf(TEXT("%.1f KB"), Bytes / 1024.0);
+	}
+
+	void PrintSection(FOutputDevice& Ar, const FSection& Section)
+	{
+		Ar.Logf(TEXT("  %s: CPU %s, GPU %s"), *Section.Name, *FormatBytes(Section.Breakdown.GetCPUBytes()), *FormatBytes(Section.Breakdown.GetGPUBytes()));
+		for (const FGVRMMemoryBreakdown::FEntry& Entry : Section.Breakdown.Entries)
+		{
+			Ar.Logf(TEXT("    %-30s %s %s"), *Entry.Name, Entry.GPUBytes > 0 ? TEXT("GPU") : TEXT("CPU"), *FormatBytes(Entry.CPUBytes + Entry.GPUBytes));
+		}
+	}
+
+	/** Print titled groups of sections and add them to the totals */
+	void PrintGroups(FOutputDevice& Ar, const TMap<FString, TArray<FSection>>& Groups, uint64& InOutCPUBytes, uint64& InOutGPUBytes)
+	{
+		for (const TPair<FString, TArray<FSection>>& Group : Groups)
+		{
+			uint64 GroupCPUBytes = 0;
+			uint64 GroupGPUBytes = 0;
+			for (const FSection& Section : Group.Value)
+			{
+				GroupCPUBytes += Section.Breakdown.GetCPUBytes();
+				GroupGPUBytes += Section.Breakdown.GetGPUBytes();
+			}
+
+			Ar.Logf(TEXT("%s: CPU %s, GPU %s"), *Group.Key, *FormatBytes(GroupCPUBytes), *FormatBytes(GroupGPUBytes));
+			for (const FSection& Section : Group.Value)
+			{
+				PrintSection(Ar, Section);
+			}
+
+			InOutCPUBytes += GroupCPUBytes;
+			InOutGPUBytes += GroupGPUBytes;
+		}
+	}
+
+	FString GetOwnerName(const UActorComponent* Component)
+	{
+		const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+		return Owner ? FString::Printf(TEXT("Actor %s"), *Owner->GetActorNameOrLabel()) : TEXT("Actor (none)");
+	}
+
+	bool IsLiveObject(const UObject* Object)
+	{
+		return Object && !Object->IsTemplate() && IsValid(Object);
+	}
+
+	void Dump(FOutputDevice& Ar)
+	{
+		// Shared assets (counted once, however many actors use them)
+		TMap<FString, TArray<FSection>> AssetGroups;
+		for (TObjectIterator<UGVRMBindingData> It; It; ++It)
+		{
+			if (IsLiveObject(*It))
+			{
+				FSection& Section = AssetGroups.FindOrAdd(TEXT("Binding data")).AddDefaulted_GetRef();
+				Section.Name = It->GetPathName();
+				It->GetMemoryBreakdown(Section.Breakdown);
+			}
+		}
+		for (TObjectIterator<UGVRMAnimationCache> It; It; ++It)
+		{
+			if (IsLiveObject(*It))
+			{
+				FSection& Section = AssetGroups.FindOrAdd(TEXT("Animation caches")).AddDefaulted_GetRef();
+				Section.Name = It->GetPathName();
+				It->GetMemoryBreakdown(Section.Breakdown);
+			}
+		}
+
+		// Per actor: game thread caches now, render thread proxies below
+		TMap<FString, TArray<FSection>> ActorGroups;
+		TArray<TPair<FString, const FGVRMSplatSceneProxy*>> SplatProxies;
+		TArray<TPair<FString, const FNiagaraDataInterfaceGVRMProxy*>> NiagaraProxies;
+
+		for (TObjectIterator<UGVRMSplatComponent> It; It; ++It)
+		{
+			UGVRMSplatComponent* Component = *It;
+			if (!IsLiveObject(Component) || !Component->IsRegistered())
+			{
+				continue;
+			}
+
+			const FString OwnerName = GetOwnerName(Component);
+			FSection& Section = ActorGroups.FindOrAdd(OwnerName).AddDefaulted_GetRef();
+			Section.Name = FString::Printf(TEXT("%s mesh cache (bone palette %d of %d)"), *Component->GetName(),
+				Component->GetMeshCache().NumBones, Component->GetMeshCache().NumSkeletonBones);
+			Component->GetMeshCache().GetMemoryBreakdown(Section.Breakdown);
+
+			if (Component->SceneProxy)
+			{
+				SplatProxies.Emplace(OwnerName, static_cast<const FGVRMSplatSceneProxy*>(Component->SceneProxy));
+			}
+		}
+
+		UNiagaraDataInterfaceGVRM::ForEachInstanceData([&ActorGroups](const FNiagaraDataInterfaceGVRMInstanceData& InstanceData)
+		{
+			const USkeletalMeshComponent* SkelComp = InstanceData.CachedSkeletalMeshComponent.Get();
+			FSection& Section = ActorGroups.FindOrAdd(GetOwnerName(SkelComp)).AddDefaulted_GetRef();
+			Section.Name = FString::Printf(TEXT("Niagara instance cache (bone palette %d of %d)"), InstanceData.NumBones, InstanceData.NumSkeletonBones);
+			InstanceData.GetMemoryBreakdown(Section.Breakdown);
+		});
+
+		for (TObjectIterator<AGVRMActor> It; It; ++It)
+		{
+			AGVRMActor* Actor = *It;
+			if (!IsLiveObject(Actor) || !Actor->SplatNiagaraSystem)
+			{
+				continue;
+			}
+
+			UNiagaraDataInterfaceGVRM* DataInterface = Cast<UNiagaraDataInterfaceGVRM>(Actor->SplatNiagaraSystem->GetDataInterface(FString("GVRM_NDI")));
+			if (const FNiagaraDataInterfaceGVRMProxy* Proxy = DataInterface ? DataInterface->GetProxyAs<FNiagaraDataInterfaceGVRMProxy>() : nullptr)
+			{
+				NiagaraProxies.Emplace(FString::Printf(TEXT("Actor %s"), *Actor->GetActorNameOrLabel()), Proxy);
+			}
+		}
+
+		// Proxies and batches live on the render thread; read them there and wait
+		TArray<FSection> SplatProxySections;
+		TArray<FSection> NiagaraProxySections;
+		TArray<TPair<int32, FGVRMMemoryBreakdown>> BatchBreakdowns;
+		TSharedPtr<FGVRMSplatViewExtension, ESPMode::ThreadSafe> ViewExtension;
+		if (SplatProxies.Num() > 0)
+		{
+			ViewExtension = FGVRMSplatViewExtension::Get();
+		}
+
+		ENQUEUE_RENDER_COMMAND(GVRMMemReport)(
+			[&SplatProxies, &NiagaraProxies, &SplatProxySections, &NiagaraProxySections, &BatchBreakdowns, &ViewExtension](FRHICommandListImmediate& RHICmdList)
+			{
+				for (const TPair<FString, const FGVRMSplatSceneProxy*>& Pair : SplatProxies)
+				{
+					FSection& Section = SplatProxySections.AddDefaulted_GetRef();
+					Section.Name = Pair.Key;
+					Pair.Value->GetMemoryBreakdown_RenderThread(Section.Breakdown);
+				}
+				for (const TPair<FString, const FNiagaraDataInterfaceGVRMProxy*>& Pair : NiagaraProxies)
+				{
+					FSection& Section = NiagaraProxySections.AddDefaulted_GetRef();
+					Section.Name = Pair.Key;
+					Pair.Value->GetMemoryBreakdown_RenderThread(Section.Breakdown);
+				}
+				if (ViewExtension.IsValid())
+				{
+					ViewExtension->GetBatchMemoryBreakdowns_RenderThread(BatchBreakdowns);
+				}
+			}
+		);
+		FlushRenderingCommands();
+
+		for (FSection& Section : SplatProxySections)
+		{
+			ActorGroups.FindOrAdd(Section.Name).Add({ TEXT("Splat scene proxy"), MoveTemp(Section.Breakdown) });
+		}
+		for (FSection& Section : NiagaraProxySections)
+		{
+			ActorGroups.FindOrAdd(Section.Name).Add({ TEXT("Niagara data interface proxy"), MoveTemp(Section.Breakdown) });
+		}
+
+		TMap<FString, TArray<FSection>> BatchGroups;
+		for (TPair<int32, FGVRMMemoryBreakdown>& Batch : BatchBreakdowns)
+		{
+			BatchGroups.FindOrAdd(TEXT("Scene skinning batches")).Add({ FString::Printf(TEXT("Batch of %d avatars"), Batch.Key), MoveTemp(Batch.Value) });
+		}
+
+		ActorGroups.KeySort(TLess<FString>());
+
+		uint64 TotalCPUBytes = 0;
+		uint64 TotalGPUBytes = 0;
+		Ar.Logf(TEXT("===== GVRM memory report ====="));
+		PrintGroups(Ar, AssetGroups, TotalCPUBytes, TotalGPUBytes);
+		PrintGroups(Ar, ActorGroups, TotalCPUBytes, TotalGPUBytes);
+		PrintGroups(Ar, BatchGroups, TotalCPUBytes, TotalGPUBytes);
+		Ar.Logf(TEXT("Total: CPU %s, GPU %s (%d actors)"), *FormatBytes(TotalCPUBytes), *FormatBytes(TotalGPUBytes), ActorGroups.Num());
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GGVRMMemReportCommand(
+	TEXT("GVRM.MemReport"),
+	TEXT("Print GVRM memory per asset, per actor and per stream (CPU caches, proxy and batch GPU buffers)."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&GVRMMemoryReport::Dump));
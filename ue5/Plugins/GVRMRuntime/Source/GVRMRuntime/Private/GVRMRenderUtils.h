@@ -0,0 +1,86 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHI.h"
+#include "RHIResources.h"
+#include "GVRMStats.h"
+
+namespace GVRMRender
+{
+	/** Size of a buffer, 0 when not created */
+	inline uint64 GetBufferSize(const FBufferRHIRef& Buffer)
+	{
+		return Buffer.IsValid() ? Buffer->GetSize() : 0;
+	}
+
+	/** Release a buffer created by UploadBuffer and its SRV (keeps STAT_GVRM_GPUBufferMemory balanced) */
+	inline void ReleaseBuffer(FBufferRHIRef& Buffer, FShaderResourceViewRHIRef& SRV)
+	{
+		DEC_MEMORY_STAT_BY(STAT_GVRM_GPUBufferMemory, GetBufferSize(Buffer));
+		SRV.SafeRelease();
+		Buffer.SafeRelease();
+	}
+
+	/** (Re)create a shader-readable buffer and fill it; only releases the previous one when Data is empty */
+	template<typename ElementType>
+	void UploadBuffer(const TCHAR* DebugName, const TArray<ElementType>& Data, uint32 SRVStride, EPixelFormat SRVFormat,
+		FBufferRHIRef& OutBuffer, FShaderResourceViewRHIRef& OutSRV)
+	{
+		ReleaseBuffer(OutBuffer, OutSRV);
+		if (Data.Num() == 0)
+		{
+			return;
+		}
+
+		LLM_SCOPE_BYTAG(GVRM_RenderData);
+		const uint32 NumBytes = Data.Num() * sizeof(ElementType);
+		FRHIResourceCreateInfo CreateInfo(DebugName);
+		OutBuffer = RHICreateVertexBuffer(NumBytes, BUF_ShaderResource | BUF_Dynamic, CreateInfo);
+		INC_MEMORY_STAT_BY(STAT_GVRM_GPUBufferMemory, NumBytes);
+
+		void* BufferData = RHILockBuffer(OutBuffer, 0, NumBytes, RLM_WriteOnly);
+		FMemory::Memcpy(BufferData, Data.GetData(), NumBytes);
+		RHIUnlockBuffer(OutBuffer);
+
+		OutSRV = RHICreateShaderResourceView(OutBuffer, SRVStride, SRVFormat);
+	}
+
+	/**
+	 * Overwrite a buffer in place when the size matches (one lock, no allocation);
+	 * otherwise (re)create it like UploadBuffer.
+	 */
+	template<typename ElementType>
+	void UpdateBuffer(const TCHAR* DebugName, const TArray<ElementType>& Data, uint32 SRVStride, EPixelFormat SRVFormat,
+		FBufferRHIRef& InOutBuffer, FShaderResourceViewRHIRef& InOutSRV)
+	{
+		const uint32 NumBytes = Data.Num() * sizeof(ElementType);
+		if (NumBytes == 0 || !InOutBuffer.IsValid() || InOutBuffer->GetSize() != NumBytes || !InOutSRV.IsValid())
+		{
+			UploadBuffer(DebugName, Data, SRVStride, SRVFormat, InOutBuffer, InOutSRV);
+			return;
+		}
+
+		void* BufferData = RHILockBuffer(InOutBuffer, 0, NumBytes, RLM_WriteOnly);
+		FMemory::Memcpy(BufferData, Data.GetData(), NumBytes);
+		RHIUnlockBuffer(InOutBuffer);
+	}
+
+	/** Like UploadBuffer, but keeps a single zeroed element for empty data so the SRV is always bindable */
+	template<typename ElementType>
+	void UploadBufferOrPlaceholder(const TCHAR* DebugName, const TArray<ElementType>& Data, uint32 SRVStride, EPixelFormat SRVFormat,
+		FBufferRHIRef& OutBuffer, FShaderResourceViewRHIRef& OutSRV)
+	{
+		if (Data.Num() > 0)
+		{
+			UploadBuffer(DebugName, Data, SRVStride, SRVFormat, OutBuffer, OutSRV);
+			return;
+		}
+
+		TArray<ElementType> Placeholder;
+		Placeholder.SetNumZeroed(1);
+		UploadBuffer(DebugName, Placeholder, SRVStride, SRVFormat, OutBuffer, OutSRV);
+	}
+}
@@ -2,19 +2,47 @@
 // Licensed under the MIT License.
 
 #include "GVRMRuntime.h"
+#include "GVRMCustomVersion.h"
+#include "GVRMStats.h"
 #include "Modules/ModuleManager.h"
-#include "Interfaces/IPluginManager.h"
-#include "Misc/Paths.h"
-#include "ShaderCore.h"
+#include "Serialization/CustomVersion.h"
 
 #define LOCTEXT_NAMESPACE "FGVRMRuntimeModule"
 
+DEFINE_STAT(STAT_GVRM_NDIUpdateCache);
+DEFINE_STAT(STAT_GVRM_NDIRenderUpload);
+DEFINE_STAT(STAT_GVRM_SplatComponentUpdate);
+DEFINE_STAT(STAT_GVRM_SplatComponentRenderUpload);
+DEFINE_STAT(STAT_GVRM_SplatComponentRenderSetup);
+DEFINE_STAT(STAT_GVRM_DroppedBonePalettes);
+DEFINE_STAT(STAT_GVRM_LateBonePalettes);
+DEFINE_STAT(STAT_GVRM_BatchedAvatars);
+DEFINE_STAT(STAT_GVRM_BatchedSplats);
+DEFINE_STAT(STAT_GVRM_RigidSplats);
+DEFINE_STAT(STAT_GVRM_SharedVertices);
+DEFINE_STAT(STAT_GVRM_ActiveMorphDeltas);
+DEFINE_STAT(STAT_GVRM_DrawnSplats);
+DEFINE_STAT(STAT_GVRM_BackfaceCulledSplats);
+DEFINE_STAT(STAT_GVRM_SubpixelCulledSplats);
+DEFINE_STAT(STAT_GVRM_FrustumCulledSplats);
+DEFINE_STAT(STAT_GVRM_SplatChunkDecode);
+DEFINE_STAT(STAT_GVRM_SpringBoneSolve);
+DEFINE_STAT(STAT_GVRM_SplatBounds);
+DEFINE_STAT(STAT_GVRM_SpringBoneJoints);
+DEFINE_STAT(STAT_GVRM_GPUBufferMemory);
+
+LLM_DEFINE_TAG(GVRM);
+LLM_DEFINE_TAG(GVRM_BindingData, TEXT("BindingData"), TEXT("GVRM"));
+LLM_DEFINE_TAG(GVRM_AnimationCache, TEXT("AnimationCache"), TEXT("GVRM"));
+LLM_DEFINE_TAG(GVRM_MeshCache, TEXT("MeshCache"), TEXT("GVRM"));
+LLM_DEFINE_TAG(GVRM_RenderData, TEXT("RenderData"), TEXT("GVRM"));
+
+const FGuid FGVRMCustomVersion::GUID(0x170503A9, 0x92A44B09, 0xBAE53E80, 0x662EA0B5);
+static FCustomVersionRegistration GRegisterGVRMCustomVersion(FGVRMCustomVersion::GUID, FGVRMCustomVersion::LatestVersion, TEXT("GVRMVer"));
+
 void FGVRMRuntimeModule::StartupModule()
 {
-	// Register shader directory
-	FString PluginShaderDir = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("GVRMRuntime"))->GetBaseDir(), TEXT("Shaders"));
-	AddShaderSourceDirectoryMapping(TEXT("/Plugin/GVRMRuntime"), PluginShaderDir);
-
+	// Shader directory is registered by the GVRMShaders module (PostConfigInit)
 	UE_LOG(LogTemp, Log, TEXT("GVRMRuntime module started"));
 }
 
@@ -2,15 +2,695 @@
 // Licensed under the MIT License.
 
 #include "GVRMSkinningData.h"
+#include "GVRMCustomVersion.h"
+#include "GVRMMemoryReport.h"
+#include "NiagaraDataInterfaceGVRM.h"
+#include "GVRMStats.h"
 #include "Misc/FileHelper.h"
+#include "Hash/CityHash.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "HAL/PlatformFileManager.h"
+#include "Async/Async.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "UObject/ObjectSaveContext.h"
+
+void UGVRMBindingData::GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const
+{
+	OutBreakdown.AddArray(TEXT("Bindings"), Bindings);
+	OutBreakdown.AddArray(TEXT("Gaussians"), Gaussians);
+	OutBreakdown.AddArray(TEXT("BoundVertexIndices"), BoundVertexIndices);
+
+	uint64 BoneOperationBytes = BoneOperations.GetAllocatedSize();
+	for (const FGVRMBoneOperation& Operation : BoneOperations)
+	{
+		BoneOperationBytes += Operation.BoneName.GetAllocatedSize();
+	}
+	OutBreakdown.AddCPU(TEXT("BoneOperations"), BoneOperationBytes);
+
+	uint64 SpringBoneBytes = SpringChains.GetAllocatedSize() + SpringColliders.GetAllocatedSize();
+	for (const FGVRMSpringBoneChain& Chain : SpringChains)
+	{
+		SpringBoneBytes += Chain.BoneNames.GetAllocatedSize() + Chain.Colliders.GetAllocatedSize();
+		for (const FString& BoneName : Chain.BoneNames)
+		{
+			SpringBoneBytes += BoneName.GetAllocatedSize();
+		}
+	}
+	for (const FGVRMSpringBoneCollider& Collider : SpringColliders)
+	{
+		SpringBoneBytes += Collider.BoneName.GetAllocatedSize();
+	}
+	OutBreakdown.AddCPU(TEXT("SpringBones"), SpringBoneBytes);
+
+	uint64 LODBindingBytes = LODBindings.GetAllocatedSize();
+	for (const FGVRMLODBinding& LODBinding : LODBindings)
+	{
+		LODBindingBytes += LODBinding.VertexRemaps.GetAllocatedSize();
+	}
+	OutBreakdown.AddCPU(TEXT("LODBindings"), LODBindingBytes);
+
+	OutBreakdown.AddArray(TEXT("RigidBindings"), RigidBindings);
+	OutBreakdown.AddArray(TEXT("RigidSplatOrder"), RigidSplatOrder);
+	OutBreakdown.AddArray(TEXT("PaletteBones"), PaletteBones);
+	OutBreakdown.AddArray(TEXT("BonePaletteSlots"), BonePaletteSlots);
+
+	uint64 LoadedChunkBytes = 0;
+	for (const FByteBulkData& Chunk : SplatChunks)
+	{
+		LoadedChunkBytes += Chunk.IsBulkDataLoaded() ? Chunk.GetBulkDataSize() : 0;
+	}
+	OutBreakdown.AddCPU(TEXT("SplatChunks (loaded)"), LoadedChunkBytes);
+	OutBreakdown.AddArray(TEXT("ChunkStagingBuffer"), ChunkStagingBuffer);
+}
+
+// ============================================
+// Splat stream chunks
+// ============================================
+
+/**
+ * Bulk data layout of one chunk of splats: flat arrays, one per stream, so a
+ * chunk is read with straight copies and no per-property reflection.
+ * SplatIndex[N], VertexIndex[N], BoneIndex[N] (int32), RelativePosition[N] (FVector3f),
+ * then with Gaussians: Rotation[N] (x, y, z, w), Scale[N], Color[N], Opacity[N].
+ */
+namespace GVRMSplatChunk
+{
+	constexpr int64 BindingBytesPerSplat = 3 * sizeof(int32) + sizeof(FVector3f);
+	constexpr int64 GaussianBytesPerSplat = sizeof(FVector4f) + 2 * sizeof(FVector3f) + sizeof(float);
+
+	int64 GetSize(int32 NumSplats, bool bWithGaussians)
+	{
+		return NumSplats * (BindingBytesPerSplat + (bWithGaussians ? GaussianBytesPerSplat : 0));
+	}
+
+	template<typename ElementType>
+	ElementType* Claim(uint8*& Cursor, int32 Num)
+	{
+		ElementType* Elements = reinterpret_cast<ElementType*>(Cursor);
+		Cursor += Num * sizeof(ElementType);
+		return Elements;
+	}
+
+	template<typename ElementType>
+	const ElementType* Claim(const uint8*& Cursor, int32 Num)
+	{
+		const ElementType* Elements = reinterpret_cast<const ElementType*>(Cursor);
+		Cursor += Num * sizeof(ElementType);
+		return Elements;
+	}
+
+	void Write(TConstArrayView<FSplatBindingInfo> Bindings, TConstArrayView<FGVRMSplatGaussian> Gaussians, uint8* Dest)
+	{
+		const int32 Num = Bindings.Num();
+		int32* SplatIndices = Claim<int32>(Dest, Num);
+		int32* VertexIndices = Claim<int32>(Dest, Num);
+		int32* BoneIndices = Claim<int32>(Dest, Num);
+		FVector3f* RelativePositions = Claim<FVector3f>(Dest, Num);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			SplatIndices[Index] = Bindings[Index].SplatIndex;
+			VertexIndices[Index] = Bindings[Index].VertexIndex;
+			BoneIndices[Index] = Bindings[Index].BoneIndex;
+			RelativePositions[Index] = FVector3f(Bindings[Index].RelativePosition);
+		}
+
+		if (Gaussians.Num() == Num)
+		{
+			FVector4f* Rotations = Claim<FVector4f>(Dest, Num);
+			FVector3f* Scales = Claim<FVector3f>(Dest, Num);
+			FVector3f* Colors = Claim<FVector3f>(Dest, Num);
+			float* Opacities = Claim<float>(Dest, Num);
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				const FGVRMSplatGaussian& Gaussian = Gaussians[Index];
+				Rotations[Index] = FVector4f(Gaussian.Rotation.X, Gaussian.Rotation.Y, Gaussian.Rotation.Z, Gaussian.Rotation.W);
+				Scales[Index] = Gaussian.Scale;
+				Colors[Index] = Gaussian.Color;
+				Opacities[Index] = Gaussian.Opacity;
+			}
+		}
+	}
+
+	/**
+	 * Hash of the chunk streams Write would produce for these splats (the fields
+	 * only, never struct padding), hashed in batches through a scratch buffer.
+	 */
+	uint64 Hash(TConstArrayView<FSplatBindingInfo> Bindings, TConstArrayView<FGVRMSplatGaussian> Gaussians)
+	{
+		constexpr int32 SplatsPerBatch = 4096;
+		const int32 Num = Bindings.Num();
+		const bool bWithGaussians = Num > 0 && Gaussians.Num() == Num;
+
+		TArray<uint8> Batch;
+		Batch.SetNumUninitialized(GetSize(FMath::Min(Num, SplatsPerBatch), bWithGaussians));
+		uint64 Result = CityHash64WithSeed(reinterpret_cast<const char*>(&Num), sizeof(Num), bWithGaussians ? 1 : 0);
+		for (int32 First = 0; First < Num; First += SplatsPerBatch)
+		{
+			const int32 NumBatch = FMath::Min(SplatsPerBatch, Num - First);
+			Write(Bindings.Slice(First, NumBatch), bWithGaussians ? Gaussians.Slice(First, NumBatch) : TConstArrayView<FGVRMSplatGaussian>(), Batch.GetData());
+			Result = CityHash64WithSeed(reinterpret_cast<const char*>(Batch.GetData()), static_cast<uint32>(GetSize(NumBatch, bWithGaussians)), Result);
+		}
+		return Result;
+	}
+
+	void Read(const uint8* Source, int32 Num, bool bWithGaussians, TArray<FSplatBindingInfo>& OutBindings, TArray<FGVRMSplatGaussian>& OutGaussians)
+	{
+		const int32* SplatIndices = Claim<int32>(Source, Num);
+		const int32* VertexIndices = Claim<int32>(Source, Num);
+		const int32* BoneIndices = Claim<int32>(Source, Num);
+		const FVector3f* RelativePositions = Claim<FVector3f>(Source, Num);
+
+		const int32 FirstBinding = OutBindings.AddUninitialized(Num);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			new (&OutBindings[FirstBinding + Index]) FSplatBindingInfo(SplatIndices[Index], VertexIndices[Index], BoneIndices[Index], FVector(RelativePositions[Index]));
+		}
+
+		if (bWithGaussians)
+		{
+			const FVector4f* Rotations = Claim<FVector4f>(Source, Num);
+			const FVector3f* Scales = Claim<FVector3f>(Source, Num);
+			const FVector3f* Colors = Claim<FVector3f>(Source, Num);
+			const float* Opacities = Claim<float>(Source, Num);
+
+			const int32 FirstGaussian = OutGaussians.AddUninitialized(Num);
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				FGVRMSplatGaussian& Gaussian = OutGaussians[FirstGaussian + Index];
+				Gaussian.Rotation = FQuat4f(Rotations[Index].X, Rotations[Index].Y, Rotations[Index].Z, Rotations[Index].W);
+				Gaussian.Scale = Scales[Index];
+				Gaussian.Color = Colors[Index];
+				Gaussian.Opacity = Opacities[Index];
+			}
+		}
+	}
+}
+
+void UGVRMBindingData::Serialize(FArchive& Ar)
+{
+	LLM_SCOPE_BYTAG(GVRM_BindingData);
+	Ar.UsingCustomVersion(FGVRMCustomVersion::GUID);
+
+	// Packages keep the splat streams in chunks; undo, duplication and other
+	// in-memory archives keep using the tagged properties
+	const bool bSplatStreamsInChunks = Ar.IsPersistent()
+		&& (Ar.IsSaving() || (Ar.IsLoading() && Ar.CustomVer(FGVRMCustomVersion::GUID) >= FGVRMCustomVersion::SplatStreamsInBulkData));
+
+	if (bSplatStreamsInChunks && Ar.IsSaving())
+	{
+		// Whoever changed the splats, the chunks follow: rebuilt when the splats no longer hash to them
+		if (bSplatChunksDirty || GVRMSplatChunk::Hash(Bindings, Gaussians) != SplatChunksHash)
+		{
+			BuildSplatChunks();
+		}
+
+		// Only empty arrays go through the tagged property path
+		TArray<FSplatBindingInfo> SavedBindings = MoveTemp(Bindings);
+		TArray<FGVRMSplatGaussian> SavedGaussians;
+		if (bChunksHaveGaussians)
+		{
+			SavedGaussians = MoveTemp(Gaussians);
+		}
+
+		Super::Serialize(Ar);
+
+		Bindings = MoveTemp(SavedBindings);
+		if (bChunksHaveGaussians)
+		{
+			Gaussians = MoveTemp(SavedGaussians);
+		}
+	}
+	else
+	{
+		Super::Serialize(Ar);
+	}
+
+	// Any load replaces the splats (undo included), and the chunk payloads are dropped once appended
+	if (Ar.IsLoading())
+	{
+		bSplatChunksDirty = true;
+	}
+
+	if (!bSplatStreamsInChunks)
+	{
+		return;
+	}
+
+	int32 NumChunks = SplatChunks.Num();
+	Ar << NumSavedSplats << bChunksHaveGaussians << NumChunks;
+
+	if (Ar.IsLoading())
+	{
+		SplatChunks.Empty(NumChunks);
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			SplatChunks.Add(new FByteBulkData());
+		}
+		NextStreamedChunk = 0;
+		Bindings.Reset(NumSavedSplats);
+		if (bChunksHaveGaussians)
+		{
+			Gaussians.Reset(NumSavedSplats);
+		}
+	}
+
+	for (FByteBulkData& Chunk : SplatChunks)
+	{
+		Chunk.Serialize(Ar, this);
+	}
+
+	// Payloads inline in the archive (memory archives) are already loaded
+	if (Ar.IsLoading())
+	{
+		while (!AreSplatStreamsComplete() && SplatChunks[NextStreamedChunk].IsBulkDataLoaded())
+		{
+			FByteBulkData& Chunk = SplatChunks[NextStreamedChunk];
+			const uint8* ChunkData = static_cast<const uint8*>(Chunk.LockReadOnly());
+			const bool bAppended = AppendSplatChunk(ChunkData, Chunk.GetBulkDataSize());
+			Chunk.Unlock();
+			Chunk.RemoveBulkData();
+			if (!bAppended)
+			{
+				break;
+			}
+		}
+	}
+}
+
+void UGVRMBindingData::PostLoad()
+{
+	Super::PostLoad();
+
+	// Editor tools need every splat; cooked builds stream them in behind the load
+	if (FPlatformProperties::RequiresCookedData())
+	{
+		RequestSplatStreams();
+	}
+	else
+	{
+		LoadSplatStreams();
+	}
+}
+
+void UGVRMBindingData::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	if (PendingChunkRequest)
+	{
+		PendingChunkRequest->Cancel();
+	}
+}
+
+bool UGVRMBindingData::IsReadyForFinishDestroy()
+{
+	if (PendingChunkRequest)
+	{
+		if (!PendingChunkRequest->PollCompletion())
+		{
+			return false;
+		}
+		PendingChunkRequest.Reset();
+	}
+	return Super::IsReadyForFinishDestroy();
+}
+
+void UGVRMBindingData::BuildSplatChunks()
+{
+	// A partially streamed asset still has its saved chunks; keep them rather than truncating
+	if (!ensureMsgf(AreSplatStreamsComplete(), TEXT("Saving %s while its splat streams are still loading"), *GetPathName()))
+	{
+		return;
+	}
+
+	NumSavedSplats = Bindings.Num();
+	bChunksHaveGaussians = NumSavedSplats > 0 && Gaussians.Num() == NumSavedSplats;
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumSavedSplats, SplatsPerChunk);
+	SplatChunks.Empty(NumChunks);
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		const int32 FirstSplat = ChunkIndex * SplatsPerChunk;
+		const int32 NumChunkSplats = FMath::Min(SplatsPerChunk, NumSavedSplats - FirstSplat);
+
+		FByteBulkData* Chunk = new FByteBulkData();
+		Chunk->Lock(LOCK_READ_WRITE);
+		uint8* ChunkData = static_cast<uint8*>(Chunk->Realloc(GVRMSplatChunk::GetSize(NumChunkSplats, bChunksHaveGaussians)));
+		GVRMSplatChunk::Write(TConstArrayView<FSplatBindingInfo>(Bindings).Slice(FirstSplat, NumChunkSplats),
+			bChunksHaveGaussians ? TConstArrayView<FGVRMSplatGaussian>(Gaussians).Slice(FirstSplat, NumChunkSplats) : TConstArrayView<FGVRMSplatGaussian>(),
+			ChunkData);
+		Chunk->Unlock();
+		Chunk->SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+		SplatChunks.Add(Chunk);
+	}
+	NextStreamedChunk = NumChunks;
+	SplatChunksHash = GVRMSplatChunk::Hash(Bindings, Gaussians);
+	bSplatChunksDirty = false;
+}
+
+bool UGVRMBindingData::AppendSplatChunk(const uint8* ChunkData, int64 ChunkSize)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatChunkDecode);
+	LLM_SCOPE_BYTAG(GVRM_BindingData);
+
+	const int32 NumChunkSplats = FMath::Min(SplatsPerChunk, NumSavedSplats - NextStreamedChunk * SplatsPerChunk);
+	if (!ChunkData || ChunkSize != GVRMSplatChunk::GetSize(NumChunkSplats, bChunksHaveGaussians))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGVRMBindingData::AppendSplatChunk - %s: chunk %d is %lld bytes, expected %lld; dropping the remaining splats"),
+			*GetPathName(), NextStreamedChunk, ChunkSize, GVRMSplatChunk::GetSize(NumChunkSplats, bChunksHaveGaussians));
+		NextStreamedChunk = SplatChunks.Num();
+		return false;
+	}
+
+	GVRMSplatChunk::Read(ChunkData, NumChunkSplats, bChunksHaveGaussians, Bindings, Gaussians);
+	++NextStreamedChunk;
+	return true;
+}
+
+void UGVRMBindingData::RequestSplatStreams()
+{
+	check(IsInGameThread());
+
+	if (!PendingChunkRequest && !AreSplatStreamsComplete())
+	{
+		StreamNextSplatChunk();
+	}
+}
+
+void UGVRMBindingData::StreamNextSplatChunk()
+{
+	const int32 ChunkIndex = NextStreamedChunk;
+	const FByteBulkData& Chunk = SplatChunks[ChunkIndex];
+
+	{
+		LLM_SCOPE_BYTAG(GVRM_BindingData);
+		ChunkStagingBuffer.Reset(Chunk.GetBulkDataSize());
+		ChunkStagingBuffer.AddUninitialized(Chunk.GetBulkDataSize());
+	}
+
+	// Completes on an IO thread; the splats are appended on the game thread
+	TWeakObjectPtr<UGVRMBindingData> WeakThis(this);
+	FBulkDataIORequestCallBack Callback = [WeakThis, ChunkIndex](bool bWasCancelled, IBulkDataIORequest*)
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, ChunkIndex, bWasCancelled]()
+		{
+			if (UGVRMBindingData* BindingData = WeakThis.Get())
+			{
+				BindingData->OnSplatChunkStreamed(ChunkIndex, bWasCancelled);
+			}
+		});
+	};
+
+	PendingChunkRequest.Reset(Chunk.CreateStreamingRequest(AIOP_BelowNormal, &Callback, ChunkStagingBuffer.GetData()));
+	if (!PendingChunkRequest)
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGVRMBindingData::StreamNextSplatChunk - %s: failed to read chunk %d"), *GetPathName(), ChunkIndex);
+		NextStreamedChunk = SplatChunks.Num();
+		OnSplatStreamsUpdated.Broadcast();
+	}
+}
+
+void UGVRMBindingData::OnSplatChunkStreamed(int32 ChunkIndex, bool bWasCancelled)
+{
+	// LoadSplatStreams may have taken the chunk over already
+	if (!PendingChunkRequest || ChunkIndex != NextStreamedChunk)
+	{
+		return;
+	}
+
+	PendingChunkRequest->WaitCompletion();
+	PendingChunkRequest.Reset();
+
+	if (bWasCancelled || !AppendSplatChunk(ChunkStagingBuffer.GetData(), ChunkStagingBuffer.Num()))
+	{
+		NextStreamedChunk = SplatChunks.Num();
+	}
+
+	if (AreSplatStreamsComplete())
+	{
+		ChunkStagingBuffer.Empty();
+	}
+	else
+	{
+		StreamNextSplatChunk();
+	}
+
+	OnSplatStreamsUpdated.Broadcast();
+}
+
+void UGVRMBindingData::LoadSplatStreams()
+{
+	if (AreSplatStreamsComplete())
+	{
+		return;
+	}
+
+	if (PendingChunkRequest)
+	{
+		PendingChunkRequest->WaitCompletion();
+		PendingChunkRequest.Reset();
+		AppendSplatChunk(ChunkStagingBuffer.GetData(), ChunkStagingBuffer.Num());
+	}
+	ChunkStagingBuffer.Empty();
+
+	while (!AreSplatStreamsComplete())
+	{
+		FByteBulkData& Chunk = SplatChunks[NextStreamedChunk];
+		void* ChunkData = nullptr;
+		Chunk.GetCopy(&ChunkData, true);
+		const bool bAppended = AppendSplatChunk(static_cast<const uint8*>(ChunkData), Chunk.GetBulkDataSize());
+		FMemory::Free(ChunkData);
+		if (!bAppended)
+		{
+			break;
+		}
+	}
+
+	OnSplatStreamsUpdated.Broadcast();
+}
+
+void UGVRMBindingData::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	FGVRMMemoryBreakdown Breakdown;
+	GetMemoryBreakdown(Breakdown);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Breakdown.GetCPUBytes());
+}
+
+int32 UGVRMBindingData::GetNumBoneInfluences() const
+{
+	return NumBoneInfluences > 0 ? GVRMSkinning::GetInfluencePermutation(NumBoneInfluences) : GVRMSkinning::MaxBoneInfluences;
+}
+
+bool UGVRMBindingData::SupportsSkinningMode(EGVRMSkinningMode Mode, const UObject* Requester) const
+{
+	if (Mode == EGVRMSkinningMode::LinearBlend || AreRigidBindingsReady())
+	{
+		return true;
+	}
+
+	// Not yet rather than missing: the rigid bindings are there, the splats are still streaming
+	if (HasRigidBindings())
+	{
+		return false;
+	}
+
+	if (!bWarnedMissingRigidBindings)
+	{
+		bWarnedMissingRigidBindings = true;
+		UE_LOG(LogTemp, Warning, TEXT("GVRM - %s requests rigid skinning, but %s has no rigid bindings; skinning with LinearBlend (set its SourceSkeletalMesh and re-save it)"),
+			*GetPathNameSafe(Requester), *GetName());
+	}
+	return false;
+}
+
+void UGVRMBindingData::RebuildMeshData()
+{
+#if WITH_EDITOR
+	USkeletalMesh* SkeletalMesh = SourceSkeletalMesh.LoadSynchronous();
+	if (!SkeletalMesh)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGVRMBindingData::RebuildMeshData - %s: SourceSkeletalMesh is not set"), *GetName());
+		return;
+	}
+
+	LoadSplatStreams();
+	Modify();
+
+	FString Message;
+	if (!BuildMeshData(SkeletalMesh, Message))
+	{
+		UE_LOG(LogTemp, Error, TEXT("UGVRMBindingData::RebuildMeshData - %s: %s"), *GetName(), *Message);
+		return;
+	}
+	UE_LOG(LogTemp, Log, TEXT("UGVRMBindingData::RebuildMeshData - %s: %s"), *GetName(), *Message);
+#endif
+}
+
+#if WITH_EDITOR
+
+void UGVRMBindingData::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// Cooking saves what the editor built
+	if (SaveContext.IsCooking() || SourceSkeletalMesh.IsNull() || !AreSplatStreamsComplete())
+	{
+		return;
+	}
+
+	USkeletalMesh* SkeletalMesh = SourceSkeletalMesh.LoadSynchronous();
+	if (!SkeletalMesh || !NeedsMeshDataBuild(*SkeletalMesh))
+	{
+		return;
+	}
+
+	FString Message;
+	if (BuildMeshData(SkeletalMesh, Message))
+	{
+		UE_LOG(LogTemp, Log, TEXT("UGVRMBindingData::PreSave - %s: rebuilt mesh data (%s)"), *GetName(), *Message);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGVRMBindingData::PreSave - %s: mesh data is stale and could not be rebuilt: %s"), *GetName(), *Message);
+	}
+}
+
+void UGVRMBindingData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName MemberName = PropertyChangedEvent.GetMemberPropertyName();
+	if (MemberName == GET_MEMBER_NAME_CHECKED(UGVRMBindingData, SourceSkeletalMesh)
+		&& !SourceSkeletalMesh.IsNull())
+	{
+		RebuildMeshData();
+	}
+}
+
+#endif // WITH_EDITOR
+
+bool UGVRMBindingData::BuildRigidBindings(TConstArrayView<FVector3f> VertexPositions, TConstArrayView<FIntVector4> BoneIndices,
+	TConstArrayView<FVector4f> BoneWeights, FString& OutErrorMessage)
+{
+	LLM_SCOPE_BYTAG(GVRM_BindingData);
+
+	const int32 NumVertices = VertexPositions.Num();
+	if (NumVertices == 0 || BoneIndices.Num() != NumVertices || BoneWeights.Num() != NumVertices)
+	{
+		OutErrorMessage = TEXT("Mesh streams are empty or inconsistent");
+		return false;
+	}
+
+	TArray<FGVRMRigidSplatBinding> NewBindings;
+	NewBindings.SetNumUninitialized(Bindings.Num());
+	int32 NumBones = 0;
+
+	for (int32 SplatIndex = 0; SplatIndex < Bindings.Num(); ++SplatIndex)
+	{
+		const int32 VertexIndex = Bindings[SplatIndex].VertexIndex;
+		if (VertexIndex < 0 || VertexIndex >= NumVertices)
+		{
+			OutErrorMessage = FString::Printf(TEXT("Splat %d is bound to vertex %d, LOD0 has %d vertices"), SplatIndex, VertexIndex, NumVertices);
+			return false;
+		}
+
+		// Two highest weighted influences; ties keep the earlier one, like the skin weight order
+		const FIntVector4& Indices = BoneIndices[VertexIndex];
+		const FVector4f& Weights = BoneWeights[VertexIndex];
+		int32 First = 0;
+		int32 Second = INDEX_NONE;
+		for (int32 Influence = 1; Influence < 4; ++Influence)
+		{
+			if (Weights[Influence] > Weights[First])
+			{
+				Second = First;
+				First = Influence;
+			}
+			else if (Weights[Influence] > 0.0f && (Second == INDEX_NONE || Weights[Influence] > Weights[Second]))
+			{
+				Second = Influence;
+			}
+		}
+
+		FGVRMRigidSplatBinding& Rigid = NewBindings[SplatIndex];
+		Rigid.HostPosition = VertexPositions[VertexIndex];
+		Rigid.PrimaryBone = Indices[First];
+		Rigid.SecondaryBone = Rigid.PrimaryBone;
+		Rigid.SecondaryWeight = 0.0f;
+		if (Second != INDEX_NONE && Weights[Second] > 0.0f)
+		{
+			Rigid.SecondaryBone = Indices[Second];
+			Rigid.SecondaryWeight = Weights[Second] / (Weights[First] + Weights[Second]);
+		}
+		NumBones = FMath::Max(NumBones, FMath::Max(Rigid.PrimaryBone, Rigid.SecondaryBone) + 1);
+	}
+
+	// Counting sort by primary bone (stable, so splats of a bone keep their original order)
+	TArray<int32> BoneStarts;
+	BoneStarts.SetNumZeroed(NumBones + 1);
+	for (const FGVRMRigidSplatBinding& Rigid : NewBindings)
+	{
+		++BoneStarts[Rigid.PrimaryBone + 1];
+	}
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		BoneStarts[BoneIndex + 1] += BoneStarts[BoneIndex];
+	}
+
+	RigidSplatOrder.SetNumUninitialized(NewBindings.Num());
+	for (int32 SplatIndex = 0; SplatIndex < NewBindings.Num(); ++SplatIndex)
+	{
+		RigidSplatOrder[BoneStarts[NewBindings[SplatIndex].PrimaryBone]++] = SplatIndex;
+	}
+	RigidBindings = MoveTemp(NewBindings);
+
+	UE_LOG(LogTemp, Log, TEXT("UGVRMBindingData::BuildRigidBindings - %s: %d splats over %d bones"), *GetName(), RigidBindings.Num(), NumBones);
+	return true;
+}
+
+bool UGVRMBindingData::BuildBonePalette(int32 NumMeshBones, TConstArrayView<int32> ReferencedBones, FString& OutErrorMessage)
+{
+	LLM_SCOPE_BYTAG(GVRM_BindingData);
+
+	if (NumMeshBones <= 0 || ReferencedBones.Num() == 0)
+	{
+		OutErrorMessage = TEXT("No bones to build a palette from");
+		return false;
+	}
+
+	TBitArray<> bReferenced(false, NumMeshBones);
+	for (const int32 BoneIndex : ReferencedBones)
+	{
+		if (BoneIndex < 0 || BoneIndex >= NumMeshBones)
+		{
+			OutErrorMessage = FString::Printf(TEXT("Bone index %d is out of range (%d mesh bones)"), BoneIndex, NumMeshBones);
+			return false;
+		}
+		bReferenced[BoneIndex] = true;
+	}
+
+	PaletteBones.Reset();
+	BonePaletteSlots.SetNumZeroed(NumMeshBones);
+	for (TConstSetBitIterator<> It(bReferenced); It; ++It)
+	{
+		BonePaletteSlots[It.GetIndex()] = PaletteBones.Add(It.GetIndex());
+	}
+
+	OutErrorMessage = FString::Printf(TEXT("Compacted bone palette from %d to %d bones"), NumMeshBones, PaletteBones.Num());
+	return true;
+}
 
 #if WITH_EDITOR
 
 bool UGVRMBindingData::ImportFromCSV(const FString& CSVFilePath, FString& OutErrorMessage)
 {
+	LLM_SCOPE_BYTAG(GVRM_BindingData);
+
 	// Check if file exists
 	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*CSVFilePath))
 	{
@@ -76,6 +756,37 @@ bool UGVRMBindingData::ImportFromCSV(const FString& CSVFilePath, FString& OutErr
 		Bindings.Add(Binding);
 	}
 
+	// Collect the unique host vertices; tables built for a previous import are stale
+	TSet<int32> UniqueVertices;
+	UniqueVertices.Reserve(Bindings.Num());
+	for (const FSplatBindingInfo& Binding : Bindings)
+	{
+		UniqueVertices.Add(Binding.VertexIndex);
+	}
+	BoundVertexIndices = UniqueVertices.Array();
+	BoundVertexIndices.Sort();
+	LODBindings.Empty();
+	RigidBindings.Empty();
+	RigidSplatOrder.Empty();
+	PaletteBones.Empty();
+	BonePaletteSlots.Empty();
+	NumBoneInfluences = 0;
+	bWarnedMissingRigidBindings = false;
+
+	// Mesh-derived tables follow the new host vertices
+	if (USkeletalMesh* SkeletalMesh = SourceSkeletalMesh.LoadSynchronous())
+	{
+		FString MeshMessage;
+		if (!BuildMeshData(SkeletalMesh, MeshMessage))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Imported %d splat bindings, but building the mesh data from %s failed: %s"),
+				Bindings.Num(), *SkeletalMesh->GetName(), *MeshMessage);
+			return false;
+		}
+		OutErrorMessage = FString::Printf(TEXT("Successfully imported %d splat bindings (%s)"), Bindings.Num(), *MeshMessage);
+		return true;
+	}
+
 	OutErrorMessage = FString::Printf(TEXT("Successfully imported %d splat bindings"), Bindings.Num());
 	return true;
 }
@@ -165,8 +876,582 @@ bool UGVRMBindingData::ImportMetadataFromJSON(const FString& JSONFilePath, FStri
 		}
 	}
 
-	OutErrorMessage = FString::Printf(TEXT("Successfully imported metadata (scale=%.2f, %d bone operations)"),
-		ModelScale, BoneOperations.Num());
+	// Read springBones (VRM spring bones in glTF axes and meters, converted like the glTF importer: (x, z, y) * 100)
+	if (JsonObject->HasField(TEXT("springBones")))
+	{
+		SpringChains.Empty();
+		SpringColliders.Empty();
+		const TSharedPtr<FJsonObject>& SpringObj = JsonObject->GetObjectField(TEXT("springBones"));
+
+		auto ReadVector = [](const TSharedPtr<FJsonObject>& Obj, const TCHAR* Field, double Scale) -> FVector
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+			if (!Obj->TryGetArrayField(Field, Values) || Values->Num() != 3)
+			{
+				return FVector::ZeroVector;
+			}
+			return FVector((*Values)[0]->AsNumber(), (*Values)[2]->AsNumber(), (*Values)[1]->AsNumber()) * Scale;
+		};
+
+		const TArray<TSharedPtr<FJsonValue>>* CollidersArray = nullptr;
+		if (SpringObj->TryGetArrayField(TEXT("colliders"), CollidersArray))
+		{
+			for (const TSharedPtr<FJsonValue>& ColliderValue : *CollidersArray)
+			{
+				const TSharedPtr<FJsonObject>& ColliderObj = ColliderValue->AsObject();
+				FGVRMSpringBoneCollider& Collider = SpringColliders.AddDefaulted_GetRef();
+				if (!ColliderObj.IsValid())
+				{
+					continue;
+				}
+				ColliderObj->TryGetStringField(TEXT("boneName"), Collider.BoneName);
+				Collider.Offset = ReadVector(ColliderObj, TEXT("offset"), 100.0);
+				double Radius = 0.0;
+				ColliderObj->TryGetNumberField(TEXT("radius"), Radius);
+				Collider.Radius = Radius * 100.0;
+				Collider.bCapsule = ColliderObj->HasField(TEXT("tail"));
+				Collider.Tail = Collider.bCapsule ? ReadVector(ColliderObj, TEXT("tail"), 100.0) : Collider.Offset;
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ChainsArray = nullptr;
+		if (SpringObj->TryGetArrayField(TEXT("chains"), ChainsArray))
+		{
+			for (const TSharedPtr<FJsonValue>& ChainValue : *ChainsArray)
+			{
+				const TSharedPtr<FJsonObject>& ChainObj = ChainValue->AsObject();
+				if (!ChainObj.IsValid())
+				{
+					continue;
+				}
+
+				FGVRMSpringBoneChain Chain;
+				const TArray<TSharedPtr<FJsonValue>>* BoneNames = nullptr;
+				if (ChainObj->TryGetArrayField(TEXT("boneNames"), BoneNames))
+				{
+					for (const TSharedPtr<FJsonValue>& NameValue : *BoneNames)
+					{
+						Chain.BoneNames.Add(NameValue->AsString());
+					}
+				}
+				ChainObj->TryGetNumberField(TEXT("stiffness"), Chain.Stiffness);
+				ChainObj->TryGetNumberField(TEXT("dragForce"), Chain.DragForce);
+				ChainObj->TryGetNumberField(TEXT("gravityPower"), Chain.GravityPower);
+				if (ChainObj->HasField(TEXT("gravityDir")))
+				{
+					Chain.GravityDir = ReadVector(ChainObj, TEXT("gravityDir"), 1.0).GetSafeNormal();
+				}
+				double HitRadius = 0.0;
+				ChainObj->TryGetNumberField(TEXT("hitRadius"), HitRadius);
+				Chain.HitRadius = HitRadius * 100.0;
+
+				const TArray<TSharedPtr<FJsonValue>>* ColliderIndices = nullptr;
+				if (ChainObj->TryGetArrayField(TEXT("colliders"), ColliderIndices))
+				{
+					for (const TSharedPtr<FJsonValue>& IndexValue : *ColliderIndices)
+					{
+						const int32 ColliderIndex = static_cast<int32>(IndexValue->AsNumber());
+						if (SpringColliders.IsValidIndex(ColliderIndex))
+						{
+							Chain.Colliders.AddUnique(ColliderIndex);
+						}
+					}
+				}
+
+				// A chain needs a tail to simulate
+				if (Chain.BoneNames.Num() >= 2)
+				{
+					SpringChains.Add(MoveTemp(Chain));
+				}
+			}
+		}
+	}
+
+	OutErrorMessage = FString::Printf(TEXT("Successfully imported metadata (scale=%.2f, %d bone operations, %d spring chains, %d colliders)"),
+		ModelScale, BoneOperations.Num(), SpringChains.Num(), SpringColliders.Num());
+	return true;
+}
+
+bool UGVRMBindingData::ImportGaussiansFromPLY(const FString& PLYFilePath, FString& OutErrorMessage)
+{
+	LLM_SCOPE_BYTAG(GVRM_BindingData);
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *PLYFilePath))
+	{
+		OutErrorMessage = FString::Printf(TEXT("Failed to read file: %s"), *PLYFilePath);
+		return false;
+	}
+
+	// Locate the end of the ASCII header
+	static const ANSICHAR EndHeader[] = "end_header\n";
+	const int32 EndHeaderLength = UE_ARRAY_COUNT(EndHeader) - 1;
+	int32 DataOffset = INDEX_NONE;
+	for (int32 Offset = 0; Offset + EndHeaderLength <= FileData.Num(); ++Offset)
+	{
+		if (FMemory::Memcmp(FileData.GetData() + Offset, EndHeader, EndHeaderLength) == 0)
+		{
+			DataOffset = Offset + EndHeaderLength;
+			break;
+		}
+	}
+
+	if (DataOffset == INDEX_NONE)
+	{
+		OutErrorMessage = TEXT("PLY header is missing end_header");
+		return false;
+	}
+
+	// Parse header: vertex count and float property layout
+	const FString Header(DataOffset, reinterpret_cast<const ANSICHAR*>(FileData.GetData()));
+	TArray<FString> HeaderLines;
+	Header.ParseIntoArrayLines(HeaderLines);
+
+	int32 NumVertices = 0;
+	TMap<FString, int32> PropertyOffsets;
+	int32 VertexStride = 0;
+	for (const FString& HeaderLine : HeaderLines)
+	{
+		TArray<FString> Tokens;
+		HeaderLine.ParseIntoArrayWS(Tokens);
+		if (Tokens.Num() >= 2 && Tokens[0] == TEXT("format") && Tokens[1] != TEXT("binary_little_endian"))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Unsupported PLY format: %s"), *Tokens[1]);
+			return false;
+		}
+		if (Tokens.Num() == 3 && Tokens[0] == TEXT("element") && Tokens[1] == TEXT("vertex"))
+		{
+			NumVertices = FCString::Atoi(*Tokens[2]);
+		}
+		else if (Tokens.Num() == 3 && Tokens[0] == TEXT("property"))
+		{
+			if (Tokens[1] != TEXT("float"))
+			{
+				OutErrorMessage = FString::Printf(TEXT("Unsupported PLY property type: %s"), *Tokens[1]);
+				return false;
+			}
+			PropertyOffsets.Add(Tokens[2], VertexStride);
+			VertexStride += sizeof(float);
+		}
+	}
+
+	static const TCHAR* RequiredProperties[] = {
+		TEXT("f_dc_0"), TEXT("f_dc_1"), TEXT("f_dc_2"), TEXT("opacity"),
+		TEXT("scale_0"), TEXT("scale_1"), TEXT("scale_2"),
+		TEXT("rot_0"), TEXT("rot_1"), TEXT("rot_2"), TEXT("rot_3")
+	};
+	int32 Offsets[UE_ARRAY_COUNT(RequiredProperties)];
+	for (int32 PropertyIndex = 0; PropertyIndex < UE_ARRAY_COUNT(RequiredProperties); ++PropertyIndex)
+	{
+		const int32* Offset = PropertyOffsets.Find(RequiredProperties[PropertyIndex]);
+		if (!Offset)
+		{
+			OutErrorMessage = FString::Printf(TEXT("PLY is missing property: %s"), RequiredProperties[PropertyIndex]);
+			return false;
+		}
+		Offsets[PropertyIndex] = *Offset;
+	}
+
+	if (NumVertices <= 0 || DataOffset + static_cast<int64>(NumVertices) * VertexStride > FileData.Num())
+	{
+		OutErrorMessage = FString::Printf(TEXT("PLY vertex data is truncated (%d vertices)"), NumVertices);
+		return false;
+	}
+
+	if (Bindings.Num() > 0 && NumVertices != Bindings.Num())
+	{
+		OutErrorMessage = FString::Printf(TEXT("PLY has %d splats but binding data has %d"), NumVertices, Bindings.Num());
+		return false;
+	}
+
+	// SH band 0 coefficient used by the 3DGS reference renderer
+	constexpr float SHC0 = 0.28209479177387814f;
+
+	Gaussians.SetNum(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	{
+		const uint8* Vertex = FileData.GetData() + DataOffset + static_cast<int64>(VertexIndex) * VertexStride;
+		auto ReadFloat = [Vertex, &Offsets](int32 PropertyIndex)
+		{
+			float Value;
+			FMemory::Memcpy(&Value, Vertex + Offsets[PropertyIndex], sizeof(float));
+			return Value;
+		};
+
+		FGVRMSplatGaussian& Gaussian = Gaussians[VertexIndex];
+		Gaussian.Color = FVector3f(
+			FMath::Clamp(0.5f + SHC0 * ReadFloat(0), 0.0f, 1.0f),
+			FMath::Clamp(0.5f + SHC0 * ReadFloat(1), 0.0f, 1.0f),
+			FMath::Clamp(0.5f + SHC0 * ReadFloat(2), 0.0f, 1.0f));
+		Gaussian.Opacity = 1.0f / (1.0f + FMath::Exp(-ReadFloat(3)));
+		Gaussian.Scale = FVector3f(FMath::Exp(ReadFloat(4)), FMath::Exp(ReadFloat(5)), FMath::Exp(ReadFloat(6)));
+
+		// PLY stores (w, x, y, z)
+		Gaussian.Rotation = FQuat4f(ReadFloat(8), ReadFloat(9), ReadFloat(10), ReadFloat(7)).GetNormalized();
+	}
+
+	OutErrorMessage = FString::Printf(TEXT("Successfully imported %d splat Gaussians"), Gaussians.Num());
+	return true;
+}
+
+namespace GVRMLODRemap
+{
+	/** Uniform grid over the vertices of one mesh LOD for nearest-vertex queries */
+	struct FVertexGrid
+	{
+		TMultiMap<FIntVector, int32> Cells;
+		FBox Bounds;
+		float CellSize = 1.0f;
+
+		void Build(const TArray<FVector>& Positions)
+		{
+			Bounds = FBox(Positions);
+			const float Extent = FMath::Max(Bounds.GetSize().GetMax(), UE_KINDA_SMALL_NUMBER);
+			CellSize = Extent / FMath::Max(FMath::Pow(static_cast<float>(Positions.Num()), 1.0f / 3.0f), 1.0f);
+
+			Cells.Empty(Positions.Num());
+			for (int32 Index = 0; Index < Positions.Num(); ++Index)
+			{
+				Cells.Add(GetCell(Positions[Index]), Index);
+			}
+		}
+
+		FIntVector GetCell(const FVector& Position) const
+		{
+			const FVector Local = (Position - Bounds.Min) / CellSize;
+			return FIntVector(FMath::FloorToInt(Local.X), FMath::FloorToInt(Local.Y), FMath::FloorToInt(Local.Z));
+		}
+
+		int32 FindNearest(const FVector& Position, const TArray<FVector>& Positions) const
+		{
+			const FIntVector Center = GetCell(Position);
+			int32 BestIndex = INDEX_NONE;
+			double BestDistSq = TNumericLimits<double>::Max();
+
+			// Grow the search shell until no unvisited cell can hold a closer vertex
+			const int32 MaxRadius = FMath::CeilToInt(Bounds.GetSize().GetMax() / CellSize) + 1;
+			for (int32 Radius = 0; Radius <= MaxRadius; ++Radius)
+			{
+				for (int32 X = -Radius; X <= Radius; ++X)
+				for (int32 Y = -Radius; Y <= Radius; ++Y)
+				for (int32 Z = -Radius; Z <= Radius; ++Z)
+				{
+					if (FMath::Max3(FMath::Abs(X), FMath::Abs(Y), FMath::Abs(Z)) != Radius)
+					{
+						continue;
+					}
+
+					TArray<int32, TInlineAllocator<16>> CellVertices;
+					Cells.MultiFind(Center + FIntVector(X, Y, Z), CellVertices);
+					for (const int32 Candidate : CellVertices)
+					{
+						const double DistSq = FVector::DistSquared(Position, Positions[Candidate]);
+						if (DistSq < BestDistSq)
+						{
+							BestDistSq = DistSq;
+							BestIndex = Candidate;
+						}
+					}
+				}
+
+				if (BestIndex != INDEX_NONE && FMath::Square(Radius * CellSize) >= BestDistSq)
+				{
+					break;
+				}
+			}
+
+			return BestIndex;
+		}
+	};
+}
+
+bool UGVRMBindingData::BuildLODRemaps(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage)
+{
+	LLM_SCOPE_BYTAG(GVRM_BindingData);
+
+	if (!SkeletalMesh)
+	{
+		OutErrorMessage = TEXT("Skeletal mesh is not valid");
+		return false;
+	}
+
+	FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+	if (!RenderData || RenderData->LODRenderData.Num() == 0)
+	{
+		OutErrorMessage = TEXT("Skeletal mesh has no render data");
+		return false;
+	}
+
+	const FSkeletalMeshLODRenderData& BaseLOD = RenderData->LODRenderData[0];
+	const int32 NumBaseVertices = BaseLOD.StaticVertexBuffers.PositionVertexBuffer.GetNumVertices();
+	for (const int32 VertexIndex : BoundVertexIndices)
+	{
+		if (VertexIndex >= NumBaseVertices)
+		{
+			OutErrorMessage = FString::Printf(TEXT("Bound vertex %d is out of range for LOD0 (%d vertices)"),
+				VertexIndex, NumBaseVertices);
+			return false;
+		}
+	}
+
+	LODBindings.Empty();
+	LODBindings.SetNum(RenderData->LODRenderData.Num() - 1);
+
+	for (int32 LODIndex = 1; LODIndex < RenderData->LODRenderData.Num(); ++LODIndex)
+	{
+		const FSkeletalMeshLODRenderData& LODData = RenderData->LODRenderData[LODIndex];
+		const FRawStaticIndexBuffer16or32Interface* IndexBuffer = LODData.MultiSizeIndexContainer.GetIndexBuffer();
+		const int32 NumLODVertices = LODData.StaticVertexBuffers.PositionVertexBuffer.GetNumVertices();
+		if (!IndexBuffer || NumLODVertices == 0)
+		{
+			OutErrorMessage = FString::Printf(TEXT("LOD %d has no CPU-accessible geometry"), LODIndex);
+			return false;
+		}
+
+		TArray<FVector> LODPositions;
+		LODPositions.SetNum(NumLODVertices);
+		for (int32 VertexIndex = 0; VertexIndex < NumLODVertices; ++VertexIndex)
+		{
+			LODPositions[VertexIndex] = FVector(LODData.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex));
+		}
+
+		// Vertex -> incident triangles
+		const int32 NumTriangles = IndexBuffer->Num() / 3;
+		TMultiMap<int32, int32> VertexTriangles;
+		VertexTriangles.Reserve(NumTriangles * 3);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				VertexTriangles.Add(IndexBuffer->Get(TriangleIndex * 3 + Corner), TriangleIndex);
+			}
+		}
+
+		GVRMLODRemap::FVertexGrid Grid;
+		Grid.Build(LODPositions);
+
+		FGVRMLODBinding& LODBinding = LODBindings[LODIndex - 1];
+		LODBinding.NumLODVertices = NumLODVertices;
+		LODBinding.VertexRemaps.SetNum(BoundVertexIndices.Num());
+
+		for (int32 BoundIndex = 0; BoundIndex < BoundVertexIndices.Num(); ++BoundIndex)
+		{
+			const FVector BasePosition(BaseLOD.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(BoundVertexIndices[BoundIndex]));
+			const int32 NearestVertex = Grid.FindNearest(BasePosition, LODPositions);
+
+			FGVRMLODVertexRemap& Remap = LODBinding.VertexRemaps[BoundIndex];
+			Remap.VertexIndices = FIntVector(NearestVertex);
+			Remap.BarycentricWeights = FVector3f(1.0f, 0.0f, 0.0f);
+			FVector BlendedPosition = LODPositions[NearestVertex];
+
+			// Project onto the closest triangle that shares the nearest vertex
+			TArray<int32, TInlineAllocator<16>> Triangles;
+			VertexTriangles.MultiFind(NearestVertex, Triangles);
+			double BestDistSq = FVector::DistSquared(BasePosition, BlendedPosition);
+			for (const int32 TriangleIndex : Triangles)
+			{
+				const int32 I0 = IndexBuffer->Get(TriangleIndex * 3 + 0);
+				const int32 I1 = IndexBuffer->Get(TriangleIndex * 3 + 1);
+				const int32 I2 = IndexBuffer->Get(TriangleIndex * 3 + 2);
+				const FVector ClosestPoint = FMath::ClosestPointOnTriangleToPoint(BasePosition, LODPositions[I0], LODPositions[I1], LODPositions[I2]);
+				const double DistSq = FVector::DistSquared(BasePosition, ClosestPoint);
+				if (DistSq < BestDistSq)
+				{
+					BestDistSq = DistSq;
+					BlendedPosition = ClosestPoint;
+					Remap.VertexIndices = FIntVector(I0, I1, I2);
+					Remap.BarycentricWeights = FVector3f(FMath::ComputeBaryCentric2D(ClosestPoint, LODPositions[I0], LODPositions[I1], LODPositions[I2]));
+				}
+			}
+
+			Remap.OffsetCorrection = FVector3f(BasePosition - BlendedPosition);
+		}
+	}
+
+	OutErrorMessage = FString::Printf(TEXT("Built LOD remaps for %d LODs (%d bound vertices)"),
+		LODBindings.Num(), BoundVertexIndices.Num());
+	return true;
+}
+
+bool UGVRMBindingData::BuildMeshData(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage)
+{
+	TArray<FString> Steps;
+	FString Message;
+
+	if (!BuildLODRemaps(SkeletalMesh, Message))
+	{
+		OutErrorMessage = FString::Printf(TEXT("LOD remaps: %s"), *Message);
+		return false;
+	}
+	Steps.Add(Message);
+
+	// Lower LODs are only followed through a remap; without one the splats stay on LOD0
+	const FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+	for (int32 LODIndex = 1; LODIndex < RenderData->LODRenderData.Num(); ++LODIndex)
+	{
+		if (!GetLODBinding(LODIndex))
+		{
+			OutErrorMessage = FString::Printf(TEXT("%s has %d LODs but no LOD remap was built for LOD %d"),
+				*SkeletalMesh->GetName(), RenderData->LODRenderData.Num(), LODIndex);
+			return false;
+		}
+	}
+
+	if (!BuildRigidBindingsFromMesh(SkeletalMesh, Message))
+	{
+		OutErrorMessage = FString::Printf(TEXT("Rigid bindings: %s"), *Message);
+		return false;
+	}
+	Steps.Add(FString::Printf(TEXT("Built rigid bindings for %d splats"), RigidBindings.Num()));
+
+	// Reads the remaps: their triangle corners can reach bones LOD0 does not
+	if (!BuildBonePaletteFromMesh(SkeletalMesh, Message))
+	{
+		OutErrorMessage = FString::Printf(TEXT("Bone palette: %s"), *Message);
+		return false;
+	}
+	Steps.Add(Message);
+
+	OutErrorMessage = FString::Join(Steps, TEXT("; "));
+	return true;
+}
+
+bool UGVRMBindingData::NeedsMeshDataBuild(const USkeletalMesh& SkeletalMesh) const
+{
+	const FSkeletalMeshRenderData* RenderData = SkeletalMesh.GetResourceForRendering();
+	if (!RenderData || Bindings.Num() == 0)
+	{
+		return false;
+	}
+
+	if (!HasRigidBindings() || NumBoneInfluences <= 0 || !HasCompactBonePalette() || BonePaletteSlots.Num() != SkeletalMesh.GetRefSkeleton().GetNum())
+	{
+		return true;
+	}
+
+	for (int32 LODIndex = 1; LODIndex < RenderData->LODRenderData.Num(); ++LODIndex)
+	{
+		const FGVRMLODBinding* LODBinding = GetLODBinding(LODIndex);
+		if (!LODBinding || LODBinding->NumLODVertices != static_cast<int32>(RenderData->LODRenderData[LODIndex].StaticVertexBuffers.PositionVertexBuffer.GetNumVertices()))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UGVRMBindingData::BuildRigidBindingsFromMesh(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage)
+{
+	if (!SkeletalMesh)
+	{
+		OutErrorMessage = TEXT("Skeletal mesh is not valid");
+		return false;
+	}
+
+	FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+	if (!RenderData || RenderData->LODRenderData.Num() == 0)
+	{
+		OutErrorMessage = TEXT("Skeletal mesh has no render data");
+		return false;
+	}
+
+	// Same streams the runtime reads, so bone indices match the palette
+	FNiagaraDataInterfaceGVRMInstanceData Streams;
+	Streams.CacheLODStreams(RenderData->LODRenderData[0], 4, nullptr, nullptr);
+	return BuildRigidBindings(Streams.CachedVertexPositions, Streams.CachedBoneIndices, Streams.CachedBoneWeights, OutErrorMessage);
+}
+
+/**
+ * Walk the skin weights of the bound LOD0 vertices and of the LOD remap triangle
+ * corners: the mesh bones they reference (influence 0 is kept even without weight,
+ * rigid bindings fall back to it) and the last weighted influence of any of them.
+ */
+static bool GatherSplatVertexInfluences(const UGVRMBindingData& BindingData, USkeletalMesh* SkeletalMesh,
+	TArray<int32>& OutReferencedBones, int32& OutNumWeightedInfluences, FString& OutErrorMessage)
+{
+	if (!SkeletalMesh)
+	{
+		OutErrorMessage = TEXT("Skeletal mesh is not valid");
+		return false;
+	}
+
+	FSkeletalMeshRenderData* RenderData = SkeletalMesh->GetResourceForRendering();
+	if (!RenderData || RenderData->LODRenderData.Num() == 0)
+	{
+		OutErrorMessage = TEXT("Skeletal mesh has no render data");
+		return false;
+	}
+
+	OutNumWeightedInfluences = 1;
+	auto AddVertexBones = [&OutReferencedBones, &OutNumWeightedInfluences](const FNiagaraDataInterfaceGVRMInstanceData& Streams, int32 VertexIndex)
+	{
+		for (int32 Influence = 0; Influence < Streams.NumInfluences; ++Influence)
+		{
+			const bool bExtra = Influence >= 4;
+			const float Weight = bExtra ? Streams.CachedExtraBoneWeights[VertexIndex][Influence - 4] : Streams.CachedBoneWeights[VertexIndex][Influence];
+			if (Influence == 0 || Weight > 0.0f)
+			{
+				OutReferencedBones.Add(bExtra ? Streams.CachedExtraBoneIndices[VertexIndex][Influence - 4] : Streams.CachedBoneIndices[VertexIndex][Influence]);
+			}
+			if (Weight > 0.0f)
+			{
+				OutNumWeightedInfluences = FMath::Max(OutNumWeightedInfluences, Influence + 1);
+			}
+		}
+	};
+
+	// Same streams the runtime reads, so bone indices match the palette
+	FNiagaraDataInterfaceGVRMInstanceData Streams;
+	Streams.CacheLODStreams(RenderData->LODRenderData[0], GVRMSkinning::MaxBoneInfluences, nullptr, nullptr);
+	for (const int32 VertexIndex : BindingData.BoundVertexIndices)
+	{
+		if (VertexIndex >= Streams.NumVertices)
+		{
+			OutErrorMessage = FString::Printf(TEXT("Bound vertex %d is out of range for LOD0 (%d vertices)"), VertexIndex, Streams.NumVertices);
+			return false;
+		}
+		AddVertexBones(Streams, VertexIndex);
+	}
+
+	for (int32 LODIndex = 1; LODIndex < RenderData->LODRenderData.Num(); ++LODIndex)
+	{
+		const FGVRMLODBinding* LODBinding = BindingData.GetLODBinding(LODIndex);
+		if (!LODBinding)
+		{
+			continue;
+		}
+
+		Streams.CacheLODStreams(RenderData->LODRenderData[LODIndex], GVRMSkinning::MaxBoneInfluences, nullptr, nullptr);
+		for (const FGVRMLODVertexRemap& Remap : LODBinding->VertexRemaps)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				if (Remap.VertexIndices[Corner] >= 0 && Remap.VertexIndices[Corner] < Streams.NumVertices)
+				{
+					AddVertexBones(Streams, Remap.VertexIndices[Corner]);
+				}
+			}
+		}
+	}
+	return true;
+}
+
+bool UGVRMBindingData::BuildBonePaletteFromMesh(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage)
+{
+	// One walk of the skin weights feeds both the influence count and the palette
+	TArray<int32> ReferencedBones;
+	int32 NumWeightedInfluences = 0;
+	if (!GatherSplatVertexInfluences(*this, SkeletalMesh, ReferencedBones, NumWeightedInfluences, OutErrorMessage))
+	{
+		return false;
+	}
+
+	NumBoneInfluences = GVRMSkinning::GetInfluencePermutation(NumWeightedInfluences);
+	if (!BuildBonePalette(SkeletalMesh->GetRefSkeleton().GetNum(), ReferencedBones, OutErrorMessage))
+	{
+		return false;
+	}
+	OutErrorMessage += FString::Printf(TEXT(", %d weighted influences per vertex (skinning reads %d)"), NumWeightedInfluences, NumBoneInfluences);
 	return true;
 }
 
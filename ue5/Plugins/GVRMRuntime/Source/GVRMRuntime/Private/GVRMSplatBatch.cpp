@@ -0,0 +1,476 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSplatBatch.h"
+#include "GVRMSplatSceneProxy.h"
+#include "GVRMRenderUtils.h"
+#include "GVRMStats.h"
+#include "GVRMMemoryReport.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "SceneView.h"
+
+FGVRMSplatBatch::~FGVRMSplatBatch()
+{
+	using namespace GVRMRender;
+	ReleaseBuffer(SplatVertexIndicesBuffer, SplatVertexIndicesSRV);
+	ReleaseBuffer(SplatRelativePositionsBuffer, SplatRelativePositionsSRV);
+	ReleaseBuffer(VertexPositionsBuffer, VertexPositionsSRV);
+	ReleaseBuffer(BoneIndicesBuffer, BoneIndicesSRV);
+	ReleaseBuffer(BoneWeightsBuffer, BoneWeightsSRV);
+	ReleaseBuffer(ExtraBoneIndicesBuffer, ExtraBoneIndicesSRV);
+	ReleaseBuffer(ExtraBoneWeightsBuffer, ExtraBoneWeightsSRV);
+	ReleaseBuffer(LODRemapIndicesBuffer, LODRemapIndicesSRV);
+	ReleaseBuffer(LODRemapWeightsBuffer, LODRemapWeightsSRV);
+	ReleaseBuffer(LODRemapOffsetsBuffer, LODRemapOffsetsSRV);
+	ReleaseBuffer(RigidSplatOrderBuffer, RigidSplatOrderSRV);
+	ReleaseBuffer(RigidHostPositionsBuffer, RigidHostPositionsSRV);
+	ReleaseBuffer(RigidBonesBuffer, RigidBonesSRV);
+	ReleaseBuffer(UniqueVertexIndicesBuffer, UniqueVertexIndicesSRV);
+	ReleaseBuffer(SplatUniqueVerticesBuffer, SplatUniqueVerticesSRV);
+	ReleaseBuffer(MorphVertexSlotsBuffer, MorphVertexSlotsSRV);
+	ReleaseBuffer(MorphDeltasBuffer, MorphDeltasSRV);
+}
+
+void FGVRMSplatBatch::GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const
+{
+	using namespace GVRMRender;
+
+	OutBreakdown.AddGPU(TEXT("SplatVertexIndices"), GetBufferSize(SplatVertexIndicesBuffer));
+	OutBreakdown.AddGPU(TEXT("SplatRelativePositions"), GetBufferSize(SplatRelativePositionsBuffer));
+	OutBreakdown.AddGPU(TEXT("MeshPositions"), GetBufferSize(VertexPositionsBuffer));
+	OutBreakdown.AddGPU(TEXT("MeshBoneIndices"), GetBufferSize(BoneIndicesBuffer));
+	OutBreakdown.AddGPU(TEXT("MeshBoneWeights"), GetBufferSize(BoneWeightsBuffer));
+	OutBreakdown.AddGPU(TEXT("MeshExtraBoneIndices"), GetBufferSize(ExtraBoneIndicesBuffer));
+	OutBreakdown.AddGPU(TEXT("MeshExtraBoneWeights"), GetBufferSize(ExtraBoneWeightsBuffer));
+	OutBreakdown.AddGPU(TEXT("LODRemapIndices"), GetBufferSize(LODRemapIndicesBuffer));
+	OutBreakdown.AddGPU(TEXT("LODRemapWeights"), GetBufferSize(LODRemapWeightsBuffer));
+	OutBreakdown.AddGPU(TEXT("LODRemapOffsets"), GetBufferSize(LODRemapOffsetsBuffer));
+	OutBreakdown.AddGPU(TEXT("RigidSplatOrder"), GetBufferSize(RigidSplatOrderBuffer));
+	OutBreakdown.AddGPU(TEXT("RigidHostPositions"), GetBufferSize(RigidHostPositionsBuffer));
+	OutBreakdown.AddGPU(TEXT("RigidBones"), GetBufferSize(RigidBonesBuffer));
+	OutBreakdown.AddGPU(TEXT("UniqueVertexIndices"), GetBufferSize(UniqueVertexIndicesBuffer));
+	OutBreakdown.AddGPU(TEXT("SplatUniqueVertices"), GetBufferSize(SplatUniqueVerticesBuffer));
+	OutBreakdown.AddGPU(TEXT("MorphVertexSlots"), GetBufferSize(MorphVertexSlotsBuffer));
+	OutBreakdown.AddGPU(TEXT("MorphDeltas"), GetBufferSize(MorphDeltasBuffer));
+
+	// Skinning outputs are RDG buffers recreated every frame from the pool
+	OutBreakdown.AddGPU(TEXT("SkinnedSplats (pooled)"), static_cast<uint64>(TotalSplats) * 2 * sizeof(FVector4f));
+	OutBreakdown.AddGPU(TEXT("SharedVertices (pooled)"), static_cast<uint64>(TotalUniqueVertices) * 2 * sizeof(FVector4f));
+	OutBreakdown.AddGPU(TEXT("MorphOffsets (pooled)"), static_cast<uint64>(TotalMorphSlots) * 3 * sizeof(int32));
+
+	OutBreakdown.AddArray(TEXT("Layout"), Layout);
+	OutBreakdown.AddArray(TEXT("PaletteScratch"), PaletteScratch);
+	OutBreakdown.AddArray(TEXT("InstanceScratch"), InstanceScratch);
+	OutBreakdown.AddArray(TEXT("CullPlaneScratch"), CullPlaneScratch);
+	OutBreakdown.AddArray(TEXT("MorphScratch"), MorphScratch);
+}
+
+bool FGVRMSplatBatch::IsLayoutCurrent(TConstArrayView<FGVRMSplatSceneProxy*> Proxies) const
+{
+	if (Layout.Num() != Proxies.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Proxies.Num(); ++Index)
+	{
+		if (Layout[Index].Proxy != Proxies[Index] || Layout[Index].MeshStreamsRevision != Proxies[Index]->GetMeshStreamsRevision())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FGVRMSplatBatch::RebuildLayout(TConstArrayView<FGVRMSplatSceneProxy*> Proxies)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatComponentRenderUpload);
+	LLM_SCOPE_BYTAG(GVRM_RenderData);
+
+	TArray<int32> SplatVertexIndices;
+	TArray<FVector4f> SplatRelativePositions;
+	TArray<FVector3f> VertexPositions;
+	TArray<FIntVector4> BoneIndices;
+	TArray<FVector4f> BoneWeights;
+	TArray<FIntVector4> ExtraBoneIndices;
+	TArray<FVector4f> ExtraBoneWeights;
+	TArray<FIntVector4> LODRemapIndices;
+	TArray<FVector4f> LODRemapWeights;
+	TArray<FVector4f> LODRemapOffsets;
+	TArray<uint32> RigidSplatOrder;
+	TArray<FVector4f> RigidHostPositions;
+	TArray<FUintVector2> RigidBones;
+	TArray<int32> UniqueVertexIndices;
+	TArray<int32> SplatUniqueVertices;
+	TArray<uint32> MorphVertexSlots;
+	TArray<FVector4f> MorphDeltas;
+
+	// One permutation skins the whole batch; avatars with fewer influences carry zero weights
+	NumInfluences = 1;
+	for (const FGVRMSplatSceneProxy* Proxy : Proxies)
+	{
+		NumInfluences = FMath::Max(NumInfluences, Proxy->GetMeshStreams()->NumInfluences);
+	}
+
+	Layout.Reset(Proxies.Num());
+	TotalMorphSlots = 0;
+	for (const FGVRMSplatSceneProxy* Proxy : Proxies)
+	{
+		const FGVRMSplatDynamicData& MeshStreams = *Proxy->GetMeshStreams();
+
+		FLayoutEntry& Entry = Layout.AddDefaulted_GetRef();
+		Entry.Proxy = Proxy;
+		Entry.MeshStreamsRevision = Proxy->GetMeshStreamsRevision();
+		Entry.SplatOffset = SplatVertexIndices.Num();
+		Entry.VertexOffset = VertexPositions.Num();
+		Entry.RemapOffset = LODRemapIndices.Num();
+		Entry.NumRemapVertices = MeshStreams.NumRemapVertices;
+		Entry.RigidOffset = RigidSplatOrder.Num();
+		Entry.UniqueVertexOffset = UniqueVertexIndices.Num();
+		Entry.NumUniqueVertices = Proxy->GetUniqueVertexIndices().Num();
+		Entry.bHasRigidStreams = Proxy->GetRigidSplatOrder().Num() > 0;
+
+		// Indices stay local to the avatar; the shader adds the instance offsets
+		SplatVertexIndices.Append(Proxy->GetSplatVertexIndices());
+		SplatRelativePositions.Append(Proxy->GetSplatRelativePositions());
+		VertexPositions.Append(MeshStreams.VertexPositions);
+		BoneIndices.Append(MeshStreams.BoneIndices);
+		BoneWeights.Append(MeshStreams.BoneWeights);
+		if (NumInfluences > 4)
+		{
+			if (MeshStreams.NumInfluences > 4)
+			{
+				ExtraBoneIndices.Append(MeshStreams.ExtraBoneIndices);
+				ExtraBoneWeights.Append(MeshStreams.ExtraBoneWeights);
+			}
+			else
+			{
+				ExtraBoneIndices.AddZeroed(MeshStreams.BoneIndices.Num());
+				ExtraBoneWeights.AddZeroed(MeshStreams.BoneWeights.Num());
+			}
+		}
+		LODRemapIndices.Append(MeshStreams.LODRemapIndices);
+		LODRemapWeights.Append(MeshStreams.LODRemapWeights);
+		LODRemapOffsets.Append(MeshStreams.LODRemapOffsets);
+		RigidSplatOrder.Append(Proxy->GetRigidSplatOrder());
+		RigidHostPositions.Append(Proxy->GetRigidHostPositions());
+		RigidBones.Append(Proxy->GetRigidBones());
+		UniqueVertexIndices.Append(Proxy->GetUniqueVertexIndices());
+
+		// Keep SplatUniqueVertices aligned with the splat streams for single-pass avatars
+		if (Entry.NumUniqueVertices > 0)
+		{
+			SplatUniqueVertices.Append(Proxy->GetSplatUniqueVertices());
+		}
+		else
+		{
+			SplatUniqueVertices.AddZeroed(Proxy->GetSplatVertexIndices().Num());
+		}
+
+		// Morph slots and the slots in the deltas are made global to the batch
+		if (MeshStreams.NumMorphSlots > 0)
+		{
+			Entry.MorphVertexOffset = MorphVertexSlots.Num();
+			Entry.MorphDeltaOffset = MorphDeltas.Num();
+			for (const int32 Slot : MeshStreams.MorphVertexSlots)
+			{
+				MorphVertexSlots.Add(Slot != INDEX_NONE ? TotalMorphSlots + Slot : GVRMSkinning::MorphSlotNone);
+			}
+			for (const FVector4f& Delta : MeshStreams.MorphDeltas)
+			{
+				MorphDeltas.Add(GVRMSkinning::EncodeMorphDelta(FVector3f(Delta), TotalMorphSlots + GVRMSkinning::GetMorphDeltaSlot(Delta)));
+			}
+			TotalMorphSlots += MeshStreams.NumMorphSlots;
+		}
+	}
+	TotalSplats = SplatVertexIndices.Num();
+	TotalUniqueVertices = UniqueVertexIndices.Num();
+
+	// No avatar shares vertices: skip the remap stream, the vertex pass then has no work
+	if (TotalUniqueVertices == 0)
+	{
+		SplatUniqueVertices.Reset();
+	}
+
+	using namespace GVRMRender;
+	UploadBuffer(TEXT("GVRMBatchSplatVertexIndices"), SplatVertexIndices, sizeof(int32), PF_R32_SINT,
+		SplatVertexIndicesBuffer, SplatVertexIndicesSRV);
+	UploadBuffer(TEXT("GVRMBatchSplatRelativePositions"), SplatRelativePositions, sizeof(FVector4f), PF_A32B32G32R32F,
+		SplatRelativePositionsBuffer, SplatRelativePositionsSRV);
+	UploadBuffer(TEXT("GVRMBatchMeshPositions"), VertexPositions, sizeof(float), PF_R32_FLOAT,
+		VertexPositionsBuffer, VertexPositionsSRV);
+	UploadBuffer(TEXT("GVRMBatchMeshBoneIndices"), BoneIndices, sizeof(FIntVector4), PF_R32G32B32A32_UINT,
+		BoneIndicesBuffer, BoneIndicesSRV);
+	UploadBuffer(TEXT("GVRMBatchMeshBoneWeights"), BoneWeights, sizeof(FVector4f), PF_A32B32G32R32F,
+		BoneWeightsBuffer, BoneWeightsSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchMeshExtraBoneIndices"), ExtraBoneIndices, sizeof(FIntVector4), PF_R32G32B32A32_UINT,
+		ExtraBoneIndicesBuffer, ExtraBoneIndicesSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchMeshExtraBoneWeights"), ExtraBoneWeights, sizeof(FVector4f), PF_A32B32G32R32F,
+		ExtraBoneWeightsBuffer, ExtraBoneWeightsSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchLODRemapIndices"), LODRemapIndices, sizeof(FIntVector4), PF_R32G32B32A32_UINT,
+		LODRemapIndicesBuffer, LODRemapIndicesSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchLODRemapWeights"), LODRemapWeights, sizeof(FVector4f), PF_A32B32G32R32F,
+		LODRemapWeightsBuffer, LODRemapWeightsSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchLODRemapOffsets"), LODRemapOffsets, sizeof(FVector4f), PF_A32B32G32R32F,
+		LODRemapOffsetsBuffer, LODRemapOffsetsSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchRigidSplatOrder"), RigidSplatOrder, sizeof(uint32), PF_R32_UINT,
+		RigidSplatOrderBuffer, RigidSplatOrderSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchRigidHostPositions"), RigidHostPositions, sizeof(FVector4f), PF_A32B32G32R32F,
+		RigidHostPositionsBuffer, RigidHostPositionsSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchRigidBones"), RigidBones, sizeof(FUintVector2), PF_R32G32_UINT,
+		RigidBonesBuffer, RigidBonesSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchUniqueVertexIndices"), UniqueVertexIndices, sizeof(uint32), PF_R32_UINT,
+		UniqueVertexIndicesBuffer, UniqueVertexIndicesSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchSplatUniqueVertices"), SplatUniqueVertices, sizeof(uint32), PF_R32_UINT,
+		SplatUniqueVerticesBuffer, SplatUniqueVerticesSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchMorphVertexSlots"), MorphVertexSlots, sizeof(uint32), PF_R32_UINT,
+		MorphVertexSlotsBuffer, MorphVertexSlotsSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMBatchMorphDeltas"), MorphDeltas, sizeof(FVector4f), PF_A32B32G32R32F,
+		MorphDeltasBuffer, MorphDeltasSRV);
+}
+
+void FGVRMSplatBatch::AddSkinningPasses(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily, TConstArrayView<FGVRMSplatSceneProxy*> Proxies)
+{
+	if (Proxies.Num() == 0)
+	{
+		return;
+	}
+
+	if (!IsLayoutCurrent(Proxies))
+	{
+		RebuildLayout(Proxies);
+	}
+
+	if (TotalSplats == 0)
+	{
+		return;
+	}
+
+	// Combined bone palette and instance table for this frame
+	PaletteScratch.Reset();
+	InstanceScratch.Reset();
+	MorphScratch.Reset();
+	uint32 NumMorphThreads = 0;
+	uint32 NumRigidSplats = 0;
+	uint32 NumSharedVertices = 0;
+	for (int32 Index = 0; Index < Layout.Num(); ++Index)
+	{
+		const FLayoutEntry& Entry = Layout[Index];
+		const FGVRMSplatSceneProxy* Proxy = Proxies[Index];
+		const FBoxSphereBounds& Bounds = Proxy->GetBounds();
+
+		FGVRMSplatBatchInstance& Instance = InstanceScratch.AddDefaulted_GetRef();
+		Instance.SplatOffset = Entry.SplatOffset;
+		Instance.NumSplats = Proxy->GetNumSplats();
+		Instance.VertexOffset = Entry.VertexOffset;
+		Instance.BoneOffset = PaletteScratch.Num();
+		Instance.RemapOffset = Entry.RemapOffset;
+		Instance.NumRemapVertices = Entry.NumRemapVertices;
+		Instance.SkinningMode = Entry.bHasRigidStreams ? static_cast<uint32>(Proxy->GetSkinningMode()) : 0;
+		Instance.RigidOffset = Entry.RigidOffset;
+		Instance.UniqueVertexOffset = Entry.UniqueVertexOffset;
+		Instance.NumUniqueVertices = Entry.NumUniqueVertices;
+		NumRigidSplats += Instance.SkinningMode != 0 ? Instance.NumSplats : 0;
+		NumSharedVertices += Instance.SkinningMode == 0 ? Instance.NumUniqueVertices : 0;
+		Instance.BoundsCenter = FVector4f(FVector3f(Bounds.Origin), 0.0f);
+		Instance.BoundsExtent = FVector4f(FVector3f(Bounds.BoxExtent), 0.0f);
+
+		const FGVRMBonePalette* Palette = Proxy->GetCurrentPalette();
+		PaletteScratch.Append(Palette->BoneMatrices);
+
+		// Active morphs point into the combined deltas and continue the batch's thread range
+		if (Entry.MorphVertexOffset != MAX_uint32 && Palette->ActiveMorphs.Num() > 0)
+		{
+			Instance.MorphVertexOffset = Entry.MorphVertexOffset;
+			for (const FGVRMActiveMorph& ActiveMorph : Palette->ActiveMorphs)
+			{
+				FGVRMActiveMorph& Morph = MorphScratch.Add_GetRef(ActiveMorph);
+				Morph.FirstDelta += Entry.MorphDeltaOffset;
+				Morph.FirstThread = NumMorphThreads;
+				NumMorphThreads += Morph.NumDeltas;
+			}
+		}
+	}
+
+	// Frustum planes of every view; an instance is skinned if any view can see it
+	constexpr uint32 MaxCullPlanes = FGVRMSplatCullInstancesCS::MaxCullPlanes;
+	uint32 NumCullViews = 0;
+	CullPlaneScratch.Reset();
+	for (const FSceneView* View : ViewFamily.Views)
+	{
+		if (!View || View->ViewFrustum.Planes.Num() > static_cast<int32>(MaxCullPlanes))
+		{
+			// Unusual frustum: skin everything rather than risk culling visible avatars
+			NumCullViews = 0;
+			CullPlaneScratch.Reset();
+			break;
+		}
+
+		for (uint32 PlaneIndex = 0; PlaneIndex < MaxCullPlanes; ++PlaneIndex)
+		{
+			// Padding planes (zero normal, positive distance) never reject
+			const bool bValidPlane = PlaneIndex < static_cast<uint32>(View->ViewFrustum.Planes.Num());
+			const FPlane& Plane = bValidPlane ? View->ViewFrustum.Planes[PlaneIndex] : FPlane(0.0, 0.0, 0.0, 1.0);
+			CullPlaneScratch.Add(FVector4f(Plane.X, Plane.Y, Plane.Z, Plane.W));
+		}
+		++NumCullViews;
+	}
+	if (CullPlaneScratch.Num() == 0)
+	{
+		CullPlaneScratch.Add(FVector4f::Zero());
+	}
+
+	SET_DWORD_STAT(STAT_GVRM_BatchedAvatars, Layout.Num());
+	SET_DWORD_STAT(STAT_GVRM_BatchedSplats, TotalSplats);
+	SET_DWORD_STAT(STAT_GVRM_RigidSplats, NumRigidSplats);
+	SET_DWORD_STAT(STAT_GVRM_SharedVertices, NumSharedVertices);
+	SET_DWORD_STAT(STAT_GVRM_ActiveMorphDeltas, NumMorphThreads);
+
+	const uint32 NumInstances = InstanceScratch.Num();
+
+	// The scratch arrays outlive graph execution, so the uploads can reference them directly
+	FRDGBufferRef InstancesBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRM.BatchInstances"),
+		sizeof(FGVRMSplatBatchInstance), NumInstances, InstanceScratch.GetData(), InstanceScratch.Num() * sizeof(FGVRMSplatBatchInstance), ERDGInitialDataFlags::NoCopy);
+	FRDGBufferRef CullPlanesBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRM.BatchCullPlanes"),
+		sizeof(FVector4f), CullPlaneScratch.Num(), CullPlaneScratch.GetData(), CullPlaneScratch.Num() * sizeof(FVector4f), ERDGInitialDataFlags::NoCopy);
+	FRDGBufferRef PaletteBuffer = CreateVertexBuffer(GraphBuilder, TEXT("GVRM.BatchBoneMatrices"),
+		FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), PaletteScratch.Num() * 3), PaletteScratch.GetData(), PaletteScratch.Num() * sizeof(FGVRMBoneMatrix3x4), ERDGInitialDataFlags::NoCopy);
+
+	FRDGBufferRef VisibleInstances = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FUintVector4), NumInstances), TEXT("GVRM.BatchVisibleInstances"));
+	FRDGBufferRef BatchCounters = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 3), TEXT("GVRM.BatchCounters"));
+	FRDGBufferRef SkinningArgs = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(2), TEXT("GVRM.BatchSkinningArgs"));
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(ViewFamily.GetFeatureLevel());
+
+	// Cull and compact (single group)
+	{
+		FGVRMSplatCullInstancesCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatCullInstancesCS::FParameters>();
+		PassParameters->NumInstances = NumInstances;
+		PassParameters->NumCullViews = NumCullViews;
+		PassParameters->MaxDispatchGroups = GRHIMaxDispatchThreadGroupsPerDimension.X;
+		PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+		PassParameters->CullPlanes = GraphBuilder.CreateSRV(CullPlanesBuffer);
+		PassParameters->RWVisibleInstances = GraphBuilder.CreateUAV(VisibleInstances);
+		PassParameters->RWSkinningArgs = GraphBuilder.CreateUAV(SkinningArgs, PF_R32_UINT);
+		PassParameters->RWBatchCounters = GraphBuilder.CreateUAV(BatchCounters);
+
+		TShaderMapRef<FGVRMSplatCullInstancesCS> ComputeShader(ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMCullSplatInstances (%u avatars)", NumInstances),
+			ComputeShader, PassParameters, FIntVector(1, 1, 1));
+	}
+
+	// Sum the active morph targets of every avatar (visible or not: the pass is tiny next to skinning)
+	FRDGBufferRef MorphOffsetsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(int32), FMath::Max(TotalMorphSlots * 3, 3u)), TEXT("GVRM.MorphOffsets"));
+	{
+		FRDGBufferUAVRef MorphOffsetsUAV = GraphBuilder.CreateUAV(MorphOffsetsBuffer, PF_R32_SINT);
+		AddClearUAVPass(GraphBuilder, MorphOffsetsUAV, 0u);
+
+		if (NumMorphThreads > 0)
+		{
+			FRDGBufferRef ActiveMorphsBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRM.BatchActiveMorphs"),
+				sizeof(FGVRMActiveMorph), MorphScratch.Num(), MorphScratch.GetData(), MorphScratch.Num() * sizeof(FGVRMActiveMorph), ERDGInitialDataFlags::NoCopy);
+
+			FGVRMSplatMorphAccumulateCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatMorphAccumulateCS::FParameters>();
+			PassParameters->NumActiveMorphs = MorphScratch.Num();
+			PassParameters->NumMorphThreads = NumMorphThreads;
+			PassParameters->ActiveMorphs = GraphBuilder.CreateSRV(ActiveMorphsBuffer);
+			PassParameters->MorphDeltas = MorphDeltasSRV;
+			PassParameters->RWMorphOffsets = MorphOffsetsUAV;
+
+			TShaderMapRef<FGVRMSplatMorphAccumulateCS> ComputeShader(ShaderMap);
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMAccumulateMorphs (%u deltas)", NumMorphThreads), ComputeShader, PassParameters,
+				FComputeShaderUtils::GetGroupCountWrapped(NumMorphThreads, FGVRMSplatMorphAccumulateCS::ThreadGroupSize));
+		}
+	}
+
+	// Skin the shared vertices of the visible LBS avatars once
+	FRDGBufferRef SharedPositionsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), FMath::Max(TotalUniqueVertices, 1u)), TEXT("GVRM.SharedVertexPositions"));
+	FRDGBufferRef SharedRotationsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), FMath::Max(TotalUniqueVertices, 1u)), TEXT("GVRM.SharedVertexRotations"));
+	if (TotalUniqueVertices > 0)
+	{
+		FGVRMSplatVertexSkinningCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatVertexSkinningCS::FParameters>();
+		PassParameters->UniqueVertexIndices = UniqueVertexIndicesSRV;
+		PassParameters->VertexPositions = VertexPositionsSRV;
+		PassParameters->BoneIndices = BoneIndicesSRV;
+		PassParameters->BoneWeights = BoneWeightsSRV;
+		PassParameters->ExtraBoneIndices = ExtraBoneIndicesSRV;
+		PassParameters->ExtraBoneWeights = ExtraBoneWeightsSRV;
+		PassParameters->BoneMatrices = GraphBuilder.CreateSRV(PaletteBuffer, PF_A32B32G32R32F);
+		PassParameters->LODRemapIndices = LODRemapIndicesSRV;
+		PassParameters->LODRemapWeights = LODRemapWeightsSRV;
+		PassParameters->LODRemapOffsets = LODRemapOffsetsSRV;
+		PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+		PassParameters->VisibleInstances = GraphBuilder.CreateSRV(VisibleInstances);
+		PassParameters->BatchCounters = GraphBuilder.CreateSRV(BatchCounters);
+		PassParameters->RWSharedVertexPositions = GraphBuilder.CreateUAV(SharedPositionsBuffer);
+		PassParameters->RWSharedVertexRotations = GraphBuilder.CreateUAV(SharedRotationsBuffer);
+		PassParameters->IndirectArgs = SkinningArgs;
+
+		FGVRMSplatVertexSkinningCS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<FGVRMNumInfluencesDim>(NumInfluences);
+		TShaderMapRef<FGVRMSplatVertexSkinningCS> ComputeShader(ShaderMap, PermutationVector);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSkinSharedVertices (%u vertices max)", TotalUniqueVertices),
+			ComputeShader, PassParameters, SkinningArgs, FGVRMSplatCullInstancesCS::VertexPassArgsOffset);
+	}
+	else
+	{
+		// Never read, but the splat pass binds them
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(SharedPositionsBuffer), 0u);
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(SharedRotationsBuffer), 0u);
+	}
+
+	// Skin every visible splat of every avatar
+	FRDGBufferRef PositionsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), TotalSplats), TEXT("GVRM.SkinnedPositions"));
+	FRDGBufferRef RotationsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), TotalSplats), TEXT("GVRM.SkinnedRotations"));
+	{
+		FGVRMSplatSkinningCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatSkinningCS::FParameters>();
+		PassParameters->SplatVertexIndices = SplatVertexIndicesSRV;
+		PassParameters->SplatRelativePositions = SplatRelativePositionsSRV;
+		PassParameters->VertexPositions = VertexPositionsSRV;
+		PassParameters->BoneIndices = BoneIndicesSRV;
+		PassParameters->BoneWeights = BoneWeightsSRV;
+		PassParameters->ExtraBoneIndices = ExtraBoneIndicesSRV;
+		PassParameters->ExtraBoneWeights = ExtraBoneWeightsSRV;
+		PassParameters->BoneMatrices = GraphBuilder.CreateSRV(PaletteBuffer, PF_A32B32G32R32F);
+		PassParameters->LODRemapIndices = LODRemapIndicesSRV;
+		PassParameters->LODRemapWeights = LODRemapWeightsSRV;
+		PassParameters->LODRemapOffsets = LODRemapOffsetsSRV;
+		PassParameters->RigidSplatOrder = RigidSplatOrderSRV;
+		PassParameters->RigidHostPositions = RigidHostPositionsSRV;
+		PassParameters->RigidBones = RigidBonesSRV;
+		PassParameters->SplatUniqueVertices = SplatUniqueVerticesSRV;
+		PassParameters->MorphVertexSlots = MorphVertexSlotsSRV;
+		PassParameters->MorphOffsets = GraphBuilder.CreateSRV(MorphOffsetsBuffer, PF_R32_SINT);
+		PassParameters->SharedVertexPositions = GraphBuilder.CreateSRV(SharedPositionsBuffer);
+		PassParameters->SharedVertexRotations = GraphBuilder.CreateSRV(SharedRotationsBuffer);
+		PassParameters->Instances = GraphBuilder.CreateSRV(InstancesBuffer);
+		PassParameters->VisibleInstances = GraphBuilder.CreateSRV(VisibleInstances);
+		PassParameters->BatchCounters = GraphBuilder.CreateSRV(BatchCounters);
+		PassParameters->RWSkinnedPositions = GraphBuilder.CreateUAV(PositionsBuffer);
+		PassParameters->RWSkinnedRotations = GraphBuilder.CreateUAV(RotationsBuffer);
+		PassParameters->IndirectArgs = SkinningArgs;
+
+		FGVRMSplatSkinningCS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<FGVRMNumInfluencesDim>(NumInfluences);
+		TShaderMapRef<FGVRMSplatSkinningCS> ComputeShader(ShaderMap, PermutationVector);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSkinSplats (%u splats max)", TotalSplats),
+			ComputeShader, PassParameters, SkinningArgs, FGVRMSplatCullInstancesCS::SplatPassArgsOffset);
+	}
+
+	const TRefCountPtr<FRDGPooledBuffer> SkinnedPositions = GraphBuilder.ConvertToExternalBuffer(PositionsBuffer);
+	const TRefCountPtr<FRDGPooledBuffer> SkinnedRotations = GraphBuilder.ConvertToExternalBuffer(RotationsBuffer);
+	bool bAnyDebugDraw = false;
+	for (int32 Index = 0; Index < Layout.Num(); ++Index)
+	{
+		Proxies[Index]->SetSkinnedSplats(SkinnedPositions, SkinnedRotations, Layout[Index].SplatOffset);
+		bAnyDebugDraw |= Proxies[Index]->HasDebugDraw();
+	}
+
+	// The palette is only kept past the graph for the debug view's joints
+	const TRefCountPtr<FRDGPooledBuffer> BoneMatrices = bAnyDebugDraw ? GraphBuilder.ConvertToExternalBuffer(PaletteBuffer) : nullptr;
+	for (int32 Index = 0; Index < Layout.Num(); ++Index)
+	{
+		Proxies[Index]->SetSkinnedBones(BoneMatrices, InstanceScratch[Index].BoneOffset, Proxies[Index]->GetCurrentPalette()->BoneMatrices.Num());
+	}
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHI.h"
+#include "RenderGraphResources.h"
+#include "GVRMSplatShaders.h"
+#include "GVRMSkinningMath.h"
+
+class FGVRMSplatSceneProxy;
+class FRDGBuilder;
+class FSceneViewFamily;
+struct FGVRMMemoryBreakdown;
+
+/**
+ * Scene-level skinning batch for UGVRMSplatComponent.
+ *
+ * Combines the skinning inputs of every splat component in a scene into one
+ * set of buffers, then per view family:
+ * - uploads one combined bone palette and instance table (RDG uploads)
+ * - sums the deltas of every active morph target into per-vertex offsets (one dispatch)
+ * - culls all instances against the family's views and compacts the visible ones (one group)
+ * - skins the shared bound vertices of the visible LBS instances once (indirect)
+ * - skins every visible splat in a single indirect dispatch (LBS or rigid per instance)
+ *
+ * Static streams are only recombined when the set of proxies or one of their
+ * mesh LODs changes, so the per-frame cost does not grow with per-actor overhead.
+ */
+class FGVRMSplatBatch
+{
+public:
+	~FGVRMSplatBatch();
+
+	/** Add the cull and skinning passes for the given proxies (all from ViewFamily's scene and ready to skin) */
+	void AddSkinningPasses(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily, TConstArrayView<FGVRMSplatSceneProxy*> Proxies);
+
+	/** GPU bytes of the combined streams and CPU bytes of the scratch arrays */
+	void GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const;
+
+	int32 GetNumInstances() const { return Layout.Num(); }
+
+private:
+	/** Where one proxy lives in the combined static streams */
+	struct FLayoutEntry
+	{
+		const FGVRMSplatSceneProxy* Proxy = nullptr;
+		uint32 MeshStreamsRevision = 0;
+		uint32 SplatOffset = 0;
+		uint32 VertexOffset = 0;
+		uint32 RemapOffset = 0;
+		uint32 NumRemapVertices = 0;
+		uint32 RigidOffset = 0;
+		uint32 UniqueVertexOffset = 0;
+		uint32 NumUniqueVertices = 0;
+		uint32 MorphVertexOffset = MAX_uint32;  // MAX_uint32 when no bound vertex has a morph target
+		uint32 MorphDeltaOffset = 0;
+		bool bHasRigidStreams = false;
+	};
+
+	bool IsLayoutCurrent(TConstArrayView<FGVRMSplatSceneProxy*> Proxies) const;
+
+	/** Recombine the splat and mesh streams of all proxies */
+	void RebuildLayout(TConstArrayView<FGVRMSplatSceneProxy*> Proxies);
+
+	TArray<FLayoutEntry> Layout;
+	uint32 TotalSplats = 0;
+	uint32 TotalUniqueVertices = 0;
+	uint32 TotalMorphSlots = 0;
+	int32 NumInfluences = 4;            // Skinning permutation, the most any proxy needs
+
+	// Combined static streams
+	FBufferRHIRef SplatVertexIndicesBuffer;
+	FBufferRHIRef SplatRelativePositionsBuffer;
+	FBufferRHIRef VertexPositionsBuffer;
+	FBufferRHIRef BoneIndicesBuffer;
+	FBufferRHIRef BoneWeightsBuffer;
+	FBufferRHIRef ExtraBoneIndicesBuffer;
+	FBufferRHIRef ExtraBoneWeightsBuffer;
+	FBufferRHIRef LODRemapIndicesBuffer;
+	FBufferRHIRef LODRemapWeightsBuffer;
+	FBufferRHIRef LODRemapOffsetsBuffer;
+	FBufferRHIRef RigidSplatOrderBuffer;
+	FBufferRHIRef RigidHostPositionsBuffer;
+	FBufferRHIRef RigidBonesBuffer;
+	FBufferRHIRef UniqueVertexIndicesBuffer;
+	FBufferRHIRef SplatUniqueVerticesBuffer;
+	FBufferRHIRef MorphVertexSlotsBuffer;
+	FBufferRHIRef MorphDeltasBuffer;
+	FShaderResourceViewRHIRef SplatVertexIndicesSRV;
+	FShaderResourceViewRHIRef SplatRelativePositionsSRV;
+	FShaderResourceViewRHIRef VertexPositionsSRV;
+	FShaderResourceViewRHIRef BoneIndicesSRV;
+	FShaderResourceViewRHIRef BoneWeightsSRV;
+	FShaderResourceViewRHIRef ExtraBoneIndicesSRV;
+	FShaderResourceViewRHIRef ExtraBoneWeightsSRV;
+	FShaderResourceViewRHIRef LODRemapIndicesSRV;
+	FShaderResourceViewRHIRef LODRemapWeightsSRV;
+	FShaderResourceViewRHIRef LODRemapOffsetsSRV;
+	FShaderResourceViewRHIRef RigidSplatOrderSRV;
+	FShaderResourceViewRHIRef RigidHostPositionsSRV;
+	FShaderResourceViewRHIRef RigidBonesSRV;
+	FShaderResourceViewRHIRef UniqueVertexIndicesSRV;
+	FShaderResourceViewRHIRef SplatUniqueVerticesSRV;
+	FShaderResourceViewRHIRef MorphVertexSlotsSRV;
+	FShaderResourceViewRHIRef MorphDeltasSRV;
+
+	// Per-frame scratch (reused, grows only when the batch grows)
+	TArray<FGVRMBoneMatrix3x4> PaletteScratch;
+	TArray<FGVRMSplatBatchInstance> InstanceScratch;
+	TArray<FVector4f> CullPlaneScratch;
+	TArray<FGVRMActiveMorph> MorphScratch;
+};
@@ -0,0 +1,183 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSplatBounds.h"
+#include "GVRMSkinningData.h"
+#include "GVRMSkinningMath.h"
+#include "NiagaraDataInterfaceGVRM.h"
+#include "GVRMMemoryReport.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Algo/BinarySearch.h"
+
+/** Gaussian standard deviations a splat is drawn out to */
+static constexpr float GVRMSplatBoundsSigmas = 3.0f;
+
+FGVRMSplatBounds::FGVRMSplatBounds() = default;
+FGVRMSplatBounds::~FGVRMSplatBounds() = default;
+
+bool FGVRMSplatBounds::Build(const USkeletalMesh& Mesh, const UGVRMBindingData& BindingData, FString& OutErrorMessage, const FNiagaraDataInterfaceGVRMInstanceData* MeshStreams)
+{
+	// Splats are only ever appended; anything else starts over
+	const int32 NumSplats = BindingData.GetSplatCount();
+	if (BuiltMesh.Get() != &Mesh || BuiltBindingData.Get() != &BindingData || NumSplats < BuiltSplatCount)
+	{
+		Reset();
+		BuiltMesh = &Mesh;
+		BuiltBindingData = &BindingData;
+	}
+
+	// A failed build counts as done too (empty), so it is not retried every frame
+	if (bBuildFailed)
+	{
+		return false;
+	}
+	const int32 FirstSplat = BuiltSplatCount;
+	BuiltSplatCount = NumSplats;
+
+	auto Fail = [this, &OutErrorMessage](FString&& ErrorMessage)
+	{
+		Bones.Empty();
+		BoneBounds.Empty();
+		VertexReach.Empty();
+		LOD0Streams.Reset();
+		bBuildFailed = true;
+		OutErrorMessage = MoveTemp(ErrorMessage);
+		return false;
+	};
+
+	const FSkeletalMeshRenderData* RenderData = Mesh.GetResourceForRendering();
+	if (!RenderData || RenderData->LODRenderData.Num() == 0)
+	{
+		return Fail(TEXT("Skeletal mesh has no render data"));
+	}
+
+	// Same streams the runtime reads: the caller's copy when it holds LOD0 (bone indices may be palette slots there)
+	const FNiagaraDataInterfaceGVRMInstanceData* Streams = MeshStreams;
+	if (Streams && !Streams->HasPendingLODStreams() && Streams->CachedLODIndex == 0 && Streams->CachedSkeletalMeshAsset.Get() == &Mesh
+		&& Streams->NumVertices > 0 && Streams->CachedVertexPositions.Num() == Streams->NumVertices)
+	{
+		LOD0Streams.Reset();
+	}
+	else
+	{
+		if (!LOD0Streams)
+		{
+			LOD0Streams = MakeUnique<FNiagaraDataInterfaceGVRMInstanceData>();
+			LOD0Streams->CacheLODStreams(RenderData->LODRenderData[0], GVRMSkinning::MaxBoneInfluences, &BindingData, nullptr);
+		}
+		Streams = LOD0Streams.Get();
+	}
+	const TArray<int32>& PaletteBones = Streams->CachedPaletteBones;
+
+	// Influence 0 is kept even without weight, like the palette: rigid bindings fall back to it
+	const bool bHasGaussians = BindingData.Gaussians.Num() == NumSplats;
+	VertexReach.Reserve(BindingData.BoundVertexIndices.Num());
+	for (int32 SplatIndex = FirstSplat; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		const FSplatBindingInfo& Binding = BindingData.Bindings[SplatIndex];
+		const int32 VertexIndex = Binding.VertexIndex;
+		if (VertexIndex < 0 || VertexIndex >= Streams->NumVertices)
+		{
+			return Fail(FString::Printf(TEXT("Splat %d is bound to vertex %d, LOD0 has %d vertices"), SplatIndex, VertexIndex, Streams->NumVertices));
+		}
+
+		float Reach = static_cast<float>(Binding.RelativePosition.Size());
+		if (bHasGaussians)
+		{
+			Reach += GVRMSplatBoundsSigmas * BindingData.Gaussians[SplatIndex].Scale.GetMax();
+		}
+
+		// Only a farther splat grows the vertex's box; the smaller box is already inside its bones' boxes
+		if (float* KnownReach = VertexReach.Find(VertexIndex))
+		{
+			if (Reach <= *KnownReach)
+			{
+				continue;
+			}
+			*KnownReach = Reach;
+		}
+		else
+		{
+			VertexReach.Add(VertexIndex, Reach);
+		}
+
+		const FBox3f VertexBox = FBox3f::BuildAABB(Streams->CachedVertexPositions[VertexIndex], FVector3f(Reach));
+		for (int32 Influence = 0; Influence < Streams->NumInfluences; ++Influence)
+		{
+			const bool bExtra = Influence >= 4;
+			const float Weight = bExtra ? Streams->CachedExtraBoneWeights[VertexIndex][Influence - 4] : Streams->CachedBoneWeights[VertexIndex][Influence];
+			if (Influence == 0 || Weight > 0.0f)
+			{
+				const int32 Slot = bExtra ? Streams->CachedExtraBoneIndices[VertexIndex][Influence - 4] : Streams->CachedBoneIndices[VertexIndex][Influence];
+				const int32 Bone = PaletteBones.Num() > 0 ? PaletteBones[Slot] : Slot;
+				BoneBounds[FindOrAddBone(Bone)] += VertexBox;
+			}
+		}
+	}
+
+	// Nothing more to fold in
+	if (BindingData.AreSplatStreamsComplete())
+	{
+		VertexReach.Empty();
+		LOD0Streams.Reset();
+	}
+	return true;
+}
+
+int32 FGVRMSplatBounds::FindOrAddBone(int32 Bone)
+{
+	const int32 Index = Algo::LowerBound(Bones, Bone);
+	if (Index == Bones.Num() || Bones[Index] != Bone)
+	{
+		Bones.Insert(Bone, Index);
+		BoneBounds.Insert(FBox3f(ForceInit), Index);
+	}
+	return Index;
+}
+
+bool FGVRMSplatBounds::IsBuiltFor(const USkeletalMesh* Mesh, const UGVRMBindingData* BindingData) const
+{
+	return Mesh && BindingData && BuiltMesh.Get() == Mesh && BuiltBindingData.Get() == BindingData
+		&& (bBuildFailed || BuiltSplatCount == BindingData->GetSplatCount());
+}
+
+void FGVRMSplatBounds::Reset()
+{
+	Bones.Reset();
+	BoneBounds.Reset();
+	VertexReach.Reset();
+	LOD0Streams.Reset();
+	BuiltMesh.Reset();
+	BuiltBindingData.Reset();
+	BuiltSplatCount = 0;
+	bBuildFailed = false;
+}
+
+FBox FGVRMSplatBounds::Calculate(TConstArrayView<FTransform> ComponentSpaceTransforms) const
+{
+	FBox Bounds(ForceInit);
+	if (Bones.Num() == 0 || Bones.Last() >= ComponentSpaceTransforms.Num())
+	{
+		return Bounds;
+	}
+
+	for (int32 Index = 0; Index < Bones.Num(); ++Index)
+	{
+		Bounds += FBox(BoneBounds[Index]).TransformBy(ComponentSpaceTransforms[Bones[Index]]);
+	}
+	return Bounds;
+}
+
+SIZE_T FGVRMSplatBounds::GetAllocatedSize() const
+{
+	SIZE_T Size = Bones.GetAllocatedSize() + BoneBounds.GetAllocatedSize() + VertexReach.GetAllocatedSize();
+	if (LOD0Streams)
+	{
+		FGVRMMemoryBreakdown Breakdown;
+		LOD0Streams->GetMemoryBreakdown(Breakdown);
+		Size += Breakdown.GetCPUBytes();
+	}
+	return Size;
+}
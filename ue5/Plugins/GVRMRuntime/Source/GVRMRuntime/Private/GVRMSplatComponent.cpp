@@ -0,0 +1,507 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSplatComponent.h"
+#include "GVRMSplatSceneProxy.h"
+#include "GVRMAnimationCache.h"
+#include "GVRMStats.h"
+#include "GVRMMemoryReport.h"
+#include "GVRMSkinningMath.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Tasks/Task.h"
+
+static TAutoConsoleVariable<bool> CVarGVRMAvatarUpdateTasks(
+	TEXT("GVRM.AvatarUpdateTasks"),
+	true,
+	TEXT("Run the splat component mesh cache, palette and upload staging work on UE::Tasks workers instead of inline in the component tick."));
+
+/** Growth of the streamed splats since the proxy was built that rebuilds it (see HandleSplatStreamsUpdated) */
+static constexpr int32 GVRMSplatStreamProxyGrowth = 2;
+
+/** Splats per BuildSplatNormals chunk (one worker each) */
+static constexpr int32 GVRMSplatNormalsPerChunk = 16384;
+
+/**
+ * Bind-pose host vertex normal of every splat on the cached mesh LOD (remapped
+ * vertices blend their triangle corners); empty without cached normals.
+ * The only per-splat CPU work of the update, so it is chunked across workers.
+ */
+static void BuildSplatNormals(const UGVRMBindingData* BindingData, const FNiagaraDataInterfaceGVRMInstanceData& MeshCache, TArray<FVector4f>& OutNormals)
+{
+	const TArray<FVector3f>& Normals = MeshCache.CachedVertexNormals;
+	if (Normals.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 NumSplats = BindingData->GetSplatCount();
+	OutNormals.SetNumUninitialized(NumSplats);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumSplats, GVRMSplatNormalsPerChunk);
+	ParallelFor(NumChunks, [BindingData, &MeshCache, &Normals, &OutNormals, NumSplats](int32 ChunkIndex)
+	{
+		const int32 First = ChunkIndex * GVRMSplatNormalsPerChunk;
+		const int32 Last = FMath::Min(First + GVRMSplatNormalsPerChunk, NumSplats);
+		for (int32 SplatIndex = First; SplatIndex < Last; ++SplatIndex)
+		{
+			const int32 VertexIndex = BindingData->Bindings[SplatIndex].VertexIndex;
+			FVector3f Normal = FVector3f::ZeroVector;
+			if (VertexIndex < MeshCache.NumRemapVertices)
+			{
+				const FIntVector4& Corners = MeshCache.CachedLODRemapIndices[VertexIndex];
+				const FVector4f& Weights = MeshCache.CachedLODRemapWeights[VertexIndex];
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Normal += Normals.IsValidIndex(Corners[Corner]) ? Normals[Corners[Corner]] * Weights[Corner] : FVector3f::ZeroVector;
+				}
+			}
+			else if (Normals.IsValidIndex(VertexIndex))
+			{
+				Normal = Normals[VertexIndex];
+			}
+			OutNormals[SplatIndex] = FVector4f(Normal.GetSafeNormal(), 0.0f);
+		}
+	}, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+UGVRMSplatComponent::UGVRMSplatComponent()
+	: MeshCache(MakeUnique<FNiagaraDataInterfaceGVRMInstanceData>())
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	bTickInEditor = true;
+
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetGenerateOverlapEvents(false);
+	CastShadow = false;
+}
+
+void UGVRMSplatComponent::SetBindingData(UGVRMBindingData* NewBindingData)
+{
+	BindingData = NewBindingData;
+	if (IsRegistered())
+	{
+		WatchSplatStreams();
+	}
+	MarkRenderStateDirty();
+}
+
+void UGVRMSplatComponent::SetSkeletalMeshComponent(USkeletalMeshComponent* NewSkeletalMeshComponent)
+{
+	SkeletalMeshComponent = NewSkeletalMeshComponent;
+	UpdateTickPrerequisite();
+	MarkRenderStateDirty();
+}
+
+void UGVRMSplatComponent::SetSkinningMode(EGVRMSkinningMode NewSkinningMode)
+{
+	// Rigid streams are always uploaded when the binding data has them, so no new proxy is needed
+	SkinningMode = NewSkinningMode;
+}
+
+void UGVRMSplatComponent::SetDebugDraw(bool bBones, bool bVertices)
+{
+	if (bDrawDebugBones == bBones && bDrawDebugVertices == bVertices)
+	{
+		return;
+	}
+
+	bDrawDebugBones = bBones;
+	bDrawDebugVertices = bVertices;
+	if (!SceneProxy)
+	{
+		return;
+	}
+
+	FGVRMSplatSceneProxy* SplatProxy = static_cast<FGVRMSplatSceneProxy*>(SceneProxy);
+	ENQUEUE_RENDER_COMMAND(SetGVRMSplatDebugDraw)(
+		[SplatProxy, bBones, bVertices](FRHICommandListImmediate& RHICmdList)
+		{
+			SplatProxy->SetDebugDraw_RenderThread(bBones, bVertices);
+		}
+	);
+}
+
+EGVRMSkinningMode UGVRMSplatComponent::GetEffectiveSkinningMode() const
+{
+	// Distant avatars switch to RigidBoneBlended; closer ones never ask for rigid bindings
+	EGVRMSkinningMode RequestedMode = SkinningMode;
+	const USkeletalMeshComponent* SkelComp = GetSourceSkeletalMesh();
+	if (SkinningMode == EGVRMSkinningMode::LinearBlend && RigidSkinningMinLOD >= 0
+		&& SkelComp && SkelComp->GetPredictedLODLevel() >= RigidSkinningMinLOD)
+	{
+		RequestedMode = EGVRMSkinningMode::RigidBoneBlended;
+	}
+
+	if (RequestedMode == EGVRMSkinningMode::LinearBlend || !BindingData || !BindingData->SupportsSkinningMode(RequestedMode, this))
+	{
+		return EGVRMSkinningMode::LinearBlend;
+	}
+	return RequestedMode;
+}
+
+void UGVRMSplatComponent::SetAnimationCache(UGVRMAnimationCache* NewAnimationCache)
+{
+	AnimationCache = NewAnimationCache;
+	CacheResource = nullptr;
+	PlaybackTime = 0.0f;
+	MarkRenderStateDirty();
+}
+
+bool UGVRMSplatComponent::IsPlayingAnimationCache() const
+{
+	return AnimationCache && BindingData && AnimationCache->NumSplats == BindingData->GetSplatCount();
+}
+
+USkeletalMeshComponent* UGVRMSplatComponent::GetSourceSkeletalMesh() const
+{
+	if (SkeletalMeshComponent)
+	{
+		return SkeletalMeshComponent;
+	}
+	return Cast<USkeletalMeshComponent>(GetAttachParent());
+}
+
+void UGVRMSplatComponent::OnRegister()
+{
+	Super::OnRegister();
+	UpdateTickPrerequisite();
+	WatchSplatStreams();
+}
+
+void UGVRMSplatComponent::OnUnregister()
+{
+	UnwatchSplatStreams();
+	Super::OnUnregister();
+}
+
+void UGVRMSplatComponent::WatchSplatStreams()
+{
+	if (WatchedBindingData.Get() == BindingData && SplatStreamsHandle.IsValid())
+	{
+		return;
+	}
+
+	UnwatchSplatStreams();
+	if (BindingData && !BindingData->AreSplatStreamsComplete())
+	{
+		WatchedBindingData = BindingData;
+		SplatStreamsHandle = BindingData->OnSplatStreamsUpdated.AddUObject(this, &UGVRMSplatComponent::HandleSplatStreamsUpdated);
+		BindingData->RequestSplatStreams();
+	}
+}
+
+void UGVRMSplatComponent::UnwatchSplatStreams()
+{
+	if (UGVRMBindingData* Watched = WatchedBindingData.Get())
+	{
+		Watched->OnSplatStreamsUpdated.Remove(SplatStreamsHandle);
+	}
+	WatchedBindingData.Reset();
+	SplatStreamsHandle.Reset();
+}
+
+void UGVRMSplatComponent::HandleSplatStreamsUpdated()
+{
+	// Draw the splats streamed in so far. A new proxy copies and uploads every splat, so it is
+	// only rebuilt when the splats grew by GVRMSplatStreamProxyGrowth, and once they are complete:
+	// the copies then add up to a few times the splat count instead of growing with the square
+	const bool bComplete = !BindingData || BindingData->AreSplatStreamsComplete();
+	if (bComplete || BindingData->GetSplatCount() >= ProxySplatCount * GVRMSplatStreamProxyGrowth)
+	{
+		MarkRenderStateDirty();
+	}
+
+	if (bComplete)
+	{
+		UnwatchSplatStreams();
+	}
+}
+
+void UGVRMSplatComponent::UpdateTickPrerequisite()
+{
+	if (USkeletalMeshComponent* SkelComp = GetSourceSkeletalMesh())
+	{
+		AddTickPrerequisiteComponent(SkelComp);
+	}
+}
+
+FPrimitiveSceneProxy* UGVRMSplatComponent::CreateSceneProxy()
+{
+	if (!BindingData || BindingData->GetSplatCount() == 0)
+	{
+		return nullptr;
+	}
+
+	if (BindingData->Gaussians.Num() != BindingData->GetSplatCount())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGVRMSplatComponent::CreateSceneProxy - Binding data has %d Gaussians for %d splats (import the PLY first)"),
+			BindingData->Gaussians.Num(), BindingData->GetSplatCount());
+		return nullptr;
+	}
+
+	if (AnimationCache && !IsPlayingAnimationCache())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UGVRMSplatComponent::CreateSceneProxy - Animation cache %s has %d splats, binding data has %d; following the skeletal mesh instead"),
+			*AnimationCache->GetName(), AnimationCache->NumSplats, BindingData->GetSplatCount());
+	}
+
+	ProxySplatCount = BindingData->GetSplatCount();
+	return new FGVRMSplatSceneProxy(this);
+}
+
+FBoxSphereBounds UGVRMSplatComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+	// Cached splats: the baked bounds over all frames, placed by the skeletal mesh
+	if (IsPlayingAnimationCache() && AnimationCache->Bounds.IsValid)
+	{
+		const USkeletalMeshComponent* SkelComp = GetSourceSkeletalMesh();
+		const FTransform& MeshTransform = SkelComp ? SkelComp->GetComponentTransform() : LocalToWorld;
+		return FBoxSphereBounds(AnimationCache->Bounds.ExpandBy(BoundsPadding).TransformBy(MeshTransform));
+	}
+
+	// Splat boxes carried by this frame's pose, placed by the skeletal mesh
+	const USkeletalMeshComponent* SkelComp = GetSourceSkeletalMesh();
+	if (SkelComp && PosedSplatBounds.IsValid)
+	{
+		return FBoxSphereBounds(PosedSplatBounds.ExpandBy(BoundsPadding).TransformBy(SkelComp->GetComponentTransform()));
+	}
+
+	// Splats stay close to the skin, so the skeletal mesh bounds plus a margin cover them
+	if (SkelComp)
+	{
+		const FBoxSphereBounds MeshBounds = SkelComp->Bounds;
+		return FBoxSphereBounds(MeshBounds.Origin, MeshBounds.BoxExtent + FVector(BoundsPadding), MeshBounds.SphereRadius + BoundsPadding);
+	}
+
+	return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector(BoundsPadding), BoundsPadding);
+}
+
+void UGVRMSplatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatComponentUpdate);
+
+	if (IsPlayingAnimationCache())
+	{
+		if (!SceneProxy)
+		{
+			return;
+		}
+
+		// Cheap once uploaded; re-requests after a re-bake released the previous copy
+		CacheResource = AnimationCache->RequestResource();
+
+		PlaybackTime += DeltaTime * PlayRate;
+		UpdateBounds();
+		MarkRenderTransformDirty();
+		MarkRenderDynamicDataDirty();
+		return;
+	}
+
+	USkeletalMeshComponent* SkelComp = GetSourceSkeletalMesh();
+	if (!SkelComp || !BindingData || !SceneProxy)
+	{
+		return;
+	}
+
+	LaunchUpdateTasks(SkelComp);
+	if (MeshCache->bCacheValid)
+	{
+		UpdateBounds();
+		MarkRenderTransformDirty();
+		MarkRenderDynamicDataDirty();
+	}
+}
+
+void UGVRMSplatComponent::LaunchUpdateTasks(USkeletalMeshComponent* SkelComp)
+{
+	WaitForUpdateTasks();
+
+	// Pose snapshot and LOD pick: everything that reads the skeletal mesh component
+	if (!MeshCache->BeginUpdate(SkelComp, GVRMSkinning::MaxBoneInfluences, BindingData))
+	{
+		return;
+	}
+
+	// Before the tasks start: they only read the snapshot as well
+	UpdateSplatBounds(*SkelComp);
+
+	FGVRMSplatSceneProxy* SplatProxy = static_cast<FGVRMSplatSceneProxy*>(SceneProxy);
+	const FMatrix LocalToWorld = SkelComp->GetComponentTransform().ToMatrixWithScale();
+	const uint8 EffectiveSkinningMode = static_cast<uint8>(GetEffectiveSkinningMode());
+	const uint64 FrameCounter = GFrameCounter;
+
+	// Palette: bone matrices from the snapshot, packed straight into the proxy's ring
+	auto BuildPalette = [this, SplatProxy, LocalToWorld, EffectiveSkinningMode, FrameCounter]()
+	{
+		SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatComponentUpdate);
+		MeshCache->UpdatePose();
+
+		FGVRMBonePaletteRing& BonePalettes = SplatProxy->GetBonePalettes();
+		FGVRMBonePalette& Palette = BonePalettes.BeginWrite(MeshCache->CachedBoneMatrices.Num());
+		GVRMSkinning::PackBoneMatrices(MeshCache->CachedBoneMatrices, Palette.BoneMatrices);
+		Palette.ActiveMorphs = MeshCache->ActiveMorphs;
+		Palette.LocalToWorld = LocalToWorld;
+		Palette.SkinningMode = EffectiveSkinningMode;
+		Palette.FrameNumber = FrameCounter;
+		if (BonePalettes.Publish())
+		{
+			INC_DWORD_STAT(STAT_GVRM_DroppedBonePalettes);
+		}
+	};
+
+	// Mesh streams: re-read after a LOD or mesh change, then staged for the proxy
+	auto StageMeshStreams = [this, SplatProxy]()
+	{
+		SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatComponentUpdate);
+		MeshCache->UpdateLODStreams();
+		if (!MeshCache->bStaticDataDirty)
+		{
+			return;
+		}
+		MeshCache->bStaticDataDirty = false;
+
+		LLM_SCOPE_BYTAG(GVRM_MeshCache);
+		TUniquePtr<FGVRMSplatDynamicData> DynamicData = MakeUnique<FGVRMSplatDynamicData>();
+		DynamicData->VertexPositions = MeshCache->CachedVertexPositions;
+		DynamicData->BoneIndices = MeshCache->CachedBoneIndices;
+		DynamicData->BoneWeights = MeshCache->CachedBoneWeights;
+		DynamicData->ExtraBoneIndices = MeshCache->CachedExtraBoneIndices;
+		DynamicData->ExtraBoneWeights = MeshCache->CachedExtraBoneWeights;
+		DynamicData->NumInfluences = MeshCache->NumInfluences;
+		DynamicData->LODRemapIndices = MeshCache->CachedLODRemapIndices;
+		DynamicData->LODRemapWeights = MeshCache->CachedLODRemapWeights;
+		DynamicData->LODRemapOffsets = MeshCache->CachedLODRemapOffsets;
+		DynamicData->NumRemapVertices = MeshCache->NumRemapVertices;
+		DynamicData->MorphVertexSlots = MeshCache->CachedMorphVertexSlots;
+		DynamicData->MorphDeltas = MeshCache->CachedMorphDeltas;
+		DynamicData->NumMorphSlots = MeshCache->NumMorphSlots;
+		BuildSplatNormals(BindingData, *MeshCache, DynamicData->SplatNormals);
+
+		ENQUEUE_RENDER_COMMAND(SendGVRMSplatDynamicData)(
+			[SplatProxy, DynamicData = MoveTemp(DynamicData)](FRHICommandListImmediate& RHICmdList) mutable
+			{
+				SplatProxy->SetDynamicData_RenderThread(RHICmdList, MoveTemp(DynamicData));
+			}
+		);
+	};
+
+	if (!CVarGVRMAvatarUpdateTasks.GetValueOnGameThread())
+	{
+		StageMeshStreams();
+		BuildPalette();
+		return;
+	}
+
+	// The two chains share no data; SendRenderDynamicData_Concurrent joins them
+	UE::Tasks::FTask PaletteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(BuildPalette));
+	if (MeshCache->bStaticDataDirty)
+	{
+		UE::Tasks::FTask StreamsTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(StageMeshStreams));
+		UpdateTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [] {}, UE::Tasks::Prerequisites(PaletteTask, StreamsTask), UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+	}
+	else
+	{
+		UpdateTask = PaletteTask;
+	}
+}
+
+void UGVRMSplatComponent::WaitForUpdateTasks() const
+{
+	if (UpdateTask.IsValid())
+	{
+		UpdateTask.Wait();
+	}
+}
+
+void UGVRMSplatComponent::UpdateSplatBounds(const USkeletalMeshComponent& SkelComp)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatBounds);
+
+	const USkeletalMesh* Mesh = SkelComp.SkeletalMesh;
+	if (!SplatBounds.IsBuiltFor(Mesh, BindingData))
+	{
+		FString ErrorMessage;
+		if (Mesh && !SplatBounds.Build(*Mesh, *BindingData, ErrorMessage, MeshCache.Get()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UGVRMSplatComponent - %s: no splat bounds (%s), using the skeletal mesh bounds"),
+				*GetNameSafe(GetOwner()), *ErrorMessage);
+		}
+	}
+
+	PosedSplatBounds = SplatBounds.Calculate(MeshCache->GetPoseSnapshot());
+}
+
+void UGVRMSplatComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	// Binding data and animation caches are shared assets and report themselves
+	WaitForUpdateTasks();
+	FGVRMMemoryBreakdown Breakdown;
+	MeshCache->GetMemoryBreakdown(Breakdown);
+	Breakdown.AddCPU(TEXT("SplatBounds"), SplatBounds.GetAllocatedSize());
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Breakdown.GetCPUBytes());
+}
+
+void UGVRMSplatComponent::CreateRenderState_Concurrent(FRegisterComponentContext* Context)
+{
+	// A new proxy has no mesh streams yet; force them to be re-read and sent
+	WaitForUpdateTasks();
+	MeshCache->InvalidateCache();
+
+	Super::CreateRenderState_Concurrent(Context);
+}
+
+void UGVRMSplatComponent::DestroyRenderState_Concurrent()
+{
+	// The update tasks write into the proxy's palette ring and enqueue commands for it
+	WaitForUpdateTasks();
+
+	Super::DestroyRenderState_Concurrent();
+}
+
+void UGVRMSplatComponent::SendRenderDynamicData_Concurrent()
+{
+	Super::SendRenderDynamicData_Concurrent();
+
+	if (IsPlayingAnimationCache())
+	{
+		SendCachePlayback();
+		return;
+	}
+
+	// The palette and mesh streams were published by this frame's update tasks;
+	// the frame's render commands must not go out before them
+	WaitForUpdateTasks();
+}
+
+void UGVRMSplatComponent::SendCachePlayback()
+{
+	if (!SceneProxy || !CacheResource)
+	{
+		return;
+	}
+
+	const USkeletalMeshComponent* SkelComp = GetSourceSkeletalMesh();
+
+	FGVRMSplatCachePlayback Playback;
+	Playback.Resource = CacheResource;
+	Playback.NumSplats = AnimationCache->NumSplats;
+	Playback.ClusterSize = UGVRMAnimationCache::ClusterSize;
+	Playback.SplatDataOffset = AnimationCache->GetSplatDataOffset();
+	Playback.FrameStride = AnimationCache->GetFrameStride();
+	AnimationCache->GetFramesAtTime(PlaybackTime, Playback.Frame0, Playback.Frame1, Playback.Alpha);
+	Playback.LocalToWorld = (SkelComp ? SkelComp->GetComponentTransform() : GetComponentTransform()).ToMatrixWithScale();
+
+	FGVRMSplatSceneProxy* SplatProxy = static_cast<FGVRMSplatSceneProxy*>(SceneProxy);
+	ENQUEUE_RENDER_COMMAND(SendGVRMSplatCachePlayback)(
+		[SplatProxy, Playback](FRHICommandListImmediate& RHICmdList)
+		{
+			SplatProxy->SetCachePlayback_RenderThread(Playback);
+		}
+	);
+}
@@ -0,0 +1,279 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSplatRendering.h"
+#include "GVRMSplatSceneProxy.h"
+#include "GVRMSplatBatch.h"
+#include "GVRMStats.h"
+#include "GVRMMemoryReport.h"
+#include "RenderGraphBuilder.h"
+#include "HAL/IConsoleManager.h"
+#include "SceneRendering.h"
+#include "PostProcess/PostProcessing.h"
+#include "RHIGPUReadback.h"
+#include "RenderGraphUtils.h"
+
+DECLARE_GPU_STAT_NAMED(GVRMSplatSkinning, TEXT("GVRM Splat Skinning"));
+DECLARE_GPU_STAT_NAMED(GVRMSplatCacheDecode, TEXT("GVRM Splat Cache Decode"));
+DECLARE_GPU_STAT_NAMED(GVRMSplatDraw, TEXT("GVRM Splat Sort and Draw"));
+
+static TAutoConsoleVariable<int32> CVarGVRMDebugMaxInstances(
+	TEXT("GVRM.DebugMaxInstances"),
+	65536,
+	TEXT("Most debug view instances (joints, sampled bound vertices and vertex-to-splat lines) drawn per view and frame, over all splat components."),
+	ECVF_RenderThreadSafe);
+
+/** Readbacks in flight before new ones are skipped (the GPU is this many frames behind) */
+static constexpr int32 MaxCullCountersReadbacks = 8;
+
+/** Views that have not drawn splats for this many frames drop out of the culling stats */
+static constexpr uint32 CullCountersMaxAge = 60;
+
+FGVRMSplatViewExtension::FGVRMSplatViewExtension(const FAutoRegister& AutoRegister)
+	: FSceneViewExtensionBase(AutoRegister)
+{
+}
+
+FGVRMSplatViewExtension::~FGVRMSplatViewExtension() = default;
+
+TSharedRef<FGVRMSplatViewExtension, ESPMode::ThreadSafe> FGVRMSplatViewExtension::Get()
+{
+	check(IsInGameThread());
+
+	static TSharedPtr<FGVRMSplatViewExtension, ESPMode::ThreadSafe> Instance;
+	if (!Instance.IsValid())
+	{
+		Instance = FSceneViewExtensions::NewExtension<FGVRMSplatViewExtension>();
+	}
+	return Instance.ToSharedRef();
+}
+
+void FGVRMSplatViewExtension::RegisterProxy_RenderThread(FGVRMSplatSceneProxy* Proxy)
+{
+	check(IsInRenderingThread());
+	Proxies.AddUnique(Proxy);
+}
+
+void FGVRMSplatViewExtension::UnregisterProxy_RenderThread(FGVRMSplatSceneProxy* Proxy)
+{
+	check(IsInRenderingThread());
+	Proxies.RemoveSingleSwap(Proxy);
+
+	// Drop the scene's batch (and its combined buffers) with its last proxy
+	const FSceneInterface* Scene = &Proxy->GetScene();
+	if (!Proxies.ContainsByPredicate([Scene](const FGVRMSplatSceneProxy* Other) { return &Other->GetScene() == Scene; }))
+	{
+		Batches.Remove(Scene);
+	}
+}
+
+void FGVRMSplatViewExtension::GetBatchMemoryBreakdowns_RenderThread(TArray<TPair<int32, FGVRMMemoryBreakdown>>& OutBreakdowns) const
+{
+	check(IsInRenderingThread());
+
+	for (const TPair<const FSceneInterface*, TUniquePtr<FGVRMSplatBatch>>& Pair : Batches)
+	{
+		TPair<int32, FGVRMMemoryBreakdown>& Entry = OutBreakdowns.AddDefaulted_GetRef();
+		Entry.Key = Pair.Value->GetNumInstances();
+		Pair.Value->GetMemoryBreakdown(Entry.Value);
+	}
+}
+
+void FGVRMSplatViewExtension::PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatComponentRenderSetup);
+
+	if (Proxies.Num() == 0)
+	{
+		return;
+	}
+
+	BatchProxies.Reset();
+	CacheProxies.Reset();
+	for (FGVRMSplatSceneProxy* Proxy : Proxies)
+	{
+		if (&Proxy->GetScene() != InViewFamily.Scene)
+		{
+			continue;
+		}
+
+		// Cached avatars skip skinning; they are decoded on their own below
+		if (Proxy->IsPlayingCache())
+		{
+			CacheProxies.Add(Proxy);
+			continue;
+		}
+
+		Proxy->UpdateBonePalette_RenderThread(InViewFamily.FrameNumber);
+		if (Proxy->IsReadyToSkin())
+		{
+			BatchProxies.Add(Proxy);
+		}
+	}
+
+	if (CacheProxies.Num() > 0)
+	{
+		RDG_EVENT_SCOPE(GraphBuilder, "GVRMSplatCacheDecode");
+		RDG_GPU_STAT_SCOPE(GraphBuilder, GVRMSplatCacheDecode);
+
+		for (FGVRMSplatSceneProxy* Proxy : CacheProxies)
+		{
+			Proxy->AddCacheDecodePass(GraphBuilder, InViewFamily.GetFeatureLevel());
+		}
+	}
+
+	if (BatchProxies.Num() == 0)
+	{
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "GVRMSplatSkinning");
+	RDG_GPU_STAT_SCOPE(GraphBuilder, GVRMSplatSkinning);
+
+	TUniquePtr<FGVRMSplatBatch>& Batch = Batches.FindOrAdd(InViewFamily.Scene);
+	if (!Batch.IsValid())
+	{
+		Batch = MakeUnique<FGVRMSplatBatch>();
+	}
+	Batch->AddSkinningPasses(GraphBuilder, InViewFamily, BatchProxies);
+}
+
+void FGVRMSplatViewExtension::PrePostProcessPass_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessingInputs& Inputs)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SplatComponentRenderSetup);
+
+	if (Proxies.Num() == 0 || !View.bIsViewInfo)
+	{
+		return;
+	}
+
+	Inputs.Validate();
+
+	const FViewInfo& ViewInfo = static_cast<const FViewInfo&>(View);
+	FRDGTextureRef SceneColor = Inputs.SceneTextures->GetParameters()->SceneColorTexture;
+	FRDGTextureRef SceneDepth = Inputs.SceneTextures->GetParameters()->SceneDepthTexture;
+
+	RDG_EVENT_SCOPE(GraphBuilder, "GVRMSplats");
+	RDG_GPU_STAT_SCOPE(GraphBuilder, GVRMSplatDraw);
+
+	ResolveCullCountersReadbacks();
+
+	// Culling results of every component drawn in this view
+	FRDGBufferRef ViewCounters = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), FGVRMSplatCullSplatsCS::NumViewCounters), TEXT("GVRM.ViewCullCounters"));
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(ViewCounters), 0u);
+	bool bDrewSplats = false;
+
+	uint32 DebugInstanceBudget = static_cast<uint32>(FMath::Max(CVarGVRMDebugMaxInstances.GetValueOnRenderThread(), 0));
+	for (FGVRMSplatSceneProxy* Proxy : Proxies)
+	{
+		if (&Proxy->GetScene() != View.Family->Scene || !Proxy->IsShown(&View) || !Proxy->HasSkinnedSplats())
+		{
+			continue;
+		}
+
+		const FBoxSphereBounds& Bounds = Proxy->GetBounds();
+		if (!View.ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent))
+		{
+			continue;
+		}
+
+		Proxy->AddDrawPasses(GraphBuilder, ViewInfo, SceneColor, SceneDepth, ViewCounters);
+		bDrewSplats = true;
+
+		// Over the splats, from the same skinned buffers
+		if (Proxy->HasDebugDraw() && DebugInstanceBudget > 0)
+		{
+			Proxy->AddDebugDrawPasses(GraphBuilder, ViewInfo, SceneColor, SceneDepth, DebugInstanceBudget);
+		}
+	}
+
+	if (bDrewSplats)
+	{
+		EnqueueCullCountersReadback(GraphBuilder, View.GetViewKey(), ViewCounters);
+	}
+}
+
+void FGVRMSplatViewExtension::EnqueueCullCountersReadback(FRDGBuilder& GraphBuilder, uint32 ViewKey, FRDGBufferRef Counters)
+{
+	if (CullCountersReadbacks.Num() >= MaxCullCountersReadbacks)
+	{
+		return;
+	}
+
+	FCullCountersReadback& Entry = CullCountersReadbacks.AddDefaulted_GetRef();
+	Entry.Readback = FreeCullCountersReadbacks.Num() > 0 ? FreeCullCountersReadbacks.Pop(false) : MakeUnique<FRHIGPUBufferReadback>(TEXT("GVRM.ViewCullCountersReadback"));
+	Entry.ViewKey = ViewKey;
+	AddEnqueueCopyPass(GraphBuilder, Entry.Readback.Get(), Counters, FGVRMSplatCullSplatsCS::NumViewCounters * sizeof(uint32));
+}
+
+void FGVRMSplatViewExtension::ResolveCullCountersReadbacks()
+{
+	const uint32 FrameNumber = GFrameCounterRenderThread;
+
+	// Readbacks complete in order
+	int32 NumResolved = 0;
+	for (; NumResolved < CullCountersReadbacks.Num() && CullCountersReadbacks[NumResolved].Readback->IsReady(); ++NumResolved)
+	{
+		const FCullCountersReadback& Entry = CullCountersReadbacks[NumResolved];
+		const uint32* Values = static_cast<const uint32*>(Entry.Readback->Lock(FGVRMSplatCullSplatsCS::NumViewCounters * sizeof(uint32)));
+
+		FGVRMSplatCullCounters& Counters = ViewCullCounters.FindOrAdd(Entry.ViewKey);
+		Counters.Visible = Values[FGVRMSplatCullSplatsCS::CounterVisible];
+		Counters.Backface = Values[FGVRMSplatCullSplatsCS::CounterBackface];
+		Counters.Subpixel = Values[FGVRMSplatCullSplatsCS::CounterSubpixel];
+		Counters.Frustum = Values[FGVRMSplatCullSplatsCS::CounterFrustum];
+		Counters.FrameNumber = FrameNumber;
+		Entry.Readback->Unlock();
+	}
+	for (int32 Index = 0; Index < NumResolved; ++Index)
+	{
+		FreeCullCountersReadbacks.Add(MoveTemp(CullCountersReadbacks[Index].Readback));
+	}
+	CullCountersReadbacks.RemoveAt(0, NumResolved);
+
+	FGVRMSplatCullCounters Total;
+	for (auto It = ViewCullCounters.CreateIterator(); It; ++It)
+	{
+		if (FrameNumber - It->Value.FrameNumber > CullCountersMaxAge)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		Total.Visible += It->Value.Visible;
+		Total.Backface += It->Value.Backface;
+		Total.Subpixel += It->Value.Subpixel;
+		Total.Frustum += It->Value.Frustum;
+	}
+
+	SET_DWORD_STAT(STAT_GVRM_DrawnSplats, Total.Visible);
+	SET_DWORD_STAT(STAT_GVRM_BackfaceCulledSplats, Total.Backface);
+	SET_DWORD_STAT(STAT_GVRM_SubpixelCulledSplats, Total.Subpixel);
+	SET_DWORD_STAT(STAT_GVRM_FrustumCulledSplats, Total.Frustum);
+}
+
+static void DumpGVRMCullStats(FOutputDevice& Ar)
+{
+	TSharedRef<FGVRMSplatViewExtension, ESPMode::ThreadSafe> ViewExtension = FGVRMSplatViewExtension::Get();
+	TMap<uint32, FGVRMSplatCullCounters> Counters;
+	ENQUEUE_RENDER_COMMAND(GVRMCullStats)(
+		[&Counters, &ViewExtension](FRHICommandListImmediate& RHICmdList)
+		{
+			Counters = ViewExtension->GetViewCullCounters_RenderThread();
+		}
+	);
+	FlushRenderingCommands();
+
+	Ar.Logf(TEXT("GVRM splat culling (%d views, last read back results)"), Counters.Num());
+	for (const TPair<uint32, FGVRMSplatCullCounters>& Pair : Counters)
+	{
+		const FGVRMSplatCullCounters& View = Pair.Value;
+		const uint32 Total = View.Visible + View.Backface + View.Subpixel + View.Frustum;
+		Ar.Logf(TEXT("  View %u: %u of %u splats drawn (backface %u, sub-pixel %u, frustum %u)"),
+			Pair.Key, View.Visible, Total, View.Backface, View.Subpixel, View.Frustum);
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GGVRMCullStatsCommand(
+	TEXT("GVRM.CullStats"),
+	TEXT("Print the per-view splat culling counters (drawn, backface, sub-pixel and frustum culled) of the splat component renderer."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&DumpGVRMCullStats));
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SceneViewExtension.h"
+#include "GVRMMemoryReport.h"
+
+class FGVRMSplatSceneProxy;
+class FGVRMSplatBatch;
+class FSceneInterface;
+class FRHIGPUBufferReadback;
+
+/** Per-view splat culling results (GPU counters, read back a few frames late) */
+struct FGVRMSplatCullCounters
+{
+	uint32 Visible = 0;
+	uint32 Backface = 0;
+	uint32 Subpixel = 0;
+	uint32 Frustum = 0;
+
+	/** Frame the counters were read back in */
+	uint32 FrameNumber = 0;
+};
+
+/**
+ * Scene view extension that drives all UGVRMSplatComponent proxies.
+ * Skins every avatar of the scene in one batch per view family, then sorts
+ * and draws per view after the opaque and translucency passes (before post
+ * processing).
+ */
+class FGVRMSplatViewExtension : public FSceneViewExtensionBase
+{
+public:
+	FGVRMSplatViewExtension(const FAutoRegister& AutoRegister);
+	virtual ~FGVRMSplatViewExtension();
+
+	/** Get (and on first use create) the extension; game thread only */
+	static TSharedRef<FGVRMSplatViewExtension, ESPMode::ThreadSafe> Get();
+
+	/** Track a proxy; render thread only */
+	void RegisterProxy_RenderThread(FGVRMSplatSceneProxy* Proxy);
+	void UnregisterProxy_RenderThread(FGVRMSplatSceneProxy* Proxy);
+
+	/** Memory of the skinning batches (one block per scene); render thread only */
+	void GetBatchMemoryBreakdowns_RenderThread(TArray<TPair<int32, FGVRMMemoryBreakdown>>& OutBreakdowns) const;
+
+	/** Latest splat culling counters per view (by view key); render thread only */
+	const TMap<uint32, FGVRMSplatCullCounters>& GetViewCullCounters_RenderThread() const { return ViewCullCounters; }
+
+	// ISceneViewExtension Interface
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily) override;
+	virtual void PrePostProcessPass_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessingInputs& Inputs) override;
+
+private:
+	/** Registered proxies (render thread only) */
+	TArray<FGVRMSplatSceneProxy*> Proxies;
+
+	/** One skinning batch per scene with registered proxies (render thread only) */
+	TMap<const FSceneInterface*, TUniquePtr<FGVRMSplatBatch>> Batches;
+
+	/** Ready proxies of the view family being set up (reused every frame) */
+	TArray<FGVRMSplatSceneProxy*> BatchProxies;
+
+	/** Proxies of the view family playing an animation cache (reused every frame) */
+	TArray<FGVRMSplatSceneProxy*> CacheProxies;
+
+	/** Copy a view's cull counters for reading on a later frame (never waits for the GPU) */
+	void EnqueueCullCountersReadback(FRDGBuilder& GraphBuilder, uint32 ViewKey, FRDGBufferRef Counters);
+
+	/** Take the finished readbacks and update the culling stats */
+	void ResolveCullCountersReadbacks();
+
+	struct FCullCountersReadback
+	{
+		TUniquePtr<FRHIGPUBufferReadback> Readback;
+		uint32 ViewKey = 0;
+	};
+
+	/** In flight, oldest first (render thread only) */
+	TArray<FCullCountersReadback> CullCountersReadbacks;
+
+	/** Resolved readbacks kept for reuse (render thread only) */
+	TArray<TUniquePtr<FRHIGPUBufferReadback>> FreeCullCountersReadbacks;
+
+	/** Latest results per view key (render thread only) */
+	TMap<uint32, FGVRMSplatCullCounters> ViewCullCounters;
+};
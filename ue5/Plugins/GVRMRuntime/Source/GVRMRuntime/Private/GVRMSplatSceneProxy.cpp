@@ -0,0 +1,665 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSplatSceneProxy.h"
+#include "GVRMSplatComponent.h"
+#include "GVRMAnimationCache.h"
+#include "GVRMSplatRendering.h"
+#include "GVRMSplatShaders.h"
+#include "GVRMRenderUtils.h"
+#include "GVRMStats.h"
+#include "GVRMMemoryReport.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "CommonRenderResources.h"
+#include "PipelineStateCache.h"
+#include "SceneRendering.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_GPU_STAT_NAMED(GVRMSplatSort, TEXT("GVRM Splat Cull and Sort"));
+
+static TAutoConsoleVariable<bool> CVarGVRMSplatCulling(
+	TEXT("GVRM.SplatCulling"),
+	true,
+	TEXT("Cull skinned splats per view before sorting (backface, sub-pixel and frustum tests); off still compacts but keeps every splat."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGVRMSplatCullingMinPixelRadius(
+	TEXT("GVRM.SplatCulling.MinPixelRadius"),
+	0.5f,
+	TEXT("Splats whose 3 sigma radius projects to fewer pixels are culled."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGVRMSplatCullingBackfaceThreshold(
+	TEXT("GVRM.SplatCulling.BackfaceThreshold"),
+	-0.3f,
+	TEXT("Splats are culled when the cosine between their host vertex normal and the direction to the camera is below this (-1 disables)."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGVRMSplatCullingFrustumMargin(
+	TEXT("GVRM.SplatCulling.FrustumMargin"),
+	1.0f,
+	TEXT("How far outside the view rect a splat center may be, in multiples of its projected 3 sigma radius."),
+	ECVF_RenderThreadSafe);
+
+FGVRMSplatSceneProxy::FGVRMSplatSceneProxy(const UGVRMSplatComponent* Component)
+	: FPrimitiveSceneProxy(Component)
+{
+	const UGVRMBindingData* BindingData = Component->BindingData;
+	check(BindingData && BindingData->Gaussians.Num() == BindingData->GetSplatCount());
+
+	LLM_SCOPE_BYTAG(GVRM_RenderData);
+
+	FGVRMSplatGPUData GPUData;
+	GPUData.InitializeFromBindingData(BindingData);
+
+	NumSplats = GPUData.NumSplats;
+	SplatVertexIndices = MoveTemp(GPUData.SplatVertexIndices);
+	SplatRelativePositions.SetNumUninitialized(NumSplats);
+	SplatScales.SetNumUninitialized(NumSplats);
+	SplatRotations.SetNumUninitialized(NumSplats);
+	SplatColors.SetNumUninitialized(NumSplats);
+
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		const FGVRMSplatGaussian& Gaussian = BindingData->Gaussians[SplatIndex];
+		SplatRelativePositions[SplatIndex] = FVector4f(GPUData.SplatRelativePositions[SplatIndex], 0.0f);
+		SplatScales[SplatIndex] = FVector4f(Gaussian.Scale, 0.0f);
+		SplatRotations[SplatIndex] = FVector4f(Gaussian.Rotation.X, Gaussian.Rotation.Y, Gaussian.Rotation.Z, Gaussian.Rotation.W);
+		SplatColors[SplatIndex] = FVector4f(Gaussian.Color, Gaussian.Opacity);
+	}
+
+	// Vertex pass inputs, only worth a second dispatch when splats share vertices
+	if (Component->bSkinSharedVerticesOnce && GPUData.UniqueVertexIndices.Num() < NumSplats)
+	{
+		UniqueVertexIndices = MoveTemp(GPUData.UniqueVertexIndices);
+		SplatUniqueVertices = MoveTemp(GPUData.SplatUniqueVertices);
+	}
+
+	// Rigid streams in bone order, so the skinning threads of one bone are adjacent
+	// (the order spans every splat, so a proxy of streamed splats waits for the last chunk)
+	if (BindingData->AreRigidBindingsReady())
+	{
+		RigidSplatOrder.SetNumUninitialized(NumSplats);
+		RigidHostPositions.SetNumUninitialized(NumSplats);
+		RigidBones.SetNumUninitialized(NumSplats);
+		for (int32 RigidIndex = 0; RigidIndex < NumSplats; ++RigidIndex)
+		{
+			const int32 SplatIndex = BindingData->RigidSplatOrder[RigidIndex];
+			const FGVRMRigidSplatBinding& Rigid = BindingData->RigidBindings[SplatIndex];
+			RigidSplatOrder[RigidIndex] = SplatIndex;
+			RigidHostPositions[RigidIndex] = FVector4f(Rigid.HostPosition, Rigid.SecondaryWeight);
+			RigidBones[RigidIndex] = FUintVector2(BindingData->GetPaletteSlot(Rigid.PrimaryBone), BindingData->GetPaletteSlot(Rigid.SecondaryBone));
+		}
+	}
+
+	bDebugDrawBones = Component->bDrawDebugBones;
+	bDebugDrawVertices = Component->bDrawDebugVertices;
+	DebugVertexStride = FMath::Max(Component->DebugVertexStride, 1);
+
+	// Splats are translucent and drawn by the view extension, not the mesh passes
+	bCastDynamicShadow = false;
+	bCastStaticShadow = false;
+
+	ViewExtension = FGVRMSplatViewExtension::Get();
+	FGVRMSplatSceneProxy* Proxy = this;
+	ENQUEUE_RENDER_COMMAND(InitGVRMSplatProxy)(
+		[Proxy](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->InitSplatBuffers_RenderThread(RHICmdList);
+			Proxy->ViewExtension->RegisterProxy_RenderThread(Proxy);
+		}
+	);
+}
+
+FGVRMSplatSceneProxy::~FGVRMSplatSceneProxy()
+{
+	// Proxies are destroyed on the render thread
+	ViewExtension->UnregisterProxy_RenderThread(this);
+
+	using namespace GVRMRender;
+	ReleaseBuffer(SplatScalesBuffer, SplatScalesSRV);
+	ReleaseBuffer(SplatRotationsBuffer, SplatRotationsSRV);
+	ReleaseBuffer(SplatColorsBuffer, SplatColorsSRV);
+	ReleaseBuffer(SplatNormalsBuffer, SplatNormalsSRV);
+	ReleaseBuffer(DebugElementsBuffer, DebugElementsSRV);
+	ReleaseBuffer(DebugRelativePositionsBuffer, DebugRelativePositionsSRV);
+}
+
+SIZE_T FGVRMSplatSceneProxy::GetTypeHash() const
+{
+	static size_t UniquePointer;
+	return reinterpret_cast<size_t>(&UniquePointer);
+}
+
+FPrimitiveViewRelevance FGVRMSplatSceneProxy::GetViewRelevance(const FSceneView* View) const
+{
+	// Drawn by FGVRMSplatViewExtension; relevance only keeps the primitive in visibility queries
+	FPrimitiveViewRelevance Result;
+	Result.bDrawRelevance = IsShown(View);
+	Result.bDynamicRelevance = false;
+	Result.bStaticRelevance = false;
+	Result.bShadowRelevance = false;
+	return Result;
+}
+
+uint32 FGVRMSplatSceneProxy::GetMemoryFootprint() const
+{
+	FGVRMMemoryBreakdown Breakdown;
+	GetMemoryBreakdown_RenderThread(Breakdown);
+	return sizeof(*this) + GetAllocatedSize() + Breakdown.GetCPUBytes();
+}
+
+void FGVRMSplatSceneProxy::GetMemoryBreakdown_RenderThread(FGVRMMemoryBreakdown& OutBreakdown) const
+{
+	using namespace GVRMRender;
+
+	OutBreakdown.AddArray(TEXT("SplatVertexIndices"), SplatVertexIndices);
+	OutBreakdown.AddArray(TEXT("SplatRelativePositions"), SplatRelativePositions);
+	OutBreakdown.AddArray(TEXT("UniqueVertexIndices"), UniqueVertexIndices);
+	OutBreakdown.AddArray(TEXT("SplatUniqueVertices"), SplatUniqueVertices);
+	OutBreakdown.AddArray(TEXT("RigidSplatOrder"), RigidSplatOrder);
+	OutBreakdown.AddArray(TEXT("RigidHostPositions"), RigidHostPositions);
+	OutBreakdown.AddArray(TEXT("RigidBones"), RigidBones);
+	OutBreakdown.AddCPU(TEXT("BonePaletteRing"), BonePalettes.GetAllocatedSize());
+	if (MeshStreams.IsValid())
+	{
+		OutBreakdown.AddArray(TEXT("MeshVertexPositions"), MeshStreams->VertexPositions);
+		OutBreakdown.AddArray(TEXT("MeshBoneIndices"), MeshStreams->BoneIndices);
+		OutBreakdown.AddArray(TEXT("MeshBoneWeights"), MeshStreams->BoneWeights);
+		OutBreakdown.AddArray(TEXT("MeshExtraBoneIndices"), MeshStreams->ExtraBoneIndices);
+		OutBreakdown.AddArray(TEXT("MeshExtraBoneWeights"), MeshStreams->ExtraBoneWeights);
+		OutBreakdown.AddArray(TEXT("MeshLODRemapIndices"), MeshStreams->LODRemapIndices);
+		OutBreakdown.AddArray(TEXT("MeshLODRemapWeights"), MeshStreams->LODRemapWeights);
+		OutBreakdown.AddArray(TEXT("MeshLODRemapOffsets"), MeshStreams->LODRemapOffsets);
+		OutBreakdown.AddArray(TEXT("MeshMorphVertexSlots"), MeshStreams->MorphVertexSlots);
+		OutBreakdown.AddArray(TEXT("MeshMorphDeltas"), MeshStreams->MorphDeltas);
+	}
+
+	OutBreakdown.AddGPU(TEXT("SplatScales"), GetBufferSize(SplatScalesBuffer));
+	OutBreakdown.AddGPU(TEXT("SplatRotations"), GetBufferSize(SplatRotationsBuffer));
+	OutBreakdown.AddGPU(TEXT("SplatColors"), GetBufferSize(SplatColorsBuffer));
+	OutBreakdown.AddGPU(TEXT("SplatNormals"), GetBufferSize(SplatNormalsBuffer));
+	OutBreakdown.AddGPU(TEXT("DebugElements"), GetBufferSize(DebugElementsBuffer) + GetBufferSize(DebugRelativePositionsBuffer));
+
+	// Cache playback decodes into buffers of its own; batched skinning output is counted with the batch
+	if (IsPlayingCache())
+	{
+		OutBreakdown.AddGPU(TEXT("CachedSplats (pooled)"), static_cast<uint64>(NumSplats) * 2 * sizeof(FVector4f));
+	}
+}
+
+void FGVRMSplatSceneProxy::InitSplatBuffers_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	using namespace GVRMRender;
+
+	UploadBuffer(TEXT("GVRMSplatScales"), SplatScales, sizeof(FVector4f), PF_A32B32G32R32F,
+		SplatScalesBuffer, SplatScalesSRV);
+	UploadBuffer(TEXT("GVRMSplatRotations"), SplatRotations, sizeof(FVector4f), PF_A32B32G32R32F,
+		SplatRotationsBuffer, SplatRotationsSRV);
+	UploadBuffer(TEXT("GVRMSplatColors"), SplatColors, sizeof(FVector4f), PF_A32B32G32R32F,
+		SplatColorsBuffer, SplatColorsSRV);
+
+	// Zero normals (no backface test) until the first mesh streams arrive
+	TArray<FVector4f> NoNormals;
+	NoNormals.SetNumZeroed(NumSplats);
+	UploadBuffer(TEXT("GVRMSplatNormals"), NoNormals, sizeof(FVector4f), PF_A32B32G32R32F,
+		SplatNormalsBuffer, SplatNormalsSRV);
+
+	// The debug view binds its buffers even when only joints are drawn
+	BuildDebugElements_RenderThread();
+
+	// The GPU copies are all that is needed from here on
+	SplatScales.Empty();
+	SplatRotations.Empty();
+	SplatColors.Empty();
+}
+
+void FGVRMSplatSceneProxy::SetDynamicData_RenderThread(FRHICommandListImmediate& RHICmdList, TUniquePtr<FGVRMSplatDynamicData> NewData)
+{
+	MeshStreams = MoveTemp(NewData);
+	++MeshStreamsRevision;
+
+	// Host normals for the backface test follow the mesh LOD; only the GPU copy is kept
+	if (MeshStreams->SplatNormals.Num() == NumSplats)
+	{
+		GVRMRender::UpdateBuffer(TEXT("GVRMSplatNormals"), MeshStreams->SplatNormals, sizeof(FVector4f), PF_A32B32G32R32F,
+			SplatNormalsBuffer, SplatNormalsSRV);
+	}
+	MeshStreams->SplatNormals.Empty();
+
+	// Resampled here once per mesh LOD, so the per-view debug draw only reads them
+	if (bDebugDrawVertices)
+	{
+		BuildDebugElements_RenderThread();
+	}
+}
+
+void FGVRMSplatSceneProxy::UpdateBonePalette_RenderThread(uint32 FrameNumber)
+{
+	if (LastPaletteFrame == FrameNumber)
+	{
+		return;
+	}
+	LastPaletteFrame = FrameNumber;
+
+	// Keep the previous palette when nothing new was published
+	const FGVRMBonePalette* Palette = BonePalettes.AcquireLatest();
+	if (!Palette)
+	{
+		INC_DWORD_STAT(STAT_GVRM_LateBonePalettes);
+		return;
+	}
+
+	CurrentPalette = Palette;
+	MeshLocalToWorld = Palette->LocalToWorld;
+}
+
+bool FGVRMSplatSceneProxy::IsReadyToSkin() const
+{
+	return NumSplats > 0 && !IsPlayingCache() && CurrentPalette && CurrentPalette->BoneMatrices.Num() > 0
+		&& MeshStreams.IsValid() && MeshStreams->VertexPositions.Num() > 0;
+}
+
+EGVRMSkinningMode FGVRMSplatSceneProxy::GetSkinningMode() const
+{
+	if (RigidSplatOrder.Num() != NumSplats || !CurrentPalette)
+	{
+		return EGVRMSkinningMode::LinearBlend;
+	}
+	return static_cast<EGVRMSkinningMode>(CurrentPalette->SkinningMode);
+}
+
+void FGVRMSplatSceneProxy::SetCachePlayback_RenderThread(const FGVRMSplatCachePlayback& InPlayback)
+{
+	CachePlayback = InPlayback;
+	MeshLocalToWorld = InPlayback.LocalToWorld;
+}
+
+void FGVRMSplatSceneProxy::AddCacheDecodePass(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type FeatureLevel)
+{
+	const FGVRMAnimationCacheResource* Resource = CachePlayback.Resource;
+	if (!Resource || !Resource->FrameDataSRV.IsValid() || !Resource->BindPositionsSRV.IsValid()
+		|| CachePlayback.NumSplats != static_cast<uint32>(NumSplats))
+	{
+		return;
+	}
+
+	FRDGBufferRef PositionsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRM.CachedPositions"));
+	FRDGBufferRef RotationsBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumSplats), TEXT("GVRM.CachedRotations"));
+
+	FGVRMSplatCacheDecodeCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatCacheDecodeCS::FParameters>();
+	PassParameters->NumSplats = NumSplats;
+	PassParameters->ClusterSize = CachePlayback.ClusterSize;
+	PassParameters->SplatDataOffset = CachePlayback.SplatDataOffset;
+	PassParameters->Frame0Offset = CachePlayback.Frame0 * CachePlayback.FrameStride;
+	PassParameters->Frame1Offset = CachePlayback.Frame1 * CachePlayback.FrameStride;
+	PassParameters->Alpha = CachePlayback.Alpha;
+	PassParameters->FrameData = Resource->FrameDataSRV;
+	PassParameters->BindPositions = Resource->BindPositionsSRV;
+	PassParameters->RWSkinnedPositions = GraphBuilder.CreateUAV(PositionsBuffer);
+	PassParameters->RWSkinnedRotations = GraphBuilder.CreateUAV(RotationsBuffer);
+
+	TShaderMapRef<FGVRMSplatCacheDecodeCS> ComputeShader(GetGlobalShaderMap(FeatureLevel));
+	FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSplatCacheDecode (%d splats)", NumSplats), ComputeShader, PassParameters,
+		FComputeShaderUtils::GetGroupCountWrapped(NumSplats, FGVRMSplatShader::ThreadGroupSize));
+
+	SetSkinnedSplats(GraphBuilder.ConvertToExternalBuffer(PositionsBuffer), GraphBuilder.ConvertToExternalBuffer(RotationsBuffer), 0);
+	SetSkinnedBones(nullptr, 0, 0);
+}
+
+void FGVRMSplatSceneProxy::SetSkinnedSplats(const TRefCountPtr<FRDGPooledBuffer>& InSkinnedPositions, const TRefCountPtr<FRDGPooledBuffer>& InSkinnedRotations, uint32 InSplatBase)
+{
+	SkinnedPositions = InSkinnedPositions;
+	SkinnedRotations = InSkinnedRotations;
+	SplatBase = InSplatBase;
+}
+
+void FGVRMSplatSceneProxy::SetSkinnedBones(const TRefCountPtr<FRDGPooledBuffer>& InBoneMatrices, uint32 InBoneBase, uint32 InNumBones)
+{
+	SkinnedBoneMatrices = InBoneMatrices;
+	BoneBase = InBoneBase;
+	NumBones = InNumBones;
+}
+
+void FGVRMSplatSceneProxy::AddDrawPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View, FRDGTextureRef SceneColor, FRDGTextureRef SceneDepth, FRDGBufferRef ViewCullCounters) const
+{
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+	FRDGBufferRef PositionsBuffer = GraphBuilder.RegisterExternalBuffer(SkinnedPositions);
+	FRDGBufferRef RotationsBuffer = GraphBuilder.RegisterExternalBuffer(SkinnedRotations);
+
+	const FMatrix44f LocalToView(MeshLocalToWorld
+		* FTranslationMatrix(View.ViewMatrices.GetPreViewTranslation())
+		* View.ViewMatrices.GetTranslatedViewMatrix());
+	const FMatrix44f ViewToClip(View.ViewMatrices.GetProjectionMatrix());
+	const FVector2f ViewportSize(View.ViewRect.Width(), View.ViewRect.Height());
+
+	// Fine culling: only the surviving splats are sorted and drawn
+	FRDGBufferRef SortArgs = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateIndirectDesc(FGVRMSplatCullSplatsCS::NumArgs), TEXT("GVRM.SplatSortArgs"));
+	const uint32 NumSortElements = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(NumSplats));
+	FRDGBufferRef SortValues = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSortElements), TEXT("GVRM.SortValues"));
+	{
+		RDG_EVENT_SCOPE(GraphBuilder, "GVRMSplatCullAndSort");
+		RDG_GPU_STAT_SCOPE(GraphBuilder, GVRMSplatSort);
+
+		FRDGBufferRef CompactedSplats = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSplats), TEXT("GVRM.CompactedSplats"));
+		FRDGBufferRef CullCounters = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), FGVRMSplatCullSplatsCS::NumCounters), TEXT("GVRM.SplatCullCounters"));
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(CullCounters), 0u);
+		{
+			FGVRMSplatCullSplatsCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatCullSplatsCS::FParameters>();
+			PassParameters->LocalToView = LocalToView;
+			PassParameters->ViewToClip = ViewToClip;
+			PassParameters->ViewportSize = ViewportSize;
+			PassParameters->NumSplats = NumSplats;
+			PassParameters->SplatBase = SplatBase;
+			PassParameters->bEnableCulling = CVarGVRMSplatCulling.GetValueOnRenderThread() ? 1 : 0;
+			PassParameters->MinPixelRadius = CVarGVRMSplatCullingMinPixelRadius.GetValueOnRenderThread();
+			PassParameters->BackfaceThreshold = CVarGVRMSplatCullingBackfaceThreshold.GetValueOnRenderThread();
+			PassParameters->FrustumMargin = CVarGVRMSplatCullingFrustumMargin.GetValueOnRenderThread();
+			PassParameters->SkinnedPositions = GraphBuilder.CreateSRV(PositionsBuffer);
+			PassParameters->SkinnedRotations = GraphBuilder.CreateSRV(RotationsBuffer);
+			PassParameters->SplatScales = SplatScalesSRV;
+			PassParameters->SplatNormals = SplatNormalsSRV;
+			PassParameters->RWCompactedSplats = GraphBuilder.CreateUAV(CompactedSplats);
+			PassParameters->RWCullCounters = GraphBuilder.CreateUAV(CullCounters);
+
+			TShaderMapRef<FGVRMSplatCullSplatsCS> ComputeShader(ShaderMap);
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMCullSplats (%d splats)", NumSplats), ComputeShader, PassParameters,
+				FComputeShaderUtils::GetGroupCountWrapped(NumSplats, FGVRMSplatShader::ThreadGroupSize));
+		}
+		{
+			FGVRMSplatBuildSortArgsCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatBuildSortArgsCS::FParameters>();
+			PassParameters->MaxDispatchGroups = GRHIMaxDispatchThreadGroupsPerDimension.X;
+			PassParameters->RWCullCounters = GraphBuilder.CreateUAV(CullCounters);
+			PassParameters->RWSortArgs = GraphBuilder.CreateUAV(SortArgs, PF_R32_UINT);
+			PassParameters->RWViewCullCounters = GraphBuilder.CreateUAV(ViewCullCounters);
+
+			TShaderMapRef<FGVRMSplatBuildSortArgsCS> ComputeShader(ShaderMap);
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMBuildSplatSortArgs"), ComputeShader, PassParameters, FIntVector(1, 1, 1));
+		}
+
+		// Back-to-front order of the survivors; the pass sequence covers the worst case, each pass only the survivors
+		FRDGBufferRef SortKeys = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSortElements), TEXT("GVRM.SortKeys"));
+		FRDGBufferSRVRef SortCountersSRV = GraphBuilder.CreateSRV(CullCounters);
+		{
+			FGVRMSplatSortKeysCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatSortKeysCS::FParameters>();
+			PassParameters->LocalToView = LocalToView;
+			PassParameters->SplatBase = SplatBase;
+			PassParameters->SkinnedPositions = GraphBuilder.CreateSRV(PositionsBuffer);
+			PassParameters->CompactedSplats = GraphBuilder.CreateSRV(CompactedSplats);
+			PassParameters->SortCounters = SortCountersSRV;
+			PassParameters->RWSortKeys = GraphBuilder.CreateUAV(SortKeys);
+			PassParameters->RWSortValues = GraphBuilder.CreateUAV(SortValues);
+			PassParameters->IndirectArgs = SortArgs;
+
+			TShaderMapRef<FGVRMSplatSortKeysCS> ComputeShader(ShaderMap);
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSplatSortKeys"), ComputeShader, PassParameters,
+				SortArgs, FGVRMSplatCullSplatsCS::SortArgsOffset);
+		}
+
+		TShaderMapRef<FGVRMSplatBitonicSortCS> SortShader(ShaderMap);
+		for (uint32 SortLevel = 2; SortLevel <= NumSortElements; SortLevel <<= 1)
+		{
+			for (uint32 SortStep = SortLevel >> 1; SortStep > 0; SortStep >>= 1)
+			{
+				FGVRMSplatBitonicSortCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatBitonicSortCS::FParameters>();
+				PassParameters->SortLevel = SortLevel;
+				PassParameters->SortStep = SortStep;
+				PassParameters->SortCounters = SortCountersSRV;
+				PassParameters->RWSortKeys = GraphBuilder.CreateUAV(SortKeys);
+				PassParameters->RWSortValues = GraphBuilder.CreateUAV(SortValues);
+				PassParameters->IndirectArgs = SortArgs;
+				FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMSplatBitonicSort"), SortShader, PassParameters,
+					SortArgs, FGVRMSplatCullSplatsCS::SortArgsOffset);
+			}
+		}
+	}
+
+	// Instanced quads, premultiplied alpha over scene color, depth tested against opaque geometry
+	FGVRMSplatDrawParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatDrawParameters>();
+	PassParameters->LocalToView = LocalToView;
+	PassParameters->ViewToClip = ViewToClip;
+	PassParameters->ViewportSize = ViewportSize;
+	PassParameters->NumSplats = NumSplats;
+	PassParameters->SplatBase = SplatBase;
+	PassParameters->SkinnedPositions = GraphBuilder.CreateSRV(PositionsBuffer);
+	PassParameters->SkinnedRotations = GraphBuilder.CreateSRV(RotationsBuffer);
+	PassParameters->SortedIndices = GraphBuilder.CreateSRV(SortValues);
+	PassParameters->SplatScales = SplatScalesSRV;
+	PassParameters->SplatRotations = SplatRotationsSRV;
+	PassParameters->SplatColors = SplatColorsSRV;
+	PassParameters->IndirectArgs = SortArgs;
+	PassParameters->RenderTargets[0] = FRenderTargetBinding(SceneColor, ERenderTargetLoadAction::ELoad);
+	PassParameters->RenderTargets.DepthStencil = FDepthStencilBinding(SceneDepth, ERenderTargetLoadAction::ELoad, FExclusiveDepthStencil::DepthRead_StencilNop);
+
+	TShaderMapRef<FGVRMSplatDrawVS> VertexShader(ShaderMap);
+	TShaderMapRef<FGVRMSplatDrawPS> PixelShader(ShaderMap);
+	const FIntRect ViewRect = View.ViewRect;
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GVRMDrawSplats (%d splats max)", NumSplats),
+		PassParameters,
+		ERDGPassFlags::Raster,
+		[PassParameters, VertexShader, PixelShader, ViewRect](FRHICommandList& RHICmdList)
+		{
+			RHICmdList.SetViewport(ViewRect.Min.X, ViewRect.Min.Y, 0.0f, ViewRect.Max.X, ViewRect.Max.Y, 1.0f);
+
+			FGraphicsPipelineStateInitializer GraphicsPSOInit;
+			RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+			GraphicsPSOInit.BlendState = TStaticBlendState<CW_RGB, BO_Add, BF_One, BF_InverseSourceAlpha>::GetRHI();
+			GraphicsPSOInit.RasterizerState = TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
+			GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_DepthNearOrEqual>::GetRHI();
+			GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GEmptyVertexDeclaration.VertexDeclarationRHI;
+			GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+			GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
+			GraphicsPSOInit.PrimitiveType = PT_TriangleStrip;
+			SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+
+			SetShaderParameters(RHICmdList, VertexShader, VertexShader.GetVertexShader(), *PassParameters);
+			SetShaderParameters(RHICmdList, PixelShader, PixelShader.GetPixelShader(), *PassParameters);
+
+			// One instance per surviving splat
+			RHICmdList.DrawPrimitiveIndirect(PassParameters->IndirectArgs->GetIndirectRHICallBuffer(), FGVRMSplatCullSplatsCS::DrawArgsOffset);
+		}
+	);
+}
+
+// ============================================
+// Debug View
+// ============================================
+
+void FGVRMSplatSceneProxy::SetDebugDraw_RenderThread(bool bInDrawBones, bool bInDrawVertices)
+{
+	bDebugDrawBones = bInDrawBones;
+	bDebugDrawVertices = bInDrawVertices;
+
+	if (bDebugDrawVertices && DebugElementsRevision != MeshStreamsRevision)
+	{
+		BuildDebugElements_RenderThread();
+	}
+}
+
+void FGVRMSplatSceneProxy::BuildDebugElements_RenderThread()
+{
+	using namespace GVRMRender;
+
+	// Placeholders until the vertices are drawn; the revision stays stale so enabling them samples
+	if (!bDebugDrawVertices)
+	{
+		NumDebugVertices = NumDebugLines = 0;
+		UploadBufferOrPlaceholder(TEXT("GVRMSplatDebugElements"), TArray<FUintVector2>(), sizeof(FUintVector2), PF_R32G32_UINT,
+			DebugElementsBuffer, DebugElementsSRV);
+		UploadBufferOrPlaceholder(TEXT("GVRMSplatDebugRelativePositions"), TArray<FVector4f>(), sizeof(FVector4f), PF_A32B32G32R32F,
+			DebugRelativePositionsBuffer, DebugRelativePositionsSRV);
+		return;
+	}
+
+	DebugElementsRevision = MeshStreamsRevision;
+
+	// Every DebugVertexStride-th distinct bound vertex, in splat order
+	TMap<int32, bool> SampledVertices;
+	SampledVertices.Reserve(NumSplats / 2);
+	TArray<int32> VertexSplats;
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		const int32 VertexIndex = SplatVertexIndices[SplatIndex];
+		if (!SampledVertices.Contains(VertexIndex))
+		{
+			const bool bSampled = SampledVertices.Num() % DebugVertexStride == 0;
+			SampledVertices.Add(VertexIndex, bSampled);
+			if (bSampled)
+			{
+				VertexSplats.Add(SplatIndex);
+			}
+		}
+	}
+
+	// Colour by the strongest influence on the current mesh LOD (palette slot)
+	auto GetVertexBone = [this](int32 VertexIndex) -> uint32
+	{
+		const FGVRMSplatDynamicData* Streams = MeshStreams.Get();
+		if (!Streams)
+		{
+			return 0;
+		}
+
+		const int32 LODVertex = VertexIndex < Streams->NumRemapVertices ? Streams->LODRemapIndices[VertexIndex].X : VertexIndex;
+		if (!Streams->BoneIndices.IsValidIndex(LODVertex) || !Streams->BoneWeights.IsValidIndex(LODVertex))
+		{
+			return 0;
+		}
+
+		const FVector4f& Weights = Streams->BoneWeights[LODVertex];
+		int32 Strongest = 0;
+		for (int32 Influence = 1; Influence < 4; ++Influence)
+		{
+			Strongest = Weights[Influence] > Weights[Strongest] ? Influence : Strongest;
+		}
+		return static_cast<uint32>(Streams->BoneIndices[LODVertex][Strongest]);
+	};
+
+	TArray<FUintVector2> Elements;
+	TArray<FVector4f> RelativePositions;
+	auto AddElement = [&](int32 SplatIndex)
+	{
+		Elements.Add(FUintVector2(static_cast<uint32>(SplatIndex), GetVertexBone(SplatVertexIndices[SplatIndex])));
+		RelativePositions.Add(SplatRelativePositions[SplatIndex]);
+	};
+
+	for (const int32 SplatIndex : VertexSplats)
+	{
+		AddElement(SplatIndex);
+	}
+	NumDebugVertices = Elements.Num();
+
+	for (int32 SplatIndex = 0; SplatIndex < NumSplats; ++SplatIndex)
+	{
+		if (SampledVertices.FindChecked(SplatVertexIndices[SplatIndex]))
+		{
+			AddElement(SplatIndex);
+		}
+	}
+	NumDebugLines = Elements.Num() - NumDebugVertices;
+
+	UploadBufferOrPlaceholder(TEXT("GVRMSplatDebugElements"), Elements, sizeof(FUintVector2), PF_R32G32_UINT,
+		DebugElementsBuffer, DebugElementsSRV);
+	UploadBufferOrPlaceholder(TEXT("GVRMSplatDebugRelativePositions"), RelativePositions, sizeof(FVector4f), PF_A32B32G32R32F,
+		DebugRelativePositionsBuffer, DebugRelativePositionsSRV);
+}
+
+void FGVRMSplatSceneProxy::AddDebugDrawPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View, FRDGTextureRef SceneColor, FRDGTextureRef SceneDepth, uint32& InOutInstanceBudget) const
+{
+	// Points are a few pixels across regardless of distance
+	constexpr float DebugPointSize = 4.0f;
+
+	// Joints come from the batch palette; cache playback has none
+	const uint32 NumJoints = bDebugDrawBones && SkinnedBoneMatrices.IsValid() ? FMath::Min(NumBones, InOutInstanceBudget) : 0;
+	InOutInstanceBudget -= NumJoints;
+
+	// Elements were sampled when the mesh streams or the debug selection changed
+	const uint32 NumPoints = bDebugDrawVertices ? FMath::Min(NumDebugVertices, InOutInstanceBudget) : 0;
+	InOutInstanceBudget -= NumPoints;
+	const uint32 NumLines = bDebugDrawVertices ? FMath::Min(NumDebugLines, InOutInstanceBudget) : 0;
+	InOutInstanceBudget -= NumLines;
+
+	if (NumJoints + NumPoints + NumLines == 0)
+	{
+		return;
+	}
+
+	FRDGBufferRef BoneMatricesBuffer = nullptr;
+	if (SkinnedBoneMatrices.IsValid())
+	{
+		BoneMatricesBuffer = GraphBuilder.RegisterExternalBuffer(SkinnedBoneMatrices);
+	}
+	else
+	{
+		// Never read without joints, but the vertex shaders bind it
+		BoneMatricesBuffer = GraphBuilder.CreateBuffer(FRDGBufferDesc::CreateBufferDesc(sizeof(FVector4f), 3), TEXT("GVRM.DebugNoBones"));
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(BoneMatricesBuffer, PF_A32B32G32R32F), 0u);
+	}
+
+	FGVRMSplatDebugParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatDebugParameters>();
+	PassParameters->LocalToView = FMatrix44f(MeshLocalToWorld
+		* FTranslationMatrix(View.ViewMatrices.GetPreViewTranslation())
+		* View.ViewMatrices.GetTranslatedViewMatrix());
+	PassParameters->ViewToClip = FMatrix44f(View.ViewMatrices.GetProjectionMatrix());
+	PassParameters->ViewportSize = FVector2f(View.ViewRect.Width(), View.ViewRect.Height());
+	PassParameters->PointSize = DebugPointSize;
+	PassParameters->SplatBase = SplatBase;
+	PassParameters->BoneBase = BoneBase;
+	PassParameters->NumDebugVertices = NumDebugVertices;
+	PassParameters->SkinnedPositions = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(SkinnedPositions));
+	PassParameters->SkinnedRotations = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(SkinnedRotations));
+	PassParameters->BoneMatrices = GraphBuilder.CreateSRV(BoneMatricesBuffer, PF_A32B32G32R32F);
+	PassParameters->DebugElements = DebugElementsSRV;
+	PassParameters->DebugRelativePositions = DebugRelativePositionsSRV;
+	PassParameters->RenderTargets[0] = FRenderTargetBinding(SceneColor, ERenderTargetLoadAction::ELoad);
+	PassParameters->RenderTargets.DepthStencil = FDepthStencilBinding(SceneDepth, ERenderTargetLoadAction::ELoad, FExclusiveDepthStencil::DepthRead_StencilNop);
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+	TShaderMapRef<FGVRMSplatDebugJointVS> JointShader(ShaderMap);
+	TShaderMapRef<FGVRMSplatDebugPointVS> PointShader(ShaderMap);
+	TShaderMapRef<FGVRMSplatDebugLineVS> LineShader(ShaderMap);
+	TShaderMapRef<FGVRMSplatDebugPS> PixelShader(ShaderMap);
+	const FIntRect ViewRect = View.ViewRect;
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GVRMSplatDebug (%u joints, %u vertices, %u lines)", NumJoints, NumPoints, NumLines),
+		PassParameters,
+		ERDGPassFlags::Raster,
+		[PassParameters, JointShader, PointShader, LineShader, PixelShader, ViewRect, NumJoints, NumPoints, NumLines](FRHICommandList& RHICmdList)
+		{
+			RHICmdList.SetViewport(ViewRect.Min.X, ViewRect.Min.Y, 0.0f, ViewRect.Max.X, ViewRect.Max.Y, 1.0f);
+
+			// One instanced draw per element kind
+			auto Draw = [&](const auto& VertexShader, EPrimitiveType PrimitiveType, uint32 NumPrimitives, uint32 NumInstances)
+			{
+				if (NumInstances == 0)
+				{
+					return;
+				}
+
+				FGraphicsPipelineStateInitializer GraphicsPSOInit;
+				RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+				GraphicsPSOInit.BlendState = TStaticBlendState<CW_RGB>::GetRHI();
+				GraphicsPSOInit.RasterizerState = TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
+				GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_DepthNearOrEqual>::GetRHI();
+				GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GEmptyVertexDeclaration.VertexDeclarationRHI;
+				GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+				GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
+				GraphicsPSOInit.PrimitiveType = PrimitiveType;
+				SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+
+				SetShaderParameters(RHICmdList, VertexShader, VertexShader.GetVertexShader(), *PassParameters);
+				SetShaderParameters(RHICmdList, PixelShader, PixelShader.GetPixelShader(), *PassParameters);
+
+				RHICmdList.DrawPrimitive(0, NumPrimitives, NumInstances);
+			};
+
+			Draw(LineShader, PT_LineList, 1, NumLines);
+			Draw(PointShader, PT_TriangleStrip, 2, NumPoints);
+			Draw(JointShader, PT_TriangleStrip, 2, NumJoints);
+		}
+	);
+}
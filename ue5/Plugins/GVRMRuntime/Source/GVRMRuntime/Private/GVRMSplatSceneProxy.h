@@ -0,0 +1,232 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PrimitiveSceneProxy.h"
+#include "RenderGraphResources.h"
+#include "GVRMBonePaletteRing.h"
+#include "GVRMSkinningData.h"
+
+class UGVRMSplatComponent;
+class FGVRMAnimationCacheResource;
+class FRDGBuilder;
+class FViewInfo;
+class FGVRMSplatViewExtension;
+struct FGVRMMemoryBreakdown;
+
+/**
+ * Skeletal mesh streams sent from UGVRMSplatComponent to its scene proxy
+ * after a LOD or mesh change. Bone matrices travel through the palette ring.
+ */
+struct FGVRMSplatDynamicData
+{
+	TArray<FVector3f> VertexPositions;
+	TArray<FIntVector4> BoneIndices;
+	TArray<FVector4f> BoneWeights;
+	TArray<FIntVector4> ExtraBoneIndices;     // Influences 4 to 7, only with 8 influences
+	TArray<FVector4f> ExtraBoneWeights;
+	int32 NumInfluences = 4;                  // GVRMSkinning::GetInfluencePermutation
+	TArray<FIntVector4> LODRemapIndices;
+	TArray<FVector4f> LODRemapWeights;
+	TArray<FVector4f> LODRemapOffsets;
+	int32 NumRemapVertices = 0;
+
+	/** LOD0 vertex to morph slot (INDEX_NONE when unmorphed) and the encoded deltas (see CacheMorphTargets) */
+	TArray<int32> MorphVertexSlots;
+	TArray<FVector4f> MorphDeltas;
+	int32 NumMorphSlots = 0;
+
+	/** Per splat: bind-pose normal of the host vertex on this LOD (uploaded, then released) */
+	TArray<FVector4f> SplatNormals;
+};
+
+/**
+ * Animation cache playback state sent from UGVRMSplatComponent every frame
+ * while it plays a UGVRMAnimationCache (replaces the bone palette).
+ */
+struct FGVRMSplatCachePlayback
+{
+	/** Owned by the cache asset, which the component keeps alive */
+	const FGVRMAnimationCacheResource* Resource = nullptr;
+
+	// Cache layout (32-bit words, see UGVRMAnimationCache)
+	uint32 NumSplats = 0;
+	uint32 ClusterSize = 0;
+	uint32 SplatDataOffset = 0;
+	uint32 FrameStride = 0;
+
+	int32 Frame0 = 0;
+	int32 Frame1 = 0;
+	float Alpha = 0.0f;
+
+	/** Transform of the skeletal mesh component the cache was baked in the space of */
+	FMatrix LocalToWorld = FMatrix::Identity;
+};
+
+/**
+ * Scene proxy for UGVRMSplatComponent.
+ * Owns the splat draw buffers and the CPU skinning inputs that FGVRMSplatBatch
+ * combines with every other avatar in the scene; adds the sort and draw passes
+ * when asked by FGVRMSplatViewExtension.
+ */
+class FGVRMSplatSceneProxy final : public FPrimitiveSceneProxy
+{
+public:
+	FGVRMSplatSceneProxy(const UGVRMSplatComponent* Component);
+	virtual ~FGVRMSplatSceneProxy();
+
+	// FPrimitiveSceneProxy Interface
+	virtual SIZE_T GetTypeHash() const override;
+	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
+	virtual uint32 GetMemoryFootprint() const override;
+
+	/** Take new mesh streams (the batch rebuilds its combined buffers on the next frame) */
+	void SetDynamicData_RenderThread(FRHICommandListImmediate& RHICmdList, TUniquePtr<FGVRMSplatDynamicData> NewData);
+
+	/** Palette ring written by the component (producer) and read here once per frame */
+	FGVRMBonePaletteRing& GetBonePalettes() { return BonePalettes; }
+
+	/** Take the newest published bone palette (once per frame) */
+	void UpdateBonePalette_RenderThread(uint32 FrameNumber);
+
+	/** Whether mesh streams and a bone palette are available for skinning */
+	bool IsReadyToSkin() const;
+
+	/** Take this frame's animation cache playback state */
+	void SetCachePlayback_RenderThread(const FGVRMSplatCachePlayback& InPlayback);
+
+	/** Whether splats come from an animation cache instead of the skinning batch */
+	bool IsPlayingCache() const { return CachePlayback.Resource != nullptr; }
+
+	/** Decode this frame's cached splats into this proxy's own skinned buffers */
+	void AddCacheDecodePass(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type FeatureLevel);
+
+	// Skinning inputs read by FGVRMSplatBatch
+	const TArray<int32>& GetSplatVertexIndices() const { return SplatVertexIndices; }
+	const TArray<FVector4f>& GetSplatRelativePositions() const { return SplatRelativePositions; }
+	const FGVRMSplatDynamicData* GetMeshStreams() const { return MeshStreams.Get(); }
+	const TArray<int32>& GetUniqueVertexIndices() const { return UniqueVertexIndices; }
+	const TArray<int32>& GetSplatUniqueVertices() const { return SplatUniqueVertices; }
+	const TArray<uint32>& GetRigidSplatOrder() const { return RigidSplatOrder; }
+	const TArray<FVector4f>& GetRigidHostPositions() const { return RigidHostPositions; }
+	const TArray<FUintVector2>& GetRigidBones() const { return RigidBones; }
+
+	/** Skinning mode of the current palette (LBS without rigid bindings) */
+	EGVRMSkinningMode GetSkinningMode() const;
+	uint32 GetMeshStreamsRevision() const { return MeshStreamsRevision; }
+	const FGVRMBonePalette* GetCurrentPalette() const { return CurrentPalette; }
+
+	/** Point the draw at this frame's batched skinning output */
+	void SetSkinnedSplats(const TRefCountPtr<FRDGPooledBuffer>& InSkinnedPositions, const TRefCountPtr<FRDGPooledBuffer>& InSkinnedRotations, uint32 InSplatBase);
+
+	/** Point the debug view at this frame's batch bone palette (null while playing a cache) */
+	void SetSkinnedBones(const TRefCountPtr<FRDGPooledBuffer>& InBoneMatrices, uint32 InBoneBase, uint32 InNumBones);
+
+	/** Whether skinned splats are available for drawing */
+	bool HasSkinnedSplats() const { return SkinnedPositions.IsValid(); }
+
+	/**
+	 * Cull the skinned splats for the view, sort the survivors back to front and draw
+	 * them into scene color. The cull counters are added to ViewCullCounters.
+	 */
+	void AddDrawPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View, FRDGTextureRef SceneColor, FRDGTextureRef SceneDepth, FRDGBufferRef ViewCullCounters) const;
+
+	/** Select the debug view elements (UGVRMSplatComponent::SetDebugDraw) */
+	void SetDebugDraw_RenderThread(bool bInDrawBones, bool bInDrawVertices);
+
+	/** Whether the debug view draws anything */
+	bool HasDebugDraw() const { return bDebugDrawBones || bDebugDrawVertices; }
+
+	/**
+	 * Draw the debug view (joints, sampled bound vertices, vertex-to-splat lines) from the
+	 * skinned buffers; at most InOutInstanceBudget instances, which is reduced by the amount drawn.
+	 */
+	void AddDebugDrawPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View, FRDGTextureRef SceneColor, FRDGTextureRef SceneDepth, uint32& InOutInstanceBudget) const;
+
+	int32 GetNumSplats() const { return NumSplats; }
+
+	/** CPU bytes of the skinning inputs and GPU bytes of the draw and decode buffers; render thread only */
+	void GetMemoryBreakdown_RenderThread(FGVRMMemoryBreakdown& OutBreakdown) const;
+
+private:
+	/** Upload the draw streams (render thread, called once after construction) */
+	void InitSplatBuffers_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+	/**
+	 * Sample the bound vertices for the debug view, on the render thread when the mesh streams
+	 * or the debug selection change (never per view); placeholders while vertices are not drawn
+	 */
+	void BuildDebugElements_RenderThread();
+
+	/** Extension that drives this proxy's passes (kept alive while registered) */
+	TSharedPtr<FGVRMSplatViewExtension, ESPMode::ThreadSafe> ViewExtension;
+
+	int32 NumSplats = 0;
+	uint32 LastPaletteFrame = MAX_uint32;
+
+	/** Skeletal mesh component transform of the current palette (splats are skinned in its space) */
+	FMatrix MeshLocalToWorld = FMatrix::Identity;
+
+	FGVRMBonePaletteRing BonePalettes;
+
+	/** Animation cache playback (Resource is null when following the skeletal mesh) */
+	FGVRMSplatCachePlayback CachePlayback;
+
+	/** Palette acquired from the ring this frame (owned by the ring's consumer slot) */
+	const FGVRMBonePalette* CurrentPalette = nullptr;
+
+	// Skinning inputs, kept on the CPU for the scene batch
+	TArray<int32> SplatVertexIndices;
+	TArray<FVector4f> SplatRelativePositions;
+	TUniquePtr<FGVRMSplatDynamicData> MeshStreams;
+	uint32 MeshStreamsRevision = 0;
+
+	// Shared vertex skinning inputs (empty when every splat skins its own vertex)
+	TArray<int32> UniqueVertexIndices;
+	TArray<int32> SplatUniqueVertices;
+
+	// Rigid-bone inputs in bone order (empty when the binding data has no rigid bindings)
+	TArray<uint32> RigidSplatOrder;
+	TArray<FVector4f> RigidHostPositions;
+	TArray<FUintVector2> RigidBones;
+
+	// Draw streams (CPU copies are released after upload)
+	TArray<FVector4f> SplatScales;
+	TArray<FVector4f> SplatRotations;
+	TArray<FVector4f> SplatColors;
+
+	FBufferRHIRef SplatScalesBuffer;
+	FBufferRHIRef SplatRotationsBuffer;
+	FBufferRHIRef SplatColorsBuffer;
+	FShaderResourceViewRHIRef SplatScalesSRV;
+	FShaderResourceViewRHIRef SplatRotationsSRV;
+	FShaderResourceViewRHIRef SplatColorsSRV;
+
+	// Host vertex normals for the per-view backface test (zero until mesh streams arrive)
+	FBufferRHIRef SplatNormalsBuffer;
+	FShaderResourceViewRHIRef SplatNormalsSRV;
+
+	// Skinning (or cache decode) output for this frame
+	TRefCountPtr<FRDGPooledBuffer> SkinnedPositions;
+	TRefCountPtr<FRDGPooledBuffer> SkinnedRotations;
+	uint32 SplatBase = 0;
+
+	// Batch bone palette for this frame (debug joints)
+	TRefCountPtr<FRDGPooledBuffer> SkinnedBoneMatrices;
+	uint32 BoneBase = 0;
+	uint32 NumBones = 0;
+
+	// Debug view: sampled vertex representatives first, then one entry per line
+	bool bDebugDrawBones = false;
+	bool bDebugDrawVertices = false;
+	int32 DebugVertexStride = 1;
+	uint32 DebugElementsRevision = MAX_uint32;
+	uint32 NumDebugVertices = 0;
+	uint32 NumDebugLines = 0;
+	FBufferRHIRef DebugElementsBuffer;
+	FBufferRHIRef DebugRelativePositionsBuffer;
+	FShaderResourceViewRHIRef DebugElementsSRV;
+	FShaderResourceViewRHIRef DebugRelativePositionsSRV;
+};
@@ -0,0 +1,816 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSpringBoneSolver.h"
+#include "GVRMSkinningData.h"
+#include "ReferenceSkeleton.h"
+#include "Async/ParallelFor.h"
+
+/**
+ * Four-lane vector and quaternion math for the packed joints.
+ * Quaternion products follow FQuat (A * B applies B first).
+ */
+namespace GVRMSpringBoneMath
+{
+	using FVec = VectorRegister4Float;
+
+	struct FVec3
+	{
+		FVec X, Y, Z;
+	};
+
+	struct FQuat4
+	{
+		FVec X, Y, Z, W;
+	};
+
+	FORCEINLINE FVec3 Add(const FVec3& A, const FVec3& B)
+	{
+		return { VectorAdd(A.X, B.X), VectorAdd(A.Y, B.Y), VectorAdd(A.Z, B.Z) };
+	}
+
+	FORCEINLINE FVec3 Sub(const FVec3& A, const FVec3& B)
+	{
+		return { VectorSubtract(A.X, B.X), VectorSubtract(A.Y, B.Y), VectorSubtract(A.Z, B.Z) };
+	}
+
+	/** A * S + B */
+	FORCEINLINE FVec3 MulAdd(const FVec3& A, const FVec& S, const FVec3& B)
+	{
+		return { VectorMultiplyAdd(A.X, S, B.X), VectorMultiplyAdd(A.Y, S, B.Y), VectorMultiplyAdd(A.Z, S, B.Z) };
+	}
+
+	FORCEINLINE FVec Dot(const FVec3& A, const FVec3& B)
+	{
+		return VectorMultiplyAdd(A.X, B.X, VectorMultiplyAdd(A.Y, B.Y, VectorMultiply(A.Z, B.Z)));
+	}
+
+	FORCEINLINE FVec3 Cross(const FVec3& A, const FVec3& B)
+	{
+		return {
+			VectorSubtract(VectorMultiply(A.Y, B.Z), VectorMultiply(A.Z, B.Y)),
+			VectorSubtract(VectorMultiply(A.Z, B.X), VectorMultiply(A.X, B.Z)),
+			VectorSubtract(VectorMultiply(A.X, B.Y), VectorMultiply(A.Y, B.X))
+		};
+	}
+
+	FORCEINLINE FVec3 Select(const FVec& Mask, const FVec3& A, const FVec3& B)
+	{
+		return { VectorSelect(Mask, A.X, B.X), VectorSelect(Mask, A.Y, B.Y), VectorSelect(Mask, A.Z, B.Z) };
+	}
+
+	FORCEINLINE FVec InvLength(const FVec3& V)
+	{
+		return VectorReciprocalSqrt(VectorMax(Dot(V, V), VectorSetFloat1(UE_SMALL_NUMBER)));
+	}
+
+	/** Head + normalize(Point - Head) * Length */
+	FORCEINLINE FVec3 ConstrainLength(const FVec3& Head, const FVec3& Point, const FVec& Length)
+	{
+		const FVec3 Delta = Sub(Point, Head);
+		return MulAdd(Delta, VectorMultiply(Length, InvLength(Delta)), Head);
+	}
+
+	FORCEINLINE FQuat4 Multiply(const FQuat4& A, const FQuat4& B)
+	{
+		return {
+			VectorAdd(VectorMultiplyAdd(A.W, B.X, VectorMultiply(A.X, B.W)), VectorSubtract(VectorMultiply(A.Y, B.Z), VectorMultiply(A.Z, B.Y))),
+			VectorAdd(VectorMultiplyAdd(A.W, B.Y, VectorMultiply(A.Y, B.W)), VectorSubtract(VectorMultiply(A.Z, B.X), VectorMultiply(A.X, B.Z))),
+			VectorAdd(VectorMultiplyAdd(A.W, B.Z, VectorMultiply(A.Z, B.W)), VectorSubtract(VectorMultiply(A.X, B.Y), VectorMultiply(A.Y, B.X))),
+			VectorSubtract(VectorMultiply(A.W, B.W), VectorMultiplyAdd(A.X, B.X, VectorMultiplyAdd(A.Y, B.Y, VectorMultiply(A.Z, B.Z))))
+		};
+	}
+
+	/** Q * V * Q^-1 for unit Q */
+	FORCEINLINE FVec3 Rotate(const FQuat4& Q, const FVec3& V)
+	{
+		const FVec3 Axis = { Q.X, Q.Y, Q.Z };
+		const FVec3 T = Cross(Axis, V);
+		const FVec3 T2 = { VectorAdd(T.X, T.X), VectorAdd(T.Y, T.Y), VectorAdd(T.Z, T.Z) };
+		return Add(MulAdd(T2, Q.W, V), Cross(Axis, T2));
+	}
+
+	/** Shortest rotation from unit A to unit B (identity when they are opposite) */
+	FORCEINLINE FQuat4 FromTo(const FVec3& A, const FVec3& B)
+	{
+		const FVec3 Axis = Cross(A, B);
+		const FVec W = VectorAdd(VectorOneFloat(), Dot(A, B));
+		const FVec Valid = VectorCompareGT(W, VectorSetFloat1(UE_KINDA_SMALL_NUMBER));
+		const FVec InvNorm = VectorReciprocalSqrt(VectorMax(VectorMultiplyAdd(W, W, Dot(Axis, Axis)), VectorSetFloat1(UE_SMALL_NUMBER)));
+		return {
+			VectorSelect(Valid, VectorMultiply(Axis.X, InvNorm), VectorZeroFloat()),
+			VectorSelect(Valid, VectorMultiply(Axis.Y, InvNorm), VectorZeroFloat()),
+			VectorSelect(Valid, VectorMultiply(Axis.Z, InvNorm), VectorZeroFloat()),
+			VectorSelect(Valid, VectorMultiply(W, InvNorm), VectorOneFloat())
+		};
+	}
+
+	FORCEINLINE FVec LaneMask(bool bX, bool bY, bool bZ, bool bW)
+	{
+		return MakeVectorRegisterFloatMask(bX ? 0xFFFFFFFFu : 0u, bY ? 0xFFFFFFFFu : 0u, bZ ? 0xFFFFFFFFu : 0u, bW ? 0xFFFFFFFFu : 0u);
+	}
+
+	FORCEINLINE FVec Lanes(const float (&Values)[4])
+	{
+		return MakeVectorRegisterFloat(Values[0], Values[1], Values[2], Values[3]);
+	}
+}
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+bool FGVRMSpringBoneAvatarSetup::Build(const UGVRMBindingData& BindingData, const FReferenceSkeleton& RefSkeleton,
+	FGVRMSpringBoneAvatarSetup& OutSetup, FString& OutErrorMessage)
+{
+	OutSetup = FGVRMSpringBoneAvatarSetup();
+
+	const int32 NumBones = RefSkeleton.GetNum();
+	OutSetup.ParentBones.SetNumUninitialized(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		OutSetup.ParentBones[BoneIndex] = RefSkeleton.GetParentIndex(BoneIndex);
+	}
+	OutSetup.RefLocalPose = RefSkeleton.GetRefBonePose();
+
+	// Colliders that resolved, and where each imported one went
+	TArray<int32> ColliderRemap;
+	ColliderRemap.Init(INDEX_NONE, BindingData.SpringColliders.Num());
+	for (int32 ColliderIndex = 0; ColliderIndex < BindingData.SpringColliders.Num(); ++ColliderIndex)
+	{
+		const FGVRMSpringBoneCollider& Collider = BindingData.SpringColliders[ColliderIndex];
+		const int32 Bone = RefSkeleton.FindBoneIndex(FName(*Collider.BoneName));
+		if (Bone == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("GVRM: Spring bone collider %d: bone '%s' not found, skipped"), ColliderIndex, *Collider.BoneName);
+			continue;
+		}
+		if (OutSetup.Colliders.Num() == FGVRMSpringBoneSolver::MaxColliders)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("GVRM: More than %d spring bone colliders, the rest are ignored"), FGVRMSpringBoneSolver::MaxColliders);
+			break;
+		}
+
+		ColliderRemap[ColliderIndex] = OutSetup.Colliders.Num();
+		FGVRMSpringBoneColliderSetup& Setup = OutSetup.Colliders.AddDefaulted_GetRef();
+		Setup.Bone = Bone;
+		Setup.Offset = FVector3f(Collider.Offset);
+		Setup.Tail = FVector3f(Collider.Tail);
+		Setup.Radius = Collider.Radius;
+		Setup.bCapsule = Collider.bCapsule;
+	}
+
+	for (int32 ChainIndex = 0; ChainIndex < BindingData.SpringChains.Num(); ++ChainIndex)
+	{
+		const FGVRMSpringBoneChain& Chain = BindingData.SpringChains[ChainIndex];
+
+		FGVRMSpringBoneChainSetup Setup;
+		Setup.Bones.Reserve(Chain.BoneNames.Num());
+		FString Problem;
+		for (const FString& BoneName : Chain.BoneNames)
+		{
+			const int32 Bone = RefSkeleton.FindBoneIndex(FName(*BoneName));
+			if (Bone == INDEX_NONE)
+			{
+				Problem = FString::Printf(TEXT("bone '%s' not found"), *BoneName);
+				break;
+			}
+			if (Setup.Bones.Num() > 0 && OutSetup.ParentBones[Bone] != Setup.Bones.Last())
+			{
+				Problem = FString::Printf(TEXT("bone '%s' is not a child of the previous bone"), *BoneName);
+				break;
+			}
+			Setup.Bones.Add(Bone);
+		}
+		if (Problem.IsEmpty() && Setup.Bones.Num() < 2)
+		{
+			Problem = TEXT("fewer than two bones");
+		}
+		if (!Problem.IsEmpty())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("GVRM: Spring chain %d skipped: %s"), ChainIndex, *Problem);
+			continue;
+		}
+
+		Setup.Stiffness = FMath::Max(Chain.Stiffness, 0.0f);
+		Setup.DragForce = FMath::Clamp(Chain.DragForce, 0.0f, 1.0f);
+		Setup.GravityPower = FMath::Max(Chain.GravityPower, 0.0f);
+		Setup.GravityDir = FVector3f(Chain.GravityDir.GetSafeNormal(UE_SMALL_NUMBER, FVector(0.0, 0.0, -1.0)));
+		Setup.HitRadius = FMath::Max(Chain.HitRadius, 0.0f);
+		for (const int32 ColliderIndex : Chain.Colliders)
+		{
+			if (ColliderRemap.IsValidIndex(ColliderIndex) && ColliderRemap[ColliderIndex] != INDEX_NONE)
+			{
+				Setup.ColliderMask |= uint64(1) << ColliderRemap[ColliderIndex];
+			}
+		}
+
+		OutSetup.Chains.Add(MoveTemp(Setup));
+	}
+
+	if (OutSetup.Chains.Num() == 0)
+	{
+		OutErrorMessage = FString::Printf(TEXT("None of the %d spring chains matches the skeleton"), BindingData.SpringChains.Num());
+		return false;
+	}
+
+	return true;
+}
+
+int32 FGVRMSpringBoneAvatarSetup::GetNumJoints() const
+{
+	int32 NumJoints = 0;
+	for (const FGVRMSpringBoneChainSetup& Chain : Chains)
+	{
+		NumJoints += Chain.Bones.Num() - 1;
+	}
+	return NumJoints;
+}
+
+// ============================================================================
+// Avatars
+// ============================================================================
+
+int32 FGVRMSpringBoneSolver::AddAvatar(FGVRMSpringBoneAvatarSetup&& Setup)
+{
+	const int32 AvatarId = FreeAvatars.Num() > 0 ? FreeAvatars.Pop(false) : Avatars.AddDefaulted();
+
+	FAvatar& Avatar = Avatars[AvatarId];
+	Avatar = FAvatar();
+	Avatar.Setup = MoveTemp(Setup);
+	Avatar.bLive = true;
+
+	++NumLiveAvatars;
+	NumJoints += Avatar.Setup.GetNumJoints();
+	bLayoutDirty = true;
+	return AvatarId;
+}
+
+void FGVRMSpringBoneSolver::RemoveAvatar(int32 AvatarId)
+{
+	if (!Avatars.IsValidIndex(AvatarId) || !Avatars[AvatarId].bLive)
+	{
+		return;
+	}
+
+	NumJoints -= Avatars[AvatarId].Setup.GetNumJoints();
+	--NumLiveAvatars;
+	Avatars[AvatarId] = FAvatar();
+	FreeAvatars.Add(AvatarId);
+	bLayoutDirty = true;
+}
+
+void FGVRMSpringBoneSolver::ResetAvatar(int32 AvatarId)
+{
+	if (Avatars.IsValidIndex(AvatarId) && Avatars[AvatarId].bLive)
+	{
+		Avatars[AvatarId].bNeedsReset = true;
+		Avatars[AvatarId].bHasResult = false;
+	}
+}
+
+void FGVRMSpringBoneSolver::ClearPoses()
+{
+	for (FAvatar& Avatar : Avatars)
+	{
+		Avatar.bHasPose = false;
+	}
+}
+
+SIZE_T FGVRMSpringBoneSolver::GetAllocatedSize() const
+{
+	SIZE_T Size = Avatars.GetAllocatedSize() + FreeAvatars.GetAllocatedSize()
+		+ Packets.GetAllocatedSize() + Joints.GetAllocatedSize() + PacketColliders.GetAllocatedSize();
+	for (const FAvatar& Avatar : Avatars)
+	{
+		Size += Avatar.Setup.Chains.GetAllocatedSize() + Avatar.Setup.Colliders.GetAllocatedSize()
+			+ Avatar.Setup.ParentBones.GetAllocatedSize() + Avatar.Setup.RefLocalPose.GetAllocatedSize()
+			+ Avatar.LaneBones.GetAllocatedSize() + Avatar.LaneTailBones.GetAllocatedSize()
+			+ Avatar.LaneRootBones.GetAllocatedSize() + Avatar.LaneRootParents.GetAllocatedSize()
+			+ Avatar.ColliderHeads.GetAllocatedSize() + Avatar.ColliderTails.GetAllocatedSize() + Avatar.ColliderRadii.GetAllocatedSize();
+		for (const FGVRMSpringBoneChainSetup& Chain : Avatar.Setup.Chains)
+		{
+			Size += Chain.Bones.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+// ============================================================================
+// Layout
+// ============================================================================
+
+void FGVRMSpringBoneSolver::RebuildLayout()
+{
+	TArray<FPacket> NewPackets;
+	TArray<FJointLanes> NewJoints;
+	TArray<FPacketCollider> NewColliders;
+	NewPackets.Reserve(Packets.Num());
+	NewJoints.Reserve(Joints.Num());
+	NewColliders.Reserve(PacketColliders.Num());
+
+	for (int32 AvatarIndex = 0; AvatarIndex < Avatars.Num(); ++AvatarIndex)
+	{
+		FAvatar& Avatar = Avatars[AvatarIndex];
+		if (!Avatar.bLive)
+		{
+			continue;
+		}
+
+		if (Avatar.FirstPacket == INDEX_NONE)
+		{
+			LayOutAvatar(AvatarIndex, NewPackets, NewJoints, NewColliders);
+			continue;
+		}
+
+		// Already laid out: move its packets as they are, state included
+		const int32 FirstPacket = NewPackets.Num();
+		for (int32 PacketIndex = Avatar.FirstPacket; PacketIndex < Avatar.FirstPacket + Avatar.NumPackets; ++PacketIndex)
+		{
+			FPacket Packet = Packets[PacketIndex];
+			NewJoints.Append(&Joints[Packet.FirstJoint], Packet.NumDepths);
+			NewColliders.Append(PacketColliders.GetData() + Packet.FirstCollider, Packet.NumColliders);
+			Packet.FirstJoint = NewJoints.Num() - Packet.NumDepths;
+			Packet.FirstCollider = NewColliders.Num() - Packet.NumColliders;
+			NewPackets.Add(Packet);
+		}
+		Avatar.FirstPacket = FirstPacket;
+	}
+
+	Packets = MoveTemp(NewPackets);
+	Joints = MoveTemp(NewJoints);
+	PacketColliders = MoveTemp(NewColliders);
+	bLayoutDirty = false;
+}
+
+void FGVRMSpringBoneSolver::LayOutAvatar(int32 AvatarIndex, TArray<FPacket>& OutPackets, TArray<FJointLanes>& OutJoints, TArray<FPacketCollider>& OutColliders)
+{
+	using namespace GVRMSpringBoneMath;
+
+	FAvatar& Avatar = Avatars[AvatarIndex];
+	const FGVRMSpringBoneAvatarSetup& Setup = Avatar.Setup;
+
+	// Longest chains first, so the lanes of a packet have similar lengths and few idle depths
+	TArray<int32> Order;
+	Order.Reserve(Setup.Chains.Num());
+	for (int32 ChainIndex = 0; ChainIndex < Setup.Chains.Num(); ++ChainIndex)
+	{
+		Order.Add(ChainIndex);
+	}
+	Order.Sort([&Setup](int32 A, int32 B)
+	{
+		const int32 LengthA = Setup.Chains[A].Bones.Num();
+		const int32 LengthB = Setup.Chains[B].Bones.Num();
+		return LengthA != LengthB ? LengthA > LengthB : A < B;
+	});
+
+	Avatar.FirstPacket = OutPackets.Num();
+	Avatar.NumPackets = FMath::DivideAndRoundUp(Order.Num(), 4);
+	Avatar.LaneBones.Reset();
+	Avatar.LaneTailBones.Reset();
+	Avatar.LaneRootBones.Init(INDEX_NONE, Avatar.NumPackets * 4);
+	Avatar.LaneRootParents.Init(INDEX_NONE, Avatar.NumPackets * 4);
+
+	for (int32 PacketIndex = 0; PacketIndex < Avatar.NumPackets; ++PacketIndex)
+	{
+		const FGVRMSpringBoneChainSetup* Chains[4] = {};
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const int32 OrderIndex = PacketIndex * 4 + Lane;
+			if (OrderIndex < Order.Num())
+			{
+				Chains[Lane] = &Setup.Chains[Order[OrderIndex]];
+				Avatar.LaneRootBones[PacketIndex * 4 + Lane] = Chains[Lane]->Bones[0];
+				Avatar.LaneRootParents[PacketIndex * 4 + Lane] = Setup.ParentBones[Chains[Lane]->Bones[0]];
+			}
+		}
+
+		FPacket& Packet = OutPackets.AddDefaulted_GetRef();
+		Packet.Avatar = AvatarIndex;
+		Packet.FirstJoint = OutJoints.Num();
+		Packet.NumDepths = Chains[0]->Bones.Num() - 1;
+		Packet.FirstCollider = OutColliders.Num();
+
+		float Stiffness[4] = {}, Inertia[4] = {}, GravityX[4] = {}, GravityY[4] = {}, GravityZ[4] = {}, HitRadius[4] = {};
+		uint64 ColliderMasks[4] = {};
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if (const FGVRMSpringBoneChainSetup* Chain = Chains[Lane])
+			{
+				const FVector3f Gravity = Chain->GravityDir * Chain->GravityPower;
+				Stiffness[Lane] = Chain->Stiffness;
+				Inertia[Lane] = 1.0f - Chain->DragForce;
+				GravityX[Lane] = Gravity.X;
+				GravityY[Lane] = Gravity.Y;
+				GravityZ[Lane] = Gravity.Z;
+				HitRadius[Lane] = Chain->HitRadius;
+				ColliderMasks[Lane] = Chain->ColliderMask;
+			}
+		}
+		Packet.Stiffness = Lanes(Stiffness);
+		Packet.Inertia = Lanes(Inertia);
+		Packet.GravityX = Lanes(GravityX);
+		Packet.GravityY = Lanes(GravityY);
+		Packet.GravityZ = Lanes(GravityZ);
+		Packet.HitRadius = Lanes(HitRadius);
+		Packet.Scale = VectorOneFloat();
+
+		// One entry per collider any lane uses, masked to those lanes
+		for (int32 ColliderIndex = 0; ColliderIndex < Setup.Colliders.Num(); ++ColliderIndex)
+		{
+			const uint64 Bit = uint64(1) << ColliderIndex;
+			const bool bUsed[4] = { (ColliderMasks[0] & Bit) != 0, (ColliderMasks[1] & Bit) != 0, (ColliderMasks[2] & Bit) != 0, (ColliderMasks[3] & Bit) != 0 };
+			if (bUsed[0] || bUsed[1] || bUsed[2] || bUsed[3])
+			{
+				FPacketCollider& PacketCollider = OutColliders.AddDefaulted_GetRef();
+				PacketCollider.Collider = ColliderIndex;
+				PacketCollider.LaneMask = LaneMask(bUsed[0], bUsed[1], bUsed[2], bUsed[3]);
+				++Packet.NumColliders;
+			}
+		}
+
+		for (int32 Depth = 0; Depth < Packet.NumDepths; ++Depth)
+		{
+			float RestQX[4] = {}, RestQY[4] = {}, RestQZ[4] = {}, RestQW[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			float AxisX[4] = {}, AxisY[4] = {}, AxisZ[4] = {}, Length[4] = {};
+			bool bActive[4] = {};
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const FGVRMSpringBoneChainSetup* Chain = Chains[Lane];
+				const bool bLaneActive = Chain && Depth < Chain->Bones.Num() - 1;
+				Avatar.LaneBones.Add(bLaneActive ? Chain->Bones[Depth] : INDEX_NONE);
+				Avatar.LaneTailBones.Add(bLaneActive ? Chain->Bones[Depth + 1] : INDEX_NONE);
+				if (!bLaneActive)
+				{
+					continue;
+				}
+
+				// The tail bone's reference translation is the joint's rest offset in its own frame
+				const FQuat4f RestRotation = FQuat4f(Setup.RefLocalPose[Chain->Bones[Depth]].GetRotation());
+				const FVector3f TailOffset = FVector3f(Setup.RefLocalPose[Chain->Bones[Depth + 1]].GetTranslation());
+				const float TailLength = TailOffset.Size();
+				const FVector3f Axis = TailLength > UE_KINDA_SMALL_NUMBER ? TailOffset / TailLength : FVector3f(0.0f, 0.0f, 1.0f);
+
+				RestQX[Lane] = RestRotation.X;
+				RestQY[Lane] = RestRotation.Y;
+				RestQZ[Lane] = RestRotation.Z;
+				RestQW[Lane] = RestRotation.W;
+				AxisX[Lane] = Axis.X;
+				AxisY[Lane] = Axis.Y;
+				AxisZ[Lane] = Axis.Z;
+				Length[Lane] = TailLength;
+				bActive[Lane] = true;
+			}
+
+			FJointLanes& Joint = OutJoints.AddDefaulted_GetRef();
+			Joint.TailX = Joint.TailY = Joint.TailZ = VectorZeroFloat();
+			Joint.PrevTailX = Joint.PrevTailY = Joint.PrevTailZ = VectorZeroFloat();
+			Joint.QX = Joint.QY = Joint.QZ = VectorZeroFloat();
+			Joint.QW = VectorOneFloat();
+			Joint.PrevQX = Joint.PrevQY = Joint.PrevQZ = VectorZeroFloat();
+			Joint.PrevQW = VectorOneFloat();
+			Joint.RestQX = Lanes(RestQX);
+			Joint.RestQY = Lanes(RestQY);
+			Joint.RestQZ = Lanes(RestQZ);
+			Joint.RestQW = Lanes(RestQW);
+			Joint.AxisX = Lanes(AxisX);
+			Joint.AxisY = Lanes(AxisY);
+			Joint.AxisZ = Lanes(AxisZ);
+			Joint.Length = Lanes(Length);
+			Joint.Active = LaneMask(bActive[0], bActive[1], bActive[2], bActive[3]);
+		}
+	}
+
+	Avatar.bNeedsReset = true;
+	Avatar.bHasResult = false;
+}
+
+// ============================================================================
+// Poses
+// ============================================================================
+
+void FGVRMSpringBoneSolver::SetPose(int32 AvatarId, const FTransform& ComponentToWorld, TConstArrayView<FTransform> ComponentSpaceTransforms)
+{
+	using namespace GVRMSpringBoneMath;
+
+	if (!Avatars.IsValidIndex(AvatarId) || !Avatars[AvatarId].bLive)
+	{
+		return;
+	}
+	if (bLayoutDirty)
+	{
+		RebuildLayout();
+	}
+
+	FAvatar& Avatar = Avatars[AvatarId];
+	if (ComponentSpaceTransforms.Num() < Avatar.Setup.ParentBones.Num())
+	{
+		// Not the skeleton the avatar was set up with (mesh swapped): leave it unsimulated
+		return;
+	}
+
+	Avatar.ComponentToWorld = ComponentToWorld;
+	const float WorldScale = (float)ComponentToWorld.GetMaximumAxisScale();
+
+	for (int32 PacketIndex = 0; PacketIndex < Avatar.NumPackets; ++PacketIndex)
+	{
+		float RootX[4] = {}, RootY[4] = {}, RootZ[4] = {};
+		float ParentQX[4] = {}, ParentQY[4] = {}, ParentQZ[4] = {}, ParentQW[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const int32 RootBone = Avatar.LaneRootBones[PacketIndex * 4 + Lane];
+			if (RootBone == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const int32 ParentBone = Avatar.LaneRootParents[PacketIndex * 4 + Lane];
+			const FVector Root = ComponentToWorld.TransformPosition(ComponentSpaceTransforms[RootBone].GetTranslation());
+			const FQuat ParentRotation = ParentBone != INDEX_NONE
+				? ComponentToWorld.GetRotation() * ComponentSpaceTransforms[ParentBone].GetRotation()
+				: ComponentToWorld.GetRotation();
+
+			RootX[Lane] = (float)Root.X;
+			RootY[Lane] = (float)Root.Y;
+			RootZ[Lane] = (float)Root.Z;
+			ParentQX[Lane] = (float)ParentRotation.X;
+			ParentQY[Lane] = (float)ParentRotation.Y;
+			ParentQZ[Lane] = (float)ParentRotation.Z;
+			ParentQW[Lane] = (float)ParentRotation.W;
+		}
+
+		FPacket& Packet = Packets[Avatar.FirstPacket + PacketIndex];
+		Packet.RootX = Lanes(RootX);
+		Packet.RootY = Lanes(RootY);
+		Packet.RootZ = Lanes(RootZ);
+		Packet.ParentQX = Lanes(ParentQX);
+		Packet.ParentQY = Lanes(ParentQY);
+		Packet.ParentQZ = Lanes(ParentQZ);
+		Packet.ParentQW = Lanes(ParentQW);
+		Packet.Scale = VectorSetFloat1(WorldScale);
+	}
+
+	const int32 NumColliders = Avatar.Setup.Colliders.Num();
+	Avatar.ColliderHeads.SetNumUninitialized(NumColliders);
+	Avatar.ColliderTails.SetNumUninitialized(NumColliders);
+	Avatar.ColliderRadii.SetNumUninitialized(NumColliders);
+	for (int32 ColliderIndex = 0; ColliderIndex < NumColliders; ++ColliderIndex)
+	{
+		const FGVRMSpringBoneColliderSetup& Collider = Avatar.Setup.Colliders[ColliderIndex];
+		const FTransform BoneToWorld = ComponentSpaceTransforms[Collider.Bone] * ComponentToWorld;
+		Avatar.ColliderHeads[ColliderIndex] = FVector3f(BoneToWorld.TransformPosition(FVector(Collider.Offset)));
+		Avatar.ColliderTails[ColliderIndex] = FVector3f(BoneToWorld.TransformPosition(FVector(Collider.Tail)));
+		Avatar.ColliderRadii[ColliderIndex] = Collider.Radius * WorldScale;
+	}
+
+	if (Avatar.bNeedsReset)
+	{
+		ResetToPose(Avatar, ComponentSpaceTransforms);
+		Avatar.bNeedsReset = false;
+	}
+	Avatar.bHasPose = true;
+}
+
+void FGVRMSpringBoneSolver::ResetToPose(FAvatar& Avatar, TConstArrayView<FTransform> ComponentSpaceTransforms)
+{
+	using namespace GVRMSpringBoneMath;
+
+	const FTransform& ComponentToWorld = Avatar.ComponentToWorld;
+	int32 LaneIndex = 0;
+	for (int32 PacketIndex = Avatar.FirstPacket; PacketIndex < Avatar.FirstPacket + Avatar.NumPackets; ++PacketIndex)
+	{
+		const FPacket& Packet = Packets[PacketIndex];
+		for (int32 Depth = 0; Depth < Packet.NumDepths; ++Depth, LaneIndex += 4)
+		{
+			float TailX[4] = {}, TailY[4] = {}, TailZ[4] = {};
+			float QX[4] = {}, QY[4] = {}, QZ[4] = {}, QW[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const int32 Bone = Avatar.LaneBones[LaneIndex + Lane];
+				if (Bone == INDEX_NONE)
+				{
+					continue;
+				}
+
+				const FVector Tail = ComponentToWorld.TransformPosition(ComponentSpaceTransforms[Avatar.LaneTailBones[LaneIndex + Lane]].GetTranslation());
+				const FQuat Rotation = ComponentToWorld.GetRotation() * ComponentSpaceTransforms[Bone].GetRotation();
+				TailX[Lane] = (float)Tail.X;
+				TailY[Lane] = (float)Tail.Y;
+				TailZ[Lane] = (float)Tail.Z;
+				QX[Lane] = (float)Rotation.X;
+				QY[Lane] = (float)Rotation.Y;
+				QZ[Lane] = (float)Rotation.Z;
+				QW[Lane] = (float)Rotation.W;
+			}
+
+			FJointLanes& Joint = Joints[Packet.FirstJoint + Depth];
+			Joint.TailX = Joint.PrevTailX = Lanes(TailX);
+			Joint.TailY = Joint.PrevTailY = Lanes(TailY);
+			Joint.TailZ = Joint.PrevTailZ = Lanes(TailZ);
+			Joint.QX = Joint.PrevQX = Lanes(QX);
+			Joint.QY = Joint.PrevQY = Lanes(QY);
+			Joint.QZ = Joint.PrevQZ = Lanes(QZ);
+			Joint.QW = Joint.PrevQW = Lanes(QW);
+		}
+	}
+
+	// The animated pose is a valid result until the first step
+	Avatar.bHasResult = true;
+}
+
+// ============================================================================
+// Step
+// ============================================================================
+
+void FGVRMSpringBoneSolver::Step(float DeltaTime)
+{
+	if (DeltaTime <= 0.0f)
+	{
+		return;
+	}
+	if (bLayoutDirty)
+	{
+		RebuildLayout();
+	}
+
+	// Packets only read their own avatar, so any split gives the same result
+	ParallelFor(Packets.Num(), [this, DeltaTime](int32 PacketIndex)
+	{
+		FPacket& Packet = Packets[PacketIndex];
+		const FAvatar& Avatar = Avatars[Packet.Avatar];
+		if (Avatar.bHasPose)
+		{
+			StepPacket(Packet, Avatar, DeltaTime);
+		}
+	}, Packets.Num() > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FGVRMSpringBoneSolver::StepPacket(FPacket& Packet, const FAvatar& Avatar, float DeltaTime)
+{
+	using namespace GVRMSpringBoneMath;
+
+	// VRM forces are in meters per second; everything here is world space cm
+	const FVec StepScale = VectorMultiply(VectorSetFloat1(DeltaTime * VRMUnitScale), Packet.Scale);
+	const FVec StiffnessStep = VectorMultiply(Packet.Stiffness, StepScale);
+	const FVec3 GravityStep = { VectorMultiply(Packet.GravityX, StepScale), VectorMultiply(Packet.GravityY, StepScale), VectorMultiply(Packet.GravityZ, StepScale) };
+	const FVec HitRadius = VectorMultiply(Packet.HitRadius, Packet.Scale);
+
+	FVec3 Head = { Packet.RootX, Packet.RootY, Packet.RootZ };
+	FQuat4 ParentRotation = { Packet.ParentQX, Packet.ParentQY, Packet.ParentQZ, Packet.ParentQW };
+
+	for (int32 Depth = 0; Depth < Packet.NumDepths; ++Depth)
+	{
+		FJointLanes& Joint = Joints[Packet.FirstJoint + Depth];
+
+		// Direction the joint would point in with its rest local rotation under the current parent
+		const FQuat4 RestRotation = Multiply(ParentRotation, { Joint.RestQX, Joint.RestQY, Joint.RestQZ, Joint.RestQW });
+		const FVec3 RestDirection = Rotate(RestRotation, { Joint.AxisX, Joint.AxisY, Joint.AxisZ });
+		const FVec Length = VectorMultiply(Joint.Length, Packet.Scale);
+
+		const FVec3 Tail = { Joint.TailX, Joint.TailY, Joint.TailZ };
+		const FVec3 PrevTail = { Joint.PrevTailX, Joint.PrevTailY, Joint.PrevTailZ };
+
+		// Verlet: inertia with drag, stiffness towards the rest direction, gravity
+		FVec3 Next = MulAdd(Sub(Tail, PrevTail), Packet.Inertia, Tail);
+		Next = MulAdd(RestDirection, StiffnessStep, Next);
+		Next = Add(Next, GravityStep);
+		Next = ConstrainLength(Head, Next, Length);
+
+		for (int32 Index = 0; Index < Packet.NumColliders; ++Index)
+		{
+			const FPacketCollider& PacketCollider = PacketColliders[Packet.FirstCollider + Index];
+			const int32 ColliderIndex = PacketCollider.Collider;
+			const FVector3f& ColliderHead = Avatar.ColliderHeads[ColliderIndex];
+
+			FVec3 Center = { VectorSetFloat1(ColliderHead.X), VectorSetFloat1(ColliderHead.Y), VectorSetFloat1(ColliderHead.Z) };
+			if (Avatar.Setup.Colliders[ColliderIndex].bCapsule)
+			{
+				// Closest point of the capsule segment
+				const FVector3f Segment = Avatar.ColliderTails[ColliderIndex] - ColliderHead;
+				const float InvSegmentSizeSquared = 1.0f / FMath::Max(Segment.SizeSquared(), UE_SMALL_NUMBER);
+				const FVec3 SegmentVec = { VectorSetFloat1(Segment.X), VectorSetFloat1(Segment.Y), VectorSetFloat1(Segment.Z) };
+				FVec T = VectorMultiply(Dot(Sub(Next, Center), SegmentVec), VectorSetFloat1(InvSegmentSizeSquared));
+				T = VectorMin(VectorMax(T, VectorZeroFloat()), VectorOneFloat());
+				Center = MulAdd(SegmentVec, T, Center);
+			}
+
+			const FVec3 Delta = Sub(Next, Center);
+			const FVec Radius = VectorAdd(HitRadius, VectorSetFloat1(Avatar.ColliderRadii[ColliderIndex]));
+			const FVec Inside = VectorBitwiseAnd(VectorCompareLT(Dot(Delta, Delta), VectorMultiply(Radius, Radius)), PacketCollider.LaneMask);
+			if (VectorMaskBits(Inside))
+			{
+				Next = Select(Inside, MulAdd(Delta, VectorMultiply(Radius, InvLength(Delta)), Center), Next);
+			}
+		}
+		Next = ConstrainLength(Head, Next, Length);
+
+		// Swing the rest rotation onto the new direction
+		const FVec3 Direction = Sub(Next, Head);
+		const FVec InvDirectionLength = InvLength(Direction);
+		const FVec3 UnitDirection = { VectorMultiply(Direction.X, InvDirectionLength), VectorMultiply(Direction.Y, InvDirectionLength), VectorMultiply(Direction.Z, InvDirectionLength) };
+		const FQuat4 Rotation = Multiply(FromTo(RestDirection, UnitDirection), RestRotation);
+
+		const FVec3 NewPrevTail = Select(Joint.Active, Tail, PrevTail);
+		const FVec3 NewTail = Select(Joint.Active, Next, Tail);
+		Joint.PrevTailX = NewPrevTail.X;
+		Joint.PrevTailY = NewPrevTail.Y;
+		Joint.PrevTailZ = NewPrevTail.Z;
+		Joint.TailX = NewTail.X;
+		Joint.TailY = NewTail.Y;
+		Joint.TailZ = NewTail.Z;
+		Joint.PrevQX = Joint.QX;
+		Joint.PrevQY = Joint.QY;
+		Joint.PrevQZ = Joint.QZ;
+		Joint.PrevQW = Joint.QW;
+		Joint.QX = Rotation.X;
+		Joint.QY = Rotation.Y;
+		Joint.QZ = Rotation.Z;
+		Joint.QW = Rotation.W;
+
+		Head = NewTail;
+		ParentRotation = Rotation;
+	}
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+bool FGVRMSpringBoneSolver::ApplyToPose(int32 AvatarId, TArrayView<FTransform> ComponentSpaceTransforms) const
+{
+	// A pending layout change leaves laid out avatars where they are; new ones have no result yet
+	if (!Avatars.IsValidIndex(AvatarId))
+	{
+		return false;
+	}
+
+	const FAvatar& Avatar = Avatars[AvatarId];
+	if (!Avatar.bLive || !Avatar.bHasResult || ComponentSpaceTransforms.Num() < Avatar.Setup.ParentBones.Num())
+	{
+		return false;
+	}
+
+	const FQuat WorldToComponentRotation = Avatar.ComponentToWorld.GetRotation().Inverse();
+	int32 LaneIndex = 0;
+	for (int32 PacketIndex = 0; PacketIndex < Avatar.NumPackets; ++PacketIndex)
+	{
+		const FPacket& Packet = Packets[Avatar.FirstPacket + PacketIndex];
+
+		// Recompose each chain root to tip: animated local transforms under the moved parents, solved rotations
+		FTransform OldParents[4];
+		FTransform NewParents[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const int32 ParentBone = Avatar.LaneRootParents[PacketIndex * 4 + Lane];
+			OldParents[Lane] = NewParents[Lane] = ParentBone != INDEX_NONE ? ComponentSpaceTransforms[ParentBone] : FTransform::Identity;
+		}
+
+		for (int32 Depth = 0; Depth < Packet.NumDepths; ++Depth, LaneIndex += 4)
+		{
+			const FJointLanes& Joint = Joints[Packet.FirstJoint + Depth];
+			alignas(16) float QX[4], QY[4], QZ[4], QW[4];
+			alignas(16) float PrevQX[4], PrevQY[4], PrevQZ[4], PrevQW[4];
+			VectorStoreAligned(Joint.QX, QX);
+			VectorStoreAligned(Joint.QY, QY);
+			VectorStoreAligned(Joint.QZ, QZ);
+			VectorStoreAligned(Joint.QW, QW);
+			VectorStoreAligned(Joint.PrevQX, PrevQX);
+			VectorStoreAligned(Joint.PrevQY, PrevQY);
+			VectorStoreAligned(Joint.PrevQZ, PrevQZ);
+			VectorStoreAligned(Joint.PrevQW, PrevQW);
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const int32 Bone = Avatar.LaneBones[LaneIndex + Lane];
+				if (Bone == INDEX_NONE)
+				{
+					continue;
+				}
+
+				FQuat Rotation(QX[Lane], QY[Lane], QZ[Lane], QW[Lane]);
+				if (ResultAlpha < 1.0f)
+				{
+					Rotation = FQuat::Slerp(FQuat(PrevQX[Lane], PrevQY[Lane], PrevQZ[Lane], PrevQW[Lane]), Rotation, ResultAlpha);
+				}
+
+				const FTransform OldBone = ComponentSpaceTransforms[Bone];
+				FTransform NewBone = OldBone.GetRelativeTransform(OldParents[Lane]) * NewParents[Lane];
+				NewBone.SetRotation((WorldToComponentRotation * Rotation).GetNormalized());
+				ComponentSpaceTransforms[Bone] = NewBone;
+
+				// Last simulated joint of the lane: its tail bone follows
+				const bool bLastJoint = Depth + 1 == Packet.NumDepths || Avatar.LaneBones[LaneIndex + 4 + Lane] == INDEX_NONE;
+				if (bLastJoint)
+				{
+					const int32 TailBone = Avatar.LaneTailBones[LaneIndex + Lane];
+					ComponentSpaceTransforms[TailBone] = ComponentSpaceTransforms[TailBone].GetRelativeTransform(OldBone) * NewBone;
+				}
+
+				OldParents[Lane] = OldBone;
+				NewParents[Lane] = NewBone;
+			}
+		}
+	}
+
+	return true;
+}
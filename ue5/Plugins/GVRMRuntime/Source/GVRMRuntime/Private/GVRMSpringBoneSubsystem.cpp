@@ -0,0 +1,249 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMSpringBoneSubsystem.h"
+#include "GVRMSkinningData.h"
+#include "GVRMStats.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarGVRMSpringBonesFixedTimeStep(
+	TEXT("GVRM.SpringBones.FixedTimeStep"),
+	1.0f / 60.0f,
+	TEXT("Seconds per spring bone step (0 = one step of the frame time). Fixed steps make the result independent of the frame rate."));
+
+static TAutoConsoleVariable<int32> CVarGVRMSpringBonesMaxSubsteps(
+	TEXT("GVRM.SpringBones.MaxSubsteps"),
+	3,
+	TEXT("Most fixed spring bone steps per frame; time beyond them is dropped."));
+
+static TAutoConsoleVariable<int32> CVarGVRMSpringBonesMaxJointSteps(
+	TEXT("GVRM.SpringBones.MaxJointSteps"),
+	65536,
+	TEXT("Joint solves per frame over all avatars (0 = no limit). Fewer substeps run when the avatars need more; one always does."));
+
+static TAutoConsoleVariable<float> CVarGVRMSpringBonesResetDistance(
+	TEXT("GVRM.SpringBones.ResetDistance"),
+	100.0f,
+	TEXT("World distance (cm) a skeletal mesh may move in one frame before its spring chains restart from the pose instead of swinging after it (0 = never)."));
+
+/** Longest frame simulated in one variable step (hitches would launch the chains) */
+static constexpr float GVRMSpringBonesMaxVariableStep = 0.1f;
+
+void FGVRMSpringBoneTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Subsystem->Tick(DeltaTime);
+	}
+}
+
+FString FGVRMSpringBoneTickFunction::DiagnosticMessage()
+{
+	return TEXT("UGVRMSpringBoneSubsystem::Tick");
+}
+
+UGVRMSpringBoneSubsystem* UGVRMSpringBoneSubsystem::Find(const USkeletalMeshComponent* SkeletalMeshComponent)
+{
+	UWorld* World = SkeletalMeshComponent ? SkeletalMeshComponent->GetWorld() : nullptr;
+	UGVRMSpringBoneSubsystem* Subsystem = World ? World->GetSubsystem<UGVRMSpringBoneSubsystem>() : nullptr;
+	return Subsystem && Subsystem->IsRegistered(SkeletalMeshComponent) ? Subsystem : nullptr;
+}
+
+void UGVRMSpringBoneSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TickFunction.Subsystem = this;
+	TickFunction.TickGroup = TG_PostUpdateWork;
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = true;
+	TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UGVRMSpringBoneSubsystem::Deinitialize()
+{
+	WaitForResultReaders();
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+	TickFunction.Subsystem = nullptr;
+
+	AvatarIds.Reset();
+	Avatars.Reset();
+	Solver = FGVRMSpringBoneSolver();
+
+	Super::Deinitialize();
+}
+
+bool UGVRMSpringBoneSubsystem::RegisterAvatar(USkeletalMeshComponent* SkeletalMeshComponent, const UGVRMBindingData* BindingData, FString& OutErrorMessage)
+{
+	if (!SkeletalMeshComponent || !SkeletalMeshComponent->SkeletalMesh || !BindingData)
+	{
+		OutErrorMessage = TEXT("Skeletal mesh or binding data is missing");
+		return false;
+	}
+
+	UnregisterAvatar(SkeletalMeshComponent);
+	WaitForResultReaders();
+
+	FGVRMSpringBoneAvatarSetup Setup;
+	if (!FGVRMSpringBoneAvatarSetup::Build(*BindingData, SkeletalMeshComponent->SkeletalMesh->GetRefSkeleton(), Setup, OutErrorMessage))
+	{
+		return false;
+	}
+
+	const int32 NumChains = Setup.Chains.Num();
+	const int32 NumJoints = Setup.GetNumJoints();
+	const int32 AvatarId = Solver.AddAvatar(MoveTemp(Setup));
+	AvatarIds.Add(SkeletalMeshComponent, AvatarId);
+	Avatars.Add({ SkeletalMeshComponent, AvatarId });
+
+	// Solve once the mesh has its final pose for the frame
+	TickFunction.AddPrerequisite(SkeletalMeshComponent, SkeletalMeshComponent->PrimaryComponentTick);
+
+	UE_LOG(LogTemp, Log, TEXT("GVRM - %s: %d spring chains (%d joints)"),
+		*GetNameSafe(SkeletalMeshComponent->GetOwner()), NumChains, NumJoints);
+	return true;
+}
+
+void UGVRMSpringBoneSubsystem::UnregisterAvatar(USkeletalMeshComponent* SkeletalMeshComponent)
+{
+	int32 AvatarId = INDEX_NONE;
+	if (!SkeletalMeshComponent || !AvatarIds.RemoveAndCopyValue(SkeletalMeshComponent, AvatarId))
+	{
+		return;
+	}
+
+	TickFunction.RemovePrerequisite(SkeletalMeshComponent, SkeletalMeshComponent->PrimaryComponentTick);
+	WaitForResultReaders();
+	RemoveAvatar(AvatarId);
+}
+
+void UGVRMSpringBoneSubsystem::RemoveAvatar(int32 AvatarId)
+{
+	Solver.RemoveAvatar(AvatarId);
+	Avatars.RemoveAllSwap([AvatarId](const FRegisteredAvatar& Avatar) { return Avatar.AvatarId == AvatarId; });
+}
+
+void UGVRMSpringBoneSubsystem::ResetAvatar(const USkeletalMeshComponent* SkeletalMeshComponent)
+{
+	if (const int32* AvatarId = AvatarIds.Find(SkeletalMeshComponent))
+	{
+		WaitForResultReaders();
+		Solver.ResetAvatar(*AvatarId);
+	}
+}
+
+bool UGVRMSpringBoneSubsystem::IsRegistered(const USkeletalMeshComponent* SkeletalMeshComponent) const
+{
+	return SkeletalMeshComponent && AvatarIds.Contains(SkeletalMeshComponent);
+}
+
+bool UGVRMSpringBoneSubsystem::ApplyToPose(const USkeletalMeshComponent* SkeletalMeshComponent, TArrayView<FTransform> ComponentSpaceTransforms) const
+{
+	const int32* AvatarId = AvatarIds.Find(SkeletalMeshComponent);
+	return AvatarId && Solver.ApplyToPose(*AvatarId, ComponentSpaceTransforms);
+}
+
+void UGVRMSpringBoneSubsystem::AddResultReader(const UE::Tasks::FTask& Task)
+{
+	check(IsInGameThread());
+
+	// Finished readers are dropped here so the list stays as long as the readers in flight
+	ResultReaders.RemoveAllSwap([](const UE::Tasks::FTask& Reader) { return Reader.IsCompleted(); });
+	ResultReaders.Add(Task);
+}
+
+void UGVRMSpringBoneSubsystem::WaitForResultReaders()
+{
+	UE::Tasks::Wait(ResultReaders);
+	ResultReaders.Reset();
+}
+
+void UGVRMSpringBoneSubsystem::Tick(float DeltaTime)
+{
+	WaitForResultReaders();
+	Solve(DeltaTime);
+	SolvedDelegate.Broadcast();
+}
+
+void UGVRMSpringBoneSubsystem::Solve(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_SpringBoneSolve);
+
+	// Poses of this frame; avatars whose component is gone or hidden from ticking are not stepped
+	Solver.ClearPoses();
+	const float ResetDistance = CVarGVRMSpringBonesResetDistance.GetValueOnGameThread();
+	for (int32 Index = Avatars.Num() - 1; Index >= 0; --Index)
+	{
+		FRegisteredAvatar& Avatar = Avatars[Index];
+		const USkeletalMeshComponent* SkeletalMeshComponent = Avatar.Component.Get();
+		if (!SkeletalMeshComponent)
+		{
+			// Destroyed without unregistering
+			const int32 AvatarId = Avatar.AvatarId;
+			for (auto It = AvatarIds.CreateIterator(); It; ++It)
+			{
+				if (It.Value() == AvatarId)
+				{
+					It.RemoveCurrent();
+				}
+			}
+			RemoveAvatar(AvatarId);
+			continue;
+		}
+
+		if (SkeletalMeshComponent->IsRegistered() && SkeletalMeshComponent->GetComponentSpaceTransforms().Num() > 0)
+		{
+			// Moves no step could follow (teleports that did not say so) restart the chains
+			const FVector Location = SkeletalMeshComponent->GetComponentLocation();
+			if (Avatar.bHasLocation && ResetDistance > 0.0f && FVector::DistSquared(Location, Avatar.LastLocation) > FMath::Square(ResetDistance))
+			{
+				Solver.ResetAvatar(Avatar.AvatarId);
+			}
+			Avatar.LastLocation = Location;
+			Avatar.bHasLocation = true;
+
+			Solver.SetPose(Avatar.AvatarId, SkeletalMeshComponent->GetComponentTransform(), SkeletalMeshComponent->GetComponentSpaceTransforms());
+		}
+	}
+
+	SET_DWORD_STAT(STAT_GVRM_SpringBoneJoints, Solver.GetNumJoints());
+	if (Solver.GetNumJoints() == 0)
+	{
+		return;
+	}
+
+	const float FixedTimeStep = CVarGVRMSpringBonesFixedTimeStep.GetValueOnGameThread();
+	if (FixedTimeStep <= 0.0f)
+	{
+		Solver.Step(FMath::Min(DeltaTime, GVRMSpringBonesMaxVariableStep));
+		Solver.SetResultAlpha(1.0f);
+		return;
+	}
+
+	const int32 MaxJointSteps = CVarGVRMSpringBonesMaxJointSteps.GetValueOnGameThread();
+	int32 MaxSteps = FMath::Max(CVarGVRMSpringBonesMaxSubsteps.GetValueOnGameThread(), 1);
+	if (MaxJointSteps > 0)
+	{
+		MaxSteps = FMath::Clamp(MaxJointSteps / Solver.GetNumJoints(), 1, MaxSteps);
+	}
+
+	AccumulatedTime += DeltaTime;
+	const int32 NumSteps = FMath::Min(FMath::FloorToInt(AccumulatedTime / FixedTimeStep), MaxSteps);
+	for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex)
+	{
+		Solver.Step(FixedTimeStep);
+	}
+
+	// Past the step limit the simulation slows down instead of catching up
+	AccumulatedTime = FMath::Min(AccumulatedTime - NumSteps * FixedTimeStep, FixedTimeStep);
+
+	// Frames above the step rate (and the ones between steps) blend the last two
+	// steps by the time left over, instead of holding the last one
+	Solver.SetResultAlpha(AccumulatedTime / FixedTimeStep);
+}
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * GVRM stat group ("stat GVRM").
+ * Covers both splat paths so their per-frame cost can be compared directly.
+ */
+DECLARE_STATS_GROUP(TEXT("GVRM"), STATGROUP_GVRM, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("NDI Update Cache"), STAT_GVRM_NDIUpdateCache, STATGROUP_GVRM, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("NDI Render Upload"), STAT_GVRM_NDIRenderUpload, STATGROUP_GVRM, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Splat Component Update"), STAT_GVRM_SplatComponentUpdate, STATGROUP_GVRM, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Splat Component Render Upload"), STAT_GVRM_SplatComponentRenderUpload, STATGROUP_GVRM, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Splat Component Render Setup"), STAT_GVRM_SplatComponentRenderSetup, STATGROUP_GVRM, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Splat Chunk Decode"), STAT_GVRM_SplatChunkDecode, STATGROUP_GVRM, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spring Bone Solve"), STAT_GVRM_SpringBoneSolve, STATGROUP_GVRM, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Splat Bounds"), STAT_GVRM_SplatBounds, STATGROUP_GVRM, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Dropped Bone Palettes"), STAT_GVRM_DroppedBonePalettes, STATGROUP_GVRM, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Late Bone Palettes"), STAT_GVRM_LateBonePalettes, STATGROUP_GVRM, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Avatars"), STAT_GVRM_BatchedAvatars, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Splats"), STAT_GVRM_BatchedSplats, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rigid Skinned Splats"), STAT_GVRM_RigidSplats, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shared Skinned Vertices"), STAT_GVRM_SharedVertices, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Morph Deltas"), STAT_GVRM_ActiveMorphDeltas, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Drawn Splats"), STAT_GVRM_DrawnSplats, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Backface Culled Splats"), STAT_GVRM_BackfaceCulledSplats, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sub-pixel Culled Splats"), STAT_GVRM_SubpixelCulledSplats, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Frustum Culled Splats"), STAT_GVRM_FrustumCulledSplats, STATGROUP_GVRM, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spring Bone Joints"), STAT_GVRM_SpringBoneJoints, STATGROUP_GVRM, );
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("GPU Buffers"), STAT_GVRM_GPUBufferMemory, STATGROUP_GVRM, );
+
+/**
+ * LLM tags ("-llm", "stat LLM"): GVRM with one child per kind of data.
+ * RHI buffers created through GVRMRender are tagged RenderData.
+ */
+LLM_DECLARE_TAG(GVRM);
+LLM_DECLARE_TAG(GVRM_BindingData);
+LLM_DECLARE_TAG(GVRM_AnimationCache);
+LLM_DECLARE_TAG(GVRM_MeshCache);
+LLM_DECLARE_TAG(GVRM_RenderData);
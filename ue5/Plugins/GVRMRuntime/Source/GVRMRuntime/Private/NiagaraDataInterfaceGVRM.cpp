@@ -2,6 +2,10 @@
 // Licensed under the MIT License.
 
 #include "NiagaraDataInterfaceGVRM.h"
+#include "GVRMRenderUtils.h"
+#include "GVRMStats.h"
+#include "GVRMMemoryReport.h"
+#include "GVRMSpringBoneSubsystem.h"
 #include "NiagaraShader.h"
 #include "NiagaraSystemInstance.h"
 #include "NiagaraRenderer.h"
@@ -10,18 +14,32 @@
 #include "RenderGraphUtils.h"
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Animation/MorphTarget.h"
+#include "GVRMSplatShaders.h"
+#include "DataDrivenShaderPlatformInfo.h"
+#include "Async/ParallelFor.h"
+#if WITH_EDITORONLY_DATA
+#include "NiagaraCompileHashVisitor.h"
+#endif
 
 // Function name constants
 const FName UNiagaraDataInterfaceGVRM::GetVertexPositionName(TEXT("GetVertexPosition"));
 const FName UNiagaraDataInterfaceGVRM::GetVertexNormalName(TEXT("GetVertexNormal"));
 const FName UNiagaraDataInterfaceGVRM::GetVertexBoneIndicesName(TEXT("GetVertexBoneIndices"));
 const FName UNiagaraDataInterfaceGVRM::GetVertexBoneWeightsName(TEXT("GetVertexBoneWeights"));
+const FName UNiagaraDataInterfaceGVRM::GetVertexExtraBoneIndicesName(TEXT("GetVertexExtraBoneIndices"));
+const FName UNiagaraDataInterfaceGVRM::GetVertexExtraBoneWeightsName(TEXT("GetVertexExtraBoneWeights"));
 const FName UNiagaraDataInterfaceGVRM::GetBoneTransformName(TEXT("GetBoneTransform"));
 const FName UNiagaraDataInterfaceGVRM::GetNumVerticesName(TEXT("GetNumVertices"));
+const FName UNiagaraDataInterfaceGVRM::GetLODVertexRemapName(TEXT("GetLODVertexRemap"));
+const FName UNiagaraDataInterfaceGVRM::GetCurrentLODName(TEXT("GetCurrentLOD"));
+const FName UNiagaraDataInterfaceGVRM::GetSkinningModeName(TEXT("GetSkinningMode"));
+const FName UNiagaraDataInterfaceGVRM::GetRigidSplatBindingName(TEXT("GetRigidSplatBinding"));
 
 UNiagaraDataInterfaceGVRM::UNiagaraDataInterfaceGVRM()
 	: SkeletalMeshComponent(nullptr)
 	, MaxBoneInfluences(4)
+	, BindingData(nullptr)
 {
 }
 
@@ -78,6 +96,33 @@ void UNiagaraDataInterfaceGVRM::GetFunctions(TArray<FNiagaraFunctionSignature>&
 		OutFunctions.Add(Sig);
 	}
 
+	// GetVertexExtraBoneIndices(int VertexIndex) -> int4 (influences 4 to 7, bone 0 unless MaxBoneInfluences is above 4)
+	{
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetVertexExtraBoneIndicesName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("GVRM")));
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("VertexIndex")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("BoneIndex4")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("BoneIndex5")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("BoneIndex6")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("BoneIndex7")));
+		OutFunctions.Add(Sig);
+	}
+
+	// GetVertexExtraBoneWeights(int VertexIndex) -> float4 (influences 4 to 7, zero unless MaxBoneInfluences is above 4)
+	{
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetVertexExtraBoneWeightsName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("GVRM")));
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("VertexIndex")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec4Def(), TEXT("Weights")));
+		OutFunctions.Add(Sig);
+	}
+
 	// GetBoneTransform(int BoneIndex) -> float4x4
 	{
 		FNiagaraFunctionSignature Sig;
@@ -100,10 +145,69 @@ void UNiagaraDataInterfaceGVRM::GetFunctions(TArray<FNiagaraFunctionSignature>&
 		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("NumVertices")));
 		OutFunctions.Add(Sig);
 	}
+
+	// GetLODVertexRemap(int VertexIndex) -> int3, float3, float3
+	{
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetLODVertexRemapName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("GVRM")));
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("VertexIndex")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("LODVertexIndex0")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("LODVertexIndex1")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("LODVertexIndex2")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("BarycentricWeights")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("OffsetCorrection")));
+		OutFunctions.Add(Sig);
+	}
+
+	// GetCurrentLOD() -> int
+	{
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetCurrentLODName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("GVRM")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("LODIndex")));
+		OutFunctions.Add(Sig);
+	}
+
+	// GetSkinningMode() -> int (EGVRMSkinningMode)
+	{
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetSkinningModeName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("GVRM")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SkinningMode")));
+		OutFunctions.Add(Sig);
+	}
+
+	// GetRigidSplatBinding(int SplatIndex) -> float3, int, int, float
+	{
+		FNiagaraFunctionSignature Sig;
+		Sig.Name = GetRigidSplatBindingName;
+		Sig.bMemberFunction = true;
+		Sig.bRequiresContext = false;
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition(GetClass()), TEXT("GVRM")));
+		Sig.Inputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SplatIndex")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetVec3Def(), TEXT("HostPosition")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("PrimaryBone")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), TEXT("SecondaryBone")));
+		Sig.Outputs.Add(FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), TEXT("SecondaryWeight")));
+		OutFunctions.Add(Sig);
+	}
 }
 
 void UNiagaraDataInterfaceGVRM::GetVMExternalFunction(const FVMExternalFunctionBindingInfo& BindingInfo, void* InstanceData, FVMExternalFunction& OutFunc)
 {
+	// Only CPU scripts bind VM functions; their mesh stream reads need the CPU copies
+	if (InstanceData)
+	{
+		static_cast<FNiagaraDataInterfaceGVRMInstanceData*>(InstanceData)->bUsedByCPUScripts = true;
+	}
+
 	if (BindingInfo.Name == GetVertexPositionName)
 	{
 		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetVertexPosition);
@@ -120,6 +224,14 @@ void UNiagaraDataInterfaceGVRM::GetVMExternalFunction(const FVMExternalFunctionB
 	{
 		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetVertexBoneWeights);
 	}
+	else if (BindingInfo.Name == GetVertexExtraBoneIndicesName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetVertexExtraBoneIndices);
+	}
+	else if (BindingInfo.Name == GetVertexExtraBoneWeightsName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetVertexExtraBoneWeights);
+	}
 	else if (BindingInfo.Name == GetBoneTransformName)
 	{
 		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetBoneTransform);
@@ -128,6 +240,22 @@ void UNiagaraDataInterfaceGVRM::GetVMExternalFunction(const FVMExternalFunctionB
 	{
 		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetNumVertices);
 	}
+	else if (BindingInfo.Name == GetLODVertexRemapName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetLODVertexRemap);
+	}
+	else if (BindingInfo.Name == GetCurrentLODName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetCurrentLOD);
+	}
+	else if (BindingInfo.Name == GetSkinningModeName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetSkinningMode);
+	}
+	else if (BindingInfo.Name == GetRigidSplatBindingName)
+	{
+		OutFunc = FVMExternalFunction::CreateUObject(this, &UNiagaraDataInterfaceGVRM::VMGetRigidSplatBinding);
+	}
 }
 
 bool UNiagaraDataInterfaceGVRM::Equals(const UNiagaraDataInterface* Other) const
@@ -139,7 +267,10 @@ bool UNiagaraDataInterfaceGVRM::Equals(const UNiagaraDataInterface* Other) const
 
 	const UNiagaraDataInterfaceGVRM* OtherTyped = CastChecked<const UNiagaraDataInterfaceGVRM>(Other);
 	return OtherTyped->SkeletalMeshComponent == SkeletalMeshComponent
-		&& OtherTyped->MaxBoneInfluences == MaxBoneInfluences;
+		&& OtherTyped->MaxBoneInfluences == MaxBoneInfluences
+		&& OtherTyped->BindingData == BindingData
+		&& OtherTyped->SkinningMode == SkinningMode
+		&& OtherTyped->bBindEngineMeshBuffers == bBindEngineMeshBuffers;
 }
 
 bool UNiagaraDataInterfaceGVRM::CopyToInternal(UNiagaraDataInterface* Destination) const
@@ -152,34 +283,85 @@ bool UNiagaraDataInterfaceGVRM::CopyToInternal(UNiagaraDataInterface* Destinatio
 	UNiagaraDataInterfaceGVRM* DestTyped = CastChecked<UNiagaraDataInterfaceGVRM>(Destination);
 	DestTyped->SkeletalMeshComponent = SkeletalMeshComponent;
 	DestTyped->MaxBoneInfluences = MaxBoneInfluences;
+	DestTyped->BindingData = BindingData;
+	DestTyped->SkinningMode = SkinningMode;
+	DestTyped->bBindEngineMeshBuffers = bBindEngineMeshBuffers;
 	return true;
 }
 
+EGVRMSkinningMode UNiagaraDataInterfaceGVRM::GetEffectiveSkinningMode() const
+{
+	return BindingData && BindingData->SupportsSkinningMode(SkinningMode, this) ? SkinningMode : EGVRMSkinningMode::LinearBlend;
+}
+
+bool UNiagaraDataInterfaceGVRM::ShouldBindEngineMeshBuffers() const
+{
+	// Skeletal mesh vertex buffers only get SRVs where the vertex factories fetch manually
+	return bBindEngineMeshBuffers && RHISupportsManualVertexFetch(GMaxRHIShaderPlatform);
+}
+
 int32 UNiagaraDataInterfaceGVRM::PerInstanceDataSize() const
 {
 	return sizeof(FNiagaraDataInterfaceGVRMInstanceData);
 }
 
+namespace GVRMInstanceRegistry
+{
+	/** Live per-instance data, for memory reports (instances are created and destroyed off the game thread too) */
+	FCriticalSection Lock;
+	TSet<const FNiagaraDataInterfaceGVRMInstanceData*> Instances;
+}
+
 bool UNiagaraDataInterfaceGVRM::InitPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
 {
 	FNiagaraDataInterfaceGVRMInstanceData* InstanceData = new (PerInstanceData) FNiagaraDataInterfaceGVRMInstanceData();
 	InstanceData->CachedSkeletalMeshComponent = SkeletalMeshComponent;
+
+	FScopeLock Lock(&GVRMInstanceRegistry::Lock);
+	GVRMInstanceRegistry::Instances.Add(InstanceData);
 	return true;
 }
 
 void UNiagaraDataInterfaceGVRM::DestroyPerInstanceData(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance)
 {
 	FNiagaraDataInterfaceGVRMInstanceData* InstanceData = static_cast<FNiagaraDataInterfaceGVRMInstanceData*>(PerInstanceData);
+	{
+		FScopeLock Lock(&GVRMInstanceRegistry::Lock);
+		GVRMInstanceRegistry::Instances.Remove(InstanceData);
+	}
 	InstanceData->~FNiagaraDataInterfaceGVRMInstanceData();
 }
 
+void UNiagaraDataInterfaceGVRM::ForEachInstanceData(TFunctionRef<void(const FNiagaraDataInterfaceGVRMInstanceData& InstanceData)> Visitor)
+{
+	check(IsInGameThread());
+
+	FScopeLock Lock(&GVRMInstanceRegistry::Lock);
+	for (const FNiagaraDataInterfaceGVRMInstanceData* InstanceData : GVRMInstanceRegistry::Instances)
+	{
+		Visitor(*InstanceData);
+	}
+}
+
 bool UNiagaraDataInterfaceGVRM::PerInstanceTick(void* PerInstanceData, FNiagaraSystemInstance* SystemInstance, float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_NDIUpdateCache);
+
 	FNiagaraDataInterfaceGVRMInstanceData* InstanceData = static_cast<FNiagaraDataInterfaceGVRMInstanceData*>(PerInstanceData);
 
 	if (InstanceData && SkeletalMeshComponent.Get())
 	{
-		InstanceData->UpdateCache(SkeletalMeshComponent.Get(), MaxBoneInfluences);
+		// CPU emitters read the copies even when the GPU binds the engine's buffers
+		const bool bCacheVertexStreams = !ShouldBindEngineMeshBuffers() || InstanceData->bUsedByCPUScripts;
+		if (InstanceData->bCacheVertexStreams != bCacheVertexStreams)
+		{
+			InstanceData->bCacheVertexStreams = bCacheVertexStreams;
+			InstanceData->InvalidateCache();
+		}
+
+		// The pose comes from the component's finalized bone transforms, converted off the game thread
+		InstanceData->WatchPose(SkeletalMeshComponent.Get());
+		InstanceData->UpdateCacheFromCapturedPose(SkeletalMeshComponent.Get(), MaxBoneInfluences, BindingData.Get());
 		return true;
 	}
 
@@ -187,15 +369,61 @@ bool UNiagaraDataInterfaceGVRM::PerInstanceTick(void* PerInstanceData, FNiagaraS
 }
 
 #if WITH_EDITORONLY_DATA
+void UNiagaraDataInterfaceGVRM::GetCommonHLSL(FString& OutHLSL)
+{
+	// Mesh stream decoding (LoadVertexPosition, LoadVertexNormal, DecodeSkinWeights) and UnpackBoneMatrix3x4
+	OutHLSL += TEXT("#include \"/Plugin/GVRMRuntime/Private/GVRMSkinningCommon.ush\"\n");
+}
+
 void UNiagaraDataInterfaceGVRM::GetParameterDefinitionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, FString& OutHLSL)
 {
-	OutHLSL += TEXT("Buffer<float3> {ParameterName}_VertexPositions;\n");
-	OutHLSL += TEXT("Buffer<float3> {ParameterName}_VertexNormals;\n");
-	OutHLSL += TEXT("Buffer<int4> {ParameterName}_BoneIndices;\n");
-	OutHLSL += TEXT("Buffer<float4> {ParameterName}_BoneWeights;\n");
-	OutHLSL += TEXT("Buffer<float4x4> {ParameterName}_BoneMatrices;\n");
+	// Mesh streams in the engine's layouts: the skeletal mesh's own buffers, or copies (see GVRMSkinning.usf)
+	OutHLSL += TEXT("Buffer<float> {ParameterName}_VertexPositions;\n");
+	OutHLSL += TEXT("Buffer<float4> {ParameterName}_VertexTangents;\n");
+	OutHLSL += TEXT("Buffer<uint> {ParameterName}_SkinWeights;\n");
+	OutHLSL += TEXT("Buffer<uint> {ParameterName}_SkinWeightLookup;\n");
+	OutHLSL += TEXT("uint {ParameterName}_SkinWeightStride;\n");
+	OutHLSL += TEXT("uint {ParameterName}_NumSkinWeightInfluences;\n");
+	OutHLSL += TEXT("uint {ParameterName}_SkinWeightFormat;\n");
+	OutHLSL += TEXT("Buffer<int> {ParameterName}_BoneSlots;\n");
+	OutHLSL += TEXT("int {ParameterName}_NumBoneSlots;\n");
+	OutHLSL += TEXT("Buffer<float4> {ParameterName}_BoneMatrices;\n");
+	OutHLSL += TEXT("Buffer<int4> {ParameterName}_LODRemapIndices;\n");
+	OutHLSL += TEXT("Buffer<float4> {ParameterName}_LODRemapWeights;\n");
+	OutHLSL += TEXT("Buffer<float4> {ParameterName}_LODRemapOffsets;\n");
+	OutHLSL += TEXT("Buffer<float4> {ParameterName}_RigidSplatPositions;\n");
+	OutHLSL += TEXT("Buffer<int2> {ParameterName}_RigidSplatBones;\n");
+	OutHLSL += TEXT("Buffer<uint> {ParameterName}_MorphVertexSlots;\n");
+	OutHLSL += TEXT("Buffer<int> {ParameterName}_MorphOffsets;\n");
+	OutHLSL += TEXT("int {ParameterName}_NumMorphVertexSlots;\n");
 	OutHLSL += TEXT("int {ParameterName}_NumVertices;\n");
 	OutHLSL += TEXT("int {ParameterName}_NumBones;\n");
+	OutHLSL += TEXT("int {ParameterName}_LODIndex;\n");
+	OutHLSL += TEXT("int {ParameterName}_NumRemapVertices;\n");
+	OutHLSL += TEXT("int {ParameterName}_SkinningMode;\n");
+
+	// Compile-time influence count, so the decode loops unroll (part of the compile hash)
+	OutHLSL += FString::Printf(TEXT("static const uint {ParameterName}_NumInfluences = %d;\n"), GVRMSkinning::GetInfluencePermutation(MaxBoneInfluences));
+
+	// All NumInfluences influences (4 to 7 in the Extra outputs, bone 0 with zero weight below 8);
+	// bone indices are remapped to palette slots here when the streams are the engine's
+	OutHLSL += TEXT("void {ParameterName}_LoadVertexInfluences(int VertexIndex, out int4 BoneIndices, out float4 BoneWeights, out int4 ExtraBoneIndices, out float4 ExtraBoneWeights)\n{\n");
+	OutHLSL += TEXT("    DecodeSkinWeights({ParameterName}_SkinWeights, {ParameterName}_SkinWeightLookup, VertexIndex, {ParameterName}_SkinWeightStride,\n");
+	OutHLSL += TEXT("        {ParameterName}_NumSkinWeightInfluences, {ParameterName}_SkinWeightFormat, {ParameterName}_NumInfluences,\n");
+	OutHLSL += TEXT("        BoneIndices, BoneWeights, ExtraBoneIndices, ExtraBoneWeights);\n");
+	OutHLSL += TEXT("    if ({ParameterName}_NumBoneSlots > 0)\n    {\n");
+	OutHLSL += TEXT("        for (int i = 0; i < 4; i++)\n        {\n");
+	OutHLSL += TEXT("            BoneIndices[i] = BoneIndices[i] < {ParameterName}_NumBoneSlots ? {ParameterName}_BoneSlots[BoneIndices[i]] : 0;\n");
+	OutHLSL += TEXT("            ExtraBoneIndices[i] = ExtraBoneIndices[i] < {ParameterName}_NumBoneSlots ? {ParameterName}_BoneSlots[ExtraBoneIndices[i]] : 0;\n");
+	OutHLSL += TEXT("        }\n    }\n");
+	OutHLSL += TEXT("}\n");
+
+	// Summed morph target offset of an LOD0 vertex in bind space (zero without active morphs)
+	OutHLSL += TEXT("float3 {ParameterName}_LoadMorphOffset(int VertexIndex)\n{\n");
+	OutHLSL += TEXT("    if (VertexIndex < 0 || VertexIndex >= {ParameterName}_NumMorphVertexSlots)\n    {\n");
+	OutHLSL += TEXT("        return float3(0, 0, 0);\n    }\n");
+	OutHLSL += TEXT("    return LoadMorphOffset({ParameterName}_MorphOffsets, {ParameterName}_MorphVertexSlots[VertexIndex]);\n");
+	OutHLSL += TEXT("}\n");
 }
 
 bool UNiagaraDataInterfaceGVRM::GetFunctionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, const FNiagaraDataInterfaceGeneratedFunction& FunctionInfo, int FunctionInstanceIndex, FString& OutHLSL)
@@ -203,21 +431,25 @@ bool UNiagaraDataInterfaceGVRM::GetFunctionHLSL(const FNiagaraDataInterfaceGPUPa
 	if (FunctionInfo.DefinitionName == GetVertexPositionName)
 	{
 		OutHLSL += FString::Printf(TEXT("void %s(int VertexIndex, out float3 Position)\n{\n"), *FunctionInfo.InstanceName);
-		OutHLSL += FString::Printf(TEXT("    Position = {ParameterName}_VertexPositions[VertexIndex];\n"));
+		OutHLSL += TEXT("    Position = LoadVertexPosition({ParameterName}_VertexPositions, VertexIndex);\n");
 		OutHLSL += TEXT("}\n");
 		return true;
 	}
 	else if (FunctionInfo.DefinitionName == GetVertexNormalName)
 	{
 		OutHLSL += FString::Printf(TEXT("void %s(int VertexIndex, out float3 Normal)\n{\n"), *FunctionInfo.InstanceName);
-		OutHLSL += FString::Printf(TEXT("    Normal = {ParameterName}_VertexNormals[VertexIndex];\n"));
+		OutHLSL += TEXT("    Normal = LoadVertexNormal({ParameterName}_VertexTangents, VertexIndex);\n");
 		OutHLSL += TEXT("}\n");
 		return true;
 	}
 	else if (FunctionInfo.DefinitionName == GetVertexBoneIndicesName)
 	{
 		OutHLSL += FString::Printf(TEXT("void %s(int VertexIndex, out int BoneIndex0, out int BoneIndex1, out int BoneIndex2, out int BoneIndex3)\n{\n"), *FunctionInfo.InstanceName);
-		OutHLSL += FString::Printf(TEXT("    int4 Indices = {ParameterName}_BoneIndices[VertexIndex];\n"));
+		OutHLSL += TEXT("    int4 Indices;\n");
+		OutHLSL += TEXT("    float4 Weights;\n");
+		OutHLSL += TEXT("    int4 ExtraIndices;\n");
+		OutHLSL += TEXT("    float4 ExtraWeights;\n");
+		OutHLSL += TEXT("    {ParameterName}_LoadVertexInfluences(VertexIndex, Indices, Weights, ExtraIndices, ExtraWeights);\n");
 		OutHLSL += TEXT("    BoneIndex0 = Indices.x;\n");
 		OutHLSL += TEXT("    BoneIndex1 = Indices.y;\n");
 		OutHLSL += TEXT("    BoneIndex2 = Indices.z;\n");
@@ -228,14 +460,43 @@ bool UNiagaraDataInterfaceGVRM::GetFunctionHLSL(const FNiagaraDataInterfaceGPUPa
 	else if (FunctionInfo.DefinitionName == GetVertexBoneWeightsName)
 	{
 		OutHLSL += FString::Printf(TEXT("void %s(int VertexIndex, out float4 Weights)\n{\n"), *FunctionInfo.InstanceName);
-		OutHLSL += FString::Printf(TEXT("    Weights = {ParameterName}_BoneWeights[VertexIndex];\n"));
+		OutHLSL += TEXT("    int4 Indices;\n");
+		OutHLSL += TEXT("    int4 ExtraIndices;\n");
+		OutHLSL += TEXT("    float4 ExtraWeights;\n");
+		OutHLSL += TEXT("    {ParameterName}_LoadVertexInfluences(VertexIndex, Indices, Weights, ExtraIndices, ExtraWeights);\n");
+		OutHLSL += TEXT("}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetVertexExtraBoneIndicesName)
+	{
+		OutHLSL += FString::Printf(TEXT("void %s(int VertexIndex, out int BoneIndex4, out int BoneIndex5, out int BoneIndex6, out int BoneIndex7)\n{\n"), *FunctionInfo.InstanceName);
+		OutHLSL += TEXT("    int4 Indices;\n");
+		OutHLSL += TEXT("    float4 Weights;\n");
+		OutHLSL += TEXT("    int4 ExtraIndices;\n");
+		OutHLSL += TEXT("    float4 ExtraWeights;\n");
+		OutHLSL += TEXT("    {ParameterName}_LoadVertexInfluences(VertexIndex, Indices, Weights, ExtraIndices, ExtraWeights);\n");
+		OutHLSL += TEXT("    BoneIndex4 = ExtraIndices.x;\n");
+		OutHLSL += TEXT("    BoneIndex5 = ExtraIndices.y;\n");
+		OutHLSL += TEXT("    BoneIndex6 = ExtraIndices.z;\n");
+		OutHLSL += TEXT("    BoneIndex7 = ExtraIndices.w;\n");
+		OutHLSL += TEXT("}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetVertexExtraBoneWeightsName)
+	{
+		OutHLSL += FString::Printf(TEXT("void %s(int VertexIndex, out float4 Weights)\n{\n"), *FunctionInfo.InstanceName);
+		OutHLSL += TEXT("    int4 Indices;\n");
+		OutHLSL += TEXT("    float4 FirstWeights;\n");
+		OutHLSL += TEXT("    int4 ExtraIndices;\n");
+		OutHLSL += TEXT("    {ParameterName}_LoadVertexInfluences(VertexIndex, Indices, FirstWeights, ExtraIndices, Weights);\n");
 		OutHLSL += TEXT("}\n");
 		return true;
 	}
 	else if (FunctionInfo.DefinitionName == GetBoneTransformName)
 	{
 		OutHLSL += FString::Printf(TEXT("void %s(int BoneIndex, out float4x4 Transform)\n{\n"), *FunctionInfo.InstanceName);
-		OutHLSL += FString::Printf(TEXT("    Transform = {ParameterName}_BoneMatrices[BoneIndex];\n"));
+		OutHLSL += TEXT("    int Base = BoneIndex * 3;\n");
+		OutHLSL += TEXT("    Transform = UnpackBoneMatrix3x4({ParameterName}_BoneMatrices[Base + 0], {ParameterName}_BoneMatrices[Base + 1], {ParameterName}_BoneMatrices[Base + 2]);\n");
 		OutHLSL += TEXT("}\n");
 		return true;
 	}
@@ -246,9 +507,62 @@ bool UNiagaraDataInterfaceGVRM::GetFunctionHLSL(const FNiagaraDataInterfaceGPUPa
 		OutHLSL += TEXT("}\n");
 		return true;
 	}
+	else if (FunctionInfo.DefinitionName == GetLODVertexRemapName)
+	{
+		OutHLSL += FString::Printf(TEXT("void %s(int VertexIndex, out int LODVertexIndex0, out int LODVertexIndex1, out int LODVertexIndex2, out float3 BarycentricWeights, out float3 OffsetCorrection)\n{\n"), *FunctionInfo.InstanceName);
+		OutHLSL += TEXT("    int4 Indices = int4(VertexIndex, VertexIndex, VertexIndex, 0);\n");
+		OutHLSL += TEXT("    BarycentricWeights = float3(1.0, 0.0, 0.0);\n");
+		OutHLSL += TEXT("    OffsetCorrection = float3(0.0, 0.0, 0.0);\n");
+		OutHLSL += TEXT("    if (VertexIndex < {ParameterName}_NumRemapVertices)\n    {\n");
+		OutHLSL += TEXT("        Indices = {ParameterName}_LODRemapIndices[VertexIndex];\n");
+		OutHLSL += TEXT("        BarycentricWeights = {ParameterName}_LODRemapWeights[VertexIndex].xyz;\n");
+		OutHLSL += TEXT("        OffsetCorrection = {ParameterName}_LODRemapOffsets[VertexIndex].xyz;\n");
+		OutHLSL += TEXT("    }\n");
+		OutHLSL += TEXT("    LODVertexIndex0 = Indices.x;\n");
+		OutHLSL += TEXT("    LODVertexIndex1 = Indices.y;\n");
+		OutHLSL += TEXT("    LODVertexIndex2 = Indices.z;\n");
+		OutHLSL += TEXT("}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetCurrentLODName)
+	{
+		OutHLSL += FString::Printf(TEXT("void %s(out int LODIndex)\n{\n"), *FunctionInfo.InstanceName);
+		OutHLSL += TEXT("    LODIndex = {ParameterName}_LODIndex;\n");
+		OutHLSL += TEXT("}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetSkinningModeName)
+	{
+		OutHLSL += FString::Printf(TEXT("void %s(out int SkinningMode)\n{\n"), *FunctionInfo.InstanceName);
+		OutHLSL += TEXT("    SkinningMode = {ParameterName}_SkinningMode;\n");
+		OutHLSL += TEXT("}\n");
+		return true;
+	}
+	else if (FunctionInfo.DefinitionName == GetRigidSplatBindingName)
+	{
+		OutHLSL += FString::Printf(TEXT("void %s(int SplatIndex, out float3 HostPosition, out int PrimaryBone, out int SecondaryBone, out float SecondaryWeight)\n{\n"), *FunctionInfo.InstanceName);
+		OutHLSL += TEXT("    float4 Position = {ParameterName}_RigidSplatPositions[SplatIndex];\n");
+		OutHLSL += TEXT("    int2 Bones = {ParameterName}_RigidSplatBones[SplatIndex];\n");
+		OutHLSL += TEXT("    HostPosition = Position.xyz;\n");
+		OutHLSL += TEXT("    PrimaryBone = Bones.x;\n");
+		OutHLSL += TEXT("    SecondaryBone = Bones.y;\n");
+		OutHLSL += TEXT("    SecondaryWeight = Position.w;\n");
+		OutHLSL += TEXT("}\n");
+		return true;
+	}
 
 	return false;
 }
+
+bool UNiagaraDataInterfaceGVRM::AppendCompileHash(FNiagaraCompileHashVisitor* InVisitor) const
+{
+	// The generated HLSL is specialized on the influence count
+	bool bSuccess = Super::AppendCompileHash(InVisitor);
+	bSuccess &= InVisitor->UpdatePOD(TEXT("GVRMNumInfluences"), GVRMSkinning::GetInfluencePermutation(MaxBoneInfluences));
+	// Bump when the generated HLSL changes
+	bSuccess &= InVisitor->UpdatePOD(TEXT("GVRMHLSLVersion"), 3);
+	return bSuccess;
+}
 #endif
 
 // VM function implementations (CPU fallback)
@@ -263,7 +577,8 @@ void UNiagaraDataInterfaceGVRM::VMGetVertexPosition(FVectorVMExternalFunctionCon
 		const int32 VertexIndex = VertexIndexParam.GetAndAdvance();
 		FVector3f Position = FVector3f::ZeroVector;
 
-		if (InstanceData->bCacheValid && VertexIndex >= 0 && VertexIndex < InstanceData->NumVertices)
+		// Streams are not copied when the GPU binds the engine's buffers
+		if (InstanceData->bCacheValid && InstanceData->CachedVertexPositions.IsValidIndex(VertexIndex))
 		{
 			Position = InstanceData->CachedVertexPositions[VertexIndex];
 		}
@@ -283,7 +598,7 @@ void UNiagaraDataInterfaceGVRM::VMGetVertexNormal(FVectorVMExternalFunctionConte
 		const int32 VertexIndex = VertexIndexParam.GetAndAdvance();
 		FVector3f Normal = FVector3f::ZAxisVector;
 
-		if (InstanceData->bCacheValid && VertexIndex >= 0 && VertexIndex < InstanceData->NumVertices)
+		if (InstanceData->bCacheValid && InstanceData->CachedVertexNormals.IsValidIndex(VertexIndex))
 		{
 			Normal = InstanceData->CachedVertexNormals[VertexIndex];
 		}
@@ -306,7 +621,7 @@ void UNiagaraDataInterfaceGVRM::VMGetVertexBoneIndices(FVectorVMExternalFunction
 		const int32 VertexIndex = VertexIndexParam.GetAndAdvance();
 		FIntVector4 BoneIndices(0, 0, 0, 0);
 
-		if (InstanceData->bCacheValid && VertexIndex >= 0 && VertexIndex < InstanceData->NumVertices)
+		if (InstanceData->bCacheValid && InstanceData->CachedBoneIndices.IsValidIndex(VertexIndex))
 		{
 			BoneIndices = InstanceData->CachedBoneIndices[VertexIndex];
 		}
@@ -329,7 +644,7 @@ void UNiagaraDataInterfaceGVRM::VMGetVertexBoneWeights(FVectorVMExternalFunction
 		const int32 VertexIndex = VertexIndexParam.GetAndAdvance();
 		FVector4f Weights(1.0f, 0.0f, 0.0f, 0.0f);
 
-		if (InstanceData->bCacheValid && VertexIndex >= 0 && VertexIndex < InstanceData->NumVertices)
+		if (InstanceData->bCacheValid && InstanceData->CachedBoneWeights.IsValidIndex(VertexIndex))
 		{
 			Weights = InstanceData->CachedBoneWeights[VertexIndex];
 		}
@@ -338,6 +653,53 @@ void UNiagaraDataInterfaceGVRM::VMGetVertexBoneWeights(FVectorVMExternalFunction
 	}
 }
 
+void UNiagaraDataInterfaceGVRM::VMGetVertexExtraBoneIndices(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FNiagaraDataInterfaceGVRMInstanceData> InstanceData(Context);
+	FNDIInputParam<int32> VertexIndexParam(Context);
+	FNDIOutputParam<int32> OutBoneIndex4(Context);
+	FNDIOutputParam<int32> OutBoneIndex5(Context);
+	FNDIOutputParam<int32> OutBoneIndex6(Context);
+	FNDIOutputParam<int32> OutBoneIndex7(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		const int32 VertexIndex = VertexIndexParam.GetAndAdvance();
+		FIntVector4 BoneIndices(0, 0, 0, 0);
+
+		// Only cached with 8 influences
+		if (InstanceData->bCacheValid && InstanceData->CachedExtraBoneIndices.IsValidIndex(VertexIndex))
+		{
+			BoneIndices = InstanceData->CachedExtraBoneIndices[VertexIndex];
+		}
+
+		OutBoneIndex4.SetAndAdvance(BoneIndices.X);
+		OutBoneIndex5.SetAndAdvance(BoneIndices.Y);
+		OutBoneIndex6.SetAndAdvance(BoneIndices.Z);
+		OutBoneIndex7.SetAndAdvance(BoneIndices.W);
+	}
+}
+
+void UNiagaraDataInterfaceGVRM::VMGetVertexExtraBoneWeights(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FNiagaraDataInterfaceGVRMInstanceData> InstanceData(Context);
+	FNDIInputParam<int32> VertexIndexParam(Context);
+	FNDIOutputParam<FVector4f> OutWeights(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	{
+		const int32 VertexIndex = VertexIndexParam.GetAndAdvance();
+		FVector4f Weights(0.0f, 0.0f, 0.0f, 0.0f);
+
+		if (InstanceData->bCacheValid && InstanceData->CachedExtraBoneWeights.IsValidIndex(VertexIndex))
+		{
+			Weights = InstanceData->CachedExtraBoneWeights[VertexIndex];
+		}
+
+		OutWeights.SetAndAdvance(Weights);
+	}
+}
+
 void UNiagaraDataInterfaceGVRM::VMGetBoneTransform(FVectorVMExternalFunctionContext& Context)
 {
 	VectorVM::FUserPtrHandler<FNiagaraDataInterfaceGVRMInstanceData> InstanceData(Context);
@@ -369,236 +731,1079 @@ void UNiagaraDataInterfaceGVRM::VMGetNumVertices(FVectorVMExternalFunctionContex
 	}
 }
 
-// Instance data cache update implementation
-void FNiagaraDataInterfaceGVRMInstanceData::UpdateCache(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences)
+void UNiagaraDataInterfaceGVRM::VMGetLODVertexRemap(FVectorVMExternalFunctionContext& Context)
 {
-	if (!SkeletalMesh || !SkeletalMesh->SkeletalMesh)
+	VectorVM::FUserPtrHandler<FNiagaraDataInterfaceGVRMInstanceData> InstanceData(Context);
+	FNDIInputParam<int32> VertexIndexParam(Context);
+	FNDIOutputParam<int32> OutLODVertexIndex0(Context);
+	FNDIOutputParam<int32> OutLODVertexIndex1(Context);
+	FNDIOutputParam<int32> OutLODVertexIndex2(Context);
+	FNDIOutputParam<FVector3f> OutBarycentricWeights(Context);
+	FNDIOutputParam<FVector3f> OutOffsetCorrection(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		bCacheValid = false;
-		return;
+		const int32 VertexIndex = VertexIndexParam.GetAndAdvance();
+		FIntVector4 Indices(VertexIndex, VertexIndex, VertexIndex, 0);
+		FVector4f Weights(1.0f, 0.0f, 0.0f, 0.0f);
+		FVector4f Offset(0.0f, 0.0f, 0.0f, 0.0f);
+
+		if (InstanceData->bCacheValid && VertexIndex >= 0 && VertexIndex < InstanceData->NumRemapVertices)
+		{
+			Indices = InstanceData->CachedLODRemapIndices[VertexIndex];
+			Weights = InstanceData->CachedLODRemapWeights[VertexIndex];
+			Offset = InstanceData->CachedLODRemapOffsets[VertexIndex];
+		}
+
+		OutLODVertexIndex0.SetAndAdvance(Indices.X);
+		OutLODVertexIndex1.SetAndAdvance(Indices.Y);
+		OutLODVertexIndex2.SetAndAdvance(Indices.Z);
+		OutBarycentricWeights.SetAndAdvance(FVector3f(Weights.X, Weights.Y, Weights.Z));
+		OutOffsetCorrection.SetAndAdvance(FVector3f(Offset.X, Offset.Y, Offset.Z));
 	}
+}
 
-	// Check if we need to update (frame number changed)
-	const uint32 CurrentFrameNumber = GFrameNumber;
-	if (bCacheValid && CachedFrameNumber == CurrentFrameNumber)
+void UNiagaraDataInterfaceGVRM::VMGetCurrentLOD(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FNiagaraDataInterfaceGVRMInstanceData> InstanceData(Context);
+	FNDIOutputParam<int32> OutLODIndex(Context);
+
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		return; // Cache still valid for this frame
+		OutLODIndex.SetAndAdvance(FMath::Max(InstanceData->CachedLODIndex, 0));
 	}
+}
 
-	CachedFrameNumber = CurrentFrameNumber;
-	CachedSkeletalMeshComponent = SkeletalMesh;
+void UNiagaraDataInterfaceGVRM::VMGetSkinningMode(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FNiagaraDataInterfaceGVRMInstanceData> InstanceData(Context);
+	FNDIOutputParam<int32> OutSkinningMode(Context);
 
-	// Get render data
-	FSkeletalMeshRenderData* RenderData = SkeletalMesh->SkeletalMesh->GetResourceForRendering();
-	if (!RenderData || RenderData->LODRenderData.Num() == 0)
+	const int32 Mode = static_cast<int32>(GetEffectiveSkinningMode());
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		bCacheValid = false;
-		return;
+		OutSkinningMode.SetAndAdvance(Mode);
 	}
+}
 
-	// Use LOD 0
-	FSkeletalMeshLODRenderData& LODData = RenderData->LODRenderData[0];
-	NumVertices = LODData.StaticVertexBuffers.PositionVertexBuffer.GetNumVertices();
+void UNiagaraDataInterfaceGVRM::VMGetRigidSplatBinding(FVectorVMExternalFunctionContext& Context)
+{
+	VectorVM::FUserPtrHandler<FNiagaraDataInterfaceGVRMInstanceData> InstanceData(Context);
+	FNDIInputParam<int32> SplatIndexParam(Context);
+	FNDIOutputParam<FVector3f> OutHostPosition(Context);
+	FNDIOutputParam<int32> OutPrimaryBone(Context);
+	FNDIOutputParam<int32> OutSecondaryBone(Context);
+	FNDIOutputParam<float> OutSecondaryWeight(Context);
 
-	// Cache vertex positions and normals
-	CachedVertexPositions.SetNum(NumVertices);
-	CachedVertexNormals.SetNum(NumVertices);
-	for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	const TArray<FGVRMRigidSplatBinding>* RigidBindings = BindingData && BindingData->HasRigidBindings() ? &BindingData->RigidBindings : nullptr;
+	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
-		CachedVertexPositions[VertexIndex] = LODData.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex);
-		CachedVertexNormals[VertexIndex] = FVector3f(LODData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex));
+		const int32 SplatIndex = SplatIndexParam.GetAndAdvance();
+		FGVRMRigidSplatBinding Rigid;
+
+		if (RigidBindings && RigidBindings->IsValidIndex(SplatIndex))
+		{
+			Rigid = (*RigidBindings)[SplatIndex];
+		}
+
+		OutHostPosition.SetAndAdvance(Rigid.HostPosition);
+		OutPrimaryBone.SetAndAdvance(Rigid.PrimaryBone);
+		OutSecondaryBone.SetAndAdvance(Rigid.SecondaryBone);
+		OutSecondaryWeight.SetAndAdvance(Rigid.SecondaryWeight);
 	}
+}
 
-	// Cache bone skinning data
-	CachedBoneIndices.SetNum(NumVertices);
-	CachedBoneWeights.SetNum(NumVertices);
+// ============================================
+// Cache update kernels
+// ============================================
 
-	const FSkinWeightVertexBuffer* SkinWeightBuffer = LODData.GetSkinWeightVertexBuffer();
-	for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+/**
+ * Chunked loops behind UpdateCache and CacheLODStreams.
+ * They reproduce the per-element accessor results exactly; only the way the
+ * data is walked changes.
+ */
+namespace GVRMCacheKernels
+{
+	/** Work per ParallelFor task; a single chunk (a VRM skeleton's bones) runs inline */
+	constexpr int32 BonesPerChunk = 256;
+	constexpr int32 VerticesPerChunk = 16384;
+
+	/** Run Function(First, Last) over [0, Num) in chunks, in parallel when there is more than one */
+	template<typename FunctionType>
+	void ForEachChunk(int32 Num, int32 ChunkSize, FunctionType&& Function)
 	{
-		FIntVector4 BoneIndices(0, 0, 0, 0);
-		FVector4f BoneWeights(1.0f, 0.0f, 0.0f, 0.0f);
+		const int32 NumChunks = FMath::DivideAndRoundUp(Num, ChunkSize);
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 First = ChunkIndex * ChunkSize;
+			Function(First, FMath::Min(First + ChunkSize, Num));
+		}, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
 
-		if (SkinWeightBuffer)
+	/** ToMatrixWithScale (vectorized double math), narrowed to float one row of four lanes at a time */
+	FORCEINLINE void TransformToMatrix(const FTransform& Transform, FMatrix44f& OutMatrix)
+	{
+		const FMatrix Matrix = Transform.ToMatrixWithScale();
+		for (int32 Row = 0; Row < 4; ++Row)
 		{
-			// Get up to MaxBoneInfluences (typically 4)
-			for (int32 InfluenceIdx = 0; InfluenceIdx < FMath::Min(MaxBoneInfluences, 4); ++InfluenceIdx)
-			{
-				const int32 BoneIndex = SkinWeightBuffer->GetBoneIndex(VertexIndex, InfluenceIdx);
-				const float BoneWeight = SkinWeightBuffer->GetBoneWeight(VertexIndex, InfluenceIdx);
+			VectorStore(MakeVectorRegisterFloatFromDouble(VectorLoad(Matrix.M[Row])), OutMatrix.M[Row]);
+		}
+	}
 
-				switch (InfluenceIdx)
-				{
-				case 0: BoneIndices.X = BoneIndex; BoneWeights.X = BoneWeight; break;
-				case 1: BoneIndices.Y = BoneIndex; BoneWeights.Y = BoneWeight; break;
-				case 2: BoneIndices.Z = BoneIndex; BoneWeights.Z = BoneWeight; break;
-				case 3: BoneIndices.W = BoneIndex; BoneWeights.W = BoneWeight; break;
-				}
-			}
+	using GVRMSkinning::FPackedSkinWeights;
+	using GVRMSkinning::UnpackSkinWeights;
+
+	/**
+	 * Fails for buffers without CPU data. For variable influence buffers
+	 * (lookup table) only Data and the index/weight widths apply; read them
+	 * with UnpackVariableSkinWeights.
+	 */
+	bool GetPackedSkinWeights(const FSkinWeightVertexBuffer& Buffer, FPackedSkinWeights& OutPacked)
+	{
+		const FSkinWeightDataVertexBuffer* DataBuffer = Buffer.GetDataVertexBuffer();
+		if (!DataBuffer || !DataBuffer->GetWeightData())
+		{
+			return false;
 		}
 
-		CachedBoneIndices[VertexIndex] = BoneIndices;
-		CachedBoneWeights[VertexIndex] = BoneWeights;
+		const bool bVariableInfluences = Buffer.GetVariableBonesPerVertex();
+		OutPacked.Data = DataBuffer->GetWeightData();
+		OutPacked.VertexStride = bVariableInfluences ? 0 : Buffer.GetConstantInfluencesVertexStride();
+		OutPacked.NumInfluences = Buffer.GetMaxBoneInfluences();
+		OutPacked.b16BitIndices = Buffer.Use16BitBoneIndex();
+		OutPacked.b16BitWeights = Buffer.Use16BitBoneWeight();
+		OutPacked.WeightOffset = OutPacked.NumInfluences * (OutPacked.b16BitIndices ? sizeof(uint16) : sizeof(uint8));
+		return true;
 	}
 
-	// Cache bone transforms
-	const TArray<FTransform>& ComponentSpaceTransforms = SkeletalMesh->GetComponentSpaceTransforms();
-	NumBones = ComponentSpaceTransforms.Num();
-	CachedBoneMatrices.SetNum(NumBones);
-
-	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	/**
+	 * UnpackSkinWeights for a variable influence buffer: the lookup table gives
+	 * each vertex's offset into the weight data and its own influence count, and
+	 * the vertex is packed like a constant one with that count.
+	 */
+	FORCEINLINE void UnpackVariableSkinWeights(const FSkinWeightVertexBuffer& Buffer, const FPackedSkinWeights& Packed, uint32 VertexIndex, uint32 NumRead, int32* OutIndices, float* OutWeights)
 	{
-		CachedBoneMatrices[BoneIndex] = FMatrix44f(ComponentSpaceTransforms[BoneIndex].ToMatrixWithScale());
+		uint32 VertexOffset = 0;
+		uint32 VertexInfluences = 0;
+		Buffer.GetVertexInfluenceOffsetCount(VertexIndex, VertexOffset, VertexInfluences);
+
+		FPackedSkinWeights Vertex = Packed;
+		Vertex.NumInfluences = VertexInfluences;
+		Vertex.WeightOffset = VertexInfluences * (Packed.b16BitIndices ? sizeof(uint16) : sizeof(uint8));
+		UnpackSkinWeights(Vertex, Packed.Data + VertexOffset, NumRead, OutIndices, OutWeights);
 	}
 
-	bCacheValid = true;
+	/**
+	 * Repack cached influences in the engine's skin weight layout for GPU upload:
+	 * NumInfluences 16-bit bone indices, then NumInfluences 16-bit weights
+	 * (NumInfluences words per vertex)
+	 */
+	void PackSkinWeights(const FNiagaraDataInterfaceGVRMInstanceData& Streams, TArray<uint32>& OutWords)
+	{
+		const int32 NumInfluences = Streams.NumInfluences;
+		const int32 NumVertices = Streams.CachedBoneIndices.Num();
+		OutWords.SetNumUninitialized(NumVertices * NumInfluences);
+		uint32* Words = OutWords.GetData();
+		ForEachChunk(NumVertices, VerticesPerChunk, [&Streams, NumInfluences, Words](int32 First, int32 Last)
+		{
+			for (int32 VertexIndex = First; VertexIndex < Last; ++VertexIndex)
+			{
+				uint16 Values[GVRMSkinning::MaxBoneInfluences * 2];
+				for (int32 Influence = 0; Influence < NumInfluences; ++Influence)
+				{
+					const bool bExtra = Influence >= 4;
+					const int32 BoneIndex = bExtra ? Streams.CachedExtraBoneIndices[VertexIndex][Influence - 4] : Streams.CachedBoneIndices[VertexIndex][Influence];
+					const float BoneWeight = bExtra ? Streams.CachedExtraBoneWeights[VertexIndex][Influence - 4] : Streams.CachedBoneWeights[VertexIndex][Influence];
+					Values[Influence] = static_cast<uint16>(FMath::Clamp<int32>(BoneIndex, 0, MAX_uint16));
+					Values[NumInfluences + Influence] = static_cast<uint16>(FMath::Clamp<int32>(FMath::RoundToInt(BoneWeight * MAX_uint16), 0, MAX_uint16));
+				}
+				FMemory::Memcpy(&Words[VertexIndex * NumInfluences], Values, NumInfluences * sizeof(uint32));
+			}
+		});
+	}
 }
 
-// GPU Proxy - called before Niagara simulation on GPU
-void FNiagaraDataInterfaceGVRMProxy::PreStage(const FNDIGpuComputePreStageContext& Context)
+// Instance data cache update implementation
+void FNiagaraDataInterfaceGVRMInstanceData::UpdateCache(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData)
 {
-	// No per-stage work needed - buffers are set in ProvidePerInstanceDataForRenderThread
-	// and bound via GetParameterDefinitionHLSL
+	if (BeginUpdate(SkeletalMesh, MaxBoneInfluences, BindingData))
+	{
+		UpdateLODStreams();
+		UpdatePose();
+	}
 }
 
-// GPU Proxy - called after Niagara simulation on GPU
-void FNiagaraDataInterfaceGVRMProxy::PostStage(const FNDIGpuComputePostStageContext& Context)
+FNiagaraDataInterfaceGVRMInstanceData::~FNiagaraDataInterfaceGVRMInstanceData()
 {
-	// No per-stage cleanup needed - resources managed by proxy lifetime
+	UnwatchPose();
 }
 
-// Provide per-instance data for render thread
-void UNiagaraDataInterfaceGVRM::ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance)
+void FNiagaraDataInterfaceGVRMInstanceData::WatchPose(USkeletalMeshComponent* SkeletalMesh)
 {
-	FNiagaraDataInterfaceGVRMInstanceData* SourceData = static_cast<FNiagaraDataInterfaceGVRMInstanceData*>(PerInstanceData);
-	FNiagaraDataInterfaceGVRMProxy* TargetProxy = static_cast<FNiagaraDataInterfaceGVRMProxy*>(DataForRenderThread);
+	check(IsInGameThread());
 
-	if (!SourceData || !SourceData->bCacheValid)
+	if (WatchedComponent.Get() == SkeletalMesh && BoneTransformsFinalizedHandle.IsValid())
 	{
 		return;
 	}
 
-	// Copy buffer dimensions
-	TargetProxy->NumVertices = SourceData->NumVertices;
-	TargetProxy->NumBones = SourceData->NumBones;
-	TargetProxy->MaxBoneInfluences = MaxBoneInfluences;
-
-	// Copy data to local variables for safe capture (avoid cross-thread pointer access)
-	TArray<FVector3f> VertexPositions = SourceData->CachedVertexPositions;
-	TArray<FVector3f> VertexNormals = SourceData->CachedVertexNormals;
-	TArray<FIntVector4> BoneIndices = SourceData->CachedBoneIndices;
-	TArray<FVector4f> BoneWeights = SourceData->CachedBoneWeights;
-	TArray<FMatrix44f> BoneMatrices = SourceData->CachedBoneMatrices;
+	UnwatchPose();
+	if (SkeletalMesh)
+	{
+		WatchedComponent = SkeletalMesh;
+		BoneTransformsFinalizedHandle = SkeletalMesh->RegisterOnBoneTransformsFinalizedDelegate(
+			FOnBoneTransformsFinalizedMultiCast::FDelegate::CreateRaw(this, &FNiagaraDataInterfaceGVRMInstanceData::HandleBoneTransformsFinalized));
+	}
+}
 
-	// Create GPU buffers on render thread
-	ENQUEUE_RENDER_COMMAND(UpdateGVRMGPUBuffers)(
-		[TargetProxy, VertexPositions, VertexNormals, BoneIndices, BoneWeights, BoneMatrices](FRHICommandListImmediate& RHICmdList)
-		{
-			// Upload vertex positions
-			if (VertexPositions.Num() > 0)
-			{
-				FRHIResourceCreateInfo CreateInfo(TEXT("GVRMVertexPositions"));
-				TargetProxy->VertexPositionsBuffer = RHICreateVertexBuffer(
-					VertexPositions.Num() * sizeof(FVector3f),
-					BUF_ShaderResource | BUF_Dynamic,
-					CreateInfo
-				);
-
-				void* BufferData = RHILockBuffer(TargetProxy->VertexPositionsBuffer, 0,
-					VertexPositions.Num() * sizeof(FVector3f), RLM_WriteOnly);
-				FMemory::Memcpy(BufferData, VertexPositions.GetData(),
-					VertexPositions.Num() * sizeof(FVector3f));
-				RHIUnlockBuffer(TargetProxy->VertexPositionsBuffer);
-
-				TargetProxy->VertexPositionsSRV = RHICreateShaderResourceView(
-					TargetProxy->VertexPositionsBuffer, sizeof(FVector3f), PF_R32_FLOAT
-				);
-			}
+void FNiagaraDataInterfaceGVRMInstanceData::UnwatchPose()
+{
+	WaitForPoseCapture();
 
-			// Upload vertex normals
-			if (VertexNormals.Num() > 0)
-			{
-				FRHIResourceCreateInfo CreateInfo(TEXT("GVRMVertexNormals"));
-				TargetProxy->VertexNormalsBuffer = RHICreateVertexBuffer(
-					VertexNormals.Num() * sizeof(FVector3f),
-					BUF_ShaderResource | BUF_Dynamic,
-					CreateInfo
-				);
-
-				void* BufferData = RHILockBuffer(TargetProxy->VertexNormalsBuffer, 0,
-					VertexNormals.Num() * sizeof(FVector3f), RLM_WriteOnly);
-				FMemory::Memcpy(BufferData, VertexNormals.GetData(),
-					VertexNormals.Num() * sizeof(FVector3f));
-				RHIUnlockBuffer(TargetProxy->VertexNormalsBuffer);
-
-				TargetProxy->VertexNormalsSRV = RHICreateShaderResourceView(
-					TargetProxy->VertexNormalsBuffer, sizeof(FVector3f), PF_R32_FLOAT
-				);
-			}
+	if (USkeletalMeshComponent* SkeletalMesh = WatchedComponent.Get())
+	{
+		SkeletalMesh->UnregisterOnBoneTransformsFinalizedDelegate(BoneTransformsFinalizedHandle);
+	}
+	WatchSpringBones(nullptr);
+	WatchedComponent.Reset();
+	BoneTransformsFinalizedHandle.Reset();
+	bPoseCaptured = false;
+	bPoseAwaitsSpringBones = false;
+}
 
-			// Upload bone indices
-			if (BoneIndices.Num() > 0)
-			{
-				FRHIResourceCreateInfo CreateInfo(TEXT("GVRMBoneIndices"));
-				TargetProxy->BoneIndicesBuffer = RHICreateVertexBuffer(
-					BoneIndices.Num() * sizeof(FIntVector4),
-					BUF_ShaderResource | BUF_Dynamic,
-					CreateInfo
-				);
-
-				void* BufferData = RHILockBuffer(TargetProxy->BoneIndicesBuffer, 0,
-					BoneIndices.Num() * sizeof(FIntVector4), RLM_WriteOnly);
-				FMemory::Memcpy(BufferData, BoneIndices.GetData(),
-					BoneIndices.Num() * sizeof(FIntVector4));
-				RHIUnlockBuffer(TargetProxy->BoneIndicesBuffer);
-
-				TargetProxy->BoneIndicesSRV = RHICreateShaderResourceView(
-					TargetProxy->BoneIndicesBuffer, sizeof(int32), PF_R32_SINT
-				);
-			}
+void FNiagaraDataInterfaceGVRMInstanceData::WatchSpringBones(UGVRMSpringBoneSubsystem* SpringBones)
+{
+	if (WatchedSpringBones.Get() == SpringBones && SpringBonesSolvedHandle.IsValid() == (SpringBones != nullptr))
+	{
+		return;
+	}
+
+	if (UGVRMSpringBoneSubsystem* OldSpringBones = WatchedSpringBones.Get())
+	{
+		OldSpringBones->OnSolved().Remove(SpringBonesSolvedHandle);
+	}
+	WatchedSpringBones = SpringBones;
+	SpringBonesSolvedHandle.Reset();
+	if (SpringBones)
+	{
+		SpringBonesSolvedHandle = SpringBones->OnSolved().AddRaw(this, &FNiagaraDataInterfaceGVRMInstanceData::HandleSpringBonesSolved);
+	}
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::WaitForPoseCapture() const
+{
+	if (PoseCaptureTask.IsValid())
+	{
+		PoseCaptureTask.Wait();
+	}
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::HandleBoneTransformsFinalized()
+{
+	const USkeletalMeshComponent* SkeletalMesh = WatchedComponent.Get();
+	if (!SkeletalMesh)
+	{
+		return;
+	}
+
+	// Only the copy stays here: the component flips its transform buffers after the broadcast
+	WaitForPoseCapture();
+	PoseSnapshot = SkeletalMesh->GetComponentSpaceTransforms();
+	bPoseCaptured = true;
+
+	// Spring bones are solved later this frame (TG_PostUpdateWork); their callback starts the conversion
+	UGVRMSpringBoneSubsystem* SpringBones = UGVRMSpringBoneSubsystem::Find(SkeletalMesh);
+	WatchSpringBones(SpringBones);
+	bPoseAwaitsSpringBones = SpringBones != nullptr;
+	if (!bPoseAwaitsSpringBones)
+	{
+		LaunchPoseConversion(nullptr);
+	}
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::HandleSpringBonesSolved()
+{
+	UGVRMSpringBoneSubsystem* SpringBones = WatchedSpringBones.Get();
+	if (!bPoseAwaitsSpringBones || !SpringBones || !WatchedComponent.IsValid())
+	{
+		return;
+	}
+
+	bPoseAwaitsSpringBones = false;
+	LaunchPoseConversion(SpringBones);
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::LaunchPoseConversion(UGVRMSpringBoneSubsystem* SpringBones)
+{
+	const USkeletalMeshComponent* SkeletalMesh = WatchedComponent.Get();
+	PoseCaptureTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, SpringBones, SkeletalMesh]
+	{
+		SCOPE_CYCLE_COUNTER(STAT_GVRM_NDIUpdateCache);
+		if (SpringBones)
+		{
+			SpringBones->ApplyToPose(SkeletalMesh, PoseSnapshot);
+		}
+		UpdatePose();
+	});
+
+	// The solver must keep this frame's result until the task applied it
+	if (SpringBones)
+	{
+		SpringBones->AddResultReader(PoseCaptureTask);
+	}
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::UpdateCacheFromCapturedPose(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData)
+{
+	WaitForPoseCapture();
+
+	// Without a solve since the capture (paused, or ticking before the spring bones) the live pose is used
+	if (!bPoseCaptured || WatchedComponent.Get() != SkeletalMesh || bPoseAwaitsSpringBones)
+	{
+		bPoseAwaitsSpringBones = false;
+		UpdateCache(SkeletalMesh, MaxBoneInfluences, BindingData);
+		return;
+	}
+
+	if (BeginUpdate(SkeletalMesh, MaxBoneInfluences, BindingData, /*bSnapshotPose*/ false))
+	{
+		UpdateLODStreams();
+
+		// The capture was converted with the previous palette bones
+		if (bPoseStale)
+		{
+			UpdatePose();
+		}
+	}
+}
+
+bool FNiagaraDataInterfaceGVRMInstanceData::BeginUpdate(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData, bool bSnapshotPose)
+{
+	PendingLODData = nullptr;
+
+	if (!SkeletalMesh || !SkeletalMesh->SkeletalMesh)
+	{
+		bCacheValid = false;
+		return false;
+	}
+
+	// Check if we need to update (frame number changed)
+	const uint32 CurrentFrameNumber = GFrameNumber;
+	if (bCacheValid && CachedFrameNumber == CurrentFrameNumber)
+	{
+		return false; // Cache still valid for this frame
+	}
+
+	CachedFrameNumber = CurrentFrameNumber;
+	CachedSkeletalMeshComponent = SkeletalMesh;
+
+	LLM_SCOPE_BYTAG(GVRM_MeshCache);
+
+	// Get render data
+	FSkeletalMeshRenderData* RenderData = SkeletalMesh->SkeletalMesh->GetResourceForRendering();
+	if (!RenderData || RenderData->LODRenderData.Num() == 0)
+	{
+		bCacheValid = false;
+		return false;
+	}
+
+	// Follow the LOD the component renders; LODs above CurrentFirstLODIdx are streamed out
+	int32 LODIndex = FMath::Clamp(SkeletalMesh->GetPredictedLODLevel(), static_cast<int32>(RenderData->CurrentFirstLODIdx), RenderData->LODRenderData.Num() - 1);
+	const FGVRMLODBinding* LODBinding = BindingData ? BindingData->GetLODBinding(LODIndex) : nullptr;
+	if (LODIndex > 0 && (!LODBinding
+		|| LODBinding->NumLODVertices != static_cast<int32>(RenderData->LODRenderData[LODIndex].StaticVertexBuffers.PositionVertexBuffer.GetNumVertices())))
+	{
+		// Without a matching remap the splat vertex indices only make sense on LOD0
+		LODIndex = 0;
+		LODBinding = nullptr;
+	}
+
+	if (LODIndex < RenderData->CurrentFirstLODIdx)
+	{
+		bCacheValid = false;
+		return false;
+	}
+
+	// Bones the splats reach, when the binding data has a compacted palette
+	static const TArray<int32> FullPalette;
+	const TArray<int32>& PaletteBones = BindingData && BindingData->HasCompactBonePalette() ? BindingData->PaletteBones : FullPalette;
+	const TArray<FTransform>& ComponentSpaceTransforms = SkeletalMesh->GetComponentSpaceTransforms();
+	if (bSnapshotPose)
+	{
+		PoseSnapshot = ComponentSpaceTransforms;
+
+		// Spring bones are solved after the mesh finalized its pose, so they only reach the snapshot
+		// (a captured pose gets them on its conversion task)
+		if (const UGVRMSpringBoneSubsystem* SpringBones = UGVRMSpringBoneSubsystem::Find(SkeletalMesh))
+		{
+			SpringBones->ApplyToPose(SkeletalMesh, PoseSnapshot);
+		}
+	}
+
+	// Vertex and skin weight streams only change with the LOD, the mesh asset or the palette
+	const bool bMeshChanged = CachedSkeletalMeshAsset.Get() != SkeletalMesh->SkeletalMesh || CachedPaletteBones != PaletteBones;
+	if (CachedLODIndex != LODIndex || bMeshChanged)
+	{
+		PendingLODData = &RenderData->LODRenderData[LODIndex];
+		PendingLODBinding = LODBinding;
+		PendingBindingData = BindingData;
+		PendingMaxBoneInfluences = MaxBoneInfluences;
+		CachedLODIndex = LODIndex;
+		CachedLODRenderData = &RenderData->LODRenderData[LODIndex];
+		CachedSkeletalMeshAsset = SkeletalMesh->SkeletalMesh;
+		CachedPaletteBones = PaletteBones;
+		bStaticDataDirty = true;
+
+		if (bMeshChanged)
+		{
+			// Rigid streams carry palette slots too
+			bRigidDataSent = false;
+			bPoseStale = true;
+			CacheMorphTargets(*SkeletalMesh->SkeletalMesh, BindingData);
+
+			const int32 NumPaletteBones = CachedPaletteBones.Num() > 0 ? CachedPaletteBones.Num() : ComponentSpaceTransforms.Num();
+			UE_LOG(LogTemp, Log, TEXT("GVRM - %s: bone palette of %d matrices for %d skeleton bones"),
+				*GetNameSafe(SkeletalMesh->GetOwner()), NumPaletteBones, ComponentSpaceTransforms.Num());
+			if (BindingData && RenderData->LODRenderData.Num() > 1 && !BindingData->GetLODBinding(1))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("GVRM - %s has no LOD remaps for the %d LODs of %s; splats stay on LOD0 (set its SourceSkeletalMesh and re-save it)"),
+					*BindingData->GetName(), RenderData->LODRenderData.Num(), *SkeletalMesh->SkeletalMesh->GetName());
+			}
+			if (CachedPaletteBones.Num() > 0 && BindingData->BonePaletteSlots.Num() != ComponentSpaceTransforms.Num())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("GVRM - Bone palette of %s was built for %d bones, %s has %d; re-save it with its SourceSkeletalMesh set"),
+					*BindingData->GetName(), BindingData->BonePaletteSlots.Num(), *SkeletalMesh->SkeletalMesh->GetName(), ComponentSpaceTransforms.Num());
+			}
+		}
+	}
+
+	GatherActiveMorphs(*SkeletalMesh);
 
-			// Upload bone weights
-			if (BoneWeights.Num() > 0)
+	// Valid for readers once UpdateLODStreams and UpdatePose have run
+	bCacheValid = true;
+	return true;
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::CacheMorphTargets(const USkeletalMesh& Mesh, const UGVRMBindingData* BindingData)
+{
+	CachedMorphDeltas.Reset();
+	CachedMorphRanges.Reset();
+	CachedMorphVertexSlots.Reset();
+	ActiveMorphs.Reset();
+	NumMorphSlots = 0;
+	NumActiveMorphDeltas = 0;
+
+	const TArray<TObjectPtr<UMorphTarget>>& MorphTargets = Mesh.GetMorphTargets();
+	const FSkeletalMeshRenderData* RenderData = Mesh.GetResourceForRendering();
+	if (MorphTargets.Num() == 0 || !RenderData || RenderData->LODRenderData.Num() == 0)
+	{
+		return;
+	}
+
+	// Splats only follow their bound vertices, so deltas anywhere else are never read
+	const int32 NumLOD0Vertices = RenderData->LODRenderData[0].GetNumVertices();
+	const bool bAllVerticesBound = !BindingData || BindingData->BoundVertexIndices.Num() == 0;
+	TBitArray<> BoundVertices(bAllVerticesBound, NumLOD0Vertices);
+	if (!bAllVerticesBound)
+	{
+		for (const int32 VertexIndex : BindingData->BoundVertexIndices)
+		{
+			if (VertexIndex >= 0 && VertexIndex < NumLOD0Vertices)
 			{
-				FRHIResourceCreateInfo CreateInfo(TEXT("GVRMBoneWeights"));
-				TargetProxy->BoneWeightsBuffer = RHICreateVertexBuffer(
-					BoneWeights.Num() * sizeof(FVector4f),
-					BUF_ShaderResource | BUF_Dynamic,
-					CreateInfo
-				);
-
-				void* BufferData = RHILockBuffer(TargetProxy->BoneWeightsBuffer, 0,
-					BoneWeights.Num() * sizeof(FVector4f), RLM_WriteOnly);
-				FMemory::Memcpy(BufferData, BoneWeights.GetData(),
-					BoneWeights.Num() * sizeof(FVector4f));
-				RHIUnlockBuffer(TargetProxy->BoneWeightsBuffer);
-
-				TargetProxy->BoneWeightsSRV = RHICreateShaderResourceView(
-					TargetProxy->BoneWeightsBuffer, sizeof(FVector4f), PF_A32B32G32R32F
-				);
+				BoundVertices[VertexIndex] = true;
+			}
+		}
+	}
+
+	CachedMorphVertexSlots.Init(INDEX_NONE, NumLOD0Vertices);
+	CachedMorphRanges.SetNumZeroed(MorphTargets.Num());
+	for (int32 MorphIndex = 0; MorphIndex < MorphTargets.Num(); ++MorphIndex)
+	{
+		int32 NumDeltas = 0;
+		const FMorphTargetDelta* Deltas = MorphTargets[MorphIndex] ? MorphTargets[MorphIndex]->GetMorphTargetDelta(0, NumDeltas) : nullptr;
+
+		FIntPoint& Range = CachedMorphRanges[MorphIndex];
+		Range.X = CachedMorphDeltas.Num();
+		for (int32 DeltaIndex = 0; Deltas && DeltaIndex < NumDeltas; ++DeltaIndex)
+		{
+			const FMorphTargetDelta& Delta = Deltas[DeltaIndex];
+			const int32 VertexIndex = static_cast<int32>(Delta.SourceIdx);
+			if (VertexIndex >= NumLOD0Vertices || !BoundVertices[VertexIndex] || Delta.PositionDelta.IsZero())
+			{
+				continue;
 			}
 
-			// Upload bone matrices
-			if (BoneMatrices.Num() > 0)
+			int32& Slot = CachedMorphVertexSlots[VertexIndex];
+			if (Slot == INDEX_NONE)
 			{
-				FRHIResourceCreateInfo CreateInfo(TEXT("GVRMBoneMatrices"));
-				TargetProxy->BoneMatricesBuffer = RHICreateVertexBuffer(
-					BoneMatrices.Num() * sizeof(FMatrix44f),
-					BUF_ShaderResource | BUF_Dynamic,
-					CreateInfo
-				);
-
-				void* BufferData = RHILockBuffer(TargetProxy->BoneMatricesBuffer, 0,
-					BoneMatrices.Num() * sizeof(FMatrix44f), RLM_WriteOnly);
-				FMemory::Memcpy(BufferData, BoneMatrices.GetData(),
-					BoneMatrices.Num() * sizeof(FMatrix44f));
-				RHIUnlockBuffer(TargetProxy->BoneMatricesBuffer);
-
-				TargetProxy->BoneMatricesSRV = RHICreateShaderResourceView(
-					TargetProxy->BoneMatricesBuffer, sizeof(FMatrix44f), PF_A32B32G32R32F
-				);
+				Slot = NumMorphSlots++;
 			}
+			CachedMorphDeltas.Add(GVRMSkinning::EncodeMorphDelta(Delta.PositionDelta, Slot));
 		}
-	);
+		Range.Y = CachedMorphDeltas.Num() - Range.X;
+	}
+
+	if (NumMorphSlots == 0)
+	{
+		CachedMorphDeltas.Empty();
+		CachedMorphRanges.Empty();
+		CachedMorphVertexSlots.Empty();
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("GVRM - %s: %d morph targets, %d deltas on %d bound vertices"),
+		*Mesh.GetName(), MorphTargets.Num(), CachedMorphDeltas.Num(), NumMorphSlots);
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::GatherActiveMorphs(const USkeletalMeshComponent& SkeletalMesh)
+{
+	ActiveMorphs.Reset();
+	NumActiveMorphDeltas = 0;
+	if (NumMorphSlots == 0)
+	{
+		return;
+	}
+
+	// Weights below this leave no visible trace (same cut as the engine's morph blending)
+	constexpr float MinMorphWeight = UE_KINDA_SMALL_NUMBER;
+
+	// ActiveMorphTargets maps each weighted morph target to its index in MorphTargetWeights, the mesh's morph index
+	for (const TPair<const UMorphTarget*, int32>& Active : SkeletalMesh.ActiveMorphTargets)
+	{
+		const int32 MorphIndex = Active.Value;
+		const float Weight = SkeletalMesh.MorphTargetWeights.IsValidIndex(MorphIndex) ? SkeletalMesh.MorphTargetWeights[MorphIndex] : 0.0f;
+		if (!CachedMorphRanges.IsValidIndex(MorphIndex) || CachedMorphRanges[MorphIndex].Y == 0 || FMath::Abs(Weight) < MinMorphWeight)
+		{
+			continue;
+		}
+
+		FGVRMActiveMorph& Morph = ActiveMorphs.AddDefaulted_GetRef();
+		Morph.FirstDelta = CachedMorphRanges[MorphIndex].X;
+		Morph.NumDeltas = CachedMorphRanges[MorphIndex].Y;
+		Morph.FirstThread = NumActiveMorphDeltas;
+		Morph.Weight = Weight;
+		NumActiveMorphDeltas += Morph.NumDeltas;
+	}
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::UpdateLODStreams()
+{
+	if (!PendingLODData)
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(GVRM_MeshCache);
+	CacheLODStreams(*PendingLODData, PendingMaxBoneInfluences, PendingBindingData, PendingLODBinding);
+
+	// Without copies the GPU remaps through the slot table instead
+	if (CachedPaletteBones.Num() > 0 && CachedBoneIndices.Num() == NumVertices)
+	{
+		const TArray<int32>& Slots = PendingBindingData->BonePaletteSlots;
+		FIntVector4* BoneIndices = CachedBoneIndices.GetData();
+		FIntVector4* ExtraBoneIndices = CachedExtraBoneIndices.Num() == NumVertices ? CachedExtraBoneIndices.GetData() : nullptr;
+		GVRMCacheKernels::ForEachChunk(NumVertices, GVRMCacheKernels::VerticesPerChunk, [&Slots, BoneIndices, ExtraBoneIndices](int32 First, int32 Last)
+		{
+			auto RemapToSlots = [&Slots](FIntVector4& Indices)
+			{
+				for (int32 Influence = 0; Influence < 4; ++Influence)
+				{
+					Indices[Influence] = Slots.IsValidIndex(Indices[Influence]) ? Slots[Indices[Influence]] : 0;
+				}
+			};
+
+			for (int32 VertexIndex = First; VertexIndex < Last; ++VertexIndex)
+			{
+				RemapToSlots(BoneIndices[VertexIndex]);
+				if (ExtraBoneIndices)
+				{
+					RemapToSlots(ExtraBoneIndices[VertexIndex]);
+				}
+			}
+		});
+	}
+
+	PendingLODData = nullptr;
+}
+
+
+void FNiagaraDataInterfaceGVRMInstanceData::CacheBoneMatrices(TConstArrayView<FTransform> ComponentSpaceTransforms)
+{
+	NumSkeletonBones = ComponentSpaceTransforms.Num();
+	NumBones = CachedPaletteBones.Num() > 0 ? CachedPaletteBones.Num() : NumSkeletonBones;
+	CachedBoneMatrices.SetNumUninitialized(NumBones);
+
+	const FTransform* Transforms = ComponentSpaceTransforms.GetData();
+	FMatrix44f* Matrices = CachedBoneMatrices.GetData();
+	if (CachedPaletteBones.Num() == 0)
+	{
+		GVRMCacheKernels::ForEachChunk(NumBones, GVRMCacheKernels::BonesPerChunk, [Transforms, Matrices](int32 First, int32 Last)
+		{
+			for (int32 BoneIndex = First; BoneIndex < Last; ++BoneIndex)
+			{
+				GVRMCacheKernels::TransformToMatrix(Transforms[BoneIndex], Matrices[BoneIndex]);
+			}
+		});
+		return;
+	}
+
+	// Gather the palette bones; a palette built for another skeleton gets identity for missing bones
+	const int32* PaletteBones = CachedPaletteBones.GetData();
+	const int32 NumTransforms = NumSkeletonBones;
+	GVRMCacheKernels::ForEachChunk(NumBones, GVRMCacheKernels::BonesPerChunk, [Transforms, Matrices, PaletteBones, NumTransforms](int32 First, int32 Last)
+	{
+		for (int32 Slot = First; Slot < Last; ++Slot)
+		{
+			const int32 BoneIndex = PaletteBones[Slot];
+			GVRMCacheKernels::TransformToMatrix(BoneIndex < NumTransforms ? Transforms[BoneIndex] : FTransform::Identity, Matrices[Slot]);
+		}
+	});
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::CacheLODStreams(const FSkeletalMeshLODRenderData& LODData, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData, const FGVRMLODBinding* LODBinding)
+{
+	NumVertices = LODData.StaticVertexBuffers.PositionVertexBuffer.GetNumVertices();
+
+	// Smallest kernel specialization holding the requested influences, capped by what the binding data's weights use
+	const int32 NumRequested = BindingData ? FMath::Min(MaxBoneInfluences, BindingData->GetNumBoneInfluences()) : MaxBoneInfluences;
+	NumInfluences = GVRMSkinning::GetInfluencePermutation(NumRequested);
+
+	// Every element is written below, unless the GPU reads the mesh buffers directly
+	const int32 NumCopiedVertices = bCacheVertexStreams ? NumVertices : 0;
+	const int32 NumExtraVertices = NumInfluences > 4 ? NumCopiedVertices : 0;
+	CachedVertexPositions.SetNumUninitialized(NumCopiedVertices);
+	CachedVertexNormals.SetNumUninitialized(NumCopiedVertices);
+	CachedBoneIndices.SetNumUninitialized(NumCopiedVertices);
+	CachedBoneWeights.SetNumUninitialized(NumCopiedVertices);
+	CachedExtraBoneIndices.SetNumUninitialized(NumExtraVertices);
+	CachedExtraBoneWeights.SetNumUninitialized(NumExtraVertices);
+
+	const FPositionVertexBuffer& PositionBuffer = LODData.StaticVertexBuffers.PositionVertexBuffer;
+	const FStaticMeshVertexBuffer& TangentBuffer = LODData.StaticVertexBuffers.StaticMeshVertexBuffer;
+	const FSkinWeightVertexBuffer* SkinWeightBuffer = LODData.GetSkinWeightVertexBuffer();
+	const uint32 NumInfluencesRead = FMath::Clamp(NumRequested, 0, GVRMSkinning::MaxBoneInfluences);
+
+	GVRMCacheKernels::FPackedSkinWeights PackedWeights;
+	const bool bPackedWeights = SkinWeightBuffer && GVRMCacheKernels::GetPackedSkinWeights(*SkinWeightBuffer, PackedWeights);
+	const bool bVariableInfluences = bPackedWeights && SkinWeightBuffer->GetVariableBonesPerVertex();
+
+	GVRMCacheKernels::ForEachChunk(NumCopiedVertices, GVRMCacheKernels::VerticesPerChunk, [&](int32 First, int32 Last)
+	{
+		// Positions are stored contiguously as FVector3f
+		if (Last > First)
+		{
+			FMemory::Memcpy(&CachedVertexPositions[First], &PositionBuffer.VertexPosition(First), (Last - First) * sizeof(FVector3f));
+		}
+
+		for (int32 VertexIndex = First; VertexIndex < Last; ++VertexIndex)
+		{
+			CachedVertexNormals[VertexIndex] = FVector3f(TangentBuffer.VertexTangentZ(VertexIndex));
+		}
+
+		for (int32 VertexIndex = First; VertexIndex < Last; ++VertexIndex)
+		{
+			// Without (CPU) skin weights every vertex follows bone 0
+			int32 BoneIndices[GVRMSkinning::MaxBoneInfluences] = {};
+			float BoneWeights[GVRMSkinning::MaxBoneInfluences] = { 1.0f };
+
+			if (bVariableInfluences)
+			{
+				GVRMCacheKernels::UnpackVariableSkinWeights(*SkinWeightBuffer, PackedWeights, VertexIndex, NumInfluencesRead, BoneIndices, BoneWeights);
+			}
+			else if (bPackedWeights)
+			{
+				GVRMCacheKernels::UnpackSkinWeights(PackedWeights, VertexIndex, NumInfluencesRead, BoneIndices, BoneWeights);
+			}
+
+			CachedBoneIndices[VertexIndex] = FIntVector4(BoneIndices[0], BoneIndices[1], BoneIndices[2], BoneIndices[3]);
+			CachedBoneWeights[VertexIndex] = FVector4f(BoneWeights[0], BoneWeights[1], BoneWeights[2], BoneWeights[3]);
+			if (NumExtraVertices > 0)
+			{
+				CachedExtraBoneIndices[VertexIndex] = FIntVector4(BoneIndices[4], BoneIndices[5], BoneIndices[6], BoneIndices[7]);
+				CachedExtraBoneWeights[VertexIndex] = FVector4f(BoneWeights[4], BoneWeights[5], BoneWeights[6], BoneWeights[7]);
+			}
+		}
+	});
+
+	// Expand the sparse LOD remap into per-LOD0-vertex slots so splats can index it directly
+	NumRemapVertices = 0;
+	CachedLODRemapIndices.Reset();
+	CachedLODRemapWeights.Reset();
+	CachedLODRemapOffsets.Reset();
+
+	if (LODBinding && BindingData && BindingData->BoundVertexIndices.Num() > 0)
+	{
+		NumRemapVertices = BindingData->BoundVertexIndices.Last() + 1;
+		CachedLODRemapIndices.SetNumZeroed(NumRemapVertices);
+		CachedLODRemapWeights.SetNumZeroed(NumRemapVertices);
+		CachedLODRemapOffsets.SetNumZeroed(NumRemapVertices);
+
+		for (int32 BoundIndex = 0; BoundIndex < BindingData->BoundVertexIndices.Num(); ++BoundIndex)
+		{
+			const int32 VertexIndex = BindingData->BoundVertexIndices[BoundIndex];
+			const FGVRMLODVertexRemap& Remap = LODBinding->VertexRemaps[BoundIndex];
+			CachedLODRemapIndices[VertexIndex] = FIntVector4(Remap.VertexIndices.X, Remap.VertexIndices.Y, Remap.VertexIndices.Z, 1);
+			CachedLODRemapWeights[VertexIndex] = FVector4f(Remap.BarycentricWeights, 0.0f);
+			CachedLODRemapOffsets[VertexIndex] = FVector4f(Remap.OffsetCorrection, 0.0f);
+		}
+	}
+}
+
+void FNiagaraDataInterfaceGVRMInstanceData::GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const
+{
+	WaitForPoseCapture();
+
+	OutBreakdown.AddArray(TEXT("VertexPositions"), CachedVertexPositions);
+	OutBreakdown.AddArray(TEXT("VertexNormals"), CachedVertexNormals);
+	OutBreakdown.AddArray(TEXT("BoneIndices"), CachedBoneIndices);
+	OutBreakdown.AddArray(TEXT("BoneWeights"), CachedBoneWeights);
+	OutBreakdown.AddArray(TEXT("ExtraBoneIndices"), CachedExtraBoneIndices);
+	OutBreakdown.AddArray(TEXT("ExtraBoneWeights"), CachedExtraBoneWeights);
+	OutBreakdown.AddArray(TEXT("BoneMatrices"), CachedBoneMatrices);
+	OutBreakdown.AddArray(TEXT("PaletteBones"), CachedPaletteBones);
+	OutBreakdown.AddArray(TEXT("PoseSnapshot"), PoseSnapshot);
+	OutBreakdown.AddArray(TEXT("LODRemapIndices"), CachedLODRemapIndices);
+	OutBreakdown.AddArray(TEXT("LODRemapWeights"), CachedLODRemapWeights);
+	OutBreakdown.AddArray(TEXT("LODRemapOffsets"), CachedLODRemapOffsets);
+	OutBreakdown.AddArray(TEXT("MorphDeltas"), CachedMorphDeltas);
+	OutBreakdown.AddArray(TEXT("MorphRanges"), CachedMorphRanges);
+	OutBreakdown.AddArray(TEXT("MorphVertexSlots"), CachedMorphVertexSlots);
+	OutBreakdown.AddArray(TEXT("ActiveMorphs"), ActiveMorphs);
+}
+
+FNiagaraDataInterfaceGVRMProxy::~FNiagaraDataInterfaceGVRMProxy()
+{
+	using namespace GVRMRender;
+	ReleaseBuffer(VertexPositionsBuffer, VertexPositionsSRV);
+	ReleaseBuffer(VertexTangentsBuffer, VertexTangentsSRV);
+	ReleaseBuffer(SkinWeightsBuffer, SkinWeightsSRV);
+	ReleaseBuffer(BoneSlotsBuffer, BoneSlotsSRV);
+	ReleaseBuffer(BoneMatricesBuffer, BoneMatricesSRV);
+	SkinWeightLookupSRV.SafeRelease();
+	ReleaseBuffer(LODRemapIndicesBuffer, LODRemapIndicesSRV);
+	ReleaseBuffer(LODRemapWeightsBuffer, LODRemapWeightsSRV);
+	ReleaseBuffer(LODRemapOffsetsBuffer, LODRemapOffsetsSRV);
+	ReleaseBuffer(RigidSplatPositionsBuffer, RigidSplatPositionsSRV);
+	ReleaseBuffer(RigidSplatBonesBuffer, RigidSplatBonesSRV);
+	ReleaseBuffer(MorphVertexSlotsBuffer, MorphVertexSlotsSRV);
+	ReleaseBuffer(MorphDeltasBuffer, MorphDeltasSRV);
+}
+
+void FNiagaraDataInterfaceGVRMProxy::GetMemoryBreakdown_RenderThread(FGVRMMemoryBreakdown& OutBreakdown) const
+{
+	check(IsInRenderingThread());
+
+	using namespace GVRMRender;
+	// Zero for the mesh streams when the engine's buffers are bound (owned by the skeletal mesh)
+	OutBreakdown.AddGPU(TEXT("VertexPositions"), GetBufferSize(VertexPositionsBuffer));
+	OutBreakdown.AddGPU(TEXT("VertexTangents"), GetBufferSize(VertexTangentsBuffer));
+	OutBreakdown.AddGPU(TEXT("SkinWeights"), GetBufferSize(SkinWeightsBuffer));
+	OutBreakdown.AddGPU(TEXT("BoneSlots"), GetBufferSize(BoneSlotsBuffer));
+	OutBreakdown.AddGPU(TEXT("BoneMatrices"), GetBufferSize(BoneMatricesBuffer));
+	OutBreakdown.AddGPU(TEXT("LODRemapIndices"), GetBufferSize(LODRemapIndicesBuffer));
+	OutBreakdown.AddGPU(TEXT("LODRemapWeights"), GetBufferSize(LODRemapWeightsBuffer));
+	OutBreakdown.AddGPU(TEXT("LODRemapOffsets"), GetBufferSize(LODRemapOffsetsBuffer));
+	OutBreakdown.AddGPU(TEXT("RigidSplatPositions"), GetBufferSize(RigidSplatPositionsBuffer));
+	OutBreakdown.AddGPU(TEXT("RigidSplatBones"), GetBufferSize(RigidSplatBonesBuffer));
+	OutBreakdown.AddGPU(TEXT("MorphVertexSlots"), GetBufferSize(MorphVertexSlotsBuffer));
+	OutBreakdown.AddGPU(TEXT("MorphDeltas"), GetBufferSize(MorphDeltasBuffer));
+	OutBreakdown.AddGPU(TEXT("MorphOffsets (pooled)"), MorphOffsets.IsValid() ? MorphOffsets->GetSize() : 0);
+	OutBreakdown.AddCPU(TEXT("BonePaletteRing"), BonePalettes.GetAllocatedSize());
+}
+
+// GPU Proxy - called before Niagara simulation on GPU
+void FNiagaraDataInterfaceGVRMProxy::PreStage(const FNDIGpuComputePreStageContext& Context)
+{
+	// Mesh streams are set in ProvidePerInstanceDataForRenderThread; bone matrices and active morphs come from the palette ring
+	UpdateBonePalette_RenderThread(Context.GetGraphBuilder());
+}
+
+void FNiagaraDataInterfaceGVRMProxy::UpdateBonePalette_RenderThread(FRDGBuilder& GraphBuilder)
+{
+	check(IsInRenderingThread());
+
+	// Several stages may run per frame; only the first one consumes a palette
+	if (LastPaletteFrame == GFrameNumberRenderThread)
+	{
+		return;
+	}
+	LastPaletteFrame = GFrameNumberRenderThread;
+
+	const FGVRMBonePalette* Palette = BonePalettes.AcquireLatest();
+	if (!Palette)
+	{
+		INC_DWORD_STAT(STAT_GVRM_LateBonePalettes);
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_GVRM_NDIRenderUpload);
+	GVRMRender::UpdateBuffer(TEXT("GVRMBoneMatrices"), Palette->BoneMatrices, sizeof(FVector4f), PF_A32B32G32R32F,
+		BoneMatricesBuffer, BoneMatricesSRV);
+
+	AddMorphPass_RenderThread(GraphBuilder, Palette->ActiveMorphs);
+}
+
+void FNiagaraDataInterfaceGVRMProxy::AddMorphPass_RenderThread(FRDGBuilder& GraphBuilder, TConstArrayView<FGVRMActiveMorph> ActiveMorphs)
+{
+	check(IsInRenderingThread());
+
+	if (NumMorphSlots == 0 || !MorphDeltasSRV.IsValid())
+	{
+		MorphOffsets.SafeRelease();
+		return;
+	}
+
+	// Nothing to add and nothing left from an earlier frame: the offsets stay zero
+	if (ActiveMorphs.Num() == 0 && bMorphOffsetsCleared && MorphOffsets.IsValid())
+	{
+		return;
+	}
+
+	const FRDGBufferDesc OffsetsDesc = FRDGBufferDesc::CreateBufferDesc(sizeof(int32), NumMorphSlots * 3);
+	FRDGBufferRef OffsetsBuffer = MorphOffsets.IsValid() && MorphOffsets->Desc == OffsetsDesc
+		? GraphBuilder.RegisterExternalBuffer(MorphOffsets)
+		: GraphBuilder.CreateBuffer(OffsetsDesc, TEXT("GVRM.MorphOffsets"));
+	FRDGBufferUAVRef OffsetsUAV = GraphBuilder.CreateUAV(OffsetsBuffer, PF_R32_SINT);
+	AddClearUAVPass(GraphBuilder, OffsetsUAV, 0u);
+
+	const FGVRMActiveMorph& LastMorph = ActiveMorphs.Num() > 0 ? ActiveMorphs.Last() : FGVRMActiveMorph();
+	const uint32 NumMorphThreads = LastMorph.FirstThread + LastMorph.NumDeltas;
+	if (NumMorphThreads > 0)
+	{
+		FRDGBufferRef ActiveMorphsBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GVRM.ActiveMorphs"),
+			sizeof(FGVRMActiveMorph), ActiveMorphs.Num(), ActiveMorphs.GetData(), ActiveMorphs.Num() * sizeof(FGVRMActiveMorph));
+
+		FGVRMSplatMorphAccumulateCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGVRMSplatMorphAccumulateCS::FParameters>();
+		PassParameters->NumActiveMorphs = ActiveMorphs.Num();
+		PassParameters->NumMorphThreads = NumMorphThreads;
+		PassParameters->ActiveMorphs = GraphBuilder.CreateSRV(ActiveMorphsBuffer);
+		PassParameters->MorphDeltas = MorphDeltasSRV;
+		PassParameters->RWMorphOffsets = OffsetsUAV;
+
+		TShaderMapRef<FGVRMSplatMorphAccumulateCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("GVRMAccumulateMorphs (%u deltas)", NumMorphThreads), ComputeShader, PassParameters,
+			FComputeShaderUtils::GetGroupCountWrapped(NumMorphThreads, FGVRMSplatMorphAccumulateCS::ThreadGroupSize));
+	}
+
+	MorphOffsets = GraphBuilder.ConvertToExternalBuffer(OffsetsBuffer);
+	bMorphOffsetsCleared = NumMorphThreads == 0;
+}
+
+bool FNiagaraDataInterfaceGVRMProxy::BindEngineMeshBuffers_RenderThread(const FSkeletalMeshLODRenderData& LODData)
+{
+	check(IsInRenderingThread());
+
+	using namespace GVRMRender;
+	ReleaseBuffer(VertexPositionsBuffer, VertexPositionsSRV);
+	ReleaseBuffer(VertexTangentsBuffer, VertexTangentsSRV);
+	ReleaseBuffer(SkinWeightsBuffer, SkinWeightsSRV);
+	SkinWeightLookupSRV.SafeRelease();
+	bBindsEngineMeshBuffers = false;
+
+	// The game thread picked the LOD a frame ago; its buffers may have been released on this thread since
+	const FSkinWeightVertexBuffer* SkinWeightBuffer = LODData.GetSkinWeightVertexBuffer();
+	if (!LODData.StaticVertexBuffers.PositionVertexBuffer.IsInitialized() || !LODData.StaticVertexBuffers.StaticMeshVertexBuffer.IsInitialized()
+		|| !SkinWeightBuffer || !SkinWeightBuffer->GetDataVertexBuffer() || !SkinWeightBuffer->GetDataVertexBuffer()->IsInitialized())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("GVRM - Skeletal mesh LOD %d buffers were released before binding; sending the streams again next frame"), LODIndex);
+		return false;
+	}
+
+	VertexPositionsSRV = LODData.StaticVertexBuffers.PositionVertexBuffer.GetSRV();
+	VertexTangentsSRV = LODData.StaticVertexBuffers.StaticMeshVertexBuffer.GetTangentsSRV();
+
+	const bool bVariableInfluences = SkinWeightBuffer->GetVariableBonesPerVertex();
+	SkinWeightsSRV = SkinWeightBuffer->GetDataVertexBuffer()->GetSRV();
+	SkinWeightLookupSRV = bVariableInfluences ? SkinWeightBuffer->GetLookupVertexBuffer()->GetSRV() : nullptr;
+	SkinWeightStride = bVariableInfluences ? 0 : SkinWeightBuffer->GetConstantInfluencesVertexStride();
+	NumSkinWeightInfluences = SkinWeightBuffer->GetMaxBoneInfluences();
+	SkinWeightFormat = (SkinWeightBuffer->Use16BitBoneIndex() ? SkinWeight16BitIndices : 0)
+		| (SkinWeightBuffer->Use16BitBoneWeight() ? SkinWeight16BitWeights : 0);
+	bBindsEngineMeshBuffers = true;
+
+	if (!VertexPositionsSRV.IsValid() || !VertexTangentsSRV.IsValid() || !SkinWeightsSRV.IsValid()
+		|| (SkinWeightStride == 0 && !SkinWeightLookupSRV.IsValid()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GVRM - Skeletal mesh LOD %d has no shader resource views for its vertex buffers; disable bBindEngineMeshBuffers to upload copies"), LODIndex);
+	}
+	return true;
+}
+
+// GPU Proxy - called after Niagara simulation on GPU
+void FNiagaraDataInterfaceGVRMProxy::PostStage(const FNDIGpuComputePostStageContext& Context)
+{
+	// No per-stage cleanup needed - resources managed by proxy lifetime
 }
 
+// Provide per-instance data for render thread
+void UNiagaraDataInterfaceGVRM::ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance)
+{
+	FNiagaraDataInterfaceGVRMInstanceData* SourceData = static_cast<FNiagaraDataInterfaceGVRMInstanceData*>(PerInstanceData);
+	FNiagaraDataInterfaceGVRMProxy* TargetProxy = static_cast<FNiagaraDataInterfaceGVRMProxy*>(DataForRenderThread);
+
+	if (!SourceData || !SourceData->bCacheValid)
+	{
+		return;
+	}
+
+	// A capture may have finished animation since PerInstanceTick
+	SourceData->WaitForPoseCapture();
+
+	// Copy buffer dimensions
+	TargetProxy->NumVertices = SourceData->NumVertices;
+	TargetProxy->NumBones = SourceData->NumBones;
+	TargetProxy->MaxBoneInfluences = MaxBoneInfluences;
+	TargetProxy->LODIndex = SourceData->CachedLODIndex;
+	TargetProxy->NumRemapVertices = SourceData->NumRemapVertices;
+
+	// Rigid streams depend only on the binding data; send them the first frame a rigid mode is selected
+	const EGVRMSkinningMode EffectiveSkinningMode = GetEffectiveSkinningMode();
+	if (EffectiveSkinningMode != EGVRMSkinningMode::LinearBlend && !SourceData->bRigidDataSent)
+	{
+		SourceData->bRigidDataSent = true;
+
+		TArray<FVector4f> RigidPositions;
+		TArray<FIntVector2> RigidBones;
+		RigidPositions.SetNumUninitialized(BindingData->RigidBindings.Num());
+		RigidBones.SetNumUninitialized(BindingData->RigidBindings.Num());
+		for (int32 SplatIndex = 0; SplatIndex < BindingData->RigidBindings.Num(); ++SplatIndex)
+		{
+			const FGVRMRigidSplatBinding& Rigid = BindingData->RigidBindings[SplatIndex];
+			RigidPositions[SplatIndex] = FVector4f(Rigid.HostPosition, Rigid.SecondaryWeight);
+			RigidBones[SplatIndex] = FIntVector2(BindingData->GetPaletteSlot(Rigid.PrimaryBone), BindingData->GetPaletteSlot(Rigid.SecondaryBone));
+		}
+
+		ENQUEUE_RENDER_COMMAND(UpdateGVRMRigidBuffers)(
+			[TargetProxy, RigidPositions = MoveTemp(RigidPositions), RigidBones = MoveTemp(RigidBones)](FRHICommandListImmediate& RHICmdList)
+			{
+				SCOPE_CYCLE_COUNTER(STAT_GVRM_NDIRenderUpload);
+				using namespace GVRMRender;
+
+				UploadBuffer(TEXT("GVRMRigidSplatPositions"), RigidPositions, sizeof(FVector4f), PF_A32B32G32R32F,
+					TargetProxy->RigidSplatPositionsBuffer, TargetProxy->RigidSplatPositionsSRV);
+				UploadBuffer(TEXT("GVRMRigidSplatBones"), RigidBones, sizeof(FIntVector2), PF_R32G32_SINT,
+					TargetProxy->RigidSplatBonesBuffer, TargetProxy->RigidSplatBonesSRV);
+			}
+		);
+	}
+	TargetProxy->SkinningMode = SourceData->bRigidDataSent ? static_cast<int32>(EffectiveSkinningMode) : 0;
+
+	// Bone matrices go through the palette ring: no per-frame allocation, and the
+	// render thread picks up the newest palette in PreStage
+	FGVRMBonePalette& Palette = TargetProxy->BonePalettes.BeginWrite(SourceData->CachedBoneMatrices.Num());
+	GVRMSkinning::PackBoneMatrices(SourceData->CachedBoneMatrices, Palette.BoneMatrices);
+	Palette.ActiveMorphs = SourceData->ActiveMorphs;
+	Palette.FrameNumber = GFrameCounter;
+	if (TargetProxy->BonePalettes.Publish())
+	{
+		INC_DWORD_STAT(STAT_GVRM_DroppedBonePalettes);
+	}
+
+	// A bind that found the LOD's buffers released sends the streams again
+	if (TargetProxy->bEngineMeshBindFailed.exchange(false))
+	{
+		SourceData->bStaticDataDirty = true;
+	}
+
+	// Vertex, skin weight and remap streams are only re-sent after a LOD or mesh change.
+	// Copy to local variables for safe capture (avoid cross-thread pointer access).
+	if (!SourceData->bStaticDataDirty)
+	{
+		return;
+	}
+	SourceData->bStaticDataDirty = false;
+
+	// With the engine's buffers bound only the palette slot table goes up; bone
+	// indices of the copies are already palette slots
+	TRefCountPtr<const FSkeletalMeshLODRenderData> EngineLODData;
+	if (ShouldBindEngineMeshBuffers())
+	{
+		EngineLODData = SourceData->CachedLODRenderData;
+	}
+	TArray<int32> BoneSlots;
+	TArray<FVector3f> VertexPositions;
+	TArray<FVector4f> VertexTangents;
+	TArray<uint32> SkinWeights;
+	if (EngineLODData.IsValid())
+	{
+		if (SourceData->CachedPaletteBones.Num() > 0)
+		{
+			BoneSlots = BindingData->BonePaletteSlots;
+		}
+	}
+	else
+	{
+		// Copies in the engine's layouts, so the shaders decode one format
+		VertexPositions = SourceData->CachedVertexPositions;
+		VertexTangents.SetNumZeroed(SourceData->CachedVertexNormals.Num() * 2);
+		for (int32 VertexIndex = 0; VertexIndex < SourceData->CachedVertexNormals.Num(); ++VertexIndex)
+		{
+			VertexTangents[VertexIndex * 2 + 1] = FVector4f(SourceData->CachedVertexNormals[VertexIndex], 0.0f);
+		}
+		GVRMCacheKernels::PackSkinWeights(*SourceData, SkinWeights);
+	}
+
+	const uint32 NumInfluences = SourceData->NumInfluences;
+	TArray<FIntVector4> LODRemapIndices = SourceData->CachedLODRemapIndices;
+	TArray<FVector4f> LODRemapWeights = SourceData->CachedLODRemapWeights;
+	TArray<FVector4f> LODRemapOffsets = SourceData->CachedLODRemapOffsets;
+	TArray<int32> MorphVertexSlots = SourceData->CachedMorphVertexSlots;
+	TArray<FVector4f> MorphDeltas = SourceData->CachedMorphDeltas;
+	const int32 NumMorphSlots = SourceData->NumMorphSlots;
+
+	// Create GPU buffers on render thread. The reference keeps the LOD render data
+	// alive; whether its buffers still are is checked there.
+	ENQUEUE_RENDER_COMMAND(UpdateGVRMGPUBuffers)(
+		[TargetProxy, EngineLODData = MoveTemp(EngineLODData), NumInfluences, BoneSlots = MoveTemp(BoneSlots), VertexPositions = MoveTemp(VertexPositions),
+		VertexTangents = MoveTemp(VertexTangents), SkinWeights = MoveTemp(SkinWeights),
+		LODRemapIndices = MoveTemp(LODRemapIndices), LODRemapWeights = MoveTemp(LODRemapWeights), LODRemapOffsets = MoveTemp(LODRemapOffsets),
+		MorphVertexSlots = MoveTemp(MorphVertexSlots), MorphDeltas = MoveTemp(MorphDeltas), NumMorphSlots](FRHICommandListImmediate& RHICmdList)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_GVRM_NDIRenderUpload);
+			using namespace GVRMRender;
+
+			if (EngineLODData.IsValid())
+			{
+				if (!TargetProxy->BindEngineMeshBuffers_RenderThread(*EngineLODData))
+				{
+					TargetProxy->bEngineMeshBindFailed = true;
+				}
+			}
+			else
+			{
+				UploadBuffer(TEXT("GVRMVertexPositions"), VertexPositions, sizeof(float), PF_R32_FLOAT,
+					TargetProxy->VertexPositionsBuffer, TargetProxy->VertexPositionsSRV);
+				UploadBuffer(TEXT("GVRMVertexTangents"), VertexTangents, sizeof(FVector4f), PF_A32B32G32R32F,
+					TargetProxy->VertexTangentsBuffer, TargetProxy->VertexTangentsSRV);
+				UploadBuffer(TEXT("GVRMSkinWeights"), SkinWeights, sizeof(uint32), PF_R32_UINT,
+					TargetProxy->SkinWeightsBuffer, TargetProxy->SkinWeightsSRV);
+				TargetProxy->SkinWeightLookupSRV.SafeRelease();
+				TargetProxy->SkinWeightStride = NumInfluences * sizeof(uint32);
+				TargetProxy->NumSkinWeightInfluences = NumInfluences;
+				TargetProxy->SkinWeightFormat = FNiagaraDataInterfaceGVRMProxy::SkinWeight16BitIndices | FNiagaraDataInterfaceGVRMProxy::SkinWeight16BitWeights;
+				TargetProxy->bBindsEngineMeshBuffers = false;
+			}
+
+			UploadBuffer(TEXT("GVRMBoneSlots"), BoneSlots, sizeof(int32), PF_R32_SINT,
+				TargetProxy->BoneSlotsBuffer, TargetProxy->BoneSlotsSRV);
+			TargetProxy->NumBoneSlots = BoneSlots.Num();
+
+			// Empty remaps (LOD0) release the previous LOD's buffers
+			UploadBuffer(TEXT("GVRMLODRemapIndices"), LODRemapIndices, sizeof(int32), PF_R32_SINT,
+				TargetProxy->LODRemapIndicesBuffer, TargetProxy->LODRemapIndicesSRV);
+			UploadBuffer(TEXT("GVRMLODRemapWeights"), LODRemapWeights, sizeof(FVector4f), PF_A32B32G32R32F,
+				TargetProxy->LODRemapWeightsBuffer, TargetProxy->LODRemapWeightsSRV);
+			UploadBuffer(TEXT("GVRMLODRemapOffsets"), LODRemapOffsets, sizeof(FVector4f), PF_A32B32G32R32F,
+				TargetProxy->LODRemapOffsetsBuffer, TargetProxy->LODRemapOffsetsSRV);
+
+			// Meshes without morph targets on bound vertices release them (the offsets follow in PreStage)
+			UploadBuffer(TEXT("GVRMMorphVertexSlots"), MorphVertexSlots, sizeof(uint32), PF_R32_UINT,
+				TargetProxy->MorphVertexSlotsBuffer, TargetProxy->MorphVertexSlotsSRV);
+			UploadBuffer(TEXT("GVRMMorphDeltas"), MorphDeltas, sizeof(FVector4f), PF_A32B32G32R32F,
+				TargetProxy->MorphDeltasBuffer, TargetProxy->MorphDeltasSRV);
+			TargetProxy->NumMorphVertexSlots = MorphVertexSlots.Num();
+			TargetProxy->NumMorphSlots = NumMorphSlots;
+			TargetProxy->bMorphOffsetsCleared = false;
+		}
+	);
+}
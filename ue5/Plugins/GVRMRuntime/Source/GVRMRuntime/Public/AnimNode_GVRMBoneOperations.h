@@ -0,0 +1,64 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNodeBase.h"
+#include "AnimNode_GVRMBoneOperations.generated.h"
+
+class UGVRMBindingData;
+
+/**
+ * Applies the bone operations of GVRM binding data (the pose adjustments from
+ * GVRM preprocessing) to the local-space pose.
+ *
+ * Bone names are resolved to compact pose indices and the rotations converted
+ * to quaternions in CacheBones, i.e. on initialization and whenever the required
+ * bones change (mesh LOD). Evaluation is a loop over the resolved operations, safe
+ * on animation worker threads.
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct GVRMRUNTIME_API FAnimNode_GVRMBoneOperations : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+	/** Input pose */
+	UPROPERTY(EditAnywhere, Category = "Links")
+	FPoseLink Source;
+
+	/** Binding data whose BoneOperations are applied */
+	UPROPERTY(EditAnywhere, Category = "GVRM", meta = (PinHiddenByDefault))
+	TObjectPtr<UGVRMBindingData> BindingData;
+
+	/** Blend weight of the operations (0 passes the input pose through) */
+	UPROPERTY(EditAnywhere, Category = "GVRM", meta = (PinShownByDefault, ClampMin = "0.0", ClampMax = "1.0"))
+	float Alpha = 1.0f;
+
+	// FAnimNode_Base interface
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+
+private:
+	/** One operation resolved against the current required bones */
+	struct FResolvedOperation
+	{
+		FCompactPoseBoneIndex BoneIndex = FCompactPoseBoneIndex(INDEX_NONE);
+		FQuat Rotation = FQuat::Identity;
+		FVector PositionOffset = FVector::ZeroVector;
+	};
+
+	/** Rebuild ResolvedOperations for the given required bones */
+	void ResolveOperations(const FBoneContainer& RequiredBones);
+
+	TArray<FResolvedOperation> ResolvedOperations;
+
+	/** Binding data ResolvedOperations were built from */
+	TWeakObjectPtr<const UGVRMBindingData> ResolvedBindingData;
+
+	/** Operations of the binding data whose bone is not in the current required bones */
+	int32 NumUnresolvedOperations = 0;
+};
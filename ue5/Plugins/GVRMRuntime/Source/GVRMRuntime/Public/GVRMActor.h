@@ -9,8 +9,24 @@
 #include "NiagaraComponent.h"
 #include "NiagaraSystem.h"
 #include "GVRMSkinningData.h"
+#include "GVRMSplatComponent.h"
+#include "GVRMAnimationCache.h"
+#include "GVRMSplatBounds.h"
 #include "GVRMActor.generated.h"
 
+/**
+ * Which renderer draws the Gaussian splats.
+ */
+UENUM(BlueprintType)
+enum class EGVRMSplatRenderer : uint8
+{
+	/** Niagara system with the GVRM data interface */
+	Niagara,
+
+	/** UGVRMSplatComponent (compute skinning, sort and instanced draw without Niagara) */
+	SplatComponent
+};
+
 /**
  * GVRM Actor - Combines VRM skeletal mesh with Gaussian Splat animation.
  *
@@ -23,7 +39,7 @@
  * 1. Place actor in level
  * 2. Assign VRM skeletal mesh
  * 3. Assign GVRM binding data asset
- * 4. Assign Niagara system for splat rendering
+ * 4. Assign Niagara system for splat rendering (or select the SplatComponent renderer)
  * 5. (Optional) Play animation on skeletal mesh
  */
 UCLASS(BlueprintType, Blueprintable)
@@ -36,6 +52,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -52,6 +69,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|Components")
 	TObjectPtr<UNiagaraComponent> SplatNiagaraSystem;
 
+	/** Niagara-free splat renderer (used when SplatRenderer is SplatComponent) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|Components")
+	TObjectPtr<UGVRMSplatComponent> SplatComponent;
+
 	// ============================================
 	// Configuration
 	// ============================================
@@ -60,6 +81,29 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
 	TObjectPtr<UGVRMBindingData> BindingData;
 
+	/** Renderer used for the splats */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
+	EGVRMSplatRenderer SplatRenderer = EGVRMSplatRenderer::Niagara;
+
+	/**
+	 * Baked animation to play instead of animating and skinning (SplatComponent renderer only).
+	 * The skeletal mesh stops ticking while the cache plays and only places the splats.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
+	TObjectPtr<UGVRMAnimationCache> AnimationCache;
+
+	/**
+	 * How splats follow the skeleton. The rigid modes need rigid bindings in the
+	 * binding data (built from its SourceSkeletalMesh) and fall back to linear
+	 * blend skinning, with a warning, without them.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
+	EGVRMSkinningMode SkinningMode = EGVRMSkinningMode::LinearBlend;
+
+	/** Switch to blended rigid skinning from this splat LOD on (-1 = never, SplatComponent renderer only) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration", meta = (ClampMin = "-1"))
+	int32 RigidSkinningMinLOD = -1;
+
 	/** Niagara system asset for splat rendering */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
 	TObjectPtr<UNiagaraSystem> SplatNiagaraSystemAsset;
@@ -76,6 +120,25 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
 	bool bApplyModelScale = true;
 
+	/**
+	 * Simulate the VRM spring bones of the binding data (UGVRMSpringBoneSubsystem).
+	 * The result moves the splats only; the skeletal mesh pose is not changed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
+	bool bSimulateSpringBones = true;
+
+	/**
+	 * Give the Niagara system fixed bounds every frame, carried by the pose from
+	 * the splats' per-bone extents (FGVRMSplatBounds), so culling and shadows need
+	 * no GPU readback. Off: the system asset's own bounds apply.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration")
+	bool bPushSplatBounds = true;
+
+	/** Margin around the pushed bounds (morph targets, LOD remaps, a frame of spring bone lag) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Configuration", meta = (ClampMin = "0.0"))
+	float SplatBoundsPadding = 20.0f;
+
 	// ============================================
 	// Runtime State
 	// ============================================
@@ -100,7 +163,8 @@ public:
 	bool InitializeGVRM();
 
 	/**
-	 * Apply bone operations from binding data to VRM skeleton.
+	 * Check the bone operations from binding data against the VRM skeleton.
+	 * The pose itself is adjusted by FAnimNode_GVRMBoneOperations in the mesh's animation blueprint.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "GVRM")
 	void ApplyBoneOperations();
@@ -151,12 +215,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Debug")
 	bool bShowBones = false;
 
-	/** Show vertex visualization (sampled) */
+	/** Show vertex visualization (sampled bound vertices and lines to their splats) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Debug")
 	bool bShowVertices = false;
 
 	/**
 	 * Draw debug visualization (bones, vertices).
+	 * Rendered on the GPU by the splat component from its skinned buffers
+	 * (SplatComponent renderer only); this only forwards the toggles.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "GVRM|Debug")
 	void DrawDebugVisualization();
@@ -181,16 +247,70 @@ protected:
 	 */
 	bool SetupNiagaraDataInterface();
 
+	/**
+	 * Assign the Niagara system asset and configure its data interface.
+	 */
+	bool SetupNiagaraSystem();
+
+	/**
+	 * Configure the splat component with skeletal mesh and binding data.
+	 */
+	bool SetupSplatComponent();
+
+	/**
+	 * Register the binding data's spring chains with the world's spring bone solver
+	 * and order the splat renderers after it.
+	 */
+	void SetupSpringBones();
+
+	/**
+	 * Push the splat bounds to the Niagara system whenever the skeletal mesh
+	 * finalizes its pose, or once the spring bones are solved when they are
+	 * simulated (Niagara renderer and bPushSplatBounds only).
+	 */
+	void SetupSplatBounds();
+
 	/**
 	 * Update performance stats.
 	 */
 	void UpdatePerformanceStats(float DeltaTime);
 
 private:
+	/** Retry initialization (and track the splat count) as streamed splats of BindingData arrive */
+	void HandleSplatStreamsUpdated();
+
+	/** OnSplatStreamsUpdated binding while waiting for streamed splats */
+	FDelegateHandle SplatStreamsHandle;
+
+	/** Carry the splat bounds to the finalized pose, spring bones included, and set them on the Niagara system */
+	void UpdateSplatBounds();
+	void RemoveSplatBounds();
+
+	/** Bone transforms finalized binding on VRMSkeletalMesh while pushing bounds without spring bones */
+	FDelegateHandle BoneTransformsFinalizedHandle;
+
+	/** Spring bone subsystem OnSolved binding while pushing bounds with spring bones */
+	FDelegateHandle SpringBonesSolvedHandle;
+
+	/** Restart the spring chains when VRMSkeletalMesh teleports */
+	void HandleSkeletalMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** TransformUpdated binding on VRMSkeletalMesh while it has spring bones */
+	FDelegateHandle SkeletalMeshTransformHandle;
+
+	/** Per-bone splat boxes of BindingData on the skeletal mesh */
+	FGVRMSplatBounds SplatBounds;
+
+	/** Copy of the finalized pose with the spring bones applied */
+	TArray<FTransform> SplatBoundsPose;
+
 	/** FPS tracking */
 	float LastFrameTime = 0.0f;
 	float CurrentFPS = 0.0f;
 
 	/** Frame counter for stats */
 	int32 FrameCounter = 0;
+
+	/** The debug view needs the SplatComponent renderer; warned once */
+	bool bLoggedDebugRendererWarning = false;
 };
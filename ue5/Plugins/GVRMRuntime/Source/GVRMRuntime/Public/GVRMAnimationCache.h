@@ -0,0 +1,215 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "RenderResource.h"
+#include "RenderCommandFence.h"
+#include "Serialization/BulkData.h"
+#include "GVRMAnimationCache.generated.h"
+
+class UAnimSequence;
+class USkeletalMesh;
+class UGVRMBindingData;
+struct FGVRMMemoryBreakdown;
+
+/**
+ * Memory versus quality of a baked animation cache.
+ * Errors are measured against the uncompressed skinned splats of every frame.
+ */
+USTRUCT(BlueprintType)
+struct GVRMRUNTIME_API FGVRMAnimationCacheReport
+{
+	GENERATED_BODY()
+
+	/** Size of the frames as raw float positions and rotations (bytes) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	int64 RawBytes = 0;
+
+	/** Size of the encoded frames plus bind positions (bytes) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	int64 CompressedBytes = 0;
+
+	/** RawBytes / CompressedBytes */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	float CompressionRatio = 0.0f;
+
+	/** Largest splat position error (cm) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	float MaxPositionError = 0.0f;
+
+	/** Root mean square splat position error (cm) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	float RMSPositionError = 0.0f;
+
+	/** Largest splat rotation error (degrees) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	float MaxRotationErrorDegrees = 0.0f;
+};
+
+/**
+ * GPU copy of an animation cache, shared by every splat component playing it.
+ * The encoded frames are uploaded once, on first playback.
+ */
+class GVRMRUNTIME_API FGVRMAnimationCacheResource : public FRenderResource
+{
+public:
+	/** Encoded frames and bind positions, consumed by InitRHI */
+	TArray<uint32> PendingFrameData;
+	TArray<FVector4f> PendingBindPositions;
+
+	FBufferRHIRef FrameDataBuffer;
+	FShaderResourceViewRHIRef FrameDataSRV;
+	FBufferRHIRef BindPositionsBuffer;
+	FShaderResourceViewRHIRef BindPositionsSRV;
+
+	// FRenderResource Interface
+	virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
+	virtual void ReleaseRHI() override;
+	virtual FString GetFriendlyName() const override { return TEXT("FGVRMAnimationCacheResource"); }
+};
+
+/**
+ * GVRM Animation Cache - Skinned splats of one animation, baked for playback.
+ *
+ * Holds per-frame splat positions and rotations as they come out of GVRM
+ * skinning. Playing it back (UGVRMSplatComponent::AnimationCache) replaces
+ * skeletal animation and skinning with one decode pass, which suits crowds
+ * and background avatars with canned motion.
+ *
+ * Encoding (quantized delta against the bind pose):
+ * - splats are grouped in clusters of ClusterSize; each frame stores a float
+ *   range per cluster and 16-bit positions within it
+ * - rotations are smallest-three quaternions (16 + 15 + 15 bits + 2-bit index)
+ * - 12 bytes per splat per frame instead of 28
+ *
+ * The frames live in bulk data outside the export, so loading the asset does
+ * not load them; playback reads them in the background the first time it
+ * needs them, then uploads them and drops the CPU copy.
+ *
+ * Baked with the GVRMBakeCache commandlet (GVRMEditor module).
+ */
+UCLASS(BlueprintType)
+class GVRMRUNTIME_API UGVRMAnimationCache : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Splats per cluster sharing one quantization range */
+	static constexpr int32 ClusterSize = 256;
+
+	/** Animation the cache was baked from */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TSoftObjectPtr<UAnimSequence> SourceAnimation;
+
+	/** Binding data the cache was baked for (splat count and order must match at playback) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TSoftObjectPtr<UGVRMBindingData> SourceBindingData;
+
+	/** Number of splats per frame */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	int32 NumSplats = 0;
+
+	/** Number of baked frames */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	int32 NumFrames = 0;
+
+	/** Frames per second */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	float SampleRate = 30.0f;
+
+	/** Whether playback wraps around (the last baked frame is the end of the animation) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	bool bLooping = true;
+
+	/** Bounds of all splats over all frames (skeletal mesh component space) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FBox Bounds = FBox(ForceInit);
+
+	/** Memory and error figures of the last bake */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FGVRMAnimationCacheReport Report;
+
+	/** Splat positions at the reference pose (component space) */
+	UPROPERTY()
+	TArray<FVector3f> BindPositions;
+
+	/** Playback length in seconds */
+	float GetDuration() const;
+
+	/** Number of clusters per frame */
+	int32 GetNumClusters() const { return FMath::DivideAndRoundUp(NumSplats, ClusterSize); }
+
+	/** Offset of the splat words within a frame (32-bit words) */
+	uint32 GetSplatDataOffset() const { return GetNumClusters() * 6; }
+
+	/** Size of one encoded frame (32-bit words) */
+	uint32 GetFrameStride() const { return GetSplatDataOffset() + NumSplats * 3; }
+
+	/** Frames around Time and the blend between them */
+	void GetFramesAtTime(float Time, int32& OutFrame0, int32& OutFrame1, float& OutAlpha) const;
+
+	/**
+	 * Get the GPU resource, starting the upload on first use. Frames that are
+	 * not in memory are first read from bulk data on an IO thread; until that
+	 * read completes this returns nullptr, so call it again on later frames.
+	 * Game thread only.
+	 */
+	FGVRMAnimationCacheResource* RequestResource();
+
+	/**
+	 * Decode one frame on the CPU (component space positions, (x, y, z, w) rotations).
+	 * Reads the frames from bulk data if they are not loaded.
+	 */
+	bool DecodeFrame(int32 FrameIndex, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations);
+
+	/** Encoded frame data (reads it from bulk data, blocking, if needed: for tools, not playback) */
+	const TArray<uint32>& GetFrameData();
+
+	/**
+	 * Encode frames into this cache, replacing its contents, and fill Report.
+	 * GetFrame is called once per frame, in order, and must output one position
+	 * and one (x, y, z, w) rotation per bind position (component space).
+	 */
+	bool EncodeFrames(TArray<FVector3f> InBindPositions, int32 InNumFrames, float InSampleRate,
+		TFunctionRef<void(int32 FrameIndex, TArray<FVector3f>& OutPositions, TArray<FVector4f>& OutRotations)> GetFrame, FString& OutErrorMessage);
+
+#if WITH_EDITOR
+	/**
+	 * Bake splats skinned by an animation into this cache.
+	 * Samples the animation at SampleRate on the binding data's skeletal mesh
+	 * (LOD0), skinning exactly like the GPU paths, then encodes and measures
+	 * the error of every frame.
+	 */
+	bool BakeFromAnimation(UAnimSequence* Animation, USkeletalMesh* SkeletalMesh, const UGVRMBindingData* BindingData, float InSampleRate, FString& OutErrorMessage);
+#endif
+
+	/** CPU (frames, bind positions) and uploaded GPU bytes per stream */
+	void GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const;
+
+	// UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void BeginDestroy() override;
+	virtual bool IsReadyForFinishDestroy() override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+private:
+	/** Encoded frames (see class comment); not inline in the package */
+	FByteBulkData FrameBulkData;
+
+	/** Frames read from FrameBulkData (or freshly baked) */
+	TArray<uint32> FrameData;
+
+	/** Background read of FrameBulkData into FrameReadBuffer, started by RequestResource */
+	TUniquePtr<IBulkDataIORequest> PendingFrameRequest;
+	TArray<uint32> FrameReadBuffer;
+
+	/** Wait for PendingFrameRequest and move what it read into FrameData */
+	void FinishFrameRead();
+
+	FGVRMAnimationCacheResource Resource;
+	bool bResourceRequested = false;
+	FRenderCommandFence ReleaseFence;
+};
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GVRMSkinningMath.h"
+#include <atomic>
+
+/**
+ * One bone palette (component-space bone matrices of one frame), plus the
+ * morph targets active in the same frame.
+ */
+struct FGVRMBonePalette
+{
+	/** Component-space bone matrices, packed 3x4 for upload */
+	TArray<FGVRMBoneMatrix3x4> BoneMatrices;
+
+	/** Morph targets with a weight this frame (FirstThread relative to this palette's first) */
+	TArray<FGVRMActiveMorph> ActiveMorphs;
+
+	/** Transform of the skinned mesh (only used by the splat component) */
+	FMatrix LocalToWorld = FMatrix::Identity;
+
+	/** EGVRMSkinningMode for this frame (only used by the splat component) */
+	uint8 SkinningMode = 0;
+
+	/** Game frame the palette was written in */
+	uint64 FrameNumber = 0;
+};
+
+/**
+ * Lock-free triple buffer for handing bone palettes from the game thread to the render thread.
+ *
+ * The producer always owns one slot, the consumer owns another, and the third
+ * is exchanged through a single atomic. Publishing never waits for the render
+ * thread and reading never waits for the game thread. Slot storage is only
+ * reallocated when the bone count changes.
+ *
+ * Counters:
+ * - Dropped: a published palette was replaced before the render thread read it (render thread lagging)
+ * - Late: the render thread asked for a palette and nothing new had been published (game thread lagging)
+ *
+ * Single producer, single consumer.
+ */
+class FGVRMBonePaletteRing
+{
+public:
+	FGVRMBonePaletteRing() = default;
+
+	FGVRMBonePaletteRing(const FGVRMBonePaletteRing&) = delete;
+	FGVRMBonePaletteRing& operator=(const FGVRMBonePaletteRing&) = delete;
+
+	/**
+	 * Get the producer's slot sized for NumBones; producer thread only.
+	 * Fill it, then call Publish().
+	 */
+	FGVRMBonePalette& BeginWrite(int32 NumBones)
+	{
+		FGVRMBonePalette& Slot = Slots[WriteSlot];
+		if (Slot.BoneMatrices.Num() != NumBones)
+		{
+			Slot.BoneMatrices.SetNumUninitialized(NumBones);
+		}
+		return Slot;
+	}
+
+	/**
+	 * Make the producer's slot the latest palette; producer thread only.
+	 * Returns true if an unread palette was dropped in the process.
+	 */
+	bool Publish()
+	{
+		const uint32 Previous = SharedSlot.exchange(WriteSlot | FreshFlag, std::memory_order_acq_rel);
+		WriteSlot = Previous & SlotMask;
+
+		if (Previous & FreshFlag)
+		{
+			NumDropped.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Take the most recently published palette; consumer thread only.
+	 * Returns null when nothing new was published since the last call.
+	 */
+	const FGVRMBonePalette* AcquireLatest()
+	{
+		if ((SharedSlot.load(std::memory_order_relaxed) & FreshFlag) == 0)
+		{
+			if (bHasConsumed)
+			{
+				NumLate.fetch_add(1, std::memory_order_relaxed);
+			}
+			return nullptr;
+		}
+
+		const uint32 Previous = SharedSlot.exchange(ReadSlot, std::memory_order_acq_rel);
+		ReadSlot = Previous & SlotMask;
+		bHasConsumed = true;
+		return &Slots[ReadSlot];
+	}
+
+	/** Palettes overwritten before the render thread read them */
+	uint32 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	/** Render thread reads that found no new palette */
+	uint32 GetNumLate() const { return NumLate.load(std::memory_order_relaxed); }
+
+	/** Allocated slot storage in bytes */
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = 0;
+		for (const FGVRMBonePalette& Slot : Slots)
+		{
+			Size += Slot.BoneMatrices.GetAllocatedSize() + Slot.ActiveMorphs.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+private:
+	static constexpr uint32 SlotMask = 0x3;
+	static constexpr uint32 FreshFlag = 0x4;
+
+	FGVRMBonePalette Slots[3];
+
+	/** Slot being written by the producer */
+	uint32 WriteSlot = 0;
+
+	/** Slot last handed to the consumer */
+	uint32 ReadSlot = 1;
+
+	/** Slot in flight between the two threads, plus FreshFlag when unread */
+	std::atomic<uint32> SharedSlot{ 2 };
+
+	/** Whether the consumer has received at least one palette (late counting starts after) */
+	bool bHasConsumed = false;
+
+	std::atomic<uint32> NumDropped{ 0 };
+	std::atomic<uint32> NumLate{ 0 };
+};
@@ -0,0 +1,32 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+/**
+ * Serialization versions of GVRM assets saved in packages.
+ */
+struct GVRMRUNTIME_API FGVRMCustomVersion
+{
+	enum Type
+	{
+		// Before any version changes were made
+		BeforeCustomVersionWasAdded = 0,
+
+		// UGVRMBindingData splat streams moved from tagged properties to chunked bulk data
+		SplatStreamsInBulkData,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	/** The GUID for this custom version number */
+	const static FGuid GUID;
+
+private:
+	FGVRMCustomVersion() {}
+};
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-stream byte counts of one GVRM owner (asset, component, proxy, batch).
+ * Filled by the GetMemoryBreakdown functions and printed by GVRM.MemReport.
+ */
+struct FGVRMMemoryBreakdown
+{
+	struct FEntry
+	{
+		FString Name;
+		uint64 CPUBytes = 0;
+		uint64 GPUBytes = 0;
+	};
+
+	TArray<FEntry> Entries;
+
+	/** Add CPU memory (empty streams are skipped) */
+	void AddCPU(const FString& Name, uint64 Bytes)
+	{
+		if (Bytes > 0)
+		{
+			Entries.Add({ Name, Bytes, 0 });
+		}
+	}
+
+	/** Add GPU memory (empty streams are skipped) */
+	void AddGPU(const FString& Name, uint64 Bytes)
+	{
+		if (Bytes > 0)
+		{
+			Entries.Add({ Name, 0, Bytes });
+		}
+	}
+
+	/** Add the allocation of a CPU array */
+	template<typename ArrayType>
+	void AddArray(const TCHAR* Name, const ArrayType& Array)
+	{
+		AddCPU(Name, Array.GetAllocatedSize());
+	}
+
+	uint64 GetCPUBytes() const
+	{
+		uint64 Total = 0;
+		for (const FEntry& Entry : Entries)
+		{
+			Total += Entry.CPUBytes;
+		}
+		return Total;
+	}
+
+	uint64 GetGPUBytes() const
+	{
+		uint64 Total = 0;
+		for (const FEntry& Entry : Entries)
+		{
+			Total += Entry.GPUBytes;
+		}
+		return Total;
+	}
+};
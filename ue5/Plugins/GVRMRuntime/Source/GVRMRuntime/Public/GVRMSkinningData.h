@@ -5,8 +5,12 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Serialization/BulkData.h"
 #include "GVRMSkinningData.generated.h"
 
+class USkeletalMesh;
+struct FGVRMMemoryBreakdown;
+
 /**
  * Single splat binding information.
  * Maps a Gaussian splat to a VRM mesh vertex and bone.
@@ -78,11 +82,193 @@ struct GVRMRUNTIME_API FGVRMBoneOperation
 	}
 };
 
+/**
+ * VRM spring bone collider: a sphere, or a capsule from Offset to Tail,
+ * attached to a skeleton bone (offsets in the bone's space, cm).
+ */
+USTRUCT(BlueprintType)
+struct GVRMRUNTIME_API FGVRMSpringBoneCollider
+{
+	GENERATED_BODY()
+
+	/** Bone the collider follows */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FString BoneName;
+
+	/** Sphere center, or capsule start */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector Offset = FVector::ZeroVector;
+
+	/** Capsule end (ignored for spheres) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector Tail = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM", meta = (ClampMin = "0.0"))
+	float Radius = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	bool bCapsule = false;
+};
+
+/**
+ * VRM spring bone chain: consecutive bones from the root to the tip. Every
+ * bone but the tip is simulated, the next bone being its tail. Parameters
+ * follow VRMC_springBone (stiffness and gravity per second, in meters as in VRM).
+ */
+USTRUCT(BlueprintType)
+struct GVRMRUNTIME_API FGVRMSpringBoneChain
+{
+	GENERATED_BODY()
+
+	/** Bones from the chain root to the tip, each the parent of the next (at least two) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TArray<FString> BoneNames;
+
+	/** Pull back towards the animated direction */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM", meta = (ClampMin = "0.0"))
+	float Stiffness = 1.0f;
+
+	/** Share of the velocity lost per step (0 to 1) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float DragForce = 0.4f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM", meta = (ClampMin = "0.0"))
+	float GravityPower = 0.0f;
+
+	/** World space */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector GravityDir = FVector(0.0, 0.0, -1.0);
+
+	/** Radius of the bone tails against the colliders (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM", meta = (ClampMin = "0.0"))
+	float HitRadius = 0.0f;
+
+	/** Indices into UGVRMBindingData::SpringColliders this chain collides with */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TArray<int32> Colliders;
+};
+
+/**
+ * Gaussian appearance of a single splat in the bind pose.
+ * Decoded from the 3DGS PLY (activated scale/opacity, normalized rotation).
+ */
+USTRUCT(BlueprintType)
+struct GVRMRUNTIME_API FGVRMSplatGaussian
+{
+	GENERATED_BODY()
+
+	/** Bind-pose rotation quaternion (same space as RelativePosition) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FQuat4f Rotation = FQuat4f::Identity;
+
+	/** Linear scale along the Gaussian's local axes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector3f Scale = FVector3f::OneVector;
+
+	/** Base color from the SH DC term (display space) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector3f Color = FVector3f::OneVector;
+
+	/** Opacity in [0, 1] */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	float Opacity = 1.0f;
+};
+
+/**
+ * Maps a bound LOD0 vertex onto a triangle of a lower mesh LOD.
+ * The host position on that LOD is the barycentric blend of the three
+ * LOD vertices, and OffsetCorrection restores the LOD0 bind position.
+ */
+USTRUCT(BlueprintType)
+struct GVRMRUNTIME_API FGVRMLODVertexRemap
+{
+	GENERATED_BODY()
+
+	/** Vertex indices of the enclosing triangle in the target LOD */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FIntVector VertexIndices = FIntVector::ZeroValue;
+
+	/** Barycentric weights of VertexIndices (sum to 1.0) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector3f BarycentricWeights = FVector3f(1.0f, 0.0f, 0.0f);
+
+	/** LOD0 vertex position minus the blended LOD position (bind pose, component space) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector3f OffsetCorrection = FVector3f::ZeroVector;
+};
+
+/**
+ * How splats follow the skeleton.
+ */
+UENUM(BlueprintType)
+enum class EGVRMSkinningMode : uint8
+{
+	/** Linear blend skinning of the host vertex (up to 4 bones, follows the mesh LOD) */
+	LinearBlend,
+
+	/** Each splat moves rigidly with the dominant bone of its host vertex (one matrix per splat) */
+	RigidBone,
+
+	/** Rigid, blended with the second bone near joints by the precomputed secondary weight */
+	RigidBoneBlended
+};
+
+/**
+ * Rigid-bone binding of one splat (see UGVRMBindingData::BuildRigidBindings).
+ * With a single-bone host vertex, rigid skinning matches LBS exactly.
+ */
+USTRUCT(BlueprintType)
+struct GVRMRUNTIME_API FGVRMRigidSplatBinding
+{
+	GENERATED_BODY()
+
+	/** LOD0 bind position of the host vertex (component space) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	FVector3f HostPosition = FVector3f::ZeroVector;
+
+	/** Highest weighted bone of the host vertex (skin weight bone index, like the mesh streams) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	int32 PrimaryBone = 0;
+
+	/** Second highest weighted bone (PrimaryBone when the vertex has one influence) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	int32 SecondaryBone = 0;
+
+	/** Weight of SecondaryBone relative to the two (0 away from joints, up to 0.5 on them) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	float SecondaryWeight = 0.0f;
+};
+
+/**
+ * Precomputed binding of the splat host vertices to one lower mesh LOD.
+ */
+USTRUCT(BlueprintType)
+struct GVRMRUNTIME_API FGVRMLODBinding
+{
+	GENERATED_BODY()
+
+	/** Vertex count of the mesh LOD at import time (used to detect stale remaps) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	int32 NumLODVertices = 0;
+
+	/** One remap per entry of UGVRMBindingData::BoundVertexIndices */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TArray<FGVRMLODVertexRemap> VertexRemaps;
+};
+
 /**
  * GVRM Binding Data Asset.
  * Contains all splat-to-vertex/bone binding information from a GVRM file.
  *
  * This asset is generated by the gvrm_to_ue5.py tool from data.json.
+ *
+ * In packages, Bindings and Gaussians are saved as bulk data in chunks of
+ * SplatsPerChunk splats (flat per-stream arrays, no tagged properties). The
+ * editor reads every chunk on load; cooked builds stream them in the
+ * background after load, appending to Bindings and Gaussians in splat order
+ * and firing OnSplatStreamsUpdated, so the first splats can be drawn before
+ * the whole asset is in. Saves reuse the chunks built by the previous save
+ * while the splats still hash to what those chunks hold.
  */
 UCLASS(BlueprintType)
 class GVRMRUNTIME_API UGVRMBindingData : public UDataAsset
@@ -90,6 +276,9 @@ class GVRMRUNTIME_API UGVRMBindingData : public UDataAsset
 	GENERATED_BODY()
 
 public:
+	/** Splats per bulk data chunk of the saved splat streams */
+	static constexpr int32 SplatsPerChunk = 65536;
+
 	/** Array of all splat bindings */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
 	TArray<FSplatBindingInfo> Bindings;
@@ -102,12 +291,69 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
 	TArray<FGVRMBoneOperation> BoneOperations;
 
+	/** VRM spring bone chains (hair, skirts, accessories), simulated by UGVRMSpringBoneSubsystem */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|SpringBones")
+	TArray<FGVRMSpringBoneChain> SpringChains;
+
+	/** Colliders the spring chains refer to */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|SpringBones")
+	TArray<FGVRMSpringBoneCollider> SpringColliders;
+
 	/** GVRM file format version */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
 	FString Version = TEXT("1.0");
 
+	/** Per-splat Gaussian appearance, indexed like Bindings (required by UGVRMSplatComponent) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TArray<FGVRMSplatGaussian> Gaussians;
+
+	/** Sorted unique LOD0 vertex indices referenced by Bindings */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|LOD")
+	TArray<int32> BoundVertexIndices;
+
+	/** Per mesh LOD remaps of BoundVertexIndices (element 0 is mesh LOD 1) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|LOD")
+	TArray<FGVRMLODBinding> LODBindings;
+
+	/** Rigid-bone bindings, indexed like Bindings (empty until BuildRigidBindings) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|Rigid")
+	TArray<FGVRMRigidSplatBinding> RigidBindings;
+
+	/** Splat indices grouped by RigidBindings[].PrimaryBone, so each bone's splats are contiguous */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|Rigid")
+	TArray<int32> RigidSplatOrder;
+
+	/** Skin weight bone indices the splats can reach, sorted; palette slot i holds bone PaletteBones[i] (empty: full skeleton palette) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|Palette")
+	TArray<int32> PaletteBones;
+
+	/** Palette slot of every mesh bone (0 for bones outside the palette, which only appear with zero weight) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|Palette")
+	TArray<int32> BonePaletteSlots;
+
 	/**
-	 * Get the number of splats in this binding data.
+	 * Skin weight influences the skinning kernels read per vertex (1, 2, 4 or 8):
+	 * the smallest specialization holding every weighted influence the splats reach.
+	 * Measured on import by BuildBonePaletteFromMesh; 0 until then (see GetNumBoneInfluences).
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GVRM|Palette")
+	int32 NumBoneInfluences = 0;
+
+#if WITH_EDITORONLY_DATA
+	/**
+	 * VRM skeletal mesh the splats were bound to. When set, the mesh-derived
+	 * tables (LOD remaps, rigid bindings, bone palette) are built on import, when it changes, and when the
+	 * asset is saved with tables missing or stale (see BuildMeshData).
+	 */
+	UPROPERTY(EditAnywhere, Category = "GVRM|Import")
+	TSoftObjectPtr<USkeletalMesh> SourceSkeletalMesh;
+#endif
+
+	/** Fired on the game thread after streamed splats were appended to Bindings and Gaussians */
+	FSimpleMulticastDelegate OnSplatStreamsUpdated;
+
+	/**
+	 * Get the number of splats in this binding data (streamed in so far).
 	 */
 	UFUNCTION(BlueprintCallable, Category = "GVRM")
 	int32 GetSplatCount() const
@@ -183,6 +429,139 @@ public:
 		return true;
 	}
 
+	/**
+	 * Get the precomputed remap for a mesh LOD.
+	 * Returns nullptr for LOD 0 or when no valid remap was built for the LOD.
+	 */
+	const FGVRMLODBinding* GetLODBinding(int32 LODIndex) const
+	{
+		const int32 BindingIndex = LODIndex - 1;
+		if (BindingIndex >= 0 && BindingIndex < LODBindings.Num()
+			&& LODBindings[BindingIndex].VertexRemaps.Num() == BoundVertexIndices.Num())
+		{
+			return &LODBindings[BindingIndex];
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Whether rigid-bone bindings are available for every splat of the asset.
+	 * They are fully resident while Bindings stream in, so this counts the
+	 * splats not streamed in yet too.
+	 */
+	bool HasRigidBindings() const
+	{
+		const int32 NumSplats = GetTotalSplatCount();
+		return RigidBindings.Num() == NumSplats && RigidSplatOrder.Num() == NumSplats && NumSplats > 0;
+	}
+
+	/**
+	 * Whether rigid skinning can run now: rigid bindings for every splat, and
+	 * every splat streamed in (RigidSplatOrder spans all of them).
+	 */
+	bool AreRigidBindingsReady() const
+	{
+		return HasRigidBindings() && AreSplatStreamsComplete();
+	}
+
+	/**
+	 * Whether Mode can run on this binding data. A rigid mode without rigid
+	 * bindings falls back to LinearBlend; the first time, this logs a warning
+	 * naming Requester. While the splats stream in, rigid modes wait for the
+	 * last chunk (LinearBlend until then) without a warning.
+	 */
+	bool SupportsSkinningMode(EGVRMSkinningMode Mode, const UObject* Requester) const;
+
+	/**
+	 * Whether skinning uses the compacted bone palette (PaletteBones) instead of every mesh bone.
+	 */
+	bool HasCompactBonePalette() const
+	{
+		return PaletteBones.Num() > 0 && BonePaletteSlots.Num() > 0;
+	}
+
+	/**
+	 * Influences the skinning kernels read per vertex: NumBoneInfluences, or the
+	 * largest permutation when it was never measured.
+	 */
+	int32 GetNumBoneInfluences() const;
+
+	/**
+	 * Palette slot of a skin weight bone index (the index itself without a compact palette).
+	 */
+	int32 GetPaletteSlot(int32 MeshBoneIndex) const
+	{
+		if (!HasCompactBonePalette())
+		{
+			return MeshBoneIndex;
+		}
+		return BonePaletteSlots.IsValidIndex(MeshBoneIndex) ? BonePaletteSlots[MeshBoneIndex] : 0;
+	}
+
+	/**
+	 * Build the compact palette from the mesh bones the splats reference (any order,
+	 * duplicates allowed) out of NumMeshBones.
+	 */
+	bool BuildBonePalette(int32 NumMeshBones, TConstArrayView<int32> ReferencedBones, FString& OutErrorMessage);
+
+	/**
+	 * Precompute rigid-bone bindings from the LOD0 mesh streams: per splat the host
+	 * vertex bind position, its two highest weighted bones and the second bone's
+	 * share of their weights, plus the splat order grouped by primary bone.
+	 */
+	bool BuildRigidBindings(TConstArrayView<FVector3f> VertexPositions, TConstArrayView<FIntVector4> BoneIndices,
+		TConstArrayView<FVector4f> BoneWeights, FString& OutErrorMessage);
+
+	/**
+	 * Whether Bindings and Gaussians hold every saved splat.
+	 * Only false while a cooked asset is still streaming its chunks.
+	 */
+	bool AreSplatStreamsComplete() const
+	{
+		return NextStreamedChunk >= SplatChunks.Num();
+	}
+
+	/**
+	 * Number of splats in the asset, including chunks that are not streamed in yet.
+	 */
+	int32 GetTotalSplatCount() const
+	{
+		return AreSplatStreamsComplete() ? Bindings.Num() : NumSavedSplats;
+	}
+
+	/**
+	 * Start streaming the remaining chunks in the background (no-op when complete
+	 * or already streaming). Game thread only.
+	 */
+	void RequestSplatStreams();
+
+	/**
+	 * Read the remaining chunks now, blocking until every splat is in.
+	 */
+	void LoadSplatStreams();
+
+	/**
+	 * Build the mesh-derived tables from SourceSkeletalMesh (editor only, no-op
+	 * in cooked builds). Logs the result; failures leave the asset on its LOD0
+	 * fallbacks.
+	 */
+	UFUNCTION(CallInEditor, Category = "GVRM|Import")
+	void RebuildMeshData();
+
+	/** CPU bytes per stream (bindings, Gaussians, LOD remaps, ...) */
+	void GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const;
+
+	// UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+	virtual bool IsReadyForFinishDestroy() override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 #if WITH_EDITOR
 	/**
 	 * Import from CSV file generated by gvrm_to_ue5.py
@@ -193,7 +572,83 @@ public:
 	 * Import metadata from JSON file generated by gvrm_to_ue5.py
 	 */
 	bool ImportMetadataFromJSON(const FString& JSONFilePath, FString& OutErrorMessage);
+
+	/**
+	 * Import per-splat Gaussian appearance from the binary 3DGS PLY extracted by gvrm_to_ue5.py.
+	 * PLY vertex order must match SplatIndex.
+	 */
+	bool ImportGaussiansFromPLY(const FString& PLYFilePath, FString& OutErrorMessage);
+
+	/**
+	 * Precompute LOD vertex remaps for every LOD of the skeletal mesh.
+	 * For each bound LOD0 vertex, finds the nearest LOD-n triangle and stores its
+	 * barycentric blend and the offset that restores the LOD0 bind position.
+	 * Requires CPU-accessible render data (editor only).
+	 */
+	bool BuildLODRemaps(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage);
+
+	/**
+	 * Build every table derived from the skeletal mesh, in dependency order:
+	 * LOD remaps, rigid bindings, bone influence count, compact bone palette. Fails if a mesh with more than one LOD ends up without a
+	 * usable remap. Called by ImportFromCSV and RebuildMeshData, and on save.
+	 */
+	bool BuildMeshData(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage);
+
+	/** Whether a mesh-derived table is missing or was built for different geometry */
+	bool NeedsMeshDataBuild(const USkeletalMesh& SkeletalMesh) const;
+
+	/**
+	 * Precompute rigid-bone bindings from LOD0 of the skeletal mesh.
+	 * Requires CPU-accessible render data (editor only).
+	 */
+	bool BuildRigidBindingsFromMesh(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage);
+
+	/**
+	 * Compact the bone palette to the bones weighted on the bound LOD0 vertices and
+	 * on the LOD remap triangle corners, and set NumBoneInfluences from the most
+	 * weighted influences among them. Run after BuildLODRemaps.
+	 * Requires CPU-accessible render data (editor only).
+	 */
+	bool BuildBonePaletteFromMesh(USkeletalMesh* SkeletalMesh, FString& OutErrorMessage);
 #endif
+
+private:
+	/** Write Bindings and Gaussians into SplatChunks, remember their hash and clear bSplatChunksDirty */
+	void BuildSplatChunks();
+
+	/** Append the splats of the next chunk to Bindings and Gaussians */
+	bool AppendSplatChunk(const uint8* ChunkData, int64 ChunkSize);
+
+	/** Issue the async read of chunk NextStreamedChunk */
+	void StreamNextSplatChunk();
+
+	/** Game thread completion of an async chunk read */
+	void OnSplatChunkStreamed(int32 ChunkIndex, bool bWasCancelled);
+
+	/** Saved splat streams, SplatsPerChunk splats each (see GVRMSplatChunk in the .cpp) */
+	TIndirectArray<FByteBulkData> SplatChunks;
+
+	/** Splat count of SplatChunks */
+	int32 NumSavedSplats = 0;
+
+	/** Whether SplatChunks carry the Gaussians (otherwise they stay a tagged property) */
+	bool bChunksHaveGaussians = false;
+
+	/** Whether SplatChunks have no payloads to save (always after a load, which drops them once appended) */
+	bool bSplatChunksDirty = true;
+
+	/** Hash of the splats SplatChunks were built from; a save with different splats rebuilds them */
+	uint64 SplatChunksHash = 0;
+
+	/** First chunk not yet appended to Bindings */
+	int32 NextStreamedChunk = 0;
+
+	/** In-flight read of NextStreamedChunk into ChunkStagingBuffer */
+	TUniquePtr<IBulkDataIORequest> PendingChunkRequest;
+	TArray<uint8> ChunkStagingBuffer;
+
+	/** A rigid mode was requested without rigid bindings and reported (warned once per asset) */
+	mutable bool bWarnedMissingRigidBindings = false;
 };
 
 /**
@@ -214,6 +669,12 @@ struct GVRMRUNTIME_API FGVRMSplatGPUData
 	/** Bone indices (one per splat, optional) */
 	TArray<int32> SplatBoneIndices;
 
+	/** Distinct bound LOD0 vertices in ascending order, skinned once for all their splats */
+	TArray<int32> UniqueVertexIndices;
+
+	/** Per splat: index of its vertex in UniqueVertexIndices */
+	TArray<int32> SplatUniqueVertices;
+
 	/** Number of splats */
 	int32 NumSplats = 0;
 
@@ -240,5 +701,55 @@ struct GVRMRUNTIME_API FGVRMSplatGPUData
 			SplatRelativePositions[i] = FVector3f(Binding.RelativePosition);
 			SplatBoneIndices[i] = Binding.BoneIndex;
 		}
+
+		BuildUniqueVertices();
+	}
+
+	/** Average number of splats sharing a bound vertex (1 when no vertex is shared) */
+	float GetSplatsPerUniqueVertex() const
+	{
+		return UniqueVertexIndices.Num() > 0 ? static_cast<float>(NumSplats) / UniqueVertexIndices.Num() : 1.0f;
+	}
+
+	/**
+	 * Build UniqueVertexIndices and SplatUniqueVertices from SplatVertexIndices.
+	 * Bound vertices are mesh indices, so a dense table sized to the largest one
+	 * replaces a hash map.
+	 */
+	void BuildUniqueVertices()
+	{
+		UniqueVertexIndices.Reset();
+		SplatUniqueVertices.SetNumUninitialized(NumSplats);
+
+		int32 MaxVertexIndex = -1;
+		for (const int32 VertexIndex : SplatVertexIndices)
+		{
+			MaxVertexIndex = FMath::Max(MaxVertexIndex, VertexIndex);
+		}
+
+		TArray<int32> VertexToUnique;
+		VertexToUnique.Init(INDEX_NONE, MaxVertexIndex + 1);
+		for (const int32 VertexIndex : SplatVertexIndices)
+		{
+			if (VertexIndex >= 0)
+			{
+				VertexToUnique[VertexIndex] = 0;
+			}
+		}
+
+		// Ascending vertex order keeps the vertex pass reads of the mesh streams coherent
+		for (int32 VertexIndex = 0; VertexIndex <= MaxVertexIndex; ++VertexIndex)
+		{
+			if (VertexToUnique[VertexIndex] != INDEX_NONE)
+			{
+				VertexToUnique[VertexIndex] = UniqueVertexIndices.Add(VertexIndex);
+			}
+		}
+
+		for (int32 i = 0; i < NumSplats; ++i)
+		{
+			const int32 VertexIndex = SplatVertexIndices[i];
+			SplatUniqueVertices[i] = VertexIndex >= 0 ? VertexToUnique[VertexIndex] : 0;
+		}
 	}
 };
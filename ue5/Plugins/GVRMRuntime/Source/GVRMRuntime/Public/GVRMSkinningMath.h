@@ -0,0 +1,599 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/IntegralConstant.h"
+
+/**
+ * Bone matrix as stored in the GPU palettes: the first three columns of a
+ * row-vector affine FMatrix44f, one float4 each (48 bytes instead of 64).
+ * The fourth column of ToMatrixWithScale is always (0, 0, 0, 1), so packing
+ * and unpacking reproduce the matrix exactly.
+ */
+struct FGVRMBoneMatrix3x4
+{
+	float M[3][4];
+};
+
+/**
+ * One morph target active in a frame, as the morph accumulation pass reads it
+ * (FGVRMActiveMorph in GVRMSplatSkinning.usf): a run of sparse deltas and its
+ * weight. Threads [FirstThread, FirstThread + NumDeltas) of the pass apply it.
+ */
+struct FGVRMActiveMorph
+{
+	uint32 FirstDelta = 0;
+	uint32 NumDeltas = 0;
+	uint32 FirstThread = 0;
+	float Weight = 0.0f;
+};
+
+/**
+ * CPU mirror of the GVRM splat skinning math (GVRMSkinningCommon.ush and
+ * ComputeSkinnedTransformLOD in GVRMSkinning.usf), plus the rigid-bone mode
+ * (SkinRigidSplat in GVRMSkinningCommon.ush), a VectorRegister version of the
+ * LBS path and a dual quaternion reference.
+ *
+ * Used where splats have to be skinned off the GPU (animation cache bake),
+ * so the results match what the shaders produce. Quaternions are (x, y, z, w)
+ * in FVector4f, exactly as the shaders store them.
+ */
+namespace GVRMSkinning
+{
+	/** Most skin weight influences the skinning kernels read per vertex */
+	static constexpr int32 MaxBoneInfluences = 8;
+
+	/**
+	 * Fixed-point scale of the accumulated morph offsets (GVRM_MORPH_FIXED_POINT_SCALE
+	 * in GVRMSkinningCommon.ush). Integer atomics make the sum independent of the
+	 * order the deltas land in; the range is +-32768 units at 1/65536 precision.
+	 */
+	static constexpr float MorphFixedPointScale = 65536.0f;
+
+	/** Morph slot of a vertex no morph target moves (GVRM_MORPH_NONE) */
+	static constexpr uint32 MorphSlotNone = MAX_uint32;
+
+	/**
+	 * Influence count the kernels are specialized for (1, 2, 4 or 8, like the
+	 * GVRM_NUM_INFLUENCES shader permutations): the smallest one holding NumInfluences.
+	 */
+	inline int32 GetInfluencePermutation(int32 NumInfluences)
+	{
+		return NumInfluences <= 1 ? 1 : NumInfluences <= 2 ? 2 : NumInfluences <= 4 ? 4 : MaxBoneInfluences;
+	}
+
+	/**
+	 * Call Function with the influence count of the matching kernel specialization
+	 * as a TIntegralConstant, so a whole loop runs on one specialization.
+	 */
+	template<typename FunctionType>
+	FORCEINLINE void DispatchInfluences(int32 NumInfluences, FunctionType&& Function)
+	{
+		switch (GetInfluencePermutation(NumInfluences))
+		{
+		case 1: Function(TIntegralConstant<int32, 1>()); break;
+		case 2: Function(TIntegralConstant<int32, 2>()); break;
+		case 4: Function(TIntegralConstant<int32, 4>()); break;
+		default: Function(TIntegralConstant<int32, 8>()); break;
+		}
+	}
+
+	/** Input streams of one skeletal mesh LOD plus the current bone palette */
+	struct FSkinningStreams
+	{
+		TConstArrayView<FVector3f> VertexPositions;
+		TConstArrayView<FIntVector4> BoneIndices;
+		TConstArrayView<FVector4f> BoneWeights;
+		TConstArrayView<FMatrix44f> BoneMatrices;
+
+		/** Influences 4 to 7 per vertex (only read with 8 influences) */
+		TConstArrayView<FIntVector4> ExtraBoneIndices;
+		TConstArrayView<FVector4f> ExtraBoneWeights;
+
+		/** Influences per vertex (1, 2, 4 or 8); unused influences must have zero weight */
+		int32 NumInfluences = 4;
+
+		/** LOD remap per LOD0 vertex slot (empty at LOD0) */
+		TConstArrayView<FIntVector4> LODRemapIndices;
+		TConstArrayView<FVector4f> LODRemapWeights;
+		TConstArrayView<FVector4f> LODRemapOffsets;
+		int32 NumRemapVertices = 0;
+	};
+
+	inline FVector4f QuaternionMultiply(const FVector4f& Q1, const FVector4f& Q2)
+	{
+		return FVector4f(
+			Q1.W * Q2.X + Q1.X * Q2.W + Q1.Y * Q2.Z - Q1.Z * Q2.Y,
+			Q1.W * Q2.Y - Q1.X * Q2.Z + Q1.Y * Q2.W + Q1.Z * Q2.X,
+			Q1.W * Q2.Z + Q1.X * Q2.Y - Q1.Y * Q2.X + Q1.Z * Q2.W,
+			Q1.W * Q2.W - Q1.X * Q2.X - Q1.Y * Q2.Y - Q1.Z * Q2.Z);
+	}
+
+	inline FVector3f RotateVectorByQuaternion(const FVector3f& V, const FVector4f& Q)
+	{
+		const FVector3f QVec(Q.X, Q.Y, Q.Z);
+		const FVector3f UV = FVector3f::CrossProduct(QVec, V);
+		const FVector3f UUV = FVector3f::CrossProduct(QVec, UV);
+		return V + 2.0f * (UV * Q.W + UUV);
+	}
+
+	inline FVector4f NormalizeQuaternion(const FVector4f& Q)
+	{
+		const float LengthSquared = Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W;
+		return LengthSquared > UE_SMALL_NUMBER ? Q * FMath::InvSqrt(LengthSquared) : FVector4f(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+
+	/** Same element order as MatrixToQuaternion in GVRMSkinningCommon.ush */
+	inline FVector4f MatrixToQuaternion(const FMatrix44f& M)
+	{
+		const float Trace = M.M[0][0] + M.M[1][1] + M.M[2][2];
+		FVector4f Q;
+
+		if (Trace > 0.0f)
+		{
+			const float S = 0.5f / FMath::Sqrt(Trace + 1.0f);
+			Q.W = 0.25f / S;
+			Q.X = (M.M[2][1] - M.M[1][2]) * S;
+			Q.Y = (M.M[0][2] - M.M[2][0]) * S;
+			Q.Z = (M.M[1][0] - M.M[0][1]) * S;
+		}
+		else if (M.M[0][0] > M.M[1][1] && M.M[0][0] > M.M[2][2])
+		{
+			const float S = 2.0f * FMath::Sqrt(1.0f + M.M[0][0] - M.M[1][1] - M.M[2][2]);
+			Q.W = (M.M[2][1] - M.M[1][2]) / S;
+			Q.X = 0.25f * S;
+			Q.Y = (M.M[0][1] + M.M[1][0]) / S;
+			Q.Z = (M.M[0][2] + M.M[2][0]) / S;
+		}
+		else if (M.M[1][1] > M.M[2][2])
+		{
+			const float S = 2.0f * FMath::Sqrt(1.0f + M.M[1][1] - M.M[0][0] - M.M[2][2]);
+			Q.W = (M.M[0][2] - M.M[2][0]) / S;
+			Q.X = (M.M[0][1] + M.M[1][0]) / S;
+			Q.Y = 0.25f * S;
+			Q.Z = (M.M[1][2] + M.M[2][1]) / S;
+		}
+		else
+		{
+			const float S = 2.0f * FMath::Sqrt(1.0f + M.M[2][2] - M.M[0][0] - M.M[1][1]);
+			Q.W = (M.M[1][0] - M.M[0][1]) / S;
+			Q.X = (M.M[0][2] + M.M[2][0]) / S;
+			Q.Y = (M.M[1][2] + M.M[2][1]) / S;
+			Q.Z = 0.25f * S;
+		}
+
+		return NormalizeQuaternion(Q);
+	}
+
+	/** Pack an affine bone matrix into the GPU palette layout (see FGVRMBoneMatrix3x4) */
+	inline void PackBoneMatrix(const FMatrix44f& Matrix, FGVRMBoneMatrix3x4& OutPacked)
+	{
+		for (int32 Column = 0; Column < 3; ++Column)
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				OutPacked.M[Column][Row] = Matrix.M[Row][Column];
+			}
+		}
+	}
+
+	/** Rebuild the matrix from its packed form, like UnpackBoneMatrix3x4 in GVRMSkinningCommon.ush */
+	inline FMatrix44f UnpackBoneMatrix(const FGVRMBoneMatrix3x4& Packed)
+	{
+		FMatrix44f Matrix;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 3; ++Column)
+			{
+				Matrix.M[Row][Column] = Packed.M[Column][Row];
+			}
+			Matrix.M[Row][3] = Row == 3 ? 1.0f : 0.0f;
+		}
+		return Matrix;
+	}
+
+	/** Pack a whole palette; OutPacked must hold Matrices.Num() entries */
+	inline void PackBoneMatrices(TConstArrayView<FMatrix44f> Matrices, TArrayView<FGVRMBoneMatrix3x4> OutPacked)
+	{
+		check(OutPacked.Num() == Matrices.Num());
+		for (int32 BoneIndex = 0; BoneIndex < Matrices.Num(); ++BoneIndex)
+		{
+			PackBoneMatrix(Matrices[BoneIndex], OutPacked[BoneIndex]);
+		}
+	}
+
+	/** Blend one bone into a vertex; a zero weight adds nothing, so there is no branch on it */
+	FORCEINLINE void AccumulateInfluence(const FMatrix44f& BoneMatrix, float Weight, const FVector3f& VertexPosition, FVector3f& InOutPosition, FVector4f& InOutRotation)
+	{
+		InOutPosition += BoneMatrix.TransformPosition(VertexPosition) * Weight;
+		InOutRotation += MatrixToQuaternion(BoneMatrix) * Weight;
+	}
+
+	/**
+	 * Linear blend skinning of one mesh vertex (position and blended bone rotation,
+	 * unnormalized) over NumInfluences influences, like SkinVertex in
+	 * GVRMSplatSkinning.usf for the same GVRM_NUM_INFLUENCES
+	 */
+	template<int32 NumInfluences>
+	inline void SkinVertex(const FSkinningStreams& Streams, int32 VertexIndex, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		static_assert(NumInfluences == 1 || NumInfluences == 2 || NumInfluences == 4 || NumInfluences == 8, "Influence counts are 1, 2, 4 or 8");
+
+		const FVector3f& VertexPosition = Streams.VertexPositions[VertexIndex];
+		const FIntVector4& Indices = Streams.BoneIndices[VertexIndex];
+		const FVector4f& Weights = Streams.BoneWeights[VertexIndex];
+
+		OutPosition = FVector3f::ZeroVector;
+		OutRotation = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+
+		for (int32 Influence = 0; Influence < FMath::Min(NumInfluences, 4); ++Influence)
+		{
+			AccumulateInfluence(Streams.BoneMatrices[Indices[Influence]], Weights[Influence], VertexPosition, OutPosition, OutRotation);
+		}
+
+		if constexpr (NumInfluences > 4)
+		{
+			const FIntVector4& ExtraIndices = Streams.ExtraBoneIndices[VertexIndex];
+			const FVector4f& ExtraWeights = Streams.ExtraBoneWeights[VertexIndex];
+			for (int32 Influence = 0; Influence < NumInfluences - 4; ++Influence)
+			{
+				AccumulateInfluence(Streams.BoneMatrices[ExtraIndices[Influence]], ExtraWeights[Influence], VertexPosition, OutPosition, OutRotation);
+			}
+		}
+	}
+
+	/** Skin one splat bound to a LOD0 vertex, following the streams' LOD remap */
+	template<int32 NumInfluences>
+	inline void SkinSplat(const FSkinningStreams& Streams, int32 VertexIndex, const FVector3f& RelativePosition, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		FVector3f Offset = RelativePosition;
+		OutPosition = FVector3f::ZeroVector;
+		OutRotation = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+
+		if (VertexIndex < Streams.NumRemapVertices)
+		{
+			const FIntVector4& RemapIndices = Streams.LODRemapIndices[VertexIndex];
+			const FVector4f& RemapWeights = Streams.LODRemapWeights[VertexIndex];
+			Offset += FVector3f(Streams.LODRemapOffsets[VertexIndex]);
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				if (RemapWeights[Corner] > 0.0f)
+				{
+					FVector3f CornerPosition;
+					FVector4f CornerRotation;
+					SkinVertex<NumInfluences>(Streams, RemapIndices[Corner], CornerPosition, CornerRotation);
+					OutPosition += CornerPosition * RemapWeights[Corner];
+					OutRotation += CornerRotation * RemapWeights[Corner];
+				}
+			}
+		}
+		else
+		{
+			SkinVertex<NumInfluences>(Streams, VertexIndex, OutPosition, OutRotation);
+		}
+
+		OutRotation = NormalizeQuaternion(OutRotation);
+		OutPosition += RotateVectorByQuaternion(Offset, OutRotation);
+	}
+
+	/** SkinSplat on the streams' influence count (prefer DispatchInfluences around loops) */
+	inline void SkinSplat(const FSkinningStreams& Streams, int32 VertexIndex, const FVector3f& RelativePosition, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		DispatchInfluences(Streams.NumInfluences, [&](auto NumInfluences)
+		{
+			SkinSplat<decltype(NumInfluences)::Value>(Streams, VertexIndex, RelativePosition, OutPosition, OutRotation);
+		});
+	}
+
+	/**
+	 * Vertex pass of two-pass skinning: the transform of a bound LOD0 vertex that
+	 * all its splats share (the rotated LOD remap offset is folded into the position).
+	 */
+	inline void SkinBoundVertex(const FSkinningStreams& Streams, int32 VertexIndex, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		SkinSplat(Streams, VertexIndex, FVector3f::ZeroVector, OutPosition, OutRotation);
+	}
+
+	/** Splat pass of two-pass skinning: apply a splat's relative offset to its vertex's SkinBoundVertex result */
+	inline FVector3f SkinSplatFromVertex(const FVector3f& VertexPosition, const FVector4f& VertexRotation, const FVector3f& RelativePosition)
+	{
+		return VertexPosition + RotateVectorByQuaternion(RelativePosition, VertexRotation);
+	}
+
+	/** Rotation of every palette bone, for rigid skinning (O(bones), once per frame) */
+	inline void ComputeBoneRotations(TConstArrayView<FMatrix44f> BoneMatrices, TArray<FVector4f>& OutRotations)
+	{
+		OutRotations.SetNumUninitialized(BoneMatrices.Num());
+		for (int32 BoneIndex = 0; BoneIndex < BoneMatrices.Num(); ++BoneIndex)
+		{
+			OutRotations[BoneIndex] = MatrixToQuaternion(BoneMatrices[BoneIndex]);
+		}
+	}
+
+	/**
+	 * Rigid-bone skinning of one splat: the host vertex and offset move with the
+	 * primary bone, blended with the secondary bone by SecondaryWeight (0 for plain rigid).
+	 * Same result as SkinSplat on a host vertex with those two influences.
+	 */
+	inline void SkinRigidSplat(TConstArrayView<FMatrix44f> BoneMatrices, TConstArrayView<FVector4f> BoneRotations,
+		const FVector3f& HostPosition, int32 PrimaryBone, int32 SecondaryBone, float SecondaryWeight,
+		const FVector3f& RelativePosition, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		OutPosition = BoneMatrices[PrimaryBone].TransformPosition(HostPosition);
+		OutRotation = BoneRotations[PrimaryBone];
+
+		if (SecondaryWeight > 0.0f)
+		{
+			const float PrimaryWeight = 1.0f - SecondaryWeight;
+			OutPosition = OutPosition * PrimaryWeight + BoneMatrices[SecondaryBone].TransformPosition(HostPosition) * SecondaryWeight;
+			OutRotation = NormalizeQuaternion(OutRotation * PrimaryWeight + BoneRotations[SecondaryBone] * SecondaryWeight);
+		}
+
+		OutPosition += RotateVectorByQuaternion(RelativePosition, OutRotation);
+	}
+
+	/**
+	 * SkinVertex with VectorRegister math: one multiply-add per matrix row and per
+	 * influence, and bone rotations looked up from ComputeBoneRotations instead of
+	 * converted per influence. Matches SkinVertex up to float rounding.
+	 */
+	template<int32 NumInfluences>
+	FORCEINLINE void SkinVertexVectorized(const FSkinningStreams& Streams, const FVector4f* BoneRotations, int32 VertexIndex,
+		VectorRegister4Float& OutPosition, VectorRegister4Float& OutRotation)
+	{
+		static_assert(NumInfluences == 1 || NumInfluences == 2 || NumInfluences == 4 || NumInfluences == 8, "Influence counts are 1, 2, 4 or 8");
+
+		const FVector3f& VertexPosition = Streams.VertexPositions[VertexIndex];
+		const VectorRegister4Float X = VectorSetFloat1(VertexPosition.X);
+		const VectorRegister4Float Y = VectorSetFloat1(VertexPosition.Y);
+		const VectorRegister4Float Z = VectorSetFloat1(VertexPosition.Z);
+
+		OutPosition = VectorZeroFloat();
+		OutRotation = VectorZeroFloat();
+
+		auto Accumulate = [&](int32 BoneIndex, float Weight)
+		{
+			const FMatrix44f& BoneMatrix = Streams.BoneMatrices[BoneIndex];
+			const VectorRegister4Float Transformed = VectorMultiplyAdd(X, VectorLoad(BoneMatrix.M[0]),
+				VectorMultiplyAdd(Y, VectorLoad(BoneMatrix.M[1]), VectorMultiplyAdd(Z, VectorLoad(BoneMatrix.M[2]), VectorLoad(BoneMatrix.M[3]))));
+			const VectorRegister4Float WeightVector = VectorSetFloat1(Weight);
+			OutPosition = VectorMultiplyAdd(Transformed, WeightVector, OutPosition);
+			OutRotation = VectorMultiplyAdd(VectorLoad(&BoneRotations[BoneIndex].X), WeightVector, OutRotation);
+		};
+
+		const FIntVector4& Indices = Streams.BoneIndices[VertexIndex];
+		const FVector4f& Weights = Streams.BoneWeights[VertexIndex];
+		for (int32 Influence = 0; Influence < FMath::Min(NumInfluences, 4); ++Influence)
+		{
+			Accumulate(Indices[Influence], Weights[Influence]);
+		}
+
+		if constexpr (NumInfluences > 4)
+		{
+			const FIntVector4& ExtraIndices = Streams.ExtraBoneIndices[VertexIndex];
+			const FVector4f& ExtraWeights = Streams.ExtraBoneWeights[VertexIndex];
+			for (int32 Influence = 0; Influence < NumInfluences - 4; ++Influence)
+			{
+				Accumulate(ExtraIndices[Influence], ExtraWeights[Influence]);
+			}
+		}
+	}
+
+	/** SkinSplat through SkinVertexVectorized; BoneRotations come from ComputeBoneRotations on the streams' palette */
+	template<int32 NumInfluences>
+	inline void SkinSplatVectorized(const FSkinningStreams& Streams, TConstArrayView<FVector4f> BoneRotations, int32 VertexIndex,
+		const FVector3f& RelativePosition, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		FVector3f Offset = RelativePosition;
+		VectorRegister4Float Position;
+		VectorRegister4Float Rotation;
+
+		if (VertexIndex < Streams.NumRemapVertices)
+		{
+			const FIntVector4& RemapIndices = Streams.LODRemapIndices[VertexIndex];
+			const FVector4f& RemapWeights = Streams.LODRemapWeights[VertexIndex];
+			Offset += FVector3f(Streams.LODRemapOffsets[VertexIndex]);
+
+			Position = VectorZeroFloat();
+			Rotation = VectorZeroFloat();
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				if (RemapWeights[Corner] > 0.0f)
+				{
+					VectorRegister4Float CornerPosition;
+					VectorRegister4Float CornerRotation;
+					SkinVertexVectorized<NumInfluences>(Streams, BoneRotations.GetData(), RemapIndices[Corner], CornerPosition, CornerRotation);
+					const VectorRegister4Float CornerWeight = VectorSetFloat1(RemapWeights[Corner]);
+					Position = VectorMultiplyAdd(CornerPosition, CornerWeight, Position);
+					Rotation = VectorMultiplyAdd(CornerRotation, CornerWeight, Rotation);
+				}
+			}
+		}
+		else
+		{
+			SkinVertexVectorized<NumInfluences>(Streams, BoneRotations.GetData(), VertexIndex, Position, Rotation);
+		}
+
+		FVector4f PositionLanes;
+		VectorStore(Position, &PositionLanes.X);
+		VectorStore(Rotation, &OutRotation.X);
+		OutRotation = NormalizeQuaternion(OutRotation);
+		OutPosition = FVector3f(PositionLanes) + RotateVectorByQuaternion(Offset, OutRotation);
+	}
+
+	/** SkinSplatVectorized on the streams' influence count (prefer DispatchInfluences around loops) */
+	inline void SkinSplatVectorized(const FSkinningStreams& Streams, TConstArrayView<FVector4f> BoneRotations, int32 VertexIndex,
+		const FVector3f& RelativePosition, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		DispatchInfluences(Streams.NumInfluences, [&](auto NumInfluences)
+		{
+			SkinSplatVectorized<decltype(NumInfluences)::Value>(Streams, BoneRotations, VertexIndex, RelativePosition, OutPosition, OutRotation);
+		});
+	}
+
+	/**
+	 * Dual quaternion skinning of one splat bound to a LOD0 vertex (CPU reference;
+	 * no kernel uses it yet). The rigid part of every weighted bone matrix is
+	 * blended as a dual quaternion, flipped into the first influence's hemisphere,
+	 * so blended joints keep their volume. Rotations are returned in the same
+	 * convention as SkinSplat, and a vertex with one influence gets the SkinSplat result.
+	 */
+	inline void SkinSplatDualQuat(const FSkinningStreams& Streams, int32 VertexIndex, const FVector3f& RelativePosition, FVector3f& OutPosition, FVector4f& OutRotation)
+	{
+		FVector4f BlendReal(0.0f, 0.0f, 0.0f, 0.0f);
+		FVector4f BlendDual(0.0f, 0.0f, 0.0f, 0.0f);
+		FVector4f FirstReal(0.0f, 0.0f, 0.0f, 0.0f);
+		bool bHasFirst = false;
+
+		const int32 NumInfluences = GetInfluencePermutation(Streams.NumInfluences);
+		for (int32 Influence = 0; Influence < NumInfluences; ++Influence)
+		{
+			const bool bExtra = Influence >= 4;
+			float Weight = bExtra ? Streams.ExtraBoneWeights[VertexIndex][Influence - 4] : Streams.BoneWeights[VertexIndex][Influence];
+			if (Weight <= 0.0f)
+			{
+				continue;
+			}
+
+			const FMatrix44f& BoneMatrix = Streams.BoneMatrices[bExtra ? Streams.ExtraBoneIndices[VertexIndex][Influence - 4] : Streams.BoneIndices[VertexIndex][Influence]];
+			const FQuat4f BoneRotation(BoneMatrix);
+			const FVector4f Real(BoneRotation.X, BoneRotation.Y, BoneRotation.Z, BoneRotation.W);
+			const FVector3f Translation = BoneMatrix.GetOrigin();
+			const FVector4f Dual = QuaternionMultiply(FVector4f(Translation, 0.0f), Real) * 0.5f;
+
+			if (!bHasFirst)
+			{
+				FirstReal = Real;
+				bHasFirst = true;
+			}
+			else if (Dot4(FirstReal, Real) < 0.0f)
+			{
+				Weight = -Weight;
+			}
+
+			BlendReal += Real * Weight;
+			BlendDual += Dual * Weight;
+		}
+
+		const float RealLengthSquared = Dot4(BlendReal, BlendReal);
+		if (RealLengthSquared <= UE_SMALL_NUMBER)
+		{
+			OutPosition = Streams.VertexPositions[VertexIndex] + RelativePosition;
+			OutRotation = FVector4f(0.0f, 0.0f, 0.0f, 1.0f);
+			return;
+		}
+
+		const float InvLength = FMath::InvSqrt(RealLengthSquared);
+		BlendReal *= InvLength;
+		BlendDual *= InvLength;
+
+		// Translation of a unit dual quaternion: 2 * Dual * conjugate(Real)
+		const FVector4f TranslationQuat = QuaternionMultiply(BlendDual, FVector4f(-BlendReal.X, -BlendReal.Y, -BlendReal.Z, BlendReal.W)) * 2.0f;
+		const FVector3f VertexPosition = RotateVectorByQuaternion(Streams.VertexPositions[VertexIndex], BlendReal) + FVector3f(TranslationQuat.X, TranslationQuat.Y, TranslationQuat.Z);
+
+		// Splat rotation as SkinSplat derives it from a bone matrix
+		const FQuat4f BlendRotation(BlendReal.X, BlendReal.Y, BlendReal.Z, BlendReal.W);
+		OutRotation = MatrixToQuaternion(FQuatRotationMatrix44f(BlendRotation));
+		OutPosition = VertexPosition + RotateVectorByQuaternion(RelativePosition, OutRotation);
+	}
+
+	/** Scale from 16-bit skin weights to [0, 1] */
+	static constexpr float SkinWeightScale = 1.0f / 65535.0f;
+
+	/**
+	 * Raw layout of a skin weight buffer as the engine packs it (FSkinWeightDataVertexBuffer):
+	 * per vertex NumInfluences bone indices, then NumInfluences weights, each 8 or 16 bits.
+	 */
+	struct FPackedSkinWeights
+	{
+		const uint8* Data = nullptr;
+		uint32 VertexStride = 0;
+		uint32 NumInfluences = 0;
+		uint32 WeightOffset = 0;
+		bool b16BitIndices = false;
+		bool b16BitWeights = false;
+	};
+
+	/**
+	 * Unpack up to NumRead influences of the vertex at VertexData, as
+	 * GetBoneIndex/GetBoneWeight return them: influences past the packed count
+	 * read as bone 0, weight 0, and 8-bit weights are widened to 16 bits by
+	 * repeating the byte. Weights are then normalized to [0, 1], like the shaders
+	 * decode them.
+	 */
+	FORCEINLINE void UnpackSkinWeights(const FPackedSkinWeights& Packed, const uint8* VertexData, uint32 NumRead, int32* OutIndices, float* OutWeights)
+	{
+		const uint8* WeightData = VertexData + Packed.WeightOffset;
+
+		for (uint32 Influence = 0; Influence < NumRead; ++Influence)
+		{
+			int32 BoneIndex = 0;
+			uint32 BoneWeight = 0;
+			if (Influence < Packed.NumInfluences)
+			{
+				BoneIndex = Packed.b16BitIndices ? reinterpret_cast<const uint16*>(VertexData)[Influence] : VertexData[Influence];
+				if (Packed.b16BitWeights)
+				{
+					BoneWeight = reinterpret_cast<const uint16*>(WeightData)[Influence];
+				}
+				else
+				{
+					BoneWeight = (static_cast<uint32>(WeightData[Influence]) << 8) | WeightData[Influence];
+				}
+			}
+			OutIndices[Influence] = BoneIndex;
+			OutWeights[Influence] = static_cast<float>(BoneWeight) * SkinWeightScale;
+		}
+	}
+
+	/** UnpackSkinWeights for a buffer with the same influence count (and stride) for every vertex */
+	FORCEINLINE void UnpackSkinWeights(const FPackedSkinWeights& Packed, uint32 VertexIndex, uint32 NumRead, int32* OutIndices, float* OutWeights)
+	{
+		UnpackSkinWeights(Packed, Packed.Data + VertexIndex * Packed.VertexStride, NumRead, OutIndices, OutWeights);
+	}
+
+	/** Morph delta as the GPU stores it: xyz = position delta, w = morph slot (bit pattern) */
+	inline FVector4f EncodeMorphDelta(const FVector3f& PositionDelta, uint32 Slot)
+	{
+		FVector4f Encoded(PositionDelta, 0.0f);
+		FMemory::Memcpy(&Encoded.W, &Slot, sizeof(uint32));
+		return Encoded;
+	}
+
+	inline uint32 GetMorphDeltaSlot(const FVector4f& Encoded)
+	{
+		uint32 Slot;
+		FMemory::Memcpy(&Slot, &Encoded.W, sizeof(uint32));
+		return Slot;
+	}
+
+	/**
+	 * CPU mirror of AccumulateMorphsCS: add every active morph's weighted deltas
+	 * to the fixed-point offsets of their slots (3 ints per slot, zeroed by the
+	 * caller). Integer sums, so the result does not depend on the order either.
+	 */
+	inline void AccumulateMorphTargets(TConstArrayView<FGVRMActiveMorph> ActiveMorphs, TConstArrayView<FVector4f> MorphDeltas, TArrayView<int32> InOutOffsets)
+	{
+		for (const FGVRMActiveMorph& Morph : ActiveMorphs)
+		{
+			const float Scale = Morph.Weight * MorphFixedPointScale;
+			for (uint32 DeltaIndex = Morph.FirstDelta; DeltaIndex < Morph.FirstDelta + Morph.NumDeltas; ++DeltaIndex)
+			{
+				const FVector4f& Delta = MorphDeltas[DeltaIndex];
+				int32* Offset = &InOutOffsets[GetMorphDeltaSlot(Delta) * 3];
+				Offset[0] += FMath::RoundToInt32(Delta.X * Scale);
+				Offset[1] += FMath::RoundToInt32(Delta.Y * Scale);
+				Offset[2] += FMath::RoundToInt32(Delta.Z * Scale);
+			}
+		}
+	}
+
+	/** Accumulated morph offset of one slot, like LoadMorphOffset in GVRMSkinningCommon.ush */
+	inline FVector3f DecodeMorphOffset(TConstArrayView<int32> Offsets, int32 Slot)
+	{
+		return FVector3f(Offsets[Slot * 3 + 0], Offsets[Slot * 3 + 1], Offsets[Slot * 3 + 2]) * (1.0f / MorphFixedPointScale);
+	}
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USkeletalMesh;
+class UGVRMBindingData;
+struct FNiagaraDataInterfaceGVRMInstanceData;
+
+/**
+ * Bounds of an avatar's splats from its pose, without reading anything back
+ * from the GPU.
+ *
+ * Build measures once, per mesh bone, the box around the bound vertices the
+ * bone influences, grown by how far their splats reach (RelativePosition plus
+ * three standard deviations of the Gaussian). The kernels skin a vertex as a
+ * weighted blend of its bones' transforms, so every splat stays inside the
+ * union of its bones' boxes carried by the pose; Calculate returns that union.
+ *
+ * While splats stream in, each Build folds in only the splats added since the
+ * previous one: boxes only grow, so a vertex whose reach grows adds its larger
+ * box to its bones' boxes and nothing is measured twice.
+ *
+ * Morph target deltas and the LOD remap are not included (callers pad for them).
+ */
+struct GVRMRUNTIME_API FGVRMSplatBounds
+{
+	FGVRMSplatBounds();
+	~FGVRMSplatBounds();
+
+	/**
+	 * Measure the per-bone boxes of BindingData's splats on the LOD0 streams of
+	 * Mesh, or extend them with the splats streamed in since the last call. Reads
+	 * MeshStreams when it holds the CPU streams of Mesh's LOD0 (a splat
+	 * component's mesh cache), else copies LOD0 once and keeps the copy until the
+	 * splat streams are complete. Fails (with the reason) if a bound vertex is
+	 * outside LOD0; a failed build stays empty for this mesh and binding data.
+	 */
+	bool Build(const USkeletalMesh& Mesh, const UGVRMBindingData& BindingData, FString& OutErrorMessage, const FNiagaraDataInterfaceGVRMInstanceData* MeshStreams = nullptr);
+
+	/** Whether Build ran for this mesh and every splat streamed in so far, or failed for this mesh */
+	bool IsBuiltFor(const USkeletalMesh* Mesh, const UGVRMBindingData* BindingData) const;
+
+	/** Forget the measured boxes */
+	void Reset();
+
+	/**
+	 * Splat bounds in component space for a component space pose of the mesh
+	 * (invalid box before Build or when the pose is missing bones).
+	 */
+	FBox Calculate(TConstArrayView<FTransform> ComponentSpaceTransforms) const;
+
+	/** Bones with splats, each with its box */
+	int32 GetNumBones() const { return Bones.Num(); }
+
+	/** CPU bytes of the measured boxes, and of the reach and streams kept while splats stream in */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Index in Bones of a mesh bone, adding it (in order, with an empty box) when new */
+	int32 FindOrAddBone(int32 Bone);
+
+	/** Mesh bones that move splats, in ascending order */
+	TArray<int32> Bones;
+
+	/** Per entry of Bones: bind pose box of its vertices' splats, in the space the bone's transform is applied to */
+	TArray<FBox3f> BoneBounds;
+
+	/** Farthest any splat of a bound vertex sits from it; kept until the splat streams are complete */
+	TMap<int32, float> VertexReach;
+
+	/** LOD0 streams copied when the caller had none; kept until the splat streams are complete */
+	TUniquePtr<FNiagaraDataInterfaceGVRMInstanceData> LOD0Streams;
+
+	/** What the boxes were measured for */
+	TWeakObjectPtr<const USkeletalMesh> BuiltMesh;
+	TWeakObjectPtr<const UGVRMBindingData> BuiltBindingData;
+	int32 BuiltSplatCount = 0;
+	bool bBuildFailed = false;
+};
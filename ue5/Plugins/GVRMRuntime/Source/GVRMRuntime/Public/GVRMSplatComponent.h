@@ -0,0 +1,214 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GVRMSkinningData.h"
+#include "NiagaraDataInterfaceGVRM.h"
+#include "GVRMSplatBounds.h"
+#include "Tasks/Task.h"
+#include "GVRMSplatComponent.generated.h"
+
+class UGVRMAnimationCache;
+class FGVRMAnimationCacheResource;
+
+/**
+ * GVRM Splat Component - Renders Gaussian splats without Niagara.
+ *
+ * Each frame the scene proxy runs, entirely in RDG:
+ * - a compute skinning pass (same math as GVRMSkinning.usf)
+ * - a per-view back-to-front bitonic sort
+ * - one instanced quad draw into scene color
+ *
+ * Takes the same inputs as the Niagara path: UGVRMBindingData (with Gaussians
+ * imported) and the VRM skeletal mesh component.
+ *
+ * With an AnimationCache set, skinning is replaced by decoding the baked
+ * frames (the skeletal mesh only provides the transform).
+ *
+ * SkinningMode selects LBS or the rigid-bone mode (needs rigid bindings in the
+ * binding data); RigidSkinningMinLOD switches distant avatars to rigid automatically.
+ *
+ * While cooked binding data is still streaming its splats, the component draws
+ * the splats loaded so far and rebuilds its proxy as each chunk arrives.
+ */
+UCLASS(ClassGroup = (Rendering), meta = (BlueprintSpawnableComponent), hidecategories = (Object, Activation, Collision, Physics, Lighting, Navigation))
+class GVRMRUNTIME_API UGVRMSplatComponent : public UPrimitiveComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGVRMSplatComponent();
+
+	/** GVRM binding data (must contain Gaussians) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TObjectPtr<UGVRMBindingData> BindingData;
+
+	/** Skeletal mesh the splats are bound to (defaults to the attach parent) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM")
+	TObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
+
+	/**
+	 * Extra margin added to the splat bounds (morph targets and LOD remaps move
+	 * splats beyond them), or to the skeletal mesh bounds until those are measured
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM", meta = (ClampMin = "0.0"))
+	float BoundsPadding = 20.0f;
+
+	/** How splats follow the skeleton (rigid modes fall back to LBS without rigid bindings) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|Skinning")
+	EGVRMSkinningMode SkinningMode = EGVRMSkinningMode::LinearBlend;
+
+	/**
+	 * Skeletal mesh LOD from which splats are skinned rigidly (RigidBoneBlended unless
+	 * SkinningMode already is rigid); -1 disables the switch.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Skinning", meta = (ClampMin = "-1"))
+	int32 RigidSkinningMinLOD = -1;
+
+	/**
+	 * Skin each bound vertex once and let its splats share the result (LBS only).
+	 * Avatars whose splats all sit on distinct vertices skin per splat regardless.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|Skinning")
+	bool bSkinSharedVerticesOnce = true;
+
+	/** Baked animation to play instead of following the skeletal mesh pose (optional) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|Animation Cache")
+	TObjectPtr<UGVRMAnimationCache> AnimationCache;
+
+	/** Playback speed of the animation cache */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GVRM|Animation Cache")
+	float PlayRate = 1.0f;
+
+	/** Current animation cache playback time (seconds) */
+	UPROPERTY(VisibleInstanceOnly, Transient, BlueprintReadWrite, Category = "GVRM|Animation Cache")
+	float PlaybackTime = 0.0f;
+
+	/** Debug view: a point per bone of the palette, drawn on the GPU over the splats */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|Debug")
+	bool bDrawDebugBones = false;
+
+	/** Debug view: sampled bound vertices and lines to their splats, coloured by bone */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|Debug")
+	bool bDrawDebugVertices = false;
+
+	/** Debug view: draw every Nth distinct bound vertex (takes effect with the next render state) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GVRM|Debug", meta = (ClampMin = "1"))
+	int32 DebugVertexStride = 16;
+
+	/**
+	 * Set the binding data and recreate the render state.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GVRM")
+	void SetBindingData(UGVRMBindingData* NewBindingData);
+
+	/**
+	 * Set the skeletal mesh the splats follow.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GVRM")
+	void SetSkeletalMeshComponent(USkeletalMeshComponent* NewSkeletalMeshComponent);
+
+	/**
+	 * Select LBS or rigid-bone skinning (takes effect on the next frame).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GVRM")
+	void SetSkinningMode(EGVRMSkinningMode NewSkinningMode);
+
+	/**
+	 * Toggle the GPU debug view (GVRM.DebugMaxInstances caps it per frame).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GVRM|Debug")
+	void SetDebugDraw(bool bBones, bool bVertices);
+
+	/**
+	 * Skinning mode used this frame (SkinningMode, the LOD switch and rigid binding availability).
+	 */
+	EGVRMSkinningMode GetEffectiveSkinningMode() const;
+
+	/**
+	 * Play a baked animation cache (null to follow the skeletal mesh pose again).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GVRM")
+	void SetAnimationCache(UGVRMAnimationCache* NewAnimationCache);
+
+	/**
+	 * Whether the splats come from the animation cache (set and matching the binding data).
+	 */
+	bool IsPlayingAnimationCache() const;
+
+	/**
+	 * Get the skeletal mesh the splats follow (explicit or attach parent).
+	 */
+	USkeletalMeshComponent* GetSourceSkeletalMesh() const;
+
+	/** Mesh streams and bone matrices (waits for this frame's update tasks) */
+	const FNiagaraDataInterfaceGVRMInstanceData& GetMeshCache() const
+	{
+		WaitForUpdateTasks();
+		return *MeshCache;
+	}
+
+	// UPrimitiveComponent Interface
+	virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void CreateRenderState_Concurrent(FRegisterComponentContext* Context) override;
+	virtual void DestroyRenderState_Concurrent() override;
+	virtual void SendRenderDynamicData_Concurrent() override;
+
+private:
+	/** Make this component tick after the skeletal mesh has finalized its pose */
+	void UpdateTickPrerequisite();
+
+	/** Send this frame's animation cache frames to the proxy */
+	void SendCachePlayback();
+
+	/**
+	 * Snapshot the pose on the game thread, then launch this frame's update as
+	 * two independent UE::Tasks chains (LOD streams -> upload staging, palette ->
+	 * publish), so the updates of all avatars spread over the task workers.
+	 */
+	void LaunchUpdateTasks(USkeletalMeshComponent* SkelComp);
+
+	/** Join the update tasks launched this frame (no-op when none are pending) */
+	void WaitForUpdateTasks() const;
+
+	/** Follow the splats of BindingData as they stream in (registered components only) */
+	void WatchSplatStreams();
+	void UnwatchSplatStreams();
+	void HandleSplatStreamsUpdated();
+
+	/** OnSplatStreamsUpdated binding on WatchedBindingData */
+	FDelegateHandle SplatStreamsHandle;
+	TWeakObjectPtr<UGVRMBindingData> WatchedBindingData;
+
+	/** Splats in the current scene proxy (set when it is created) */
+	int32 ProxySplatCount = 0;
+
+	/** Mesh streams and bone matrices, shared implementation with the Niagara data interface (on the heap: it must not move) */
+	TUniquePtr<FNiagaraDataInterfaceGVRMInstanceData> MeshCache;
+
+	/** Per-bone splat boxes, measured once per mesh and extended with each splat stream chunk */
+	FGVRMSplatBounds SplatBounds;
+
+	/** This frame's splat bounds in the skeletal mesh's component space (invalid until measured) */
+	FBox PosedSplatBounds = FBox(ForceInit);
+
+	/** Carry the splat bounds to this frame's pose snapshot (game thread, after BeginUpdate) */
+	void UpdateSplatBounds(const USkeletalMeshComponent& SkelComp);
+
+	/** This frame's update tasks, joined before the cache or the proxy is touched again */
+	UE::Tasks::FTask UpdateTask;
+
+	/** GPU frames of AnimationCache (owned by the asset, requested on the game thread) */
+	const FGVRMAnimationCacheResource* CacheResource = nullptr;
+};
@@ -0,0 +1,218 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UGVRMBindingData;
+struct FReferenceSkeleton;
+
+/** One spring chain of an avatar, resolved to mesh bone indices */
+struct FGVRMSpringBoneChainSetup
+{
+	/** Root to tip, each bone the parent of the next; all but the tip are simulated */
+	TArray<int32> Bones;
+
+	float Stiffness = 1.0f;
+	float DragForce = 0.4f;
+	float GravityPower = 0.0f;
+	FVector3f GravityDir = FVector3f(0.0f, 0.0f, -1.0f);
+	float HitRadius = 0.0f;
+
+	/** Bit i: collides with the avatar's collider i */
+	uint64 ColliderMask = 0;
+};
+
+/** One collider of an avatar, resolved to a mesh bone */
+struct FGVRMSpringBoneColliderSetup
+{
+	int32 Bone = INDEX_NONE;
+	FVector3f Offset = FVector3f::ZeroVector;
+	FVector3f Tail = FVector3f::ZeroVector;
+	float Radius = 0.0f;
+	bool bCapsule = false;
+};
+
+/** Everything the solver needs about one avatar's skeleton */
+struct GVRMRUNTIME_API FGVRMSpringBoneAvatarSetup
+{
+	TArray<FGVRMSpringBoneChainSetup> Chains;
+	TArray<FGVRMSpringBoneColliderSetup> Colliders;
+
+	/** Parent of every mesh bone (INDEX_NONE for the root) */
+	TArray<int32> ParentBones;
+
+	/** Reference local pose of every mesh bone: rest rotations, bone axes and lengths */
+	TArray<FTransform> RefLocalPose;
+
+	/**
+	 * Resolve the spring chains and colliders of the binding data against a
+	 * skeleton. Chains whose bones are missing or not a parent-child sequence
+	 * are skipped (and reported); fails if no chain is left.
+	 */
+	static bool Build(const UGVRMBindingData& BindingData, const FReferenceSkeleton& RefSkeleton,
+		FGVRMSpringBoneAvatarSetup& OutSetup, FString& OutErrorMessage);
+
+	int32 GetNumJoints() const;
+};
+
+/**
+ * Batched VRM spring bone solver (VRMC_springBone integration: verlet with
+ * drag, stiffness towards the animated direction, gravity, bone length
+ * constraint, sphere and capsule colliders).
+ *
+ * The chains of all avatars are packed four to a packet, one chain per SIMD
+ * lane, and each packet's joints are stored by depth as structure-of-arrays
+ * lanes, so a step walks every packet from the root depth to the tip depth
+ * with VectorRegister math only. Packets never mix avatars; avatars are
+ * independent and stepped in parallel. The layout is only rebuilt when an
+ * avatar is added or removed (existing avatars keep their state).
+ *
+ * Simulation happens in world space; the output replaces the rotations of the
+ * chain bones in a component space pose. The result depends only on the poses
+ * and the step sizes, so a fixed step gives reproducible output.
+ */
+class GVRMRUNTIME_API FGVRMSpringBoneSolver
+{
+public:
+	/** Colliders per avatar (bits of FGVRMSpringBoneChainSetup::ColliderMask) */
+	static constexpr int32 MaxColliders = 64;
+
+	/** VRM parameters are in meters, poses in cm */
+	static constexpr float VRMUnitScale = 100.0f;
+
+	/** Add an avatar; returns its id. Its tails start at the first pose set. */
+	int32 AddAvatar(FGVRMSpringBoneAvatarSetup&& Setup);
+	void RemoveAvatar(int32 AvatarId);
+
+	/** Restart the avatar's chains from its next pose (teleports) */
+	void ResetAvatar(int32 AvatarId);
+
+	/** Animated inputs of this frame: chain roots and colliders. Avatars without a pose are not stepped. */
+	void SetPose(int32 AvatarId, const FTransform& ComponentToWorld, TConstArrayView<FTransform> ComponentSpaceTransforms);
+
+	/** Advance every avatar with a pose by DeltaTime seconds (one integration step) */
+	void Step(float DeltaTime);
+
+	/**
+	 * Replace the chain bones of a component space pose with the result, the
+	 * last two steps blended by the result alpha (tips follow their parents).
+	 * False if the avatar has no result yet.
+	 */
+	bool ApplyToPose(int32 AvatarId, TArrayView<FTransform> ComponentSpaceTransforms) const;
+
+	/**
+	 * Where between the last two steps ApplyToPose samples (1 = the last step).
+	 * Fixed steps set it to the leftover time divided by the step size, so frames
+	 * between steps still move.
+	 */
+	void SetResultAlpha(float Alpha) { ResultAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f); }
+
+	/** Forget every pose, so nothing is stepped until the next SetPose */
+	void ClearPoses();
+
+	int32 GetNumAvatars() const { return NumLiveAvatars; }
+	int32 GetNumJoints() const { return NumJoints; }
+
+	/** CPU bytes of the packed state */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Four chains of one avatar side by side, one per lane */
+	struct FPacket
+	{
+		int32 Avatar = INDEX_NONE;
+		int32 FirstJoint = 0;                   // In Joints
+		int32 NumDepths = 0;                    // Simulated joints of the longest chain
+		int32 FirstCollider = 0;                // In PacketColliders
+		int32 NumColliders = 0;
+
+		// Per lane chain parameters
+		VectorRegister4Float Stiffness;
+		VectorRegister4Float Inertia;           // 1 - DragForce
+		VectorRegister4Float GravityX, GravityY, GravityZ;  // Direction times power
+		VectorRegister4Float HitRadius;
+
+		// Frame inputs, world space: root joint position, world rotation of its parent, world scale
+		VectorRegister4Float RootX, RootY, RootZ;
+		VectorRegister4Float ParentQX, ParentQY, ParentQZ, ParentQW;
+		VectorRegister4Float Scale;
+	};
+
+	/** The joints of one depth of a packet, one per lane */
+	struct FJointLanes
+	{
+		// State, world space
+		VectorRegister4Float TailX, TailY, TailZ;
+		VectorRegister4Float PrevTailX, PrevTailY, PrevTailZ;
+
+		// Result: world rotation, and the one of the step before
+		VectorRegister4Float QX, QY, QZ, QW;
+		VectorRegister4Float PrevQX, PrevQY, PrevQZ, PrevQW;
+
+		// Reference pose: local rotation, unit direction to the tail in the joint's frame, length
+		VectorRegister4Float RestQX, RestQY, RestQZ, RestQW;
+		VectorRegister4Float AxisX, AxisY, AxisZ;
+		VectorRegister4Float Length;
+
+		/** All bits set in lanes that have a joint at this depth */
+		VectorRegister4Float Active;
+	};
+
+	/** One collider a packet tests, with the lanes that use it */
+	struct FPacketCollider
+	{
+		int32 Collider = 0;                     // In the avatar's colliders
+		VectorRegister4Float LaneMask;
+	};
+
+	struct FAvatar
+	{
+		FGVRMSpringBoneAvatarSetup Setup;
+
+		// Range in the packed arrays (INDEX_NONE until laid out)
+		int32 FirstPacket = INDEX_NONE;
+		int32 NumPackets = 0;
+
+		/** Per packet, depth and lane: simulated bone, and the bone at its tail (INDEX_NONE for empty lanes) */
+		TArray<int32> LaneBones;
+		TArray<int32> LaneTailBones;
+
+		/** Per packet and lane: root joint and its parent */
+		TArray<int32> LaneRootBones;
+		TArray<int32> LaneRootParents;
+
+		// World space colliders of the current pose
+		TArray<FVector3f> ColliderHeads;
+		TArray<FVector3f> ColliderTails;
+		TArray<float> ColliderRadii;
+
+		FTransform ComponentToWorld = FTransform::Identity;
+		bool bLive = false;
+		bool bHasPose = false;
+		bool bNeedsReset = true;
+		bool bHasResult = false;
+	};
+
+	void RebuildLayout();
+
+	/** Fill the packets of a new avatar */
+	void LayOutAvatar(int32 AvatarIndex, TArray<FPacket>& OutPackets, TArray<FJointLanes>& OutJoints, TArray<FPacketCollider>& OutColliders);
+
+	/** Start the avatar's tails and rotations at its current pose */
+	void ResetToPose(FAvatar& Avatar, TConstArrayView<FTransform> ComponentSpaceTransforms);
+
+	void StepPacket(FPacket& Packet, const FAvatar& Avatar, float DeltaTime);
+
+	TArray<FAvatar> Avatars;
+	TArray<int32> FreeAvatars;
+	int32 NumLiveAvatars = 0;
+	int32 NumJoints = 0;
+	bool bLayoutDirty = false;
+	float ResultAlpha = 1.0f;
+
+	TArray<FPacket> Packets;
+	TArray<FJointLanes> Joints;
+	TArray<FPacketCollider> PacketColliders;
+};
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "GVRMSpringBoneSolver.h"
+#include "GVRMSpringBoneSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+class UGVRMBindingData;
+class UGVRMSpringBoneSubsystem;
+
+/**
+ * Steps the spring bones of the world once per frame, after every registered
+ * skeletal mesh has finished its pose (TG_PostUpdateWork with the meshes as
+ * prerequisites) and before anything that reads the result.
+ */
+USTRUCT()
+struct FGVRMSpringBoneTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UGVRMSpringBoneSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGVRMSpringBoneTickFunction> : public TStructOpsTypeTraitsBase2<FGVRMSpringBoneTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * VRM spring bones of every GVRM avatar in a world, simulated together by one
+ * FGVRMSpringBoneSolver.
+ *
+ * The engine pose of the skeletal meshes is left alone: the GVRM pose
+ * snapshots pick up the result through ApplyToPose, either in
+ * FNiagaraDataInterfaceGVRMInstanceData::BeginUpdate (renderers ticking after
+ * GetTickFunction()) or on a task launched from OnSolved (captured poses).
+ * Tasks reading the result off the game thread are registered with
+ * AddResultReader; the solver is not changed before they finish.
+ *
+ * Steps use a fixed time step (GVRM.SpringBones.FixedTimeStep) with at most
+ * GVRM.SpringBones.MaxSubsteps per frame, further limited so that a frame
+ * never solves more than GVRM.SpringBones.MaxJointSteps joints (at least one
+ * step always runs). The result blends the last two steps by the time not yet
+ * stepped, so frames faster than the step rate move smoothly. A component that teleports (AGVRMActor resets its avatar)
+ * or moves more than GVRM.SpringBones.ResetDistance in one frame restarts its
+ * chains from the new pose.
+ */
+UCLASS()
+class GVRMRUNTIME_API UGVRMSpringBoneSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** The subsystem of the component's world, if the component has spring bones registered */
+	static UGVRMSpringBoneSubsystem* Find(const USkeletalMeshComponent* SkeletalMeshComponent);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Simulate the spring chains of the binding data on the component. False (with the reason) if none resolves. */
+	bool RegisterAvatar(USkeletalMeshComponent* SkeletalMeshComponent, const UGVRMBindingData* BindingData, FString& OutErrorMessage);
+	void UnregisterAvatar(USkeletalMeshComponent* SkeletalMeshComponent);
+
+	/** Restart the component's chains from its next pose (after teleporting it) */
+	void ResetAvatar(const USkeletalMeshComponent* SkeletalMeshComponent);
+
+	bool IsRegistered(const USkeletalMeshComponent* SkeletalMeshComponent) const;
+
+	/** Write this frame's spring bone rotations into a component space pose of the component */
+	bool ApplyToPose(const USkeletalMeshComponent* SkeletalMeshComponent, TArrayView<FTransform> ComponentSpaceTransforms) const;
+
+	/** Tick function anything reading the result should depend on */
+	FTickFunction& GetTickFunction() { return TickFunction; }
+
+	/** Broadcast on the game thread after every tick, once this frame's result is ready for ApplyToPose */
+	FSimpleMulticastDelegate& OnSolved() { return SolvedDelegate; }
+
+	/** Keep the result as is until Task (calling ApplyToPose off the game thread) has finished */
+	void AddResultReader(const UE::Tasks::FTask& Task);
+
+	const FGVRMSpringBoneSolver& GetSolver() const { return Solver; }
+
+	/** Gather this frame's poses and advance the simulation */
+	void Tick(float DeltaTime);
+
+private:
+	FGVRMSpringBoneSolver Solver;
+	FGVRMSpringBoneTickFunction TickFunction;
+
+	struct FRegisteredAvatar
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> Component;
+		int32 AvatarId = INDEX_NONE;
+
+		/** Component location of the last solve (GVRM.SpringBones.ResetDistance) */
+		FVector LastLocation = FVector::ZeroVector;
+		bool bHasLocation = false;
+	};
+
+	/** Solver avatar of each registered component */
+	TMap<TObjectKey<USkeletalMeshComponent>, int32> AvatarIds;
+
+	/** Registered components, for gathering the poses */
+	TArray<FRegisteredAvatar> Avatars;
+
+	void RemoveAvatar(int32 AvatarId);
+
+	/** Join the tasks still reading the result; before anything changes the solver */
+	void WaitForResultReaders();
+
+	/** Advance the simulation by this frame's time */
+	void Solve(float DeltaTime);
+
+	FSimpleMulticastDelegate SolvedDelegate;
+	TArray<UE::Tasks::FTask> ResultReaders;
+
+	/** Time not yet simulated with fixed steps */
+	float AccumulatedTime = 0.0f;
+};
@@ -7,8 +7,17 @@
 #include "NiagaraDataInterface.h"
 #include "NiagaraCommon.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Rendering/SkeletalMeshLODRenderData.h"
+#include "GVRMSkinningData.h"
+#include "GVRMBonePaletteRing.h"
+#include "Tasks/Task.h"
 #include "NiagaraDataInterfaceGVRM.generated.h"
 
+class FRDGBuilder;
+class UGVRMSpringBoneSubsystem;
+struct FGVRMMemoryBreakdown;
+struct FNiagaraDataInterfaceGVRMInstanceData;
+
 /**
  * Niagara Data Interface for accessing GVRM skeletal mesh data.
  * Provides vertex positions, normals, bone indices, and bone weights
@@ -34,12 +43,17 @@ public:
 	virtual bool HasPreSimulateTick() const override { return true; }
 
 #if WITH_EDITORONLY_DATA
+	virtual void GetCommonHLSL(FString& OutHLSL) override;
 	virtual void GetParameterDefinitionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, FString& OutHLSL) override;
 	virtual bool GetFunctionHLSL(const FNiagaraDataInterfaceGPUParamInfo& ParamInfo, const FNiagaraDataInterfaceGeneratedFunction& FunctionInfo, int FunctionInstanceIndex, FString& OutHLSL) override;
+	virtual bool AppendCompileHash(FNiagaraCompileHashVisitor* InVisitor) const override;
 #endif
 
 	virtual void ProvidePerInstanceDataForRenderThread(void* DataForRenderThread, void* PerInstanceData, const FNiagaraSystemInstanceID& SystemInstance) override;
 
+	/** Visit the per-instance data of every live Niagara system instance using this interface (game thread, for memory reports) */
+	static void ForEachInstanceData(TFunctionRef<void(const FNiagaraDataInterfaceGVRMInstanceData& InstanceData)> Visitor);
+
 protected:
 	virtual bool CopyToInternal(UNiagaraDataInterface* Destination) const override;
 
@@ -48,69 +62,238 @@ public:
 	UPROPERTY(EditAnywhere, Category = "GVRM")
 	TObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
 
-	/** Maximum number of bone influences per vertex (typically 4) */
+	/**
+	 * Maximum number of bone influences per vertex (typically 4). The GPU skinning
+	 * is compiled for 1, 2, 4 or 8 influences (rounded up), and the cached streams
+	 * never hold more than the binding data's NumBoneInfluences.
+	 */
 	UPROPERTY(EditAnywhere, Category = "GVRM", meta = (ClampMin = "1", ClampMax = "8"))
 	int32 MaxBoneInfluences = 4;
 
+	/** Binding data providing LOD vertex remaps (splats stay on LOD0 without it) */
+	UPROPERTY(EditAnywhere, Category = "GVRM")
+	TObjectPtr<UGVRMBindingData> BindingData;
+
+	/** How splats follow the skeleton (rigid modes need rigid bindings in BindingData, LBS otherwise) */
+	UPROPERTY(EditAnywhere, Category = "GVRM")
+	EGVRMSkinningMode SkinningMode = EGVRMSkinningMode::LinearBlend;
+
+	/**
+	 * Read vertex positions, normals and skin weights straight from the skeletal
+	 * mesh's GPU buffers instead of keeping CPU copies and uploading duplicates.
+	 * Falls back to copies on platforms without manual vertex fetch.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GVRM")
+	bool bBindEngineMeshBuffers = true;
+
+	/** Skinning mode the GPU functions report (SkinningMode, or LBS without rigid bindings) */
+	EGVRMSkinningMode GetEffectiveSkinningMode() const;
+
+	/** Whether the GPU binds the engine's mesh buffers (bBindEngineMeshBuffers and the RHI supports it) */
+	bool ShouldBindEngineMeshBuffers() const;
+
 private:
 	// Function names for Niagara VM binding
 	static const FName GetVertexPositionName;
 	static const FName GetVertexNormalName;
 	static const FName GetVertexBoneIndicesName;
 	static const FName GetVertexBoneWeightsName;
+	static const FName GetVertexExtraBoneIndicesName;
+	static const FName GetVertexExtraBoneWeightsName;
 	static const FName GetBoneTransformName;
 	static const FName GetNumVerticesName;
+	static const FName GetLODVertexRemapName;
+	static const FName GetCurrentLODName;
+	static const FName GetSkinningModeName;
+	static const FName GetRigidSplatBindingName;
 
 	// VM function implementations (CPU fallback)
 	void VMGetVertexPosition(FVectorVMExternalFunctionContext& Context);
 	void VMGetVertexNormal(FVectorVMExternalFunctionContext& Context);
 	void VMGetVertexBoneIndices(FVectorVMExternalFunctionContext& Context);
 	void VMGetVertexBoneWeights(FVectorVMExternalFunctionContext& Context);
+	void VMGetVertexExtraBoneIndices(FVectorVMExternalFunctionContext& Context);
+	void VMGetVertexExtraBoneWeights(FVectorVMExternalFunctionContext& Context);
 	void VMGetBoneTransform(FVectorVMExternalFunctionContext& Context);
 	void VMGetNumVertices(FVectorVMExternalFunctionContext& Context);
+	void VMGetLODVertexRemap(FVectorVMExternalFunctionContext& Context);
+	void VMGetCurrentLOD(FVectorVMExternalFunctionContext& Context);
+	void VMGetSkinningMode(FVectorVMExternalFunctionContext& Context);
+	void VMGetRigidSplatBinding(FVectorVMExternalFunctionContext& Context);
 };
 
 /**
  * Per-instance data for the GVRM Data Interface.
  * Cached data that is updated per frame.
  */
-struct FNiagaraDataInterfaceGVRMInstanceData
+struct GVRMRUNTIME_API FNiagaraDataInterfaceGVRMInstanceData
 {
+	FNiagaraDataInterfaceGVRMInstanceData() = default;
+	~FNiagaraDataInterfaceGVRMInstanceData();
+
+	// The mesh delegates and the pose capture task hold this instance's address, so it never moves
+	FNiagaraDataInterfaceGVRMInstanceData(const FNiagaraDataInterfaceGVRMInstanceData&) = delete;
+	FNiagaraDataInterfaceGVRMInstanceData(FNiagaraDataInterfaceGVRMInstanceData&&) = delete;
+	FNiagaraDataInterfaceGVRMInstanceData& operator=(const FNiagaraDataInterfaceGVRMInstanceData&) = delete;
+	FNiagaraDataInterfaceGVRMInstanceData& operator=(FNiagaraDataInterfaceGVRMInstanceData&&) = delete;
+
 	/** Cached skeletal mesh component reference */
 	TWeakObjectPtr<USkeletalMeshComponent> CachedSkeletalMeshComponent;
 
+	/** Skeletal mesh asset the static streams were read from */
+	TWeakObjectPtr<USkeletalMesh> CachedSkeletalMeshAsset;
+
+	/** Mesh LOD the static streams were read from */
+	int32 CachedLODIndex = INDEX_NONE;
+
+	/**
+	 * Render data of that LOD; the GPU binds its buffers when the streams are not
+	 * copied. Held by reference like the engine's skeletal mesh data interface, so
+	 * render commands may keep it past a mesh release.
+	 */
+	TRefCountPtr<const FSkeletalMeshLODRenderData> CachedLODRenderData;
+
 	/** Cached vertex positions in component space (before skinning) */
 	TArray<FVector3f> CachedVertexPositions;
 
 	/** Cached vertex normals in component space (before skinning) */
 	TArray<FVector3f> CachedVertexNormals;
 
-	/** Cached bone indices per vertex (4 indices per vertex) */
+	/** Cached bone indices per vertex (influences 0 to 3, palette slots with a compact palette) */
 	TArray<FIntVector4> CachedBoneIndices;
 
-	/** Cached bone weights per vertex (4 weights per vertex, sum to 1.0) */
+	/** Cached bone weights per vertex (influences 0 to 3, normalized; unused influences are bone 0 with weight 0) */
 	TArray<FVector4f> CachedBoneWeights;
 
-	/** Cached bone transforms (component space to world space) */
+	/** Second weight stream: influences 4 to 7 per vertex (empty unless NumInfluences is 8) */
+	TArray<FIntVector4> CachedExtraBoneIndices;
+	TArray<FVector4f> CachedExtraBoneWeights;
+
+	/** Cached bone transforms (component space to world space), one per palette slot */
 	TArray<FMatrix44f> CachedBoneMatrices;
 
-	/** Number of vertices in the skeletal mesh */
+	/** Mesh bone of each palette slot, from the binding data (empty: every mesh bone, in order) */
+	TArray<int32> CachedPaletteBones;
+
+	/** LOD remap triangle indices per LOD0 vertex (xyz = LOD vertices, w = 1 if bound) */
+	TArray<FIntVector4> CachedLODRemapIndices;
+
+	/** LOD remap barycentric weights per LOD0 vertex (xyz, w unused) */
+	TArray<FVector4f> CachedLODRemapWeights;
+
+	/** LOD remap offset corrections per LOD0 vertex (xyz, w unused) */
+	TArray<FVector4f> CachedLODRemapOffsets;
+
+	/**
+	 * Sparse LOD0 morph target deltas on the bound vertices, grouped by morph
+	 * target (see GVRMSkinning::EncodeMorphDelta: xyz = position delta, w = morph slot)
+	 */
+	TArray<FVector4f> CachedMorphDeltas;
+
+	/** First delta and delta count in CachedMorphDeltas per mesh morph target */
+	TArray<FIntPoint> CachedMorphRanges;
+
+	/** Morph slot per LOD0 vertex, INDEX_NONE when no morph target moves it (empty without morph targets) */
+	TArray<int32> CachedMorphVertexSlots;
+
+	/** Morph targets with a weight this frame, from the component's active morph targets */
+	TArray<FGVRMActiveMorph> ActiveMorphs;
+
+	/** Distinct bound vertices that some morph target moves */
+	int32 NumMorphSlots = 0;
+
+	/** Deltas applied this frame (sum of the active morphs' NumDeltas) */
+	int32 NumActiveMorphDeltas = 0;
+
+	/** Number of vertices in the current mesh LOD */
 	int32 NumVertices = 0;
 
-	/** Number of bones in the skeleton */
+	/** Number of LOD0 vertex slots covered by the remap (0 when reading LOD0 directly) */
+	int32 NumRemapVertices = 0;
+
+	/** Number of bone matrices in the palette */
 	int32 NumBones = 0;
 
+	/** Number of bones in the skeleton (palette size before compaction) */
+	int32 NumSkeletonBones = 0;
+
+	/** Influences per vertex in the cached skin weight streams (1, 2, 4 or 8, see GVRMSkinning::GetInfluencePermutation) */
+	int32 NumInfluences = 4;
+
 	/** Frame counter for cache invalidation */
 	uint32 CachedFrameNumber = 0;
 
 	/** Whether the cache is valid */
 	bool bCacheValid = false;
 
+	/** Whether the vertex, skin weight and remap streams changed since the last GPU upload */
+	bool bStaticDataDirty = false;
+
+	/** Whether the binding data's rigid streams were sent to the proxy */
+	bool bRigidDataSent = false;
+
+	/**
+	 * Whether CacheLODStreams copies the vertex and skin weight streams to the CPU.
+	 * Off when the GPU reads the engine's mesh buffers and no CPU script uses the
+	 * interface; the remap streams are always cached.
+	 */
+	bool bCacheVertexStreams = true;
+
+	/** Whether a CPU (VM) script bound this instance's functions */
+	bool bUsedByCPUScripts = false;
+
 	/**
 	 * Update cached skeletal mesh data.
 	 * Should be called once per frame in PreSimulateTick.
+	 * Vertex and skin weight streams are only re-read when the component's LOD changes.
+	 * Same as BeginUpdate followed by UpdateLODStreams and UpdatePose.
+	 */
+	void UpdateCache(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData);
+
+	/**
+	 * Game thread half of UpdateCache: validate the component, pick the LOD and
+	 * snapshot the pose. Returns whether there is work for UpdateLODStreams and
+	 * UpdatePose, which only read the snapshot and may run on any thread (one at a
+	 * time each, both finished before the cache is read).
+	 */
+	bool BeginUpdate(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData, bool bSnapshotPose = true);
+
+	/**
+	 * Capture the pose of SkeletalMesh when its bone transforms are finalized
+	 * (after animation evaluation) and convert it to the palette on a task, so
+	 * the update no longer reads the component's pose. With spring bones the task
+	 * starts once they are solved and applies them itself. No-op if already
+	 * watching it.
 	 */
-	void UpdateCache(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences);
+	void WatchPose(USkeletalMeshComponent* SkeletalMesh);
+	void UnwatchPose();
+
+	/**
+	 * UpdateCache on the pose captured by WatchPose: only the LOD pick and stream
+	 * reads remain, the palette is the latest converted capture. Falls back to
+	 * UpdateCache until the first capture, and when the spring bones were not
+	 * solved since the capture.
+	 */
+	void UpdateCacheFromCapturedPose(USkeletalMeshComponent* SkeletalMesh, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData);
+
+	/** Join the capture conversion task; before reading the bone matrices */
+	void WaitForPoseCapture() const;
+
+	/** Whether the last BeginUpdate left LOD streams to re-read */
+	bool HasPendingLODStreams() const { return PendingLODData != nullptr; }
+
+	/** Re-read the streams of the LOD picked by BeginUpdate, if it changed */
+	void UpdateLODStreams();
+
+	/** Convert the pose snapshot taken by BeginUpdate to the bone palette */
+	void UpdatePose()
+	{
+		CacheBoneMatrices(PoseSnapshot);
+		bPoseStale = false;
+	}
+
+	/** Component space pose taken by the last BeginUpdate or capture (spring bones applied once UpdatePose ran) */
+	TConstArrayView<FTransform> GetPoseSnapshot() const { return PoseSnapshot; }
 
 	/**
 	 * Invalidate the cache, forcing a refresh on next access.
@@ -118,7 +301,73 @@ struct FNiagaraDataInterfaceGVRMInstanceData
 	void InvalidateCache()
 	{
 		bCacheValid = false;
+		CachedLODIndex = INDEX_NONE;
 	}
+
+	/**
+	 * Read the vertex, skin weight and remap streams of one mesh LOD.
+	 * Also used without a component (animation cache bake).
+	 */
+	void CacheLODStreams(const FSkeletalMeshLODRenderData& LODData, int32 MaxBoneInfluences, const UGVRMBindingData* BindingData, const FGVRMLODBinding* LODBinding);
+
+	/**
+	 * Gather the LOD0 deltas of every morph target of Mesh on the vertices the
+	 * binding data binds splats to (every vertex without binding data). Needs the
+	 * morph targets' CPU data; cost is paid once per mesh change.
+	 */
+	void CacheMorphTargets(const USkeletalMesh& Mesh, const UGVRMBindingData* BindingData);
+
+	/**
+	 * Build ActiveMorphs from the component's active morph targets and weights
+	 * (only morph targets with deltas on bound vertices); game thread.
+	 */
+	void GatherActiveMorphs(const USkeletalMeshComponent& SkeletalMesh);
+
+	/**
+	 * Convert component space bone transforms to the skinning palette, only the
+	 * CachedPaletteBones entries when set. Bit-identical to
+	 * FMatrix44f(Transform.ToMatrixWithScale()) per bone.
+	 */
+	void CacheBoneMatrices(TConstArrayView<FTransform> ComponentSpaceTransforms);
+
+	/** CPU bytes per cached stream */
+	void GetMemoryBreakdown(FGVRMMemoryBreakdown& OutBreakdown) const;
+
+private:
+	/** Bone transforms finalized callback of the watched component */
+	void HandleBoneTransformsFinalized();
+
+	/** Spring bone subsystem callback: this frame's spring pose is ready */
+	void HandleSpringBonesSolved();
+
+	/** Follow the spring bone subsystem of the watched component (null for none) */
+	void WatchSpringBones(UGVRMSpringBoneSubsystem* SpringBones);
+
+	/** Convert the captured pose on a task, applying SpringBones' result to it first when set */
+	void LaunchPoseConversion(UGVRMSpringBoneSubsystem* SpringBones);
+
+	/** Component space bone transforms copied by BeginUpdate or the capture callback */
+	TArray<FTransform> PoseSnapshot;
+
+	/** Whether the palette bones changed since PoseSnapshot was last converted */
+	bool bPoseStale = false;
+
+	// Pose capture (WatchPose)
+	TWeakObjectPtr<USkeletalMeshComponent> WatchedComponent;
+	FDelegateHandle BoneTransformsFinalizedHandle;
+	UE::Tasks::FTask PoseCaptureTask;
+	bool bPoseCaptured = false;
+
+	// Spring bones of the watched component; the capture waits for their solve
+	TWeakObjectPtr<UGVRMSpringBoneSubsystem> WatchedSpringBones;
+	FDelegateHandle SpringBonesSolvedHandle;
+	bool bPoseAwaitsSpringBones = false;
+
+	// LOD streams left to read by UpdateLODStreams (null when the LOD did not change)
+	const FSkeletalMeshLODRenderData* PendingLODData = nullptr;
+	const FGVRMLODBinding* PendingLODBinding = nullptr;
+	const UGVRMBindingData* PendingBindingData = nullptr;
+	int32 PendingMaxBoneInfluences = 4;
 };
 
 /**
@@ -127,35 +376,97 @@ struct FNiagaraDataInterfaceGVRMInstanceData
  */
 struct FNiagaraDataInterfaceGVRMProxy : public FNiagaraDataInterfaceProxy
 {
-	// GPU buffers (RHI resources)
+	/** SkinWeightFormat bits (GVRM_SKIN_WEIGHT_* in GVRMSkinningCommon.ush) */
+	static constexpr uint32 SkinWeight16BitIndices = 1;
+	static constexpr uint32 SkinWeight16BitWeights = 2;
+
+	// GPU buffers (RHI resources). The mesh stream buffers only exist when the
+	// streams are uploaded as copies; otherwise their SRVs are the engine's.
 	FBufferRHIRef VertexPositionsBuffer;
-	FBufferRHIRef VertexNormalsBuffer;
-	FBufferRHIRef BoneIndicesBuffer;
-	FBufferRHIRef BoneWeightsBuffer;
+	FBufferRHIRef VertexTangentsBuffer;
+	FBufferRHIRef SkinWeightsBuffer;
+	FBufferRHIRef BoneSlotsBuffer;
 	FBufferRHIRef BoneMatricesBuffer;
+	FBufferRHIRef LODRemapIndicesBuffer;
+	FBufferRHIRef LODRemapWeightsBuffer;
+	FBufferRHIRef LODRemapOffsetsBuffer;
+	FBufferRHIRef RigidSplatPositionsBuffer;
+	FBufferRHIRef RigidSplatBonesBuffer;
+	FBufferRHIRef MorphVertexSlotsBuffer;
+	FBufferRHIRef MorphDeltasBuffer;
 
 	// Shader resource views for GPU access
 	FShaderResourceViewRHIRef VertexPositionsSRV;
-	FShaderResourceViewRHIRef VertexNormalsSRV;
-	FShaderResourceViewRHIRef BoneIndicesSRV;
-	FShaderResourceViewRHIRef BoneWeightsSRV;
+	FShaderResourceViewRHIRef VertexTangentsSRV;
+	FShaderResourceViewRHIRef SkinWeightsSRV;
+	FShaderResourceViewRHIRef SkinWeightLookupSRV;
+	FShaderResourceViewRHIRef BoneSlotsSRV;
 	FShaderResourceViewRHIRef BoneMatricesSRV;
+	FShaderResourceViewRHIRef LODRemapIndicesSRV;
+	FShaderResourceViewRHIRef LODRemapWeightsSRV;
+	FShaderResourceViewRHIRef LODRemapOffsetsSRV;
+	FShaderResourceViewRHIRef RigidSplatPositionsSRV;
+	FShaderResourceViewRHIRef RigidSplatBonesSRV;
+	FShaderResourceViewRHIRef MorphVertexSlotsSRV;
+	FShaderResourceViewRHIRef MorphDeltasSRV;
+
+	/** This frame's summed morph offsets, 3 fixed-point ints per morph slot (GVRM_MORPH_FIXED_POINT_SCALE) */
+	TRefCountPtr<FRDGPooledBuffer> MorphOffsets;
 
 	// Buffer dimensions
 	int32 NumVertices = 0;
 	int32 NumBones = 0;
 	int32 MaxBoneInfluences = 4;
+	int32 LODIndex = 0;
+	int32 NumRemapVertices = 0;
+	int32 NumBoneSlots = 0;
+	int32 NumMorphVertexSlots = 0;
+	int32 NumMorphSlots = 0;
+
+	// Skin weight stream layout (FSkinWeightDataVertexBuffer)
+	uint32 SkinWeightStride = 0;
+	uint32 NumSkinWeightInfluences = 0;
+	uint32 SkinWeightFormat = 0;
+
+	/** Whether the mesh streams are the skeletal mesh's own buffers (no copies uploaded) */
+	bool bBindsEngineMeshBuffers = false;
+
+	/** Set by the render thread when BindEngineMeshBuffers_RenderThread found the buffers released; the game thread re-sends the streams */
+	std::atomic<bool> bEngineMeshBindFailed{ false };
+
+	/** EGVRMSkinningMode (rigid only once the rigid streams are uploaded) */
+	int32 SkinningMode = 0;
+
+	/** Bone palettes handed over from the game thread (consumed once per render frame) */
+	FGVRMBonePaletteRing BonePalettes;
+
+	/** Render frame the last palette was consumed in */
+	uint32 LastPaletteFrame = MAX_uint32;
+
+	/** Whether MorphOffsets holds only zeros (no morph was active when it was last written) */
+	bool bMorphOffsetsCleared = false;
+
+	/** Upload the newest published bone palette and sum its active morphs; render thread only */
+	void UpdateBonePalette_RenderThread(FRDGBuilder& GraphBuilder);
+
+	/** Sum the weighted deltas of the active morphs into MorphOffsets; render thread only */
+	void AddMorphPass_RenderThread(FRDGBuilder& GraphBuilder, TConstArrayView<FGVRMActiveMorph> ActiveMorphs);
+
+	/**
+	 * Point the mesh stream SRVs at the LOD's own GPU buffers and release any
+	 * uploaded copies; render thread only. Binds nothing (and returns false) when
+	 * the LOD's buffers were released since the game thread picked it (streamed
+	 * out or mesh released): the caller flags bEngineMeshBindFailed and the game
+	 * thread sends the streams again next frame.
+	 */
+	bool BindEngineMeshBuffers_RenderThread(const FSkeletalMeshLODRenderData& LODData);
+
+	/** GPU bytes per buffer and CPU bytes of the palette ring; render thread only */
+	void GetMemoryBreakdown_RenderThread(FGVRMMemoryBreakdown& OutBreakdown) const;
 
 	virtual void PreStage(const FNDIGpuComputePreStageContext& Context) override;
 	virtual void PostStage(const FNDIGpuComputePostStageContext& Context) override;
 
 	// Destructor to clean up GPU resources
-	virtual ~FNiagaraDataInterfaceGVRMProxy()
-	{
-		VertexPositionsBuffer.SafeRelease();
-		VertexNormalsBuffer.SafeRelease();
-		BoneIndicesBuffer.SafeRelease();
-		BoneWeightsBuffer.SafeRelease();
-		BoneMatricesBuffer.SafeRelease();
-	}
+	virtual ~FNiagaraDataInterfaceGVRMProxy();
 };
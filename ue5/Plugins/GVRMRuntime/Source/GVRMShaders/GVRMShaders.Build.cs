@@ -0,0 +1,29 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+using UnrealBuildTool;
+
+public class GVRMShaders : ModuleRules
+{
+	public GVRMShaders(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"RenderCore",
+				"RHI",
+			}
+		);
+
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Projects",
+			}
+		);
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#include "GVRMShaders.h"
+#include "GVRMSplatShaders.h"
+#include "Modules/ModuleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "ShaderCore.h"
+
+#define LOCTEXT_NAMESPACE "FGVRMShadersModule"
+
+void FGVRMShadersModule::StartupModule()
+{
+	// Register shader directory
+	FString PluginShaderDir = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("GVRMRuntime"))->GetBaseDir(), TEXT("Shaders"));
+	AddShaderSourceDirectoryMapping(TEXT("/Plugin/GVRMRuntime"), PluginShaderDir);
+}
+
+void FGVRMShadersModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FGVRMShadersModule, GVRMShaders)
+
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatCullInstancesCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "CullInstancesCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatMorphAccumulateCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "AccumulateMorphsCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatVertexSkinningCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "SkinVerticesCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatSkinningCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "SkinSplatsCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatCacheDecodeCS, "/Plugin/GVRMRuntime/Private/GVRMSplatCache.usf", "DecodeCacheCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatCullSplatsCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "CullSplatsCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatBuildSortArgsCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "BuildSortArgsCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatSortKeysCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "SortKeysCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatBitonicSortCS, "/Plugin/GVRMRuntime/Private/GVRMSplatSkinning.usf", "BitonicSortCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatDrawVS, "/Plugin/GVRMRuntime/Private/GVRMSplatDraw.usf", "MainVS", SF_Vertex);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatDrawPS, "/Plugin/GVRMRuntime/Private/GVRMSplatDraw.usf", "MainPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatDebugJointVS, "/Plugin/GVRMRuntime/Private/GVRMSplatDebug.usf", "JointVS", SF_Vertex);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatDebugPointVS, "/Plugin/GVRMRuntime/Private/GVRMSplatDebug.usf", "PointVS", SF_Vertex);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatDebugLineVS, "/Plugin/GVRMRuntime/Private/GVRMSplatDebug.usf", "LineVS", SF_Vertex);
+IMPLEMENT_GLOBAL_SHADER(FGVRMSplatDebugPS, "/Plugin/GVRMRuntime/Private/GVRMSplatDebug.usf", "MainPS", SF_Pixel);
@@ -0,0 +1,21 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+/**
+ * GVRM Shaders Module
+ * Registers the plugin shader directory and the global shaders used by
+ * UGVRMSplatComponent. Loaded at PostConfigInit so the shader types exist
+ * before the global shader map is compiled.
+ */
+class FGVRMShadersModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
@@ -0,0 +1,435 @@
+// Copyright (c) 2025 gaussian-vrm community
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "RenderGraphResources.h"
+
+/**
+ * Base class for the GVRM splat component shaders (SM5 and above).
+ */
+class FGVRMSplatShader : public FGlobalShader
+{
+public:
+	static constexpr uint32 ThreadGroupSize = 64;
+
+	FGVRMSplatShader() = default;
+	FGVRMSplatShader(const ShaderMetaType::CompiledShaderInitializerType& Initializer)
+		: FGlobalShader(Initializer)
+	{
+	}
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), ThreadGroupSize);
+	}
+};
+
+/**
+ * Skin weight influences the LBS kernels blend per vertex. Each count is its
+ * own permutation so the influence loop unrolls without per-weight branches;
+ * influences 4 to 7 come from the Extra* streams (8 only).
+ */
+class FGVRMNumInfluencesDim : SHADER_PERMUTATION_SPARSE_INT("GVRM_NUM_INFLUENCES", 1, 2, 4, 8);
+
+/**
+ * One splat component in the scene-level skinning batch.
+ * Layout mirrors FGVRMSplatBatchInstance in GVRMSplatSkinning.usf.
+ */
+struct FGVRMSplatBatchInstance
+{
+	uint32 SplatOffset = 0;
+	uint32 NumSplats = 0;
+	uint32 VertexOffset = 0;
+	uint32 BoneOffset = 0;
+	uint32 RemapOffset = 0;
+	uint32 NumRemapVertices = 0;
+	uint32 SkinningMode = 0;
+	uint32 RigidOffset = 0;
+	uint32 UniqueVertexOffset = 0;
+	uint32 NumUniqueVertices = 0;
+	uint32 MorphVertexOffset = MAX_uint32;    // GVRM_MORPH_NONE without active morphs
+	uint32 Padding0 = 0;
+	FVector4f BoundsCenter = FVector4f::Zero();
+	FVector4f BoundsExtent = FVector4f::Zero();
+};
+
+/**
+ * Culls all batch instances against the view family, compacts the visible ones
+ * and writes the indirect args for FGVRMSplatVertexSkinningCS and
+ * FGVRMSplatSkinningCS (single group).
+ */
+class GVRMSHADERS_API FGVRMSplatCullInstancesCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatCullInstancesCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatCullInstancesCS, FGVRMSplatShader);
+
+	static constexpr uint32 ScanGroupSize = 1024;
+	static constexpr uint32 MaxCullPlanes = 8;
+
+	/** Byte offsets of the two dispatches in the indirect args buffer */
+	static constexpr uint32 VertexPassArgsOffset = 0;
+	static constexpr uint32 SplatPassArgsOffset = sizeof(FRHIDispatchIndirectParameters);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(uint32, NumInstances)
+		SHADER_PARAMETER(uint32, NumCullViews)
+		SHADER_PARAMETER(uint32, MaxDispatchGroups)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGVRMSplatBatchInstance>, Instances)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, CullPlanes)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FUintVector4>, RWVisibleInstances)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, RWSkinningArgs)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWBatchCounters)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGVRMSplatShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("SCAN_GROUP_SIZE"), ScanGroupSize);
+		OutEnvironment.SetDefine(TEXT("MAX_CULL_PLANES"), MaxCullPlanes);
+	}
+};
+
+/**
+ * Sums the weighted sparse deltas of the active morph targets into fixed-point
+ * offsets per morphed vertex (one thread per delta of an active morph, atomics).
+ * Shared by the skinning batch and the Niagara data interface.
+ */
+class GVRMSHADERS_API FGVRMSplatMorphAccumulateCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatMorphAccumulateCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatMorphAccumulateCS, FGVRMSplatShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(uint32, NumActiveMorphs)
+		SHADER_PARAMETER(uint32, NumMorphThreads)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGVRMActiveMorph>, ActiveMorphs)
+		SHADER_PARAMETER_SRV(Buffer<float4>, MorphDeltas)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<int>, RWMorphOffsets)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+/**
+ * Skins the distinct bound vertices of the visible LBS avatars once each, for
+ * FGVRMSplatSkinningCS to share between the splats bound to them.
+ */
+class GVRMSHADERS_API FGVRMSplatVertexSkinningCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatVertexSkinningCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatVertexSkinningCS, FGVRMSplatShader);
+
+	using FPermutationDomain = TShaderPermutationDomain<FGVRMNumInfluencesDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_SRV(Buffer<uint>, UniqueVertexIndices)
+		SHADER_PARAMETER_SRV(Buffer<float>, VertexPositions)
+		SHADER_PARAMETER_SRV(Buffer<uint4>, BoneIndices)
+		SHADER_PARAMETER_SRV(Buffer<float4>, BoneWeights)
+		SHADER_PARAMETER_SRV(Buffer<uint4>, ExtraBoneIndices)
+		SHADER_PARAMETER_SRV(Buffer<float4>, ExtraBoneWeights)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, BoneMatrices)
+		SHADER_PARAMETER_SRV(Buffer<uint4>, LODRemapIndices)
+		SHADER_PARAMETER_SRV(Buffer<float4>, LODRemapWeights)
+		SHADER_PARAMETER_SRV(Buffer<float4>, LODRemapOffsets)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGVRMSplatBatchInstance>, Instances)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FUintVector4>, VisibleInstances)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, BatchCounters)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, RWSharedVertexPositions)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, RWSharedVertexRotations)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+/**
+ * Skins the visible splats of every batched avatar in one indirect dispatch
+ * (LBS of the host vertex + rotated relative offset, or rigid per bone). LBS
+ * avatars with a vertex pass only rotate their offsets by the shared results.
+ * The host vertex's morph offset is added to the relative offset.
+ */
+class GVRMSHADERS_API FGVRMSplatSkinningCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatSkinningCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatSkinningCS, FGVRMSplatShader);
+
+	using FPermutationDomain = TShaderPermutationDomain<FGVRMNumInfluencesDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_SRV(Buffer<int>, SplatVertexIndices)
+		SHADER_PARAMETER_SRV(Buffer<float4>, SplatRelativePositions)
+		SHADER_PARAMETER_SRV(Buffer<float>, VertexPositions)
+		SHADER_PARAMETER_SRV(Buffer<uint4>, BoneIndices)
+		SHADER_PARAMETER_SRV(Buffer<float4>, BoneWeights)
+		SHADER_PARAMETER_SRV(Buffer<uint4>, ExtraBoneIndices)
+		SHADER_PARAMETER_SRV(Buffer<float4>, ExtraBoneWeights)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, BoneMatrices)
+		SHADER_PARAMETER_SRV(Buffer<uint4>, LODRemapIndices)
+		SHADER_PARAMETER_SRV(Buffer<float4>, LODRemapWeights)
+		SHADER_PARAMETER_SRV(Buffer<float4>, LODRemapOffsets)
+		SHADER_PARAMETER_SRV(Buffer<uint>, RigidSplatOrder)
+		SHADER_PARAMETER_SRV(Buffer<float4>, RigidHostPositions)
+		SHADER_PARAMETER_SRV(Buffer<uint2>, RigidBones)
+		SHADER_PARAMETER_SRV(Buffer<uint>, SplatUniqueVertices)
+		SHADER_PARAMETER_SRV(Buffer<uint>, MorphVertexSlots)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<int>, MorphOffsets)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SharedVertexPositions)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SharedVertexRotations)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGVRMSplatBatchInstance>, Instances)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FUintVector4>, VisibleInstances)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, BatchCounters)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, RWSkinnedPositions)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, RWSkinnedRotations)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+/**
+ * Decodes two frames of a baked animation cache (UGVRMAnimationCache) and
+ * interpolates between them, writing the same outputs as the skinning pass.
+ */
+class GVRMSHADERS_API FGVRMSplatCacheDecodeCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatCacheDecodeCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatCacheDecodeCS, FGVRMSplatShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(uint32, NumSplats)
+		SHADER_PARAMETER(uint32, ClusterSize)
+		SHADER_PARAMETER(uint32, SplatDataOffset)
+		SHADER_PARAMETER(uint32, Frame0Offset)
+		SHADER_PARAMETER(uint32, Frame1Offset)
+		SHADER_PARAMETER(float, Alpha)
+		SHADER_PARAMETER_SRV(Buffer<uint>, FrameData)
+		SHADER_PARAMETER_SRV(Buffer<float4>, BindPositions)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, RWSkinnedPositions)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, RWSkinnedRotations)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+/**
+ * Per-view fine culling of one component's skinned splats (backface, sub-pixel,
+ * frustum); compacts the survivors into a list for sorting and drawing.
+ */
+class GVRMSHADERS_API FGVRMSplatCullSplatsCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatCullSplatsCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatCullSplatsCS, FGVRMSplatShader);
+
+	/** Counters written per component and summed per view (GVRM_CULL_COUNTER_* in GVRMSplatSkinning.usf) */
+	enum ECounter : uint32
+	{
+		CounterVisible = 0,
+		CounterBackface = 1,
+		CounterSubpixel = 2,
+		CounterFrustum = 3,
+		CounterSortElements = 4,
+		NumCounters = 5,
+		NumViewCounters = 4,
+	};
+
+	/** Byte offsets in the per-component indirect args buffer: sort dispatch, then splat draw */
+	static constexpr uint32 SortArgsOffset = 0;
+	static constexpr uint32 DrawArgsOffset = sizeof(FRHIDispatchIndirectParameters);
+	static constexpr uint32 NumArgs = (sizeof(FRHIDispatchIndirectParameters) + sizeof(FRHIDrawIndirectParameters)) / sizeof(uint32);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(FMatrix44f, LocalToView)
+		SHADER_PARAMETER(FMatrix44f, ViewToClip)
+		SHADER_PARAMETER(FVector2f, ViewportSize)
+		SHADER_PARAMETER(uint32, NumSplats)
+		SHADER_PARAMETER(uint32, SplatBase)
+		SHADER_PARAMETER(uint32, bEnableCulling)
+		SHADER_PARAMETER(float, MinPixelRadius)
+		SHADER_PARAMETER(float, BackfaceThreshold)
+		SHADER_PARAMETER(float, FrustumMargin)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SkinnedPositions)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SkinnedRotations)
+		SHADER_PARAMETER_SRV(Buffer<float4>, SplatScales)
+		SHADER_PARAMETER_SRV(Buffer<float4>, SplatNormals)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWCompactedSplats)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWCullCounters)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGVRMSplatShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+
+		// One atomic per wave for the compaction where the platform always has wave intrinsics
+		if (FDataDrivenShaderPlatformInfo::GetSupportsWaveOperations(Parameters.Platform) == ERHIFeatureSupport::RuntimeGuaranteed)
+		{
+			OutEnvironment.CompilerFlags.Add(CFLAG_WaveOperations);
+		}
+	}
+};
+
+/**
+ * Sizes the sort to a component's survivors and writes the indirect args of
+ * the sort passes and the splat draw (single thread).
+ */
+class GVRMSHADERS_API FGVRMSplatBuildSortArgsCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatBuildSortArgsCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatBuildSortArgsCS, FGVRMSplatShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(uint32, MaxDispatchGroups)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWCullCounters)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, RWSortArgs)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWViewCullCounters)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+/**
+ * Writes view-depth sort keys for the surviving splats, padded to a power of two (indirect).
+ */
+class GVRMSHADERS_API FGVRMSplatSortKeysCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatSortKeysCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatSortKeysCS, FGVRMSplatShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(FMatrix44f, LocalToView)
+		SHADER_PARAMETER(uint32, SplatBase)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SkinnedPositions)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, CompactedSplats)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortCounters)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWSortKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWSortValues)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+/**
+ * One compare-and-swap step of a bitonic sort (far splats first) over the survivors (indirect).
+ */
+class GVRMSHADERS_API FGVRMSplatBitonicSortCS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatBitonicSortCS);
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatBitonicSortCS, FGVRMSplatShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(uint32, SortLevel)
+		SHADER_PARAMETER(uint32, SortStep)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortCounters)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWSortKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RWSortValues)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	END_SHADER_PARAMETER_STRUCT()
+};
+
+/** Parameters shared by the splat quad vertex and pixel shaders */
+BEGIN_SHADER_PARAMETER_STRUCT(FGVRMSplatDrawParameters, GVRMSHADERS_API)
+	SHADER_PARAMETER(FMatrix44f, LocalToView)
+	SHADER_PARAMETER(FMatrix44f, ViewToClip)
+	SHADER_PARAMETER(FVector2f, ViewportSize)
+	SHADER_PARAMETER(uint32, NumSplats)
+	SHADER_PARAMETER(uint32, SplatBase)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SkinnedPositions)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SkinnedRotations)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortedIndices)
+	SHADER_PARAMETER_SRV(Buffer<float4>, SplatScales)
+	SHADER_PARAMETER_SRV(Buffer<float4>, SplatRotations)
+	SHADER_PARAMETER_SRV(Buffer<float4>, SplatColors)
+	RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	RENDER_TARGET_BINDING_SLOTS()
+END_SHADER_PARAMETER_STRUCT()
+
+/**
+ * Expands each sorted splat into a screen-aligned quad covering its projected Gaussian.
+ */
+class GVRMSHADERS_API FGVRMSplatDrawVS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatDrawVS);
+	using FParameters = FGVRMSplatDrawParameters;
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatDrawVS, FGVRMSplatShader);
+};
+
+/**
+ * Evaluates the Gaussian falloff and outputs premultiplied color.
+ */
+class GVRMSHADERS_API FGVRMSplatDrawPS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatDrawPS);
+	using FParameters = FGVRMSplatDrawParameters;
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatDrawPS, FGVRMSplatShader);
+};
+
+/** Parameters shared by the debug view shaders (joints, sampled bound vertices, vertex-to-splat lines) */
+BEGIN_SHADER_PARAMETER_STRUCT(FGVRMSplatDebugParameters, GVRMSHADERS_API)
+	SHADER_PARAMETER(FMatrix44f, LocalToView)
+	SHADER_PARAMETER(FMatrix44f, ViewToClip)
+	SHADER_PARAMETER(FVector2f, ViewportSize)
+	SHADER_PARAMETER(float, PointSize)
+	SHADER_PARAMETER(uint32, SplatBase)
+	SHADER_PARAMETER(uint32, BoneBase)
+	SHADER_PARAMETER(uint32, NumDebugVertices)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SkinnedPositions)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float4>, SkinnedRotations)
+	SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<float4>, BoneMatrices)
+	SHADER_PARAMETER_SRV(Buffer<uint2>, DebugElements)
+	SHADER_PARAMETER_SRV(Buffer<float4>, DebugRelativePositions)
+	RENDER_TARGET_BINDING_SLOTS()
+END_SHADER_PARAMETER_STRUCT()
+
+/**
+ * One screen-space quad per bone of the component's palette.
+ */
+class GVRMSHADERS_API FGVRMSplatDebugJointVS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatDebugJointVS);
+	using FParameters = FGVRMSplatDebugParameters;
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatDebugJointVS, FGVRMSplatShader);
+};
+
+/**
+ * One screen-space quad per sampled bound vertex.
+ */
+class GVRMSHADERS_API FGVRMSplatDebugPointVS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatDebugPointVS);
+	using FParameters = FGVRMSplatDebugParameters;
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatDebugPointVS, FGVRMSplatShader);
+};
+
+/**
+ * One line per splat of a sampled vertex, from the vertex to the splat.
+ */
+class GVRMSHADERS_API FGVRMSplatDebugLineVS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatDebugLineVS);
+	using FParameters = FGVRMSplatDebugParameters;
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatDebugLineVS, FGVRMSplatShader);
+};
+
+/**
+ * Flat bone colour (round points, plain lines).
+ */
+class GVRMSHADERS_API FGVRMSplatDebugPS : public FGVRMSplatShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGVRMSplatDebugPS);
+	using FParameters = FGVRMSplatDebugParameters;
+	SHADER_USE_PARAMETER_STRUCT(FGVRMSplatDebugPS, FGVRMSplatShader);
+};
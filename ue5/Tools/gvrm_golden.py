@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 gaussian-vrm community
+# Licensed under the MIT License.
+
+"""
+GVRM Skinning Golden Generator
+
+GVRMRuntime のスキニング回帰テスト (FGVRMGoldenSuite) 用のゴールデンファイルを生成します。
+固定シードの合成アバター (ボーン行列、頂点、スキンウェイト、LOD リマップ、スプラット) と、
+その参照出力を倍精度で計算して 1 つのバイナリに書き出します。
+
+参照出力は GVRMSkinningCommon.ush / GVRMSplatSkinning.usf と同じ式で計算します:
+  LBS       - 8 インフルエンスの線形ブレンドスキニング (LOD0)
+  LBSRemap  - 同じく、LOD リマップ (3 頂点の重心座標 + オフセット) 経由
+  DQS       - デュアルクォータニオンスキニング (LOD0)
+  Quantized - エンジンの 8 ビットウェイトに量子化した LBS
+
+Usage:
+    python gvrm_golden.py -o ../Plugins/GVRMRuntime/Resources/Golden/GVRMSkinningGolden.bin
+"""
+
+import argparse
+import math
+import random
+import struct
+from pathlib import Path
+
+FILE_MAGIC = 0x47565247  # 'GVRG'
+FILE_VERSION = 2
+
+NUM_BONES = 24
+NUM_VERTICES = 256
+NUM_SPLATS = 1024
+NUM_POSES = 4
+NUM_INFLUENCES = 8
+
+# 最大回転角 (度)。トレースが常に正なので MatrixToQuaternion の分岐が float と double で一致する
+MAX_POSE_ANGLE = 80.0
+
+
+def f32(value):
+    """float32 に丸める (C++ 側が読む値と同じにする)"""
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+# ============================================
+# 行列とクォータニオン (FMatrix44f の行ベクトル規約、(x, y, z, w))
+# ============================================
+
+def quat_multiply(a, b):
+    """GVRMSkinning::QuaternionMultiply"""
+    ax, ay, az, aw = a
+    bx, by, bz, bw = b
+    return (
+        aw * bx + ax * bw + ay * bz - az * by,
+        aw * by - ax * bz + ay * bw + az * bx,
+        aw * bz + ax * by - ay * bx + az * bw,
+        aw * bw - ax * bx - ay * by - az * bz)
+
+
+def rotate_vector(v, q):
+    """GVRMSkinning::RotateVectorByQuaternion"""
+    qv = q[:3]
+    uv = cross(qv, v)
+    uuv = cross(qv, uv)
+    return tuple(v[i] + 2.0 * (uv[i] * q[3] + uuv[i]) for i in range(3))
+
+
+def cross(a, b):
+    return (a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0])
+
+
+def normalize_quat(q):
+    """GVRMSkinning::NormalizeQuaternion"""
+    length_squared = sum(c * c for c in q)
+    if length_squared <= 1.0e-8:
+        return (0.0, 0.0, 0.0, 1.0)
+    inv = 1.0 / math.sqrt(length_squared)
+    return tuple(c * inv for c in q)
+
+
+def matrix_to_quaternion(m):
+    """GVRMSkinning::MatrixToQuaternion (トレース正の分岐のみ使う)"""
+    trace = m[0][0] + m[1][1] + m[2][2]
+    if trace <= 0.25:
+        raise ValueError(f"trace {trace} too small for a stable golden pose")
+    s = 0.5 / math.sqrt(trace + 1.0)
+    return normalize_quat((
+        (m[2][1] - m[1][2]) * s,
+        (m[0][2] - m[2][0]) * s,
+        (m[1][0] - m[0][1]) * s,
+        0.25 / s))
+
+
+def fquat_from_matrix(m):
+    """FQuat4f(const FMatrix44f&) (トレース正の分岐)"""
+    trace = m[0][0] + m[1][1] + m[2][2]
+    root = math.sqrt(trace + 1.0)
+    s = 0.5 / root
+    return (
+        (m[1][2] - m[2][1]) * s,
+        (m[2][0] - m[0][2]) * s,
+        (m[0][1] - m[1][0]) * s,
+        0.5 * root)
+
+
+def quat_rotation_matrix(q, translation=(0.0, 0.0, 0.0)):
+    """FQuatRotationTranslationMatrix44f"""
+    x, y, z, w = q
+    x2, y2, z2 = x + x, y + y, z + z
+    xx, xy, xz = x * x2, x * y2, x * z2
+    yy, yz, zz = y * y2, y * z2, z * z2
+    wx, wy, wz = w * x2, w * y2, w * z2
+    return [
+        [1.0 - (yy + zz), xy + wz, xz - wy, 0.0],
+        [xy - wz, 1.0 - (xx + zz), yz + wx, 0.0],
+        [xz + wy, yz - wx, 1.0 - (xx + yy), 0.0],
+        [translation[0], translation[1], translation[2], 1.0]]
+
+
+def transform_position(m, v):
+    """FMatrix44f::TransformPosition"""
+    return tuple(v[0] * m[0][j] + v[1] * m[1][j] + v[2] * m[2][j] + m[3][j] for j in range(3))
+
+
+# ============================================
+# 合成アバター
+# ============================================
+
+class GoldenAvatar:
+    """固定シードの合成アバターとポーズ"""
+
+    def __init__(self, seed):
+        rng = random.Random(seed)
+
+        self.vertex_positions = [
+            (f32(rng.uniform(-30.0, 30.0)), f32(rng.uniform(-15.0, 15.0)), f32(rng.uniform(0.0, 170.0)))
+            for _ in range(NUM_VERTICES)]
+
+        # 1〜8 インフルエンス、ウェイト降順 (エンジンと同じ)。未使用はボーン 0、ウェイト 0
+        self.bone_indices = []
+        self.bone_weights = []
+        self.quantized_weights = []
+        for _ in range(NUM_VERTICES):
+            count = rng.choice((1, 1, 2, 2, 3, 4, 4, 5, 6, 8))
+            bones = rng.sample(range(NUM_BONES), count)
+            raw = sorted((rng.uniform(0.05, 1.0) for _ in range(count)), reverse=True)
+            total = sum(raw)
+            weights = [f32(w / total) for w in raw]
+
+            quantized = [min(255, max(0, int(round(w * 255.0)))) for w in weights]
+            quantized[0] += 255 - sum(quantized)
+
+            padding = NUM_INFLUENCES - count
+            self.bone_indices.append(bones + [0] * padding)
+            self.bone_weights.append(weights + [0.0] * padding)
+            self.quantized_weights.append(quantized + [0] * padding)
+
+        # 各頂点を自身と 2 つのランダム頂点の三角形に投影したような LOD リマップ
+        self.remap_indices = []
+        self.remap_weights = []
+        self.remap_offsets = []
+        for vertex_index in range(NUM_VERTICES):
+            u = rng.random()
+            v = rng.random() * (1.0 - u)
+            self.remap_indices.append((vertex_index, rng.randrange(NUM_VERTICES), rng.randrange(NUM_VERTICES), 0))
+            self.remap_weights.append((f32(1.0 - u - v), f32(u), f32(v), 0.0))
+            direction = normalize_vector((rng.gauss(0.0, 1.0), rng.gauss(0.0, 1.0), rng.gauss(0.0, 1.0)))
+            length = rng.uniform(0.0, 0.5)
+            self.remap_offsets.append(tuple(f32(c * length) for c in direction) + (0.0,))
+
+        self.splat_vertices = [rng.randrange(NUM_VERTICES) for _ in range(NUM_SPLATS)]
+        self.relative_positions = [
+            tuple(f32(rng.uniform(-1.5, 1.5)) for _ in range(3)) for _ in range(NUM_SPLATS)]
+
+        # ポーズ 0 はバインドポーズ (単位行列)
+        self.poses = []
+        for pose_index in range(NUM_POSES):
+            matrices = []
+            for _ in range(NUM_BONES):
+                if pose_index == 0:
+                    q, translation = (0.0, 0.0, 0.0, 1.0), (0.0, 0.0, 0.0)
+                else:
+                    axis = normalize_vector((rng.gauss(0.0, 1.0), rng.gauss(0.0, 1.0), rng.gauss(0.0, 1.0)))
+                    angle = math.radians(rng.uniform(-MAX_POSE_ANGLE, MAX_POSE_ANGLE))
+                    half = math.sin(angle * 0.5)
+                    q = (axis[0] * half, axis[1] * half, axis[2] * half, math.cos(angle * 0.5))
+                    translation = tuple(rng.uniform(-20.0, 20.0) for _ in range(3))
+                matrix = quat_rotation_matrix(q, translation)
+                matrices.append([[f32(c) for c in row] for row in matrix])
+            self.poses.append(matrices)
+
+    # --------------------------------------------
+    # 参照スキニング
+    # --------------------------------------------
+
+    def skin_vertex(self, matrices, vertex_index, weights):
+        """SkinVertex: 全インフルエンスを分岐なしでブレンド"""
+        position = [0.0, 0.0, 0.0]
+        rotation = [0.0, 0.0, 0.0, 0.0]
+        vertex = self.vertex_positions[vertex_index]
+        for bone, weight in zip(self.bone_indices[vertex_index], weights[vertex_index]):
+            transformed = transform_position(matrices[bone], vertex)
+            bone_rotation = matrix_to_quaternion(matrices[bone])
+            for i in range(3):
+                position[i] += transformed[i] * weight
+            for i in range(4):
+                rotation[i] += bone_rotation[i] * weight
+        return position, rotation
+
+    def skin_splat_lbs(self, matrices, splat_index, weights, use_remap):
+        """SkinSplat (LOD リマップ有無)"""
+        vertex_index = self.splat_vertices[splat_index]
+        offset = list(self.relative_positions[splat_index])
+
+        if use_remap:
+            position = [0.0, 0.0, 0.0]
+            rotation = [0.0, 0.0, 0.0, 0.0]
+            for i in range(3):
+                offset[i] += self.remap_offsets[vertex_index][i]
+            for corner in range(3):
+                corner_weight = self.remap_weights[vertex_index][corner]
+                if corner_weight > 0.0:
+                    corner_position, corner_rotation = self.skin_vertex(matrices, self.remap_indices[vertex_index][corner], weights)
+                    for i in range(3):
+                        position[i] += corner_position[i] * corner_weight
+                    for i in range(4):
+                        rotation[i] += corner_rotation[i] * corner_weight
+        else:
+            position, rotation = self.skin_vertex(matrices, vertex_index, weights)
+
+        rotation = normalize_quat(rotation)
+        rotated = rotate_vector(tuple(offset), rotation)
+        return tuple(position[i] + rotated[i] for i in range(3)), rotation
+
+    def skin_splat_dqs(self, matrices, splat_index):
+        """SkinSplatDualQuat"""
+        vertex_index = self.splat_vertices[splat_index]
+        blend_real = [0.0, 0.0, 0.0, 0.0]
+        blend_dual = [0.0, 0.0, 0.0, 0.0]
+        first_real = None
+
+        for bone, weight in zip(self.bone_indices[vertex_index], self.bone_weights[vertex_index]):
+            if weight <= 0.0:
+                continue
+            real = fquat_from_matrix(matrices[bone])
+            translation = tuple(matrices[bone][3][:3])
+            dual = tuple(c * 0.5 for c in quat_multiply(translation + (0.0,), real))
+            if first_real is None:
+                first_real = real
+            elif sum(a * b for a, b in zip(first_real, real)) < 0.0:
+                weight = -weight
+            for i in range(4):
+                blend_real[i] += real[i] * weight
+                blend_dual[i] += dual[i] * weight
+
+        inv_length = 1.0 / math.sqrt(sum(c * c for c in blend_real))
+        blend_real = tuple(c * inv_length for c in blend_real)
+        blend_dual = tuple(c * inv_length for c in blend_dual)
+
+        conjugate = (-blend_real[0], -blend_real[1], -blend_real[2], blend_real[3])
+        translation = tuple(c * 2.0 for c in quat_multiply(blend_dual, conjugate))
+        rotated_vertex = rotate_vector(self.vertex_positions[vertex_index], blend_real)
+        vertex_position = tuple(rotated_vertex[i] + translation[i] for i in range(3))
+
+        rotation = matrix_to_quaternion(quat_rotation_matrix(blend_real))
+        rotated = rotate_vector(self.relative_positions[splat_index], rotation)
+        return tuple(vertex_position[i] + rotated[i] for i in range(3)), rotation
+
+    def reference(self, name):
+        """全ポーズ・全スプラットの参照出力 (ポーズ順)"""
+        quantized = [[q / 255.0 for q in weights] for weights in self.quantized_weights]
+        positions = []
+        rotations = []
+        for matrices in self.poses:
+            for splat_index in range(NUM_SPLATS):
+                if name == 'LBS':
+                    position, rotation = self.skin_splat_lbs(matrices, splat_index, self.bone_weights, False)
+                elif name == 'LBSRemap':
+                    position, rotation = self.skin_splat_lbs(matrices, splat_index, self.bone_weights, True)
+                elif name == 'DQS':
+                    position, rotation = self.skin_splat_dqs(matrices, splat_index)
+                elif name == 'Quantized':
+                    position, rotation = self.skin_splat_lbs(matrices, splat_index, quantized, False)
+                else:
+                    raise ValueError(name)
+                positions.extend(position)
+                rotations.extend(rotation)
+        return positions, rotations
+
+
+def normalize_vector(v):
+    length = math.sqrt(sum(c * c for c in v))
+    return tuple(c / length for c in v)
+
+
+# ============================================
+# FArchive 形式での書き出し
+# ============================================
+
+def write_int32(out, value):
+    out += struct.pack('<i', value)
+
+
+def write_float_array(out, values):
+    write_int32(out, len(values))
+    out += struct.pack(f'<{len(values)}f', *values)
+
+
+def write_int32_array(out, values):
+    write_int32(out, len(values))
+    out += struct.pack(f'<{len(values)}i', *values)
+
+
+def write_uint8_array(out, values):
+    write_int32(out, len(values))
+    out += bytes(values)
+
+
+def write_string(out, value):
+    """FString (ANSI、終端 NUL を含む長さ)"""
+    encoded = value.encode('ascii') + b'\0'
+    write_int32(out, len(encoded))
+    out += encoded
+
+
+def flatten(rows):
+    return [value for row in rows for value in row]
+
+
+def write_golden(path, seed):
+    avatar = GoldenAvatar(seed)
+    out = bytearray()
+
+    out += struct.pack('<I', FILE_MAGIC)
+    write_int32(out, FILE_VERSION)
+    write_int32(out, seed)
+    write_int32(out, NUM_BONES)
+    write_int32(out, NUM_VERTICES)
+    write_int32(out, NUM_SPLATS)
+    write_int32(out, NUM_POSES)
+
+    write_float_array(out, flatten(avatar.vertex_positions))
+    write_int32_array(out, flatten(avatar.bone_indices))
+    write_float_array(out, flatten(avatar.bone_weights))
+    write_uint8_array(out, flatten(avatar.quantized_weights))
+    write_int32_array(out, flatten(avatar.remap_indices))
+    write_float_array(out, flatten(avatar.remap_weights))
+    write_float_array(out, flatten(avatar.remap_offsets))
+    write_int32_array(out, avatar.splat_vertices)
+    write_float_array(out, flatten(avatar.relative_positions))
+    write_float_array(out, [c for matrices in avatar.poses for matrix in matrices for row in matrix for c in row])
+
+    names = ('LBS', 'LBSRemap', 'DQS', 'Quantized')
+    write_int32(out, len(names))
+    for name in names:
+        print(f"  Computing {name}...")
+        positions, rotations = avatar.reference(name)
+        write_string(out, name)
+        write_float_array(out, positions)
+        write_float_array(out, rotations)
+
+    path = Path(path)
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(bytes(out))
+    print(f"  ✓ Wrote {path} ({len(out)} bytes)")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate the GVRMRuntime skinning golden file',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Example:
+  python gvrm_golden.py -o ../Plugins/GVRMRuntime/Resources/Golden/GVRMSkinningGolden.bin
+        """
+    )
+    parser.add_argument('-o', '--output', required=True, help='Output golden file')
+    parser.add_argument('--seed', type=int, default=1234, help='Fixture seed (default: 1234)')
+    args = parser.parse_args()
+
+    write_golden(args.output, args.seed)
+
+
+if __name__ == '__main__':
+    main()
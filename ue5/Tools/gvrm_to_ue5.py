@@ -19,6 +19,7 @@ import zipfile
 import json
 import csv
 import os
+import struct
 import argparse
 from pathlib import Path
 
@@ -58,7 +59,8 @@ class GVRMConverter:
 
             # 4. メタデータをJSON出力
             print("\n[4/5] Exporting metadata...")
-            self._export_metadata(data)
+            spring_bones = self._read_spring_bones(z.read('model.vrm'))
+            self._export_metadata(data, spring_bones)
 
             # 5. UE5インポート用のREADME生成
             print("\n[5/5] Generating import instructions...")
@@ -122,7 +124,7 @@ class GVRMConverter:
 
         print(f"  ✓ Exported {num_splats:,} splat bindings to splat_binding.csv")
 
-    def _export_metadata(self, data):
+    def _export_metadata(self, data, spring_bones=None):
         """メタデータをJSON出力"""
         metadata = {
             'modelScale': data.get('modelScale', 1.0),
@@ -131,12 +133,141 @@ class GVRMConverter:
             'version': '1.0',
             'source': str(self.gvrm_path.name)
         }
+        if spring_bones and spring_bones['chains']:
+            metadata['springBones'] = spring_bones
 
         json_path = self.output_dir / "metadata.json"
         with open(json_path, 'w') as f:
             json.dump(metadata, f, indent=2)
 
         print(f"  ✓ Exported metadata to metadata.json")
+        if spring_bones and spring_bones['chains']:
+            print(f"  ✓ Spring bones: {len(spring_bones['chains'])} chains, {len(spring_bones['colliders'])} colliders")
+
+    @staticmethod
+    def _read_glb_json(glb):
+        """GLB (model.vrm) の JSON チャンクを読み込む"""
+        if len(glb) < 20 or glb[:4] != b'glTF':
+            return None
+        chunk_length, chunk_type = struct.unpack_from('<II', glb, 12)
+        if chunk_type != 0x4E4F534A:  # 'JSON'
+            return None
+        return json.loads(glb[20:20 + chunk_length].decode('utf-8'))
+
+    def _read_spring_bones(self, vrm_bytes):
+        """
+        スプリングボーンを読み込む (VRMC_springBone、なければ VRM0 secondaryAnimation)。
+        glTF の座標系・メートル単位のまま出力し、UE 側で変換する。
+        """
+        gltf = self._read_glb_json(vrm_bytes)
+        if gltf is None:
+            return None
+
+        nodes = gltf.get('nodes', [])
+
+        def node_name(index):
+            if 0 <= index < len(nodes):
+                return nodes[index].get('name', f'node_{index}')
+            return ''
+
+        extensions = gltf.get('extensions', {})
+        colliders = []
+        chains = []
+
+        if 'VRMC_springBone' in extensions:
+            spring_bone = extensions['VRMC_springBone']
+            for collider in spring_bone.get('colliders', []):
+                shape = collider.get('shape', {})
+                entry = {'boneName': node_name(collider.get('node', -1)), 'offset': [0.0, 0.0, 0.0], 'radius': 0.0}
+                if 'sphere' in shape:
+                    entry['offset'] = shape['sphere'].get('offset', [0.0, 0.0, 0.0])
+                    entry['radius'] = shape['sphere'].get('radius', 0.0)
+                elif 'capsule' in shape:
+                    entry['offset'] = shape['capsule'].get('offset', [0.0, 0.0, 0.0])
+                    entry['radius'] = shape['capsule'].get('radius', 0.0)
+                    entry['tail'] = shape['capsule'].get('tail', [0.0, 0.0, 0.0])
+                colliders.append(entry)  # 形状がなくてもインデックスを保つ
+
+            groups = [group.get('colliders', []) for group in spring_bone.get('colliderGroups', [])]
+            for spring in spring_bone.get('springs', []):
+                joints = spring.get('joints', [])
+                if len(joints) < 2:
+                    continue
+                # パラメータはチェーン単位 (先頭ジョイントの値)
+                first = joints[0]
+                collider_indices = sorted({index
+                                           for group in spring.get('colliderGroups', []) if 0 <= group < len(groups)
+                                           for index in groups[group]})
+                chains.append({
+                    'boneNames': [node_name(joint.get('node', -1)) for joint in joints],
+                    'stiffness': first.get('stiffness', 1.0),
+                    'dragForce': first.get('dragForce', 0.5),
+                    'gravityPower': first.get('gravityPower', 0.0),
+                    'gravityDir': first.get('gravityDir', [0.0, -1.0, 0.0]),
+                    'hitRadius': first.get('hitRadius', 0.0),
+                    'colliders': collider_indices,
+                })
+
+        elif 'VRM' in extensions:
+            secondary = extensions['VRM'].get('secondaryAnimation', {})
+
+            # VRM0 のオフセットは Unity 座標 (X 反転)
+            def unity_vector(value, default):
+                if not isinstance(value, dict):
+                    return default
+                return [-value.get('x', 0.0), value.get('y', 0.0), value.get('z', 0.0)]
+
+            group_colliders = []
+            for group in secondary.get('colliderGroups', []):
+                indices = []
+                for collider in group.get('colliders', []):
+                    indices.append(len(colliders))
+                    colliders.append({
+                        'boneName': node_name(group.get('node', -1)),
+                        'offset': unity_vector(collider.get('offset'), [0.0, 0.0, 0.0]),
+                        'radius': collider.get('radius', 0.0),
+                    })
+                group_colliders.append(indices)
+
+            for bone_group in secondary.get('boneGroups', []):
+                collider_indices = sorted({index
+                                           for group in bone_group.get('colliderGroups', []) if 0 <= group < len(group_colliders)
+                                           for index in group_colliders[group]})
+                # ルートから葉までの経路ごとに1本のチェーンにする (分岐より上のボーンは経路間で共有)
+                for root in bone_group.get('bones', []):
+                    for bone_chain in self._leaf_paths(nodes, root):
+                        if len(bone_chain) < 2:
+                            continue
+                        chains.append({
+                            'boneNames': [node_name(node) for node in bone_chain],
+                            'stiffness': bone_group.get('stiffiness', 1.0),  # VRM0 の綴り
+                            'dragForce': bone_group.get('dragForce', 0.4),
+                            'gravityPower': bone_group.get('gravityPower', 0.0),
+                            'gravityDir': unity_vector(bone_group.get('gravityDir'), [0.0, -1.0, 0.0]),
+                            'hitRadius': bone_group.get('hitRadius', 0.0),
+                            'colliders': collider_indices,
+                        })
+
+        return {'colliders': colliders, 'chains': chains}
+
+    @staticmethod
+    def _leaf_paths(nodes, root):
+        """root から各葉ノードまでのノード経路 (深さ優先、子の順)"""
+        paths = []
+        stack = [[root]]
+        while stack:
+            path = stack.pop()
+            children = [child for child in nodes[path[-1]].get('children', []) if 0 <= child < len(nodes)]
+            if not children:
+                paths.append(path)
+                continue
+            # 最初の子の経路を先に出す
+            for child in reversed(children):
+                stack.append(path + [child])
+        if len(paths) > 1:
+            name = nodes[root].get('name', f'node_{root}')
+            print(f"  ! Spring bone root '{name}' branches into {len(paths)} chains; bones above a branch are shared by them")
+        return paths
 
     def _generate_readme(self):
         """UE5インポート手順を生成"""
@@ -149,7 +280,7 @@ This directory contains converted GVRM data for Unreal Engine 5.
 - `model.vrm` - VRM character model (requires VRM4U plugin)
 - `model.ply` - Gaussian splatting point cloud (requires XVERSE plugin)
 - `splat_binding.csv` - Splat-to-vertex binding data
-- `metadata.json` - Additional metadata (scale, bone operations)
+- `metadata.json` - Additional metadata (scale, bone operations, spring bones)
 
 ## Import Steps
 
@@ -173,10 +304,12 @@ This directory contains converted GVRM data for Unreal Engine 5.
 4. Save to `/Game/GVRM/Data/`
 
 ### 5. Create GVRM Binding Asset
-1. Create a Data Asset of type `UGVRMBindingData`
-2. Reference the Data Table created in step 4
-3. Set metadata from `metadata.json`
-4. Save to `/Game/GVRM/Data/`
+Run the GVRMImport commandlet on this directory:
+
+    UnrealEditor-Cmd MyProject.uproject -run=GVRMImport -unattended -Input=<this directory> -Output=/Game/GVRM/Data/Avatar_Binding -SkeletalMesh=/Game/GVRM/Avatar
+
+The skeletal mesh is required for the mesh LOD remaps. It can also be set later
+as the asset's Source Skeletal Mesh; the remaps are then built on save.
 
 ### 6. Setup GVRM Actor
 1. Create a Blueprint based on `AGVRMActor`